@@ -24,6 +24,7 @@
 
 #include "core/HiResTimer.hpp"
 #include "core/spyLog.hpp"
+#include "core/trace/Recorder.hpp"
 
 // Define FW_PROFILING_DISABLED before including this header if you need to disable profiling output
 
@@ -31,31 +32,21 @@ namespace sight::core
 {
 
 /**
- * @brief This class holds a timer. It displays elapsed time at destruction.
+ * @brief This class records its lifetime as a scope in the trace recorder.
+ *
+ * Nothing is recorded unless the recording is enabled with core::trace::Recorder::setEnabled().
  */
 class fwProfileScope
 {
 public:
 
     fwProfileScope(const char* label) :
-        m_label(label)
-    {
-        m_timer.start();
-    }
-
-    ~fwProfileScope()
+        m_scope("profile", label)
     {
-        m_timer.stop();
-
-        std::stringstream log;
-        log << "TIMER : " << m_label << " = " << m_timer.getElapsedTimeInMilliSec() << " ms.";
-        core::log::SpyLogger::getSpyLogger().info(log.str(), __FILE__, __LINE__);
     }
 
-    /// Timer
-    core::HiResTimer m_timer;
-    /// Timer label
-    const char* m_label;
+    /// Trace scope
+    core::trace::Scope m_scope;
 };
 
 /**
@@ -118,7 +109,8 @@ public:
 
     fwProfileScopeAvg(const char* label, fwProfileFrameTimer& frameTimer) :
         m_label(label),
-        m_frameTimer(frameTimer)
+        m_frameTimer(frameTimer),
+        m_scope("profile", label)
     {
         m_timer.start();
     }
@@ -143,10 +135,14 @@ public:
     const char* m_label;
     /// Timer used to get the elapsed time between two profiling scopes
     fwProfileFrameTimer& m_frameTimer;
+    /// Trace scope
+    core::trace::Scope m_scope;
 };
 
 /**
  * @brief This class is used to compute the elapsed time between two profiling scopes.
+ *
+ * The elapsed time is recorded as a counter in the trace recorder, in milliseconds.
  */
 class fwProfileFrame
 {
@@ -156,9 +152,11 @@ public:
         m_label(label),
         m_frameTimer(frameTimer)
     {
-        std::stringstream log;
-        log << "FRAME : " << m_label << " = " << m_frameTimer.m_timer.getElapsedTimeInMilliSec() << " ms.";
-        core::log::SpyLogger::getSpyLogger().info(log.str(), __FILE__, __LINE__);
+        if(core::trace::Recorder::isEnabled())
+        {
+            core::trace::Recorder::counter("profile", m_label, m_frameTimer.m_timer.getElapsedTimeInMilliSec());
+        }
+
         m_frameTimer.reset();
     }
 
@@ -204,16 +202,16 @@ public:
 };
 
 #ifndef FW_PROFILING_DISABLED
-/// Display the elapsed time inside a code block
+/// Record the execution of a code block in the trace recorder
 #define FW_PROFILE(_label) \
     core::fwProfileScope BOOST_PP_CAT(profiler, __LINE__)(_label);
 
-/// Display the elapsed time inside a code block, every N seconds
+/// Display the average elapsed time inside a code block every N seconds, and record it in the trace recorder
 #define FW_PROFILE_AVG(_label, interval) \
     static core::fwProfileFrameTimer BOOST_PP_CAT(frameTimer, __LINE__)(interval); \
     core::fwProfileScopeAvg BOOST_PP_CAT(profiler, __LINE__)(_label, BOOST_PP_CAT(frameTimer, __LINE__));
 
-/// Display the elapsed time between two calls of a code block
+/// Record the elapsed time between two calls of a code block in the trace recorder
 #define FW_PROFILE_FRAME(_label) \
     static core::fwProfileFrameTimer BOOST_PP_CAT(frameTimer, __LINE__)(0); \
     core::fwProfileFrame BOOST_PP_CAT(profiler, __LINE__)(_label, BOOST_PP_CAT(frameTimer, __LINE__));
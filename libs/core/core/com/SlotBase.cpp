@@ -25,11 +25,20 @@
 #include "core/com/exception/BadRun.hpp"
 #include "core/com/SlotBase.hxx"
 
+#include <core/trace/Recorder.hpp>
+
 namespace sight::core::com
 {
 
 //------------------------------------------------------------------------------
 
+void SlotBase::setName(const std::string& name)
+{
+    m_name = core::trace::Recorder::intern(name);
+}
+
+//------------------------------------------------------------------------------
+
 void SlotBase::run() const
 {
     typedef SlotRun<void ()> SlotFuncType;
@@ -31,6 +31,7 @@
 #include <core/mt/types.hpp>
 #include <core/spyLog.hpp>
 
+#include <atomic>
 #include <future>
 #include <queue>
 #include <set>
@@ -112,6 +113,15 @@ struct CORE_CLASS_API SlotBase : virtual core::BaseObject
         return m_worker;
     }
 
+    /// Sets Slot's name, used to identify its executions in the worker metrics and in the traces.
+    CORE_API void setName(const std::string& name);
+
+    /// Returns Slot's name, an empty string if it has not been set.
+    const char* getName() const
+    {
+        return m_name.load(std::memory_order_relaxed);
+    }
+
     /**
      * @brief  Run the Slot.
      * @throw  BadRun if given arguments do not match the slot implementation
@@ -243,6 +253,9 @@ struct CORE_CLASS_API SlotBase : virtual core::BaseObject
         /// Slot's Worker.
         SPTR(core::thread::Worker) m_worker;
 
+        /// Slot's name, interned in the trace recorder.
+        std::atomic<const char*> m_name {""};
+
         /// Container of current connections.
         ConnectionSetType m_connections;
 
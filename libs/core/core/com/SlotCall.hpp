@@ -97,7 +97,8 @@ struct CORE_CLASS_API SlotCall<R(A ...)>: SlotRun<void(A ...)>
     protected:
 
         template<typename WEAKCALL>
-        static std::shared_future<R> postWeakCall(const SPTR(core::thread::Worker)& worker, WEAKCALL f);
+        static std::shared_future<R> postWeakCall(const SPTR(core::thread::Worker)& worker, WEAKCALL f,
+                                                  const char* name);
 
         /**
          * @brief Binds the given parameters to the call method within a R() function.
@@ -33,6 +33,7 @@
 #include <core/mt/types.hpp>
 #include <core/thread/TaskHandler.hpp>
 #include <core/thread/Worker.hpp>
+#include <core/trace/Recorder.hpp>
 
 #include <future>
 
@@ -64,7 +65,8 @@ typename SlotCall< R(A ...) >::SharedFutureType SlotCall< R(A ...) >::asyncCall(
         core::com::util::weakcall(
             std::dynamic_pointer_cast< const SlotBase >(this->shared_from_this()),
             this->bindCall( args ... )
-            )
+            ),
+        this->getName()
         );
 }
 
@@ -86,7 +88,8 @@ typename SlotCall< R(A ...) >::SharedFutureType SlotCall< R(A ...) >::asyncCall(
             std::dynamic_pointer_cast< const SlotBase >(this->shared_from_this()),
             this->bindCall( args ... ),
             this->m_worker
-            )
+            ),
+        this->getName()
         );
 }
 
@@ -94,14 +97,15 @@ typename SlotCall< R(A ...) >::SharedFutureType SlotCall< R(A ...) >::asyncCall(
 
 template< typename R, typename ... A >
 template< typename WEAKCALL >
-std::shared_future< R > SlotCall< R(A ...) >::postWeakCall( const core::thread::Worker::sptr& worker, WEAKCALL f )
+std::shared_future< R > SlotCall< R(A ...) >::postWeakCall( const core::thread::Worker::sptr& worker, WEAKCALL f,
+                                                             const char* name )
 {
     std::packaged_task< R() > task( f );
     std::future< R > ufuture = task.get_future();
 
     std::function< void() > ftask = core::thread::moveTaskIntoFunction(task);
 
-    worker->post(ftask);
+    worker->post(core::trace::traceFlow("com", *name != '\0' ? name : "slot", ftask), name);
 
     return ufuture;
 }
@@ -93,7 +93,8 @@ struct CORE_CLASS_API SlotRun<void(A ...)>: SlotBase
     protected:
 
         template<typename R, typename WEAKCALL>
-        static std::shared_future<R> postWeakCall(const SPTR(core::thread::Worker)& worker, WEAKCALL f);
+        static std::shared_future<R> postWeakCall(const SPTR(core::thread::Worker)& worker, WEAKCALL f,
+                                                  const char* name);
 
         /**
          * @brief Binds the given parameters to the run method within a void() function.
@@ -33,6 +33,7 @@
 #include <core/mt/types.hpp>
 #include <core/thread/TaskHandler.hpp>
 #include <core/thread/Worker.hpp>
+#include <core/trace/Recorder.hpp>
 
 #include <future>
 
@@ -63,7 +64,8 @@ inline SlotBase::VoidSharedFutureType SlotRun< void (A ...) >::asyncRun(
         core::com::util::weakcall(
             std::dynamic_pointer_cast< const SlotBase >(this->shared_from_this()),
             this->bindRun( args ... )
-            )
+            ),
+        this->getName()
         );
 }
 
@@ -85,7 +87,8 @@ inline SlotBase::VoidSharedFutureType SlotRun< void (A ...) >::asyncRun(A ... ar
             std::dynamic_pointer_cast< const SlotBase >(this->shared_from_this()),
             this->bindRun( args ... ),
             this->m_worker
-            )
+            ),
+        this->getName()
         );
 }
 
@@ -95,14 +98,15 @@ inline SlotBase::VoidSharedFutureType SlotRun< void (A ...) >::asyncRun(A ... ar
 // keyword
 template< typename ... A >
 template< typename R, typename WEAKCALL >
-std::shared_future< R > SlotRun< void (A ...) >::postWeakCall( const core::thread::Worker::sptr& worker, WEAKCALL f )
+std::shared_future< R > SlotRun< void (A ...) >::postWeakCall( const core::thread::Worker::sptr& worker, WEAKCALL f,
+                                                                const char* name )
 {
     std::packaged_task< R() > task( f );
     std::future< R > ufuture = task.get_future();
 
     std::function< void() > ftask = core::thread::moveTaskIntoFunction(task);
 
-    worker->post(ftask);
+    worker->post(core::trace::traceFlow("com", *name != '\0' ? name : "slot", ftask), name);
 
     return ufuture;
 }
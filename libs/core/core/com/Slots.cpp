@@ -59,6 +59,11 @@ void Slots::setWorker(const core::thread::Worker::sptr& worker)
 
 Slots& Slots::operator()(const SlotKeyType& key, const SlotBase::sptr& slot)
 {
+    if(*slot->getName() == '\0')
+    {
+        slot->setName(key);
+    }
+
     m_slots.insert(SlotMapType::value_type(key, slot));
     return *this;
 }
@@ -111,6 +111,13 @@ void Logger::clear()
 
 //-----------------------------------------------------------------------------
 
+void Logger::append(const Logger& logger)
+{
+    m_logContainer.insert(m_logContainer.end(), logger.m_logContainer.begin(), logger.m_logContainer.end());
+}
+
+//-----------------------------------------------------------------------------
+
 bool Logger::logSorter(const core::log::Log& logA, const core::log::Log& logB)
 {
     return logA.getLevel() > logB.getLevel();
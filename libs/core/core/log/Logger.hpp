@@ -95,6 +95,12 @@ public:
      */
     CORE_API void clear();
 
+    /**
+     * @brief Append the logs of another logger, in their order
+     * @param[in] logger Logger whose logs are appended
+     */
+    CORE_API void append(const Logger& logger);
+
     /// Return whether the logger contains logs or not
     bool empty() const
     {
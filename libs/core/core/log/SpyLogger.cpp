@@ -28,6 +28,7 @@
 
 #include "core/macros.hpp"
 
+#include <boost/core/null_deleter.hpp>
 #include <boost/log/attributes.hpp>
 #include <boost/log/attributes/current_process_id.hpp>
 #include <boost/log/attributes/current_thread_id.hpp>
@@ -35,17 +36,28 @@
 #include <boost/log/core.hpp>
 #include <boost/log/expressions.hpp>
 #include <boost/log/expressions/formatters/date_time.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
 #include <boost/log/sinks/sink.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/sinks/text_file_backend.hpp>
+#include <boost/log/sinks/text_ostream_backend.hpp>
 #include <boost/log/sources/global_logger_storage.hpp>
 #include <boost/log/sources/logger.hpp>
 #include <boost/log/sources/severity_logger.hpp>
 #include <boost/log/support/date_time.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/utility/setup/common_attributes.hpp>
-#include <boost/log/utility/setup/console.hpp>
-#include <boost/log/utility/setup/file.hpp>
-
-#include <regex>
+#include <boost/parameter/keyword.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 namespace sight::core
 {
@@ -58,6 +70,327 @@ SpyLogger SpyLogger::s_spyLogger;
 BOOST_LOG_GLOBAL_LOGGER(lg, ::boost::log::sources::severity_logger_mt< ::boost::log::trivial::severity_level>);
 BOOST_LOG_GLOBAL_LOGGER_DEFAULT(lg, ::boost::log::sources::severity_logger_mt< ::boost::log::trivial::severity_level>);
 
+namespace
+{
+
+/// Settings of the queue of an asynchronous appender.
+struct QueueSettings
+{
+    std::size_t m_size;
+    SpyLogger::OverflowPolicy m_policy;
+};
+
+/// Named parameter used to pass the QueueSettings to the asynchronous sink frontend.
+BOOST_PARAMETER_KEYWORD(tag, queue_settings)
+
+/// Number of messages dropped by all the asynchronous appenders with the OverflowPolicy::COUNT policy.
+std::atomic<std::uint64_t> s_droppedCount {0};
+
+/**
+ * @brief Bounded multi-producer queue of log records, used as the queueing strategy of the asynchronous sinks.
+ *
+ * Pushing and popping is lock-free. The mutex is only used to put the writer thread to sleep when the queue is empty,
+ * and the producers take it only if the writer thread is sleeping.
+ */
+class LogQueue
+{
+public:
+
+    /// Initializing constructor, called by the asynchronous sink frontend with the named parameters.
+    template<typename ArgsT>
+    explicit LogQueue(const ArgsT& args) :
+        LogQueue(static_cast<const QueueSettings&>(args[queue_settings]))
+    {
+    }
+
+protected:
+
+    //------------------------------------------------------------------------------
+
+    void enqueue(const ::boost::log::record_view& rec)
+    {
+        while(!this->push(rec))
+        {
+            if(m_policy != SpyLogger::OverflowPolicy::BLOCK)
+            {
+                if(m_policy == SpyLogger::OverflowPolicy::COUNT)
+                {
+                    s_droppedCount.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                return;
+            }
+
+            std::this_thread::yield();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    bool try_enqueue(const ::boost::log::record_view& rec)
+    {
+        return this->push(rec);
+    }
+
+    //------------------------------------------------------------------------------
+
+    bool try_dequeue_ready(::boost::log::record_view& rec)
+    {
+        return this->pop(rec);
+    }
+
+    //------------------------------------------------------------------------------
+
+    bool try_dequeue(::boost::log::record_view& rec)
+    {
+        return this->pop(rec);
+    }
+
+    //------------------------------------------------------------------------------
+
+    bool dequeue_ready(::boost::log::record_view& rec)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while(!m_interruptionRequested)
+        {
+            m_waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(this->pop(rec))
+            {
+                m_waiting.store(false, std::memory_order_relaxed);
+                return true;
+            }
+
+            m_condition.wait(lock);
+            m_waiting.store(false, std::memory_order_relaxed);
+        }
+
+        m_interruptionRequested = false;
+        return false;
+    }
+
+    //------------------------------------------------------------------------------
+
+    void interrupt_dequeue()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_interruptionRequested = true;
+        m_condition.notify_one();
+    }
+
+private:
+
+    /// Slot of the ring buffer, its sequence tells whether it can be written or read at a given position.
+    struct Cell
+    {
+        std::atomic<std::size_t> m_sequence;
+        ::boost::log::record_view m_record;
+    };
+
+    //------------------------------------------------------------------------------
+
+    explicit LogQueue(const QueueSettings& settings) :
+        m_policy(settings.m_policy)
+    {
+        std::size_t size = 2;
+        while(size < settings.m_size)
+        {
+            size <<= 1;
+        }
+
+        m_cells.reset(new Cell[size]);
+        m_mask = size - 1;
+        for(std::size_t i = 0 ; i < size ; ++i)
+        {
+            m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    bool push(const ::boost::log::record_view& rec)
+    {
+        Cell* cell       = nullptr;
+        std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        while(true)
+        {
+            cell = &m_cells[pos & m_mask];
+            const std::size_t sequence = cell->m_sequence.load(std::memory_order_acquire);
+            const auto diff            = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if(diff == 0)
+            {
+                if(m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if(diff < 0)
+            {
+                // The queue is full
+                return false;
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->m_record = rec;
+        cell->m_sequence.store(pos + 1, std::memory_order_release);
+
+        // Wake up the writer thread if it is sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(m_waiting.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_condition.notify_one();
+        }
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------
+
+    bool pop(::boost::log::record_view& rec)
+    {
+        Cell* cell       = nullptr;
+        std::size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        while(true)
+        {
+            cell = &m_cells[pos & m_mask];
+            const std::size_t sequence = cell->m_sequence.load(std::memory_order_acquire);
+            const auto diff            = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if(diff == 0)
+            {
+                if(m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if(diff < 0)
+            {
+                // The queue is empty
+                return false;
+            }
+            else
+            {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        rec.swap(cell->m_record);
+        cell->m_record = ::boost::log::record_view();
+        cell->m_sequence.store(pos + m_mask + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    const SpyLogger::OverflowPolicy m_policy;
+
+    std::unique_ptr<Cell[]> m_cells;
+    std::size_t m_mask {0};
+
+    // The positions are kept on different cache lines, since they are modified by different threads
+    std::atomic<std::size_t> m_enqueuePos {0};
+    char m_padding[64];
+    std::atomic<std::size_t> m_dequeuePos {0};
+
+    std::atomic_bool m_waiting {false};
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_interruptionRequested {false};
+};
+
+/// Appender registered in the logging core.
+struct Appender
+{
+    ::boost::shared_ptr< ::boost::log::sinks::sink> m_sink;
+
+    /// Stops the writer thread of an asynchronous appender after having written the pending messages.
+    std::function<void()> m_stop;
+};
+
+/// Keeps the appenders, to be able to flush and remove them.
+struct AppenderRegistry
+{
+    //------------------------------------------------------------------------------
+
+    ~AppenderRegistry()
+    {
+        // Ensures the writer threads are stopped before the backends are destroyed
+        for(auto& appender : m_appenders)
+        {
+            if(appender.second.m_stop)
+            {
+                appender.second.m_stop();
+            }
+        }
+    }
+
+    std::mutex m_mutex;
+    SpyLogger::AppenderIdType m_nextId {0};
+    std::map<SpyLogger::AppenderIdType, Appender> m_appenders;
+};
+
+//------------------------------------------------------------------------------
+
+AppenderRegistry& appenderRegistry()
+{
+    static AppenderRegistry registry;
+    return registry;
+}
+
+//------------------------------------------------------------------------------
+
+template<typename BackendT, typename FormatterT>
+SpyLogger::AppenderIdType addAppender(
+    const ::boost::shared_ptr<BackendT>& backend,
+    const FormatterT& formatter,
+    SpyLogger::LevelType level,
+    bool asynchronous,
+    const QueueSettings& settings
+)
+{
+    namespace expr  = ::boost::log::expressions;
+    namespace sinks = ::boost::log::sinks;
+
+    const auto filter = expr::attr< ::boost::log::trivial::severity_level>("Severity")
+                        >= static_cast< ::boost::log::trivial::severity_level>(level);
+
+    Appender appender;
+    if(asynchronous)
+    {
+        typedef sinks::asynchronous_sink<BackendT, LogQueue> SinkType;
+        const auto sink = ::boost::make_shared<SinkType>(backend, queue_settings = settings);
+        sink->set_formatter(formatter);
+        sink->set_filter(filter);
+        appender.m_sink = sink;
+        appender.m_stop = [sink]()
+                          {
+                              sink->stop();
+                              sink->flush();
+                          };
+    }
+    else
+    {
+        typedef sinks::synchronous_sink<BackendT> SinkType;
+        const auto sink = ::boost::make_shared<SinkType>(backend);
+        sink->set_formatter(formatter);
+        sink->set_filter(filter);
+        appender.m_sink = sink;
+    }
+
+    AppenderRegistry& registry = appenderRegistry();
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+    ::boost::log::core::get()->add_sink(appender.m_sink);
+
+    const SpyLogger::AppenderIdType id = registry.m_nextId++;
+    registry.m_appenders[id] = appender;
+    return id;
+}
+
+} // namespace
+
 //-----------------------------------------------------------------------------
 
 std::string stripFilePath(const char* path)
@@ -65,16 +398,33 @@ std::string stripFilePath(const char* path)
     // Keep the minimum file tree necessary to identify the file, i.e.
     // /home/user/dev/sight/modules/visu/modules/viz/scene3d/adaptor/src/modules/viz/scene3d/adaptor/SCamera.cpp ->
     // modules/viz/scene3d/adaptor/SCamera.cpp
-    static const std::regex regex("(include|src)(?!.*(src|include))/(.*)");
+    // This is called on each message by the logging thread, so the last "src/" or "include/" is searched by hand
+    // rather than with a regular expression.
+    if(path == nullptr)
+    {
+        return std::string();
+    }
+
+    const std::string_view fullPath(path);
+    const std::size_t srcPos     = fullPath.rfind("src");
+    const std::size_t includePos = fullPath.rfind("include");
+
+    std::size_t end = std::string_view::npos;
+    if(srcPos != std::string_view::npos && (includePos == std::string_view::npos || srcPos > includePos))
+    {
+        end = srcPos + 3;
+    }
+    else if(includePos != std::string_view::npos)
+    {
+        end = includePos + 7;
+    }
 
-    std::smatch match;
-    std::string strippedPath(path);
-    if(std::regex_search(strippedPath, match, regex))
+    if(end < fullPath.size() && fullPath[end] == '/')
     {
-        strippedPath.assign(match[3].first, match[3].second);
+        return std::string(fullPath.substr(end + 1));
     }
 
-    return strippedPath;
+    return std::string(fullPath);
 }
 
 //-----------------------------------------------------------------------------
@@ -99,27 +449,27 @@ void SpyLogger::createBasicConfiguration()
 
 //-----------------------------------------------------------------------------
 
-void SpyLogger::addStreamAppender(std::ostream& os, LevelType level)
+SpyLogger::AppenderIdType SpyLogger::addStreamAppender(std::ostream& os, LevelType level)
 {
-    namespace expr     = ::boost::log::expressions;
-    namespace keywords = ::boost::log::keywords;
+    namespace expr = ::boost::log::expressions;
 
     typedef ::boost::posix_time::ptime::time_duration_type DurationType;
 
-    ::boost::log::add_console_log(
-        os,
-        keywords::format = (
-            expr::stream << "["
-            << expr::attr<unsigned int>("LineID")
-            << "][" << expr::format_date_time<DurationType>("Uptime", "%H:%M:%S.%f")
-            << "][" << expr::attr< ::boost::log::trivial::severity_level>("Severity")
-            << "] " << expr::smessage
-                           ),
-        keywords::filter = expr::attr< ::boost::log::trivial::severity_level>("Severity")
-                           >= static_cast< ::boost::log::trivial::severity_level>(level),
-        // auto-flush feature of the backend
-        keywords::auto_flush = true
-    );
+    auto backend = ::boost::make_shared< ::boost::log::sinks::text_ostream_backend>();
+    backend->add_stream(::boost::shared_ptr<std::ostream>(&os, ::boost::null_deleter()));
+    // auto-flush feature of the backend
+    backend->auto_flush(true);
+
+    return addAppender(
+        backend,
+        expr::stream << "["
+        << expr::attr<unsigned int>("LineID")
+        << "][" << expr::format_date_time<DurationType>("Uptime", "%H:%M:%S.%f")
+        << "][" << expr::attr< ::boost::log::trivial::severity_level>("Severity")
+        << "] " << expr::smessage,
+        level,
+        m_asynchronous,
+        {m_queueSize, m_overflowPolicy});
 }
 
 //-----------------------------------------------------------------------------
@@ -130,35 +480,107 @@ void SpyLogger::addStreamAppender(std::ostream& os, LevelType level)
 
 //-----------------------------------------------------------------------------
 
-void SpyLogger::addFileAppender(const std::string& logFile, LevelType level)
+SpyLogger::AppenderIdType SpyLogger::addFileAppender(const std::string& logFile, LevelType level)
 {
     namespace expr     = ::boost::log::expressions;
     namespace keywords = ::boost::log::keywords;
 
     typedef ::boost::posix_time::ptime::time_duration_type DurationType;
 
-    ::boost::log::add_file_log(
+    auto backend = ::boost::make_shared< ::boost::log::sinks::text_file_backend>(
         // file name pattern
         keywords::file_name = logFile,
         // rotate files every 10 MiB...
         keywords::rotation_size = 10 * 1024 * 1024,
         // ...or at midnight
-        keywords::time_based_rotation = ::boost::log::sinks::file::rotation_at_time_point(0, 0, 0),
-        // log record format
-        keywords::format = (
-            expr::stream
-            << "[" << expr::format_date_time< ::boost::posix_time::ptime>("TimeStamp", "%d.%m.%Y %H:%M:%S.%f")
-            << "][" << expr::format_date_time<DurationType>("Uptime", "%H:%M:%S.%f")
-            << "][" << expr::attr< ::boost::log::attributes::current_process_id::value_type>("ProcessID")
-            << "][" << expr::attr< ::boost::log::attributes::current_thread_id::value_type>("ThreadID")
-            << "][" << expr::attr< ::boost::log::trivial::severity_level>("Severity")
-            << "] " << expr::smessage
-                           ),
-        keywords::filter = expr::attr< ::boost::log::trivial::severity_level>("Severity")
-                           >= static_cast< ::boost::log::trivial::severity_level>(level),
-        // auto-flush feature of the backend
-        keywords::auto_flush = true
+        keywords::time_based_rotation = ::boost::log::sinks::file::rotation_at_time_point(0, 0, 0)
     );
+    // auto-flush feature of the backend
+    backend->auto_flush(true);
+
+    return addAppender(
+        backend,
+        expr::stream
+        << "[" << expr::format_date_time< ::boost::posix_time::ptime>("TimeStamp", "%d.%m.%Y %H:%M:%S.%f")
+        << "][" << expr::format_date_time<DurationType>("Uptime", "%H:%M:%S.%f")
+        << "][" << expr::attr< ::boost::log::attributes::current_process_id::value_type>("ProcessID")
+        << "][" << expr::attr< ::boost::log::attributes::current_thread_id::value_type>("ThreadID")
+        << "][" << expr::attr< ::boost::log::trivial::severity_level>("Severity")
+        << "] " << expr::smessage,
+        level,
+        m_asynchronous,
+        {m_queueSize, m_overflowPolicy});
+}
+
+//-----------------------------------------------------------------------------
+
+void SpyLogger::removeAppender(AppenderIdType id)
+{
+    Appender appender;
+    {
+        AppenderRegistry& registry = appenderRegistry();
+        std::lock_guard<std::mutex> lock(registry.m_mutex);
+        const auto it = registry.m_appenders.find(id);
+        if(it == registry.m_appenders.end())
+        {
+            return;
+        }
+
+        appender = it->second;
+        registry.m_appenders.erase(it);
+    }
+
+    ::boost::log::core::get()->remove_sink(appender.m_sink);
+    if(appender.m_stop)
+    {
+        appender.m_stop();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SpyLogger::setAsynchronous(bool asynchronous, std::size_t queueSize, OverflowPolicy policy)
+{
+    m_asynchronous   = asynchronous;
+    m_queueSize      = queueSize;
+    m_overflowPolicy = policy;
+}
+
+//-----------------------------------------------------------------------------
+
+bool SpyLogger::isAsynchronous() const
+{
+    return m_asynchronous;
+}
+
+//-----------------------------------------------------------------------------
+
+std::uint64_t SpyLogger::getDroppedCount() const
+{
+    return s_droppedCount.load(std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+
+void SpyLogger::flush()
+{
+    std::vector< ::boost::shared_ptr< ::boost::log::sinks::sink> > sinks;
+    {
+        AppenderRegistry& registry = appenderRegistry();
+        std::lock_guard<std::mutex> lock(registry.m_mutex);
+        for(const auto& appender : registry.m_appenders)
+        {
+            if(appender.second.m_stop)
+            {
+                sinks.push_back(appender.second.m_sink);
+            }
+        }
+    }
+
+    for(const auto& sink : sinks)
+    {
+        sink->flush();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -215,6 +637,9 @@ void SpyLogger::error(const std::string& mes, const char* file, int line)
 void SpyLogger::fatal(const std::string& mes, const char* file, int line)
 {
     BOOST_LOG_SEV(lg::get(), ::boost::log::trivial::fatal) << "[" << stripFilePath(file) << ":" << line << "] " << mes;
+
+    // The application is usually aborted after a fatal message, it must be written before
+    this->flush();
 }
 
 //-----------------------------------------------------------------------------
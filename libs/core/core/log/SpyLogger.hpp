@@ -25,6 +25,7 @@
 #include "core/BaseObject.hpp"
 #include "core/config.hpp"
 
+#include <cstdint>
 #include <iostream>
 #include <string>
 
@@ -37,7 +38,10 @@ namespace log
 /**
  * @brief   Implements the SpyLogger.
  *
- *
+ * Appenders are synchronous by default: the message is formatted and written by the thread that logs it. When
+ * setAsynchronous() is enabled, the appenders added afterwards only push the messages in a bounded lock-free queue,
+ * and a dedicated thread per appender formats and writes them. The behavior when the queue is full is given by the
+ * OverflowPolicy.
  */
 class SpyLogger : public core::BaseObject
 {
@@ -53,11 +57,46 @@ public:
         SL_FATAL
     };
 
+    /// Behavior of the asynchronous appenders when their queue is full.
+    enum class OverflowPolicy
+    {
+        BLOCK, ///< The logging thread waits until the writer thread frees some space.
+        DROP,  ///< The message is discarded.
+        COUNT  ///< The message is discarded and counted, see getDroppedCount().
+    };
+
+    /// Identifier of an appender, used to remove it.
+    typedef std::size_t AppenderIdType;
+
     CORE_API void createBasicConfiguration();
 
-    CORE_API void addStreamAppender(std::ostream& os = std::clog, LevelType level = SL_TRACE);
+    CORE_API AppenderIdType addStreamAppender(std::ostream& os = std::clog, LevelType level = SL_TRACE);
+
+    CORE_API AppenderIdType addFileAppender(const std::string& logFile = "SLM.log", LevelType level = SL_TRACE);
 
-    CORE_API void addFileAppender(const std::string& logFile = "SLM.log", LevelType level = SL_TRACE);
+    /// Removes an appender, once its pending messages are written.
+    CORE_API void removeAppender(AppenderIdType id);
+
+    /**
+     * @brief Chooses whether the appenders added afterwards write the messages from a dedicated thread.
+     * @param asynchronous enables the asynchronous appenders
+     * @param queueSize maximum number of messages waiting to be written by each appender, rounded up to a power of 2
+     * @param policy behavior when the queue of an appender is full
+     */
+    CORE_API void setAsynchronous(
+        bool asynchronous,
+        std::size_t queueSize = 8192,
+        OverflowPolicy policy = OverflowPolicy::BLOCK
+    );
+
+    /// Returns true if the appenders added afterwards are asynchronous.
+    CORE_API bool isAsynchronous() const;
+
+    /// Returns the number of messages discarded with the OverflowPolicy::COUNT policy.
+    CORE_API std::uint64_t getDroppedCount() const;
+
+    /// Blocks until the pending messages of all asynchronous appenders are written.
+    CORE_API void flush();
 
     // CORE_API void addSyslogAppender(const std::string & hostName, const std::string & facilityName);
 
@@ -89,6 +128,12 @@ protected:
     CORE_API SpyLogger();
 
     CORE_API static SpyLogger s_spyLogger;
+
+private:
+
+    bool m_asynchronous {false};
+    std::size_t m_queueSize {8192};
+    OverflowPolicy m_overflowPolicy {OverflowPolicy::BLOCK};
 }; // SpyLogger
 
 } // namespace log
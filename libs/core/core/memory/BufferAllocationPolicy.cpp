@@ -25,11 +25,55 @@
 #include "core/memory/ByteSize.hpp"
 #include "core/memory/exception/Memory.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#if defined(linux) || defined(__linux)
+#include <sys/mman.h>
+#endif
+
 namespace sight::core::memory
 {
 
 //------------------------------------------------------------------------------
 
+struct DefaultPolicy
+{
+    std::mutex mutex;
+    BufferAllocationPolicy::sptr policy {BufferMallocPolicy::New()};
+};
+
+//------------------------------------------------------------------------------
+
+static DefaultPolicy& getDefaultPolicy()
+{
+    static DefaultPolicy defaultPolicy;
+    return defaultPolicy;
+}
+
+//------------------------------------------------------------------------------
+
+BufferAllocationPolicy::sptr BufferAllocationPolicy::getDefault()
+{
+    DefaultPolicy& defaultPolicy = getDefaultPolicy();
+    std::lock_guard<std::mutex> lock(defaultPolicy.mutex);
+    return defaultPolicy.policy;
+}
+
+//------------------------------------------------------------------------------
+
+void BufferAllocationPolicy::setDefault(const BufferAllocationPolicy::sptr& policy)
+{
+    SIGHT_ASSERT("The default allocation policy can not be null", policy);
+    DefaultPolicy& defaultPolicy = getDefaultPolicy();
+    std::lock_guard<std::mutex> lock(defaultPolicy.mutex);
+    defaultPolicy.policy = policy;
+}
+
+//------------------------------------------------------------------------------
+
 void BufferMallocPolicy::allocate(
     BufferType& buffer,
     BufferAllocationPolicy::SizeType size
@@ -157,6 +201,130 @@ BufferAllocationPolicy::sptr BufferNewPolicy::New()
 
 //------------------------------------------------------------------------------
 
+/// Stored just before an aligned buffer, to free it and to know its size when it is reallocated
+struct AlignedHeader
+{
+    void* base;
+    BufferAllocationPolicy::SizeType size;
+};
+
+//------------------------------------------------------------------------------
+
+static AlignedHeader* getAlignedHeader(BufferAllocationPolicy::BufferType buffer)
+{
+    return static_cast<AlignedHeader*>(buffer) - 1;
+}
+
+//------------------------------------------------------------------------------
+
+BufferAlignedPolicy::BufferAlignedPolicy(SizeType alignment, SizeType hugePageThreshold) :
+    m_alignment(std::max(alignment, sizeof(AlignedHeader))),
+    m_hugePageThreshold(hugePageThreshold)
+{
+    SIGHT_ASSERT("The alignment must be a power of two", (alignment & (alignment - 1)) == 0);
+}
+
+//------------------------------------------------------------------------------
+
+void BufferAlignedPolicy::allocate(
+    BufferType& buffer,
+    BufferAllocationPolicy::SizeType size
+)
+{
+    if(size > 0)
+    {
+        const bool hugePages     = m_hugePageThreshold > 0 && size >= m_hugePageThreshold;
+        const SizeType alignment = hugePages ? std::max(m_alignment, HUGE_PAGE_SIZE) : m_alignment;
+
+        // The header is stored in the first aligned block, the buffer starts right after it
+        const SizeType offset    = m_alignment;
+        const SizeType allocSize = offset + size;
+
+        void* base = nullptr;
+#ifdef WIN32
+        base = _aligned_malloc(allocSize, alignment);
+#else
+        if(posix_memalign(&base, alignment, allocSize) != 0)
+        {
+            base = nullptr;
+        }
+#endif
+
+        if(base == nullptr)
+        {
+            SIGHT_THROW_EXCEPTION_MSG(
+                core::memory::exception::Memory,
+                "Cannot allocate memory ("
+                << core::memory::ByteSize(core::memory::ByteSize::SizeType(size)) << ")."
+            );
+        }
+
+#if defined(linux) || defined(__linux)
+        if(hugePages)
+        {
+            // Only a hint, the memory is still valid if the system does not use huge pages
+            madvise(base, allocSize, MADV_HUGEPAGE);
+        }
+#endif
+
+        buffer = static_cast<char*>(base) + offset;
+
+        AlignedHeader* header = getAlignedHeader(buffer);
+        header->base = base;
+        header->size = size;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void BufferAlignedPolicy::reallocate(
+    BufferType& buffer,
+    BufferAllocationPolicy::SizeType size
+)
+{
+    if(buffer == nullptr)
+    {
+        this->allocate(buffer, size);
+    }
+    else if(size == 0)
+    {
+        this->destroy(buffer);
+    }
+    else
+    {
+        // There is no aligned realloc, the content is copied in a new buffer
+        BufferType newBuffer = nullptr;
+        this->allocate(newBuffer, size);
+        std::memcpy(newBuffer, buffer, std::min(size, getAlignedHeader(buffer)->size));
+        this->destroy(buffer);
+        buffer = newBuffer;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void BufferAlignedPolicy::destroy(BufferType& buffer)
+{
+    if(buffer != nullptr)
+    {
+#ifdef WIN32
+        _aligned_free(getAlignedHeader(buffer)->base);
+#else
+        free(getAlignedHeader(buffer)->base);
+#endif
+        buffer = nullptr;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+BufferAllocationPolicy::sptr BufferAlignedPolicy::New(SizeType alignment, SizeType hugePageThreshold)
+{
+    return BufferAllocationPolicy::sptr(new BufferAlignedPolicy(alignment, hugePageThreshold));
+}
+
+//------------------------------------------------------------------------------
+
 void BufferNoAllocPolicy::allocate(
     BufferType& buffer,
     BufferAllocationPolicy::SizeType size
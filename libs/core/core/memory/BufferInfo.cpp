@@ -47,6 +47,8 @@ void BufferInfo::clear()
     lastAccess = core::LogicStamp();
     bufferPolicy.reset();
     istreamFactory.reset();
+    mappedFile.reset();
+    sharedBuffer.reset();
 }
 
 } // namespace sight::core::memory
@@ -26,11 +26,13 @@
 #include "core/memory/BufferAllocationPolicy.hpp"
 #include "core/memory/FileFormat.hpp"
 #include "core/memory/FileHolder.hpp"
+#include "core/memory/MappedFile.hpp"
 #include "core/memory/stream/in/IFactory.hpp"
 #include <core/LogicStamp.hpp>
 #include <core/macros.hpp>
 
 #include <filesystem>
+#include <string>
 
 namespace sight::core::memory
 {
@@ -64,6 +66,16 @@ struct CORE_CLASS_API BufferInfo
     core::memory::BufferAllocationPolicy::sptr bufferPolicy;
 
     SPTR(core::memory::stream::in::IFactory) istreamFactory;
+
+    /// class name of the data owning the buffer, used to aggregate the statistics, and optional owner identifier
+    std::string owner;
+    std::string ownerId;
+
+    /// memory shared with other buffers until one of them is locked for writing (copy-on-write), null otherwise
+    SPTR(void) sharedBuffer;
+
+    /// mapping of the dumped file, set if 'buffer' points to the mapped file instead of an allocated memory
+    core::memory::MappedFile::sptr mappedFile;
 };
 
 } // namespace sight::core::memory
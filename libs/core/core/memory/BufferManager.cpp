@@ -25,18 +25,26 @@
 #include "core/memory/policy/NeverDump.hpp"
 #include "core/memory/stream/in/Buffer.hpp"
 #include "core/memory/stream/in/Raw.hpp"
+#include "core/memory/stream/in/RawZstd.hpp"
 #include <core/com/Signal.hxx>
+#include <core/HiResClock.hpp>
 #include <core/LazyInstantiator.hpp>
+#include <core/thread/Pool.hpp>
 #include <core/thread/Worker.hpp>
 #include <core/tools/System.hpp>
 
+#include <boost/iostreams/filter/zstd.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
 #include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iosfwd>
 #include <iostream>
+#include <set>
 
 namespace sight::core::memory
 {
@@ -48,6 +56,100 @@ SPTR(void) getLock(const BufferManager::sptr& manager, BufferManager::ConstBuffe
 
 //-----------------------------------------------------------------------------
 
+/// Writes a buffer in a new temporary file, compressed if the level is not null, and returns the size of the file
+BufferManager::SizeType writeDumpFile(
+    BufferManager::ConstBufferType buffer,
+    BufferManager::SizeType size,
+    const std::filesystem::path& path,
+    int level
+)
+{
+    std::ofstream fs(path, std::ios::binary | std::ios::trunc);
+    SIGHT_THROW_IF("Memory management : Unable to open " << path, !fs.good());
+    const char* charBuf = static_cast<const char*>(buffer);
+
+    if(level > 0)
+    {
+        ::boost::iostreams::filtering_ostream filter;
+        filter.push(::boost::iostreams::zstd_compressor(::boost::iostreams::zstd_params(level)));
+        filter.push(fs);
+        filter.write(charBuf, static_cast<std::streamsize>(size));
+        SIGHT_THROW_IF("Memory management : Unable to write " << path, filter.bad());
+
+        // Writes the end of the compressed frame
+        filter.reset();
+    }
+    else
+    {
+        fs.write(charBuf, static_cast<std::streamsize>(size));
+    }
+
+    const std::streamoff fileSize = fs.tellp();
+    fs.close();
+    SIGHT_THROW_IF("Memory management : Unable to write " << path, fs.bad() || fileSize < 0);
+
+    return static_cast<BufferManager::SizeType>(fileSize);
+}
+
+//-----------------------------------------------------------------------------
+
+/// Reads a dumped buffer in a new buffer, returns NULL on failure
+BufferManager::BufferType readDumpFile(
+    const SPTR(core::memory::stream::in::IFactory)& factory,
+    BufferManager::SizeType size,
+    const core::memory::BufferAllocationPolicy::sptr& policy
+)
+{
+    BufferManager::BufferType buffer = NULL;
+    try
+    {
+        policy->allocate(buffer, size);
+
+        SPTR(std::istream) isptr = (*factory)();
+        const std::streamsize read =
+            isptr->read(static_cast<char*>(buffer), static_cast<std::streamsize>(size)).gcount();
+        SIGHT_THROW_IF(
+            " Bad file size, expected: " << size << ", was: " << read,
+            static_cast<BufferManager::SizeType>(read) != size || isptr->fail()
+        );
+    }
+    catch(const std::exception& e)
+    {
+        SIGHT_ERROR("Unable to prefetch the buffer : " << e.what());
+        if(buffer != NULL)
+        {
+            policy->destroy(buffer);
+        }
+    }
+
+    return buffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/// Memory shared by several buffers, freed with the last one
+struct SharedMemory
+{
+    SharedMemory(BufferManager::BufferType _buffer, const core::memory::BufferAllocationPolicy::sptr& _policy) :
+        buffer(_buffer),
+        policy(_policy)
+    {
+    }
+
+    ~SharedMemory()
+    {
+        if(buffer != NULL)
+        {
+            policy->destroy(buffer);
+        }
+    }
+
+    BufferManager::BufferType buffer;
+    core::memory::BufferAllocationPolicy::sptr policy;
+};
+
+//-----------------------------------------------------------------------------
+
 BufferManager::sptr BufferManager::getDefault()
 {
     return core::LazyInstantiator<BufferManager>::getInstance();
@@ -59,6 +161,11 @@ BufferManager::BufferManager() :
     m_updatedSig(UpdatedSignalType::New()),
     m_dumpPolicy(core::memory::policy::NeverDump::New()),
     m_loadingMode(BufferManager::DIRECT),
+    m_dumpMode(BufferManager::COPY),
+    m_mappingThreshold(1024 * 1024),
+    m_compressionLevel(0),
+    m_asynchronousDump(false),
+    m_ioStats(),
     m_worker(core::thread::Worker::New())
 {
 }
@@ -103,6 +210,17 @@ void BufferManager::unregisterBufferImpl(BufferManager::BufferPtrType bufferPtr)
         m_bufferInfos[bufferPtr].lockCounter.expired()
     );
 
+    this->cancelDump(bufferPtr);
+    this->cancelRestore(bufferPtr);
+
+    const auto iter = m_bufferInfos.find(bufferPtr);
+    if(iter != m_bufferInfos.end() && iter->second.size > 0 && iter->second.sharedBuffer.use_count() <= 1)
+    {
+        // The buffer leaves the manager, it is not accounted anymore
+        ++m_ioStats.freeCount;
+        m_ioStats.freedBytes += iter->second.size;
+    }
+
     m_bufferInfos.erase(bufferPtr);
     m_updatedSig->asyncEmit();
 }
@@ -156,6 +274,9 @@ void BufferManager::allocateBufferImpl(
     info.lastAccess.modified();
     info.size         = size;
     info.bufferPolicy = policy;
+
+    ++m_ioStats.allocationCount;
+    m_ioStats.allocatedBytes += size;
     m_updatedSig->asyncEmit();
 }
 
@@ -207,6 +328,72 @@ void BufferManager::setBufferImpl(
             std::bind(&getLock, this->getSptr(), bufferPtr)
         );
     info.userStreamFactory = false;
+
+    ++m_ioStats.allocationCount;
+    m_ioStats.allocatedBytes += size;
+    m_updatedSig->asyncEmit();
+}
+
+//-----------------------------------------------------------------------------
+
+std::shared_future<void> BufferManager::mapFile(
+    BufferManager::BufferPtrType bufferPtr,
+    const std::filesystem::path& file,
+    SizeType offset,
+    SizeType size,
+    const core::memory::BufferAllocationPolicy::sptr& policy
+)
+{
+    return m_worker->postTask<void>(
+        std::bind(&BufferManager::mapFileImpl, this, bufferPtr, file, offset, size, policy)
+    );
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::mapFileImpl(
+    BufferManager::BufferPtrType bufferPtr,
+    const std::filesystem::path& file,
+    SizeType offset,
+    SizeType size,
+    const core::memory::BufferAllocationPolicy::sptr& policy
+)
+{
+    BufferInfo& info = m_bufferInfos[bufferPtr];
+
+    SIGHT_ASSERT("Buffer is already set", *bufferPtr == NULL && info.loaded);
+
+    // The user file is only read, it is not deleted with the mapping
+    const auto mappedFile = std::make_shared<core::memory::MappedFile>(
+        core::memory::FileHolder(file),
+        size,
+        offset,
+        true
+    );
+
+    m_dumpPolicy->setRequest(info, bufferPtr, size);
+
+    if(!info.loaded)
+    {
+        info.clear();
+    }
+
+    info.mappedFile = mappedFile;
+    *bufferPtr      = info.mappedFile->getBuffer();
+
+    info.lastAccess.modified();
+    info.size         = size;
+    info.bufferPolicy = policy;
+    info.fileFormat   = core::memory::OTHER;
+    info.fsFile.clear();
+    info.istreamFactory =
+        std::make_shared<core::memory::stream::in::Buffer>(
+            *bufferPtr,
+            size,
+            std::bind(&getLock, this->getSptr(), bufferPtr)
+        );
+    info.userStreamFactory = false;
+
     m_updatedSig->asyncEmit();
 }
 
@@ -224,11 +411,27 @@ void BufferManager::reallocateBufferImpl(BufferManager::BufferPtrType bufferPtr,
     BufferInfo& info = m_bufferInfos[bufferPtr];
     SIGHT_ASSERT("Buffer must be allocated or dumped", (*bufferPtr != NULL) || !info.loaded);
 
+    this->cancelDump(bufferPtr);
+    this->cancelRestore(bufferPtr);
+
     m_dumpPolicy->reallocateRequest(info, bufferPtr, newSize);
 
+    const bool isShared = info.sharedBuffer.use_count() > 1;
+
     try
     {
-        if(info.loaded)
+        if(info.loaded && (info.mappedFile || info.sharedBuffer))
+        {
+            // The mapping size is fixed and the shared memory is used by other buffers, the data is moved to an
+            // allocated buffer
+            BufferManager::BufferType newBuffer = NULL;
+            info.bufferPolicy->allocate(newBuffer, newSize);
+            std::memcpy(newBuffer, *bufferPtr, std::min(info.size, newSize));
+            info.mappedFile.reset();
+            info.sharedBuffer.reset();
+            *bufferPtr = newBuffer;
+        }
+        else if(info.loaded)
         {
             info.bufferPolicy->reallocate(*bufferPtr, newSize);
         }
@@ -250,6 +453,15 @@ void BufferManager::reallocateBufferImpl(BufferManager::BufferPtrType bufferPtr,
             std::bind(&getLock, this->getSptr(), bufferPtr)
         );
 
+    if(!isShared)
+    {
+        ++m_ioStats.freeCount;
+        m_ioStats.freedBytes += info.size;
+    }
+
+    ++m_ioStats.allocationCount;
+    m_ioStats.allocatedBytes += newSize;
+
     info.lastAccess.modified();
     info.size = newSize;
 
@@ -270,11 +482,28 @@ void BufferManager::destroyBufferImpl(BufferManager::BufferPtrType bufferPtr)
     BufferInfo& info = m_bufferInfos[bufferPtr];
     SIGHT_ASSERT("Buffer must be allocated or dumped", (*bufferPtr != NULL) || !info.loaded);
 
+    this->cancelDump(bufferPtr);
+    this->cancelRestore(bufferPtr);
+
     m_dumpPolicy->destroyRequest(info, bufferPtr);
 
-    if(info.loaded)
+    // Shared memory is only freed with its last buffer
+    const bool isShared = info.sharedBuffer.use_count() > 1;
+
+    if(info.loaded && info.mappedFile)
     {
-        info.bufferPolicy->destroy(*bufferPtr);
+        info.mappedFile.reset();
+        *bufferPtr = NULL;
+    }
+    else if(info.loaded)
+    {
+        releaseBuffer(info, bufferPtr);
+    }
+
+    if(!isShared)
+    {
+        ++m_ioStats.freeCount;
+        m_ioStats.freedBytes += info.size;
     }
 
     info.clear();
@@ -296,6 +525,11 @@ std::shared_future<void> BufferManager::swapBuffer(
 
 void BufferManager::swapBufferImpl(BufferManager::BufferPtrType bufA, BufferManager::BufferPtrType bufB)
 {
+    this->cancelDump(bufA);
+    this->cancelDump(bufB);
+    this->cancelRestore(bufA);
+    this->cancelRestore(bufB);
+
     BufferInfo& infoA = m_bufferInfos[bufA];
     BufferInfo& infoB = m_bufferInfos[bufB];
 
@@ -306,12 +540,152 @@ void BufferManager::swapBufferImpl(BufferManager::BufferPtrType bufA, BufferMana
     std::swap(infoA.bufferPolicy, infoB.bufferPolicy);
     std::swap(infoA.istreamFactory, infoB.istreamFactory);
     std::swap(infoA.userStreamFactory, infoB.userStreamFactory);
+    std::swap(infoA.mappedFile, infoB.mappedFile);
+    std::swap(infoA.sharedBuffer, infoB.sharedBuffer);
     infoA.lastAccess.modified();
     infoB.lastAccess.modified();
 }
 
 //-----------------------------------------------------------------------------
 
+std::shared_future<bool> BufferManager::shareBuffer(
+    BufferManager::BufferPtrType bufferPtr,
+    BufferManager::ConstBufferPtrType sourcePtr
+)
+{
+    return m_worker->postTask<bool>(std::bind(&BufferManager::shareBufferImpl, this, bufferPtr, sourcePtr));
+}
+
+//------------------------------------------------------------------------------
+
+bool BufferManager::shareBufferImpl(
+    BufferManager::BufferPtrType bufferPtr,
+    BufferManager::ConstBufferPtrType sourcePtr
+)
+{
+    BufferManager::BufferPtrType castedSource = const_cast<BufferManager::BufferPtrType>(sourcePtr);
+    BufferInfo& sourceInfo                    = m_bufferInfos[castedSource];
+    BufferInfo& info                          = m_bufferInfos[bufferPtr];
+    SIGHT_ASSERT("Buffer has already been allocated", info.loaded && (*bufferPtr == NULL));
+
+    // A locked buffer may be modified through its current address, its memory can not be shared
+    if(sourceInfo.size == 0 || sourceInfo.lockCount() > 0 || !sourceInfo.bufferPolicy
+       || std::dynamic_pointer_cast<core::memory::BufferNoAllocPolicy>(sourceInfo.bufferPolicy))
+    {
+        return false;
+    }
+
+    if(!sourceInfo.loaded && !this->restoreBuffer(sourceInfo, castedSource))
+    {
+        return false;
+    }
+
+    if(sourceInfo.mappedFile)
+    {
+        return false;
+    }
+
+    if(!sourceInfo.sharedBuffer)
+    {
+        // The memory is now owned by all the buffers sharing it
+        sourceInfo.sharedBuffer = std::make_shared<SharedMemory>(*castedSource, sourceInfo.bufferPolicy);
+    }
+
+    m_dumpPolicy->setRequest(info, bufferPtr, sourceInfo.size);
+
+    *bufferPtr = *castedSource;
+
+    info.lastAccess.modified();
+    info.size              = sourceInfo.size;
+    info.bufferPolicy      = sourceInfo.bufferPolicy;
+    info.sharedBuffer      = sourceInfo.sharedBuffer;
+    info.fileFormat        = core::memory::OTHER;
+    info.userStreamFactory = false;
+    info.fsFile.clear();
+    info.istreamFactory =
+        std::make_shared<core::memory::stream::in::Buffer>(
+            *bufferPtr,
+            info.size,
+            std::bind(&getLock, this->getSptr(), bufferPtr)
+        );
+    m_updatedSig->asyncEmit();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+std::shared_future<void> BufferManager::unshareBuffer(BufferManager::ConstBufferPtrType bufferPtr)
+{
+    return m_worker->postTask<void>(std::bind(&BufferManager::unshareBufferImpl, this, bufferPtr));
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::unshareBufferImpl(BufferManager::ConstBufferPtrType bufferPtr)
+{
+    BufferInfoMapType::iterator iterInfo = m_bufferInfos.find(bufferPtr);
+    if(iterInfo == m_bufferInfos.end() || !iterInfo->second.sharedBuffer)
+    {
+        return;
+    }
+
+    // A dump in progress reads the shared memory
+    this->cancelDump(bufferPtr);
+
+    BufferInfo& info                          = iterInfo->second;
+    BufferManager::BufferPtrType castedBuffer = const_cast<BufferManager::BufferPtrType>(bufferPtr);
+    if(!info.loaded || !info.sharedBuffer)
+    {
+        return;
+    }
+
+    if(info.sharedBuffer.use_count() > 1)
+    {
+        BufferManager::BufferType copy = NULL;
+        info.bufferPolicy->allocate(copy, info.size);
+        std::memcpy(copy, *castedBuffer, info.size);
+        *castedBuffer = copy;
+
+        ++m_ioStats.allocationCount;
+        m_ioStats.allocatedBytes += info.size;
+    }
+    else
+    {
+        // Last user of the memory, it takes it back
+        std::static_pointer_cast<SharedMemory>(info.sharedBuffer)->buffer = NULL;
+    }
+
+    info.sharedBuffer.reset();
+    info.istreamFactory =
+        std::make_shared<core::memory::stream::in::Buffer>(
+            *castedBuffer,
+            info.size,
+            std::bind(&getLock, this->getSptr(), castedBuffer)
+        );
+    info.lastAccess.modified();
+    m_updatedSig->asyncEmit();
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::releaseBuffer(BufferInfo& info, BufferManager::BufferPtrType bufferPtr)
+{
+    if(info.sharedBuffer)
+    {
+        // The memory is freed with the last buffer using it
+        info.sharedBuffer.reset();
+    }
+    else
+    {
+        info.bufferPolicy->destroy(*bufferPtr);
+    }
+
+    *bufferPtr = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
 struct AutoUnlock
 {
     AutoUnlock(
@@ -365,6 +739,9 @@ SPTR(void) BufferManager::lockBufferImpl(BufferManager::ConstBufferPtrType buffe
     BufferManager::BufferPtrType castedBuffer = const_cast<BufferManager::BufferPtrType>(bufferPtr);
     BufferInfo& info                          = m_bufferInfos[castedBuffer];
 
+    // The buffer may be modified once locked, a dump written in the meantime would be outdated
+    this->cancelDump(bufferPtr);
+
     m_dumpPolicy->lockRequest(info, castedBuffer);
 
     SPTR(void) counter = info.lockCounter.lock();
@@ -424,24 +801,69 @@ bool BufferManager::dumpBuffer(BufferInfo& info, BufferManager::BufferPtrType bu
         return false;
     }
 
-    std::filesystem::path tmp        = core::tools::System::getTemporaryFolder();
-    std::filesystem::path dumpedFile = std::filesystem::temp_directory_path() / core::tools::System::genTempFileName();
-
     info.lockCounter.reset();
 
-    if(this->writeBufferImpl(*bufferPtr, info.size, dumpedFile))
+    if(info.mappedFile && info.mappedFile->isCopyOnWrite())
     {
-        info.fsFile            = core::memory::FileHolder(dumpedFile, true);
-        info.fileFormat        = core::memory::RAW;
-        info.istreamFactory    = std::make_shared<core::memory::stream::in::Raw>(info.fsFile);
-        info.userStreamFactory = false;
-        info.bufferPolicy->destroy(*bufferPtr);
-        *bufferPtr  = NULL;
-        info.loaded = false;
+        // The modifications of a copy-on-write mapping are not in the mapped file. The content is dumped synchronously
+        // since an asynchronous dump releases the buffer with its allocation policy.
+        const AsyncDump result = writeDump(*bufferPtr, info.size, m_compressionLevel);
+        if(result.file.empty())
+        {
+            return false;
+        }
 
-        m_dumpPolicy->dumpSuccess(info, bufferPtr);
+        info.mappedFile.reset();
+        *bufferPtr = NULL;
+        this->setDumped(info, bufferPtr, result.file, result.format);
 
-        m_updatedSig->asyncEmit();
+        ++m_ioStats.dumpCount;
+        m_ioStats.dumpedBytes   += info.size;
+        m_ioStats.dumpFileBytes += result.fileSize;
+        m_ioStats.dumpTime      += result.time;
+        return true;
+    }
+
+    if(info.mappedFile)
+    {
+        // The mapped file already holds the buffer content, unmapping it is enough
+        const core::memory::FileHolder file = info.mappedFile->getFile();
+        info.mappedFile.reset();
+        *bufferPtr = NULL;
+        this->setDumped(info, bufferPtr, file, core::memory::RAW);
+        return true;
+    }
+
+    if(m_pendingDumps.find(bufferPtr) != m_pendingDumps.end())
+    {
+        // Already being dumped, the memory is not released yet
+        return false;
+    }
+
+    if(m_asynchronousDump)
+    {
+        // The memory is released by finishDump() once the file is written
+        m_pendingDumps[bufferPtr] = this->getPool().post(
+            &BufferManager::writeDumpTask,
+            this,
+            bufferPtr,
+            *bufferPtr,
+            info.size,
+            m_compressionLevel
+        );
+        return false;
+    }
+
+    const AsyncDump result = writeDump(*bufferPtr, info.size, m_compressionLevel);
+    if(!result.file.empty())
+    {
+        releaseBuffer(info, bufferPtr);
+        this->setDumped(info, bufferPtr, result.file, result.format);
+
+        ++m_ioStats.dumpCount;
+        m_ioStats.dumpedBytes   += info.size;
+        m_ioStats.dumpFileBytes += result.fileSize;
+        m_ioStats.dumpTime      += result.time;
     }
 
     return !info.loaded;
@@ -449,6 +871,34 @@ bool BufferManager::dumpBuffer(BufferInfo& info, BufferManager::BufferPtrType bu
 
 //-----------------------------------------------------------------------------
 
+void BufferManager::setDumped(
+    BufferInfo& info,
+    BufferManager::BufferPtrType bufferPtr,
+    const core::memory::FileHolder& file,
+    core::memory::FileFormatType format
+)
+{
+    info.fsFile            = file;
+    info.fileFormat        = format;
+    info.userStreamFactory = false;
+    info.loaded            = false;
+
+    if(info.fileFormat == core::memory::RAWZSTD)
+    {
+        info.istreamFactory = std::make_shared<core::memory::stream::in::RawZstd>(info.fsFile);
+    }
+    else
+    {
+        info.istreamFactory = std::make_shared<core::memory::stream::in::Raw>(info.fsFile);
+    }
+
+    m_dumpPolicy->dumpSuccess(info, bufferPtr);
+
+    m_updatedSig->asyncEmit();
+}
+
+//-----------------------------------------------------------------------------
+
 std::shared_future<bool> BufferManager::restoreBuffer(BufferManager::ConstBufferPtrType bufferPtr)
 {
     return m_worker->postTask<bool>(std::bind(&BufferManager::restoreBufferImpl, this, bufferPtr));
@@ -472,14 +922,48 @@ bool BufferManager::restoreBuffer(
 )
 {
     allocSize = ((allocSize) ? allocSize : info.size);
+
+    if(!info.loaded && allocSize == info.size)
+    {
+        // Uses the buffer prefetched in the background, if any
+        this->finishRestore(bufferPtr);
+        if(info.loaded)
+        {
+            return true;
+        }
+    }
+    else
+    {
+        this->cancelRestore(bufferPtr);
+    }
+
     if(!info.loaded)
     {
-        info.bufferPolicy->allocate(*bufferPtr, allocSize);
+        const core::HiResClock::HiResClockType start = core::HiResClock::getTimeInMicroSec();
+
+        if(m_dumpMode == BufferManager::MAPPED && info.fileFormat == core::memory::RAW && !info.userStreamFactory
+           && !info.fsFile.empty() && allocSize == info.size && info.size >= m_mappingThreshold)
+        {
+            try
+            {
+                info.mappedFile = std::make_shared<core::memory::MappedFile>(info.fsFile, info.size);
+                *bufferPtr      = info.mappedFile->getBuffer();
+            }
+            catch(const core::memory::exception::Memory& e)
+            {
+                SIGHT_WARN(e.what() << ", the buffer is read instead.");
+                info.mappedFile.reset();
+            }
+        }
 
-        char* charBuf  = static_cast<char*>(*bufferPtr);
-        SizeType size  = std::min(allocSize, info.size);
-        bool notFailed = false;
+        bool notFailed = (info.mappedFile != nullptr);
+        if(!notFailed)
         {
+            info.bufferPolicy->allocate(*bufferPtr, allocSize);
+
+            char* charBuf = static_cast<char*>(*bufferPtr);
+            SizeType size = std::min(allocSize, info.size);
+
             SPTR(std::istream) isptr = (*info.istreamFactory)();
             std::istream& is = *isptr;
             SizeType read    = is.read(charBuf, size).gcount();
@@ -490,25 +974,11 @@ bool BufferManager::restoreBuffer(
 
         if(notFailed)
         {
-            info.loaded = true;
-            info.fsFile.clear();
-            info.lastAccess.modified();
-
-            m_dumpPolicy->restoreSuccess(info, bufferPtr);
-
-            info.fileFormat     = core::memory::OTHER;
-            info.istreamFactory =
-                std::make_shared<core::memory::stream::in::Buffer>(
-                    *bufferPtr,
-                    allocSize,
-                    std::bind(
-                        &getLock,
-                        this->getSptr(),
-                        bufferPtr
-                    )
-                );
-            info.userStreamFactory = false;
-            m_updatedSig->asyncEmit();
+            ++m_ioStats.restoreCount;
+            m_ioStats.restoredBytes += std::min(allocSize, info.size);
+            m_ioStats.restoreTime   += core::HiResClock::getTimeInMicroSec() - start;
+
+            this->setRestored(info, bufferPtr, allocSize);
             return true;
         }
     }
@@ -518,6 +988,240 @@ bool BufferManager::restoreBuffer(
 
 //-----------------------------------------------------------------------------
 
+void BufferManager::setRestored(BufferInfo& info, BufferManager::BufferPtrType bufferPtr, SizeType size)
+{
+    info.loaded = true;
+    info.fsFile.clear();
+    info.lastAccess.modified();
+
+    m_dumpPolicy->restoreSuccess(info, bufferPtr);
+
+    info.fileFormat     = core::memory::OTHER;
+    info.istreamFactory =
+        std::make_shared<core::memory::stream::in::Buffer>(
+            *bufferPtr,
+            size,
+            std::bind(
+                &getLock,
+                this->getSptr(),
+                bufferPtr
+            )
+        );
+    info.userStreamFactory = false;
+    m_updatedSig->asyncEmit();
+}
+
+//-----------------------------------------------------------------------------
+
+std::shared_future<void> BufferManager::prefetchBuffer(BufferManager::ConstBufferPtrType bufferPtr)
+{
+    return m_worker->postTask<void>(std::bind(&BufferManager::prefetchBufferImpl, this, bufferPtr));
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::prefetchBufferImpl(BufferManager::ConstBufferPtrType bufferPtr)
+{
+    BufferInfoMapType::iterator iterInfo = m_bufferInfos.find(bufferPtr);
+    SIGHT_THROW_IF("Buffer is not managed by core::memory::BufferManager.", iterInfo == m_bufferInfos.end());
+    const BufferInfo& info = iterInfo->second;
+
+    if(info.loaded || !info.istreamFactory || m_pendingRestores.find(bufferPtr) != m_pendingRestores.end())
+    {
+        return;
+    }
+
+    m_pendingRestores[bufferPtr] = this->getPool().post(
+        &BufferManager::readDumpTask,
+        this,
+        bufferPtr,
+        info.istreamFactory,
+        info.size,
+        info.bufferPolicy
+    );
+}
+
+//------------------------------------------------------------------------------
+
+BufferManager::AsyncDump BufferManager::writeDumpTask(
+    BufferManager::ConstBufferPtrType bufferPtr,
+    BufferManager::ConstBufferType buffer,
+    SizeType size,
+    int level
+)
+{
+    const AsyncDump result = writeDump(buffer, size, level);
+
+    m_worker->post(std::bind(&BufferManager::finishDump, this, bufferPtr));
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+BufferManager::AsyncDump BufferManager::writeDump(BufferManager::ConstBufferType buffer, SizeType size, int level)
+{
+    const core::HiResClock::HiResClockType start = core::HiResClock::getTimeInMicroSec();
+
+    AsyncDump result;
+    result.format   = level > 0 ? core::memory::RAWZSTD : core::memory::RAW;
+    result.fileSize = 0;
+
+    const std::filesystem::path dumpedFile = std::filesystem::temp_directory_path()
+                                             / core::tools::System::genTempFileName();
+    try
+    {
+        result.fileSize = writeDumpFile(buffer, size, dumpedFile, level);
+        result.file     = core::memory::FileHolder(dumpedFile, true);
+    }
+    catch(const std::exception& e)
+    {
+        SIGHT_ERROR("Unable to dump the buffer : " << e.what());
+        std::error_code ec;
+        std::filesystem::remove(dumpedFile, ec);
+    }
+
+    result.time = core::HiResClock::getTimeInMicroSec() - start;
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+BufferManager::AsyncRestore BufferManager::readDumpTask(
+    BufferManager::ConstBufferPtrType bufferPtr,
+    SPTR(core::memory::stream::in::IFactory) factory,
+    SizeType size,
+    core::memory::BufferAllocationPolicy::sptr policy
+)
+{
+    const core::HiResClock::HiResClockType start = core::HiResClock::getTimeInMicroSec();
+
+    AsyncRestore result;
+    result.buffer = readDumpFile(factory, size, policy);
+    result.time   = core::HiResClock::getTimeInMicroSec() - start;
+
+    m_worker->post(std::bind(&BufferManager::finishRestore, this, bufferPtr));
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::finishDump(BufferManager::ConstBufferPtrType bufferPtr)
+{
+    const auto iter = m_pendingDumps.find(bufferPtr);
+    if(iter == m_pendingDumps.end())
+    {
+        // Already applied or canceled
+        return;
+    }
+
+    const AsyncDump result = iter->second.get();
+    m_pendingDumps.erase(iter);
+
+    BufferInfoMapType::iterator iterInfo = m_bufferInfos.find(bufferPtr);
+    if(result.file.empty() || iterInfo == m_bufferInfos.end())
+    {
+        return;
+    }
+
+    BufferInfo& info                          = iterInfo->second;
+    BufferManager::BufferPtrType castedBuffer = const_cast<BufferManager::BufferPtrType>(bufferPtr);
+    if(info.loaded && info.lockCount() == 0)
+    {
+        releaseBuffer(info, castedBuffer);
+        this->setDumped(info, castedBuffer, result.file, result.format);
+
+        ++m_ioStats.dumpCount;
+        m_ioStats.dumpedBytes   += info.size;
+        m_ioStats.dumpFileBytes += result.fileSize;
+        m_ioStats.dumpTime      += result.time;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::finishRestore(BufferManager::ConstBufferPtrType bufferPtr)
+{
+    const auto iter = m_pendingRestores.find(bufferPtr);
+    if(iter == m_pendingRestores.end())
+    {
+        // Already applied or canceled
+        return;
+    }
+
+    const AsyncRestore result = iter->second.get();
+    m_pendingRestores.erase(iter);
+
+    BufferInfoMapType::iterator iterInfo = m_bufferInfos.find(bufferPtr);
+    if(result.buffer == NULL || iterInfo == m_bufferInfos.end())
+    {
+        return;
+    }
+
+    BufferInfo& info = iterInfo->second;
+    BufferManager::BufferType buffer = result.buffer;
+    if(info.loaded)
+    {
+        info.bufferPolicy->destroy(buffer);
+        return;
+    }
+
+    BufferManager::BufferPtrType castedBuffer = const_cast<BufferManager::BufferPtrType>(bufferPtr);
+    *castedBuffer = buffer;
+
+    ++m_ioStats.restoreCount;
+    m_ioStats.restoredBytes += info.size;
+    m_ioStats.restoreTime   += result.time;
+
+    this->setRestored(info, castedBuffer, info.size);
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::cancelDump(BufferManager::ConstBufferPtrType bufferPtr)
+{
+    const auto iter = m_pendingDumps.find(bufferPtr);
+    if(iter != m_pendingDumps.end())
+    {
+        // The dump file is removed with the result
+        iter->second.wait();
+        m_pendingDumps.erase(iter);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::cancelRestore(BufferManager::ConstBufferPtrType bufferPtr)
+{
+    const auto iter = m_pendingRestores.find(bufferPtr);
+    if(iter != m_pendingRestores.end())
+    {
+        BufferManager::BufferType buffer = iter->second.get().buffer;
+        m_pendingRestores.erase(iter);
+
+        if(buffer != NULL)
+        {
+            m_bufferInfos[bufferPtr].bufferPolicy->destroy(buffer);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+core::thread::Pool& BufferManager::getPool()
+{
+    if(!m_pool)
+    {
+        m_pool = std::make_unique<core::thread::Pool>();
+    }
+
+    return *m_pool;
+}
+
+//-----------------------------------------------------------------------------
+
 std::shared_future<bool> BufferManager::writeBuffer(
     BufferManager::ConstBufferType buffer,
     SizeType size,
@@ -578,6 +1282,34 @@ bool BufferManager::readBufferImpl(BufferManager::BufferType buffer, SizeType si
 
 //-----------------------------------------------------------------------------
 
+std::shared_future<void> BufferManager::setBufferOwner(
+    BufferManager::ConstBufferPtrType bufferPtr,
+    const std::string& owner,
+    const std::string& ownerId
+)
+{
+    return m_worker->postTask<void>(std::bind(&BufferManager::setBufferOwnerImpl, this, bufferPtr, owner, ownerId));
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::setBufferOwnerImpl(
+    BufferManager::ConstBufferPtrType bufferPtr,
+    const std::string& owner,
+    const std::string& ownerId
+)
+{
+    const auto iter = m_bufferInfos.find(bufferPtr);
+    if(iter != m_bufferInfos.end())
+    {
+        iter->second.owner   = owner;
+        iter->second.ownerId = ownerId;
+        m_updatedSig->asyncEmit();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 std::shared_future<std::string> BufferManager::toString() const
 {
     return m_worker->postTask<std::string>(std::bind(&BufferManager::toStringImpl, this));
@@ -596,6 +1328,7 @@ std::string BufferManager::toStringImpl() const
     << std::setw(4) << "Lock" << " "
     << "DumpStatus" << " "
     << "File" << " "
+    << "Owner" << " "
     << std::endl;
     for(BufferInfoMapType::value_type item : m_bufferInfos)
     {
@@ -607,6 +1340,7 @@ std::string BufferManager::toStringImpl() const
         << std::setw(4) << info.lockCount() << " "
         << ((info.loaded) ? "   " : "not") << " loaded "
         << std::filesystem::path(info.fsFile) << " "
+        << info.owner << " "
         << std::endl;
     }
 
@@ -639,32 +1373,88 @@ std::shared_future<BufferManager::BufferInfoMapType> BufferManager::getBufferInf
 
 BufferManager::BufferInfoMapType BufferManager::getBufferInfosImpl() const
 {
-    return m_bufferInfos;
+    BufferInfoMapType bufferInfos = m_bufferInfos;
+
+    // The copies must not keep the shared memory alive, nor prevent the buffers from taking it back
+    for(BufferInfoMapType::value_type& item : bufferInfos)
+    {
+        item.second.sharedBuffer.reset();
+    }
+
+    return bufferInfos;
 }
 
 //-----------------------------------------------------------------------------
 
 std::shared_future<BufferManager::BufferStats> BufferManager::getBufferStats() const
 {
-    return m_worker->postTask<BufferManager::BufferStats>(
-        std::bind(&BufferManager::computeBufferStats, m_bufferInfos)
-    );
+    return m_worker->postTask<BufferManager::BufferStats>(std::bind(&BufferManager::getBufferStatsImpl, this));
+}
+
+//------------------------------------------------------------------------------
+
+BufferManager::BufferStats BufferManager::getBufferStatsImpl() const
+{
+    BufferStats stats = m_ioStats;
+
+    const BufferStats sizes = computeBufferStats(m_bufferInfos);
+    stats.totalDumped  = sizes.totalDumped;
+    stats.totalManaged = sizes.totalManaged;
+    stats.owners       = sizes.owners;
+
+    return stats;
+}
+
+//------------------------------------------------------------------------------
+
+std::shared_future<BufferManager::SizeType> BufferManager::getPendingDumpSize() const
+{
+    return m_worker->postTask<SizeType>(std::bind(&BufferManager::getPendingDumpSizeImpl, this));
+}
+
+//------------------------------------------------------------------------------
+
+BufferManager::SizeType BufferManager::getPendingDumpSizeImpl() const
+{
+    SizeType size = 0;
+    for(const auto& pendingDump : m_pendingDumps)
+    {
+        const auto iter = m_bufferInfos.find(pendingDump.first);
+        if(iter != m_bufferInfos.end())
+        {
+            size += iter->second.size;
+        }
+    }
+
+    return size;
 }
 
 //------------------------------------------------------------------------------
 
 BufferManager::BufferStats BufferManager::computeBufferStats(const BufferInfoMapType& bufferInfo)
 {
-    BufferStats stats = {0, 0};
+    BufferStats stats = {};
+    std::set<const void*> sharedBuffers;
     for(const BufferInfoMapType::value_type& item : bufferInfo)
     {
         const BufferInfo& info = item.second;
+        OwnerStats& ownerStats = stats.owners[info.owner];
+        ++ownerStats.count;
+
+        if(info.sharedBuffer && !sharedBuffers.insert(info.sharedBuffer.get()).second)
+        {
+            // Shared memory is accounted once, with the first buffer using it
+            continue;
+        }
+
         if(!info.loaded)
         {
-            stats.totalDumped += info.size;
+            stats.totalDumped      += info.size;
+            ownerStats.totalDumped += info.size;
         }
 
-        stats.totalManaged += info.size;
+        stats.totalManaged      += info.size;
+        ownerStats.totalManaged += info.size;
     }
 
     return stats;
@@ -776,4 +1566,60 @@ void BufferManager::setLoadingMode(LoadingModeType mode)
     m_loadingMode = mode;
 }
 
+//------------------------------------------------------------------------------
+
+BufferManager::DumpModeType BufferManager::getDumpMode() const
+{
+    return m_dumpMode;
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::setDumpMode(DumpModeType mode)
+{
+    m_dumpMode = mode;
+}
+
+//------------------------------------------------------------------------------
+
+BufferManager::SizeType BufferManager::getMappingThreshold() const
+{
+    return m_mappingThreshold;
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::setMappingThreshold(SizeType size)
+{
+    m_mappingThreshold = size;
+}
+
+//------------------------------------------------------------------------------
+
+int BufferManager::getDumpCompressionLevel() const
+{
+    return m_compressionLevel;
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::setDumpCompressionLevel(int level)
+{
+    m_compressionLevel = level;
+}
+
+//------------------------------------------------------------------------------
+
+bool BufferManager::isAsynchronousDump() const
+{
+    return m_asynchronousDump;
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManager::setAsynchronousDump(bool async)
+{
+    m_asynchronousDump = async;
+}
+
 } //namespace sight::core::memory
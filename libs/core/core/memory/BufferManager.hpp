@@ -32,10 +32,12 @@
 
 #include <filesystem>
 #include <future>
+#include <map>
 
 namespace sight::core::thread
 {
 
+class Pool;
 class Worker;
 
 }
@@ -104,10 +106,43 @@ public:
         LAZY
     } LoadingModeType;
 
+    typedef enum
+    {
+        COPY,
+        MAPPED
+    } DumpModeType;
+
+    struct OwnerStats
+    {
+        /// number of buffers tagged with this owner
+        std::size_t count;
+        SizeType totalDumped;
+        SizeType totalManaged;
+    };
+
+    typedef std::map<std::string, OwnerStats> OwnerStatsMapType;
+
     struct BufferStats
     {
         SizeType totalDumped;
         SizeType totalManaged;
+        /// number of buffers dumped and restored since the start
+        std::size_t dumpCount;
+        std::size_t restoreCount;
+        /// number of buffer bytes dumped and restored, and size of the written dump files
+        SizeType dumpedBytes;
+        SizeType restoredBytes;
+        SizeType dumpFileBytes;
+        /// cumulated time spent writing the dump files and reading them back, in microseconds
+        double dumpTime;
+        double restoreTime;
+        /// number of buffers allocated and freed since the start, and the corresponding bytes
+        std::size_t allocationCount;
+        std::size_t freeCount;
+        SizeType allocatedBytes;
+        SizeType freedBytes;
+        /// sizes of the buffers aggregated by owner, untagged buffers are gathered under an empty owner
+        OwnerStatsMapType owners;
     };
 
     struct StreamInfo
@@ -164,6 +199,26 @@ public:
         const core::memory::BufferAllocationPolicy::sptr& policy
     );
 
+    /**
+     * @brief Maps a part of a file as the buffer of a BufferObject
+     *
+     * The mapping is copy-on-write: the pages are read from the file when they are accessed and the modifications are
+     * never written to it. The file must not be modified while it is mapped.
+     *
+     * @param bufferPtr BufferObject's buffer pointer, the buffer must be empty
+     * @param file mapped file
+     * @param offset position of the buffer in the file
+     * @param size size of the buffer
+     * @param policy BufferObject's allocation policy, used if the buffer is reallocated
+     */
+    CORE_API std::shared_future<void> mapFile(
+        BufferPtrType bufferPtr,
+        const std::filesystem::path& file,
+        SizeType offset,
+        SizeType size,
+        const core::memory::BufferAllocationPolicy::sptr& policy
+    );
+
     /**
      * @brief Hook called when a reallocation is requested from a BufferObject
      *
@@ -187,6 +242,30 @@ public:
      */
     CORE_API virtual std::shared_future<void> swapBuffer(BufferPtrType bufA, BufferPtrType bufB);
 
+    /**
+     * @brief Makes a buffer share the memory of another one (copy-on-write)
+     *
+     * Both buffers use the same memory until one of them is unshared, i.e. when it is locked for writing. The source is
+     * restored if it is dumped. Nothing is done if the source memory can not be shared: locked buffer, external memory or
+     * mapped dump.
+     *
+     * @param bufferPtr BufferObject's buffer pointer, the buffer must be empty
+     * @param sourcePtr buffer pointer of the BufferObject to share
+     *
+     * @return true if the memory is shared
+     */
+    CORE_API std::shared_future<bool> shareBuffer(BufferPtrType bufferPtr, ConstBufferPtrType sourcePtr);
+
+    /**
+     * @brief Gives a buffer its own memory if it is shared with other buffers
+     *
+     * The buffer is copied if the memory is still used by another buffer, otherwise the buffer takes back the memory.
+     * The buffer address may change, thus it must not be called while the buffer is locked and used.
+     *
+     * @param bufferPtr BufferObject's buffer pointer
+     */
+    CORE_API std::shared_future<void> unshareBuffer(ConstBufferPtrType bufferPtr);
+
     /**
      * @brief Hook called when a BufferObject is locked
      *
@@ -205,6 +284,21 @@ public:
      */
     CORE_API virtual std::shared_future<bool> unlockBuffer(ConstBufferPtrType bufferPtr);
 
+    /**
+     * @brief Tags a buffer with the data that owns it
+     *
+     * The tag is kept when the buffer is reallocated, destroyed or swapped and is used to aggregate the statistics.
+     *
+     * @param bufferPtr BufferObject's buffer pointer
+     * @param owner class name of the owner, i.e. "sight::data::Image"
+     * @param ownerId optional identifier of the owner, i.e. its uuid or the uid of the service that created it
+     */
+    CORE_API std::shared_future<void> setBufferOwner(
+        ConstBufferPtrType bufferPtr,
+        const std::string& owner,
+        const std::string& ownerId = ""
+    );
+
     /**
      * @brief returns BufferManager status string
      */
@@ -217,12 +311,23 @@ public:
      *
      * @param bufferPtr Buffer to dump/restore
      *
-     * @return true on success
+     * @return true on success, i.e. once the buffer memory is released. An asynchronous dump returns false, the memory
+     * is released once its file is written, see getPendingDumpSize().
      * @{ */
     CORE_API std::shared_future<bool> dumpBuffer(ConstBufferPtrType bufferPtr);
     CORE_API std::shared_future<bool> restoreBuffer(ConstBufferPtrType bufferPtr);
     /**  @} */
 
+    /**
+     * @brief Starts restoring a dumped buffer in the background
+     *
+     * The buffer is read on the BufferManager thread pool, the next lock on this buffer then only waits for the end of
+     * the reading if it is not over yet. Nothing is done if the buffer is loaded or already being restored.
+     *
+     * @param bufferPtr Buffer to restore
+     */
+    CORE_API std::shared_future<void> prefetchBuffer(ConstBufferPtrType bufferPtr);
+
     /**
      * @brief Write/read a buffer
      *
@@ -265,8 +370,18 @@ public:
 
     /**
      * @brief Returns managed buffers statistics
+     *
+     * computeBufferStats() only fills the sizes of the given buffers, the dump, restore, allocation and free counters
+     * are zeroed.
      */
     CORE_API std::shared_future<BufferStats> getBufferStats() const;
+
+    /**
+     * @brief Returns the size of the buffers being dumped asynchronously
+     *
+     * Their memory is not released yet, it will be once their files are written unless they are locked meanwhile.
+     */
+    CORE_API std::shared_future<SizeType> getPendingDumpSize() const;
     CORE_API static BufferStats computeBufferStats(const BufferInfoMapType& bufferInfo);
 
     /**
@@ -296,6 +411,43 @@ public:
     CORE_API LoadingModeType getLoadingMode() const;
     CORE_API void setLoadingMode(LoadingModeType mode);
 
+    /**
+     * @brief Dump mode
+     *
+     * In COPY mode, a dumped buffer is entirely read back in a newly allocated memory when it is restored.
+     *
+     * In MAPPED mode, a dumped buffer whose size is at least the mapping threshold is restored by mapping its file in
+     * memory : the restoration is immediate and only the accessed pages are loaded. Dumping such a buffer again only
+     * unmaps the file, which already holds the data.
+     * @{ */
+    CORE_API DumpModeType getDumpMode() const;
+    CORE_API void setDumpMode(DumpModeType mode);
+    CORE_API SizeType getMappingThreshold() const;
+    CORE_API void setMappingThreshold(SizeType size);
+    /**  @} */
+
+    /**
+     * @brief Dump compression level
+     *
+     * With a level of 0, the dump files are written raw. Otherwise, they are compressed with Zstandard at the given
+     * level (1 to 19), which reduces the disk usage and the I/O. Compressed dumps are never restored by mapping.
+     * @{ */
+    CORE_API int getDumpCompressionLevel() const;
+    CORE_API void setDumpCompressionLevel(int level);
+    /**  @} */
+
+    /**
+     * @brief Asynchronous dump
+     *
+     * When enabled, the dump files are written on the BufferManager thread pool, so several buffers are compressed in
+     * parallel and the requests on the other buffers are not blocked. dumpBuffer() then returns false once the dump is
+     * started and the buffer memory is released when its file is written, the size of these pending dumps is returned
+     * by getPendingDumpSize(). The dump is dropped if the buffer is locked or modified in the meantime.
+     * @{ */
+    CORE_API bool isAsynchronousDump() const;
+    CORE_API void setAsynchronousDump(bool async);
+    /**  @} */
+
     /**
      * @brief Returns the current BufferManager instance
      * @note This method is thread-safe.
@@ -327,14 +479,27 @@ protected:
         SizeType size,
         const core::memory::BufferAllocationPolicy::sptr& policy
     );
+    void mapFileImpl(
+        BufferPtrType bufferPtr,
+        const std::filesystem::path& file,
+        SizeType offset,
+        SizeType size,
+        const core::memory::BufferAllocationPolicy::sptr& policy
+    );
     virtual void reallocateBufferImpl(BufferPtrType bufferPtr, SizeType newSize);
     virtual void destroyBufferImpl(BufferPtrType bufferPtr);
     virtual void swapBufferImpl(BufferPtrType bufA, BufferPtrType bufB);
+    bool shareBufferImpl(BufferPtrType bufferPtr, ConstBufferPtrType sourcePtr);
+    void unshareBufferImpl(ConstBufferPtrType bufferPtr);
     virtual SPTR(void) lockBufferImpl(ConstBufferPtrType bufferPtr);
     virtual bool unlockBufferImpl(ConstBufferPtrType bufferPtr);
+    void setBufferOwnerImpl(ConstBufferPtrType bufferPtr, const std::string& owner, const std::string& ownerId);
     virtual std::string toStringImpl() const;
     bool dumpBufferImpl(ConstBufferPtrType buffer);
     bool restoreBufferImpl(ConstBufferPtrType buffer);
+    void prefetchBufferImpl(ConstBufferPtrType bufferPtr);
+    BufferStats getBufferStatsImpl() const;
+    SizeType getPendingDumpSizeImpl() const;
     bool writeBufferImpl(ConstBufferType buffer, SizeType size, std::filesystem::path& path);
     bool readBufferImpl(BufferType buffer, SizeType size, std::filesystem::path& path);
     BufferInfoMapType getBufferInfosImpl() const;
@@ -358,6 +523,70 @@ protected:
     CORE_API bool restoreBuffer(BufferInfo& info, BufferPtrType bufferPtr, SizeType size = 0);
     /**  @} */
 
+    /// Result of a dump file written, possibly in the background
+    struct AsyncDump
+    {
+        core::memory::FileHolder file;
+        core::memory::FileFormatType format;
+        SizeType fileSize;
+        double time;
+    };
+
+    /// Result of a buffer read in the background
+    struct AsyncRestore
+    {
+        BufferType buffer;
+        double time;
+    };
+
+    /**
+     * @brief Background dump/restore tasks, run on the thread pool
+     * @{ */
+    AsyncDump writeDumpTask(ConstBufferPtrType bufferPtr, ConstBufferType buffer, SizeType size, int level);
+    AsyncRestore readDumpTask(
+        ConstBufferPtrType bufferPtr,
+        SPTR(core::memory::stream::in::IFactory) factory,
+        SizeType size,
+        core::memory::BufferAllocationPolicy::sptr policy
+    );
+    /**  @} */
+
+    /// Writes a buffer in a new dump file, compressed if the level is not null. The file is empty on failure.
+    static AsyncDump writeDump(ConstBufferType buffer, SizeType size, int level);
+
+    /**
+     * @brief Applies the background dump/restore of a buffer, waiting for it if it is not over
+     * @{ */
+    void finishDump(ConstBufferPtrType bufferPtr);
+    void finishRestore(ConstBufferPtrType bufferPtr);
+    /**  @} */
+
+    /**
+     * @brief Waits for the background dump/restore of a buffer and drops it
+     *
+     * Called before any operation that accesses or frees the buffer memory.
+     * @{ */
+    void cancelDump(ConstBufferPtrType bufferPtr);
+    void cancelRestore(ConstBufferPtrType bufferPtr);
+    /**  @} */
+
+    /// Frees the memory of a loaded buffer, shared memory is only freed with its last buffer
+    static void releaseBuffer(BufferInfo& info, BufferPtrType bufferPtr);
+
+    /// Marks a buffer as dumped in the given file, once its memory is released
+    void setDumped(
+        BufferInfo& info,
+        BufferPtrType bufferPtr,
+        const core::memory::FileHolder& file,
+        core::memory::FileFormatType format
+    );
+
+    /// Marks a buffer as restored, once its memory is filled
+    void setRestored(BufferInfo& info, BufferPtrType bufferPtr, SizeType size);
+
+    /// Returns the thread pool used to dump and restore in the background, created on first use
+    core::thread::Pool& getPool();
+
     SPTR(UpdatedSignalType) m_updatedSig;
 
     core::LogicStamp m_lastAccess;
@@ -367,8 +596,27 @@ protected:
 
     LoadingModeType m_loadingMode;
 
+    DumpModeType m_dumpMode;
+
+    /// Minimum size of the buffers restored by mapping their file, in MAPPED dump mode
+    SizeType m_mappingThreshold;
+
+    int m_compressionLevel;
+
+    bool m_asynchronousDump;
+
+    /// Dump and restore counters, the buffer sizes are not used
+    BufferStats m_ioStats;
+
+    /// Dumps and restores running in the background
+    std::map<ConstBufferPtrType, std::shared_future<AsyncDump> > m_pendingDumps;
+    std::map<ConstBufferPtrType, std::shared_future<AsyncRestore> > m_pendingRestores;
+
     SPTR(core::thread::Worker) m_worker;
 
+    /// Runs the background tasks, declared after the worker so that it is joined first
+    std::unique_ptr<core::thread::Pool> m_pool;
+
     /// Mutex to protect concurrent access in BufferManager
     mutable core::mt::ReadWriteMutex m_mutex;
 };
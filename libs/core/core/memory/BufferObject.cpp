@@ -24,6 +24,8 @@
 
 #include "core/memory/BufferObject.hpp"
 
+#include <cstring>
+
 namespace scm = sight::core::memory;
 
 SIGHT_IMPLEMENT_REFLECTION((sight) (core) (memory) (BufferObject))
@@ -39,6 +41,7 @@ namespace sight::core::memory
 BufferObject::BufferObject() :
     m_buffer(0),
     m_size(0),
+    m_shared(false),
     m_bufferManager(core::memory::BufferManager::getDefault()),
     m_allocPolicy(core::memory::BufferNoAllocPolicy::New())
 {
@@ -61,6 +64,7 @@ void BufferObject::allocate(SizeType size, const core::memory::BufferAllocationP
     m_bufferManager->allocateBuffer(&m_buffer, size, policy).get();
     m_allocPolicy = policy;
     m_size        = size;
+    this->sendOwner();
 }
 
 //------------------------------------------------------------------------------
@@ -68,7 +72,8 @@ void BufferObject::allocate(SizeType size, const core::memory::BufferAllocationP
 void BufferObject::reallocate(SizeType size)
 {
     m_bufferManager->reallocateBuffer(&m_buffer, size).get();
-    m_size = size;
+    m_size   = size;
+    m_shared = false;
 }
 
 //------------------------------------------------------------------------------
@@ -78,6 +83,77 @@ void BufferObject::destroy()
     m_bufferManager->destroyBuffer(&m_buffer).get();
     m_allocPolicy = core::memory::BufferNoAllocPolicy::New();
     m_size        = 0;
+    m_shared      = false;
+}
+
+//------------------------------------------------------------------------------
+
+void BufferObject::prefetch() const
+{
+    m_bufferManager->prefetchBuffer(&m_buffer);
+}
+
+//------------------------------------------------------------------------------
+
+void BufferObject::share(const BufferObject::csptr& source)
+{
+    SIGHT_ASSERT("The buffer must be empty to share another one", this->isEmpty());
+
+    if(source->isEmpty())
+    {
+        return;
+    }
+
+    bool shared = false;
+    if(m_bufferManager == source->m_bufferManager)
+    {
+        core::mt::ScopedLock lock(source->m_lockDumpMutex);
+        shared           = m_bufferManager->shareBuffer(&m_buffer, &(source->m_buffer)).get();
+        source->m_shared = source->m_shared || shared;
+    }
+
+    if(shared)
+    {
+        m_allocPolicy = source->m_allocPolicy;
+        m_size        = source->m_size;
+        m_shared      = true;
+        this->sendOwner();
+    }
+    else
+    {
+        ConstLock lockSource(source);
+        this->allocate(source->getSize());
+        Lock lockDest(this->getSptr());
+        std::memcpy(lockDest.getBuffer(), lockSource.getBuffer(), source->getSize());
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void BufferObject::setOwner(const std::string& owner, const std::string& ownerId)
+{
+    if(owner != m_owner || ownerId != m_ownerId)
+    {
+        m_owner     = owner;
+        m_ownerId   = ownerId;
+        m_ownerSent = false;
+    }
+
+    if(!this->isEmpty())
+    {
+        this->sendOwner();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void BufferObject::sendOwner()
+{
+    if(!m_ownerSent && !m_owner.empty())
+    {
+        m_bufferManager->setBufferOwner(&m_buffer, m_owner, m_ownerId);
+        m_ownerSent = true;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -91,6 +167,22 @@ void BufferObject::setBuffer(
     m_bufferManager->setBuffer(&m_buffer, buffer, size, policy).get();
     m_allocPolicy = policy;
     m_size        = size;
+    this->sendOwner();
+}
+
+//------------------------------------------------------------------------------
+
+void BufferObject::mapFile(
+    const std::filesystem::path& file,
+    SizeType offset,
+    SizeType size,
+    const core::memory::BufferAllocationPolicy::sptr& policy
+)
+{
+    m_bufferManager->mapFile(&m_buffer, file, offset, size, policy).get();
+    m_allocPolicy = policy;
+    m_size        = size;
+    this->sendOwner();
 }
 
 //------------------------------------------------------------------------------
@@ -114,8 +206,20 @@ void BufferObject::swap(const BufferObject::sptr& _source)
     m_bufferManager->swapBuffer(&m_buffer, &(_source->m_buffer)).get();
 
     std::swap(m_size, _source->m_size);
+    std::swap(m_shared, _source->m_shared);
     m_bufferManager.swap(_source->m_bufferManager);
     m_allocPolicy.swap(_source->m_allocPolicy);
+
+    // The owners stay with the buffer objects, they are sent if the buffers have just been assigned
+    if(!this->isEmpty())
+    {
+        this->sendOwner();
+    }
+
+    if(!_source->isEmpty())
+    {
+        _source->sendOwner();
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -138,6 +242,7 @@ void BufferObject::setIStreamFactory(
     m_size        = size;
     m_allocPolicy = policy;
     m_bufferManager->setIStreamFactory(&m_buffer, factory, size, sourceFile, format, policy).get();
+    this->sendOwner();
 }
 
 } //namespace sight::core::memory
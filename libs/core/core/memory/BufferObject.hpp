@@ -97,6 +97,9 @@ public:
      * This class purpose is to provide a way to count buffer uses, to prevent
      * BufferManager changes on buffer if nb uses > 0
      *
+     * A Lock gives a write access: a buffer sharing its memory (see share()) is
+     * copied first. A ConstLock keeps the memory shared.
+     *
      * The count is shared with the associated BufferObject. Be aware that this
      * mechanism is actually not thread-safe.
      *
@@ -128,6 +131,16 @@ public:
             SIGHT_ASSERT("Can't lock NULL object", bo);
 
             core::mt::ScopedLock lock(bo->m_lockDumpMutex);
+            if constexpr(!std::is_const<T>::value)
+            {
+                if(bo->m_shared)
+                {
+                    // The buffer may be modified, it stops sharing its memory with the other BufferObjects
+                    bo->m_bufferManager->unshareBuffer(&(bo->m_buffer)).get();
+                    bo->m_shared = false;
+                }
+            }
+
             m_count = bo->m_count.lock();
             if(!m_count)
             {
@@ -136,6 +149,16 @@ public:
             }
         }
 
+        /**
+         * @brief Build a read lock from a write lock, both hold the same count.
+         */
+        template<typename U, typename = std::enable_if_t<std::is_same_v<const U, T> && !std::is_same_v<U, T> > >
+        LockBase(const LockBase<U>& other) :
+            m_count(other.m_count),
+            m_bufferObject(other.m_bufferObject)
+        {
+        }
+
         /**
          * @brief Returns BufferObject's buffer pointer
          */
@@ -157,6 +180,9 @@ public:
 
     protected:
 
+        template<typename U>
+        friend class LockBase;
+
         BufferObject::CounterType m_count;
         WPTR(T) m_bufferObject;
     };
@@ -191,13 +217,13 @@ public:
      * The allocation may have been hooked by the buffer manager.
      *
      * @param size number of bytes to allocate
-     * @param policy Buffer allocation policy, default is Malloc policy
+     * @param policy Buffer allocation policy, default is BufferAllocationPolicy::getDefault()
      *
      */
     CORE_API virtual void allocate(
         SizeType size,
         const core::memory::BufferAllocationPolicy::sptr& policy =
-        core::memory::BufferMallocPolicy::New()
+        core::memory::BufferAllocationPolicy::getDefault()
     );
 
     /**
@@ -221,6 +247,41 @@ public:
      */
     CORE_API virtual void destroy();
 
+    /**
+     * @brief Starts restoring the buffer in the background if it is dumped
+     *
+     * Useful when the buffer is about to be used, the next lock then does not have to wait for the whole reading.
+     */
+    CORE_API void prefetch() const;
+
+    /**
+     * @brief Shares the buffer of another BufferObject (copy-on-write)
+     *
+     * Both BufferObjects use the same memory until one of them is locked for writing with a Lock, this one then gets
+     * its own copy. The buffer is simply copied if the source memory can not be shared (locked, external or mapped).
+     * A Lock must not be requested while a ConstLock on the same BufferObject is used, since the buffer may move.
+     *
+     * @param source BufferObject to share, this buffer must be empty
+     */
+    CORE_API void share(const BufferObject::csptr& source);
+
+    /**
+     * @brief Tags the buffer with the data that owns it
+     *
+     * The BufferManager aggregates its memory statistics by owner. The tag is only sent to the BufferManager once the
+     * buffer is assigned (allocated, shared, mapped...), it can thus be changed freely beforehand.
+     *
+     * @param owner class name of the owner, i.e. "sight::data::Image"
+     * @param ownerId optional identifier of the owner, i.e. its uuid
+     */
+    CORE_API void setOwner(const std::string& owner, const std::string& ownerId = "");
+
+    /// Returns the class name of the data that owns the buffer, empty if it is not tagged
+    const std::string& getOwner() const
+    {
+        return m_owner;
+    }
+
     /**
      * @brief Buffer setter
      *
@@ -238,6 +299,28 @@ public:
         core::memory::BufferMallocPolicy::New()
     );
 
+    /**
+     * @brief Maps a part of a file as the buffer
+     *
+     * The pixels or elements are read from the file by the system when they are accessed, without any allocation nor
+     * copy. The mapping is copy-on-write, the modifications of the buffer are never written to the file. The file must
+     * not be modified nor truncated as long as it is mapped.
+     *
+     * @param file mapped file, it must be at least 'offset + size' bytes long
+     * @param offset position of the buffer in the file
+     * @param size buffer's size
+     * @param policy Buffer allocation policy used if the buffer is reallocated, default is
+     * BufferAllocationPolicy::getDefault()
+     * @throw core::memory::exception::Memory if the file can not be mapped
+     */
+    CORE_API void mapFile(
+        const std::filesystem::path& file,
+        SizeType offset,
+        SizeType size,
+        const core::memory::BufferAllocationPolicy::sptr& policy =
+        core::memory::BufferAllocationPolicy::getDefault()
+    );
+
     /**
      * @brief Return a lock on the BufferObject
      *
@@ -319,7 +402,7 @@ public:
         SizeType size,
         const std::filesystem::path& sourceFile                  = "",
         core::memory::FileFormatType format                      = core::memory::OTHER,
-        const core::memory::BufferAllocationPolicy::sptr& policy = core::memory::BufferMallocPolicy::New()
+        const core::memory::BufferAllocationPolicy::sptr& policy = core::memory::BufferAllocationPolicy::getDefault()
     );
 
 protected:
@@ -330,11 +413,26 @@ protected:
 
     mutable WeakCounterType m_count;
     mutable core::mt::Mutex m_lockDumpMutex;
+
+    /// true if the memory may be shared with other BufferObjects, protected by m_lockDumpMutex
+    mutable bool m_shared;
     core::mt::ReadWriteMutex m_mutex;
 
     core::memory::BufferManager::sptr m_bufferManager;
 
     core::memory::BufferAllocationPolicy::sptr m_allocPolicy;
+
+private:
+
+    /// Sends the owner to the BufferManager, if it has not been sent yet
+    void sendOwner();
+
+    /// Owner of the buffer and its optional identifier, see setOwner()
+    std::string m_owner;
+    std::string m_ownerId;
+
+    /// true once the owner has been sent to the BufferManager
+    bool m_ownerSent {false};
 };
 
 } // namespace sight::core
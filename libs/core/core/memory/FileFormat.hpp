@@ -27,9 +27,10 @@ namespace sight::core::memory
 
 typedef enum
 {
-    OTHER = 0,
-    RAW   = 1,
-    RAWZ  = 1 << 2
+    OTHER   = 0,
+    RAW     = 1,
+    RAWZ    = 1 << 2,
+    RAWZSTD = 1 << 3
 } FileFormatType;
 
 } // namespace sight::core::memory
@@ -57,6 +57,13 @@ protected:
      * This allow locking of complex object with several BufferObject
      */
     CORE_API virtual void lockBuffer(std::vector<core::memory::BufferObject::Lock>& locks) const = 0;
+
+    /**
+     * @brief Must allocate a core::memory::BufferObject::ConstLock and store it into the vector parameter
+     *
+     * Used to lock a const object, the buffers shared with other objects (copy-on-write) stay shared.
+     */
+    CORE_API virtual void lockBuffer(std::vector<core::memory::BufferObject::ConstLock>& locks) const = 0;
 };
 
 }
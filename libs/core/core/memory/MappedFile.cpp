@@ -0,0 +1,98 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "core/memory/MappedFile.hpp"
+
+#include "core/memory/ByteSize.hpp"
+#include "core/memory/exception/Memory.hpp"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <system_error>
+
+namespace sight::core::memory
+{
+
+//------------------------------------------------------------------------------
+
+MappedFile::MappedFile(const FileHolder& file, SizeType size, SizeType offset, bool copyOnWrite) :
+    m_file(file),
+    m_size(size),
+    m_copyOnWrite(copyOnWrite)
+{
+    namespace ipc = boost::interprocess;
+
+    // Accessing a mapped page beyond the end of the file is a fatal error
+    const std::filesystem::path path = file;
+    std::error_code error;
+    const std::uintmax_t fileSize = std::filesystem::file_size(path, error);
+    if(error || fileSize < offset + size)
+    {
+        SIGHT_THROW_EXCEPTION_MSG(
+            core::memory::exception::Memory,
+            "Cannot map " << file.string() << " (" << core::memory::ByteSize(core::memory::ByteSize::SizeType(size))
+            << " at offset " << offset << "): the file is too small"
+        );
+    }
+
+    try
+    {
+        // A copy-on-write mapping only needs to read the file
+        m_mapping = std::make_unique<ipc::file_mapping>(
+            path.string().c_str(),
+            copyOnWrite ? ipc::read_only : ipc::read_write
+        );
+        m_region = std::make_unique<ipc::mapped_region>(
+            *m_mapping,
+            copyOnWrite ? ipc::copy_on_write : ipc::read_write,
+            static_cast<ipc::offset_t>(offset),
+            size
+        );
+    }
+    catch(const ipc::interprocess_exception& e)
+    {
+        SIGHT_THROW_EXCEPTION_MSG(
+            core::memory::exception::Memory,
+            "Cannot map " << file.string() << " ("
+            << core::memory::ByteSize(core::memory::ByteSize::SizeType(size)) << "): " << e.what()
+        );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+MappedFile::~MappedFile()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void* MappedFile::getBuffer() const
+{
+    return m_region->get_address();
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::core::memory
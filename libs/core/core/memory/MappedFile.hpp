@@ -0,0 +1,100 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "core/config.hpp"
+#include "core/memory/FileHolder.hpp"
+#include <core/macros.hpp>
+
+#include <memory>
+
+namespace boost::interprocess
+{
+
+class file_mapping;
+class mapped_region;
+
+}
+
+namespace sight::core::memory
+{
+
+/**
+ * @brief Maps a file in memory, in read/write or copy-on-write mode.
+ *
+ * The pages of the file are only loaded when they are accessed. In read/write mode, the system writes the modified
+ * pages back to the file, so it can evict them under memory pressure. In copy-on-write mode, the file is only read and
+ * the modified pages are private copies, thus a file owned by the user can be mapped without ever being altered. The
+ * file is kept as long as the mapping exists.
+ */
+class CORE_CLASS_API MappedFile
+{
+public:
+
+    typedef SPTR(MappedFile) sptr;
+    typedef std::size_t SizeType;
+
+    /**
+     * @brief Maps a part of a file.
+     * @param file file to map, it must be at least 'offset + size' bytes long
+     * @param size number of bytes to map
+     * @param offset position of the first mapped byte in the file, it does not need to be aligned on a page
+     * @param copyOnWrite if true, the modifications are kept in memory and are never written to the file
+     * @throw core::memory::exception::Memory if the file can not be mapped
+     */
+    CORE_API MappedFile(const FileHolder& file, SizeType size, SizeType offset = 0, bool copyOnWrite = false);
+
+    /// Unmaps the file.
+    CORE_API ~MappedFile();
+
+    /// Returns the address of the mapped file.
+    CORE_API void* getBuffer() const;
+
+    /// Returns the number of mapped bytes.
+    SizeType getSize() const
+    {
+        return m_size;
+    }
+
+    /// Returns the mapped file.
+    const FileHolder& getFile() const
+    {
+        return m_file;
+    }
+
+    /// Returns true if the modifications are not written to the file.
+    bool isCopyOnWrite() const
+    {
+        return m_copyOnWrite;
+    }
+
+private:
+
+    FileHolder m_file;
+    SizeType m_size;
+    bool m_copyOnWrite;
+
+    std::unique_ptr<boost::interprocess::file_mapping> m_mapping;
+    std::unique_ptr<boost::interprocess::mapped_region> m_region;
+};
+
+} // namespace sight::core::memory
@@ -166,14 +166,22 @@ size_t ValveDump::dump(size_t nbOfBytes)
             }
         }
 
+        // The buffers being dumped asynchronously release their memory once their file is written, they are not
+        // dumped again nor counted as dumped, but they reduce the number of bytes left to dump
+        std::size_t pending = manager->getPendingDumpSize().get();
+
         for(const BufferVectorType::value_type& pair : bufferInfos)
         {
-            if(dumped < nbOfBytes)
+            if(dumped + pending < nbOfBytes)
             {
                 if(manager->dumpBuffer(pair.first).get())
                 {
                     dumped += pair.second.size;
                 }
+                else if(manager->isAsynchronousDump())
+                {
+                    pending = manager->getPendingDumpSize().get();
+                }
             }
             else
             {
@@ -0,0 +1,76 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "core/memory/stream/in/RawZstd.hpp"
+
+#include <core/macros.hpp>
+
+#include <boost/iostreams/filter/zstd.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+namespace sight::core::memory
+{
+
+namespace stream
+{
+
+namespace in
+{
+
+struct ZstdFilteringStream : ::boost::iostreams::filtering_istream
+{
+    ~ZstdFilteringStream()
+    {
+        try
+        {
+            this->reset();
+        }
+        catch(...)
+        {
+        }
+    }
+
+    SPTR(void) heldStream;
+};
+
+SPTR(std::istream) RawZstd::get()
+{
+    SPTR(std::ifstream) fs =
+        std::make_shared<std::ifstream>(m_path, std::ios::in | std::ios::binary);
+
+    SPTR(ZstdFilteringStream) filter = std::make_shared<ZstdFilteringStream>();
+
+    filter->heldStream = fs;
+
+    filter->push(::boost::iostreams::zstd_decompressor());
+    filter->push(*fs);
+
+    return filter;
+}
+
+} // namespace in
+
+} // namespace stream
+
+} // namespace sight::core::memory
@@ -34,9 +34,10 @@
  * -# Debug
  * -# Trace
  *
- * Log level is set by defining SPYLOG_LEVEL to N where 0 < N <= 6. If log
- * level is set to N, every log level lesser than N will be enabled, the other
- * macro will be define but won't have any effect.
+ * Log level is set by defining SPYLOG_LEVEL to N where 0 < N <= 6 (6 by default,
+ * see the SIGHT_LOG_LEVEL CMake option). If log level is set to N, every log
+ * level lesser than or equal to N will be enabled, the other macros will be
+ * defined but won't have any effect. Fatal messages are always enabled.
  *
  * Each log level macro can accept strings or stringstreams:
  *   - Example : SIGHT_INFO( "Count : " << i );
@@ -98,20 +99,30 @@
 
 // -----------------------------------------------------------------------------
 
-#define SL_TRACE(log, message) SL_LOG(log, trace, message);
-#define SL_TRACE_IF(log, message, cond) __FWCORE_IF(cond, SL_LOG(log, trace, message); )
+// Messages of a level above SPYLOG_LEVEL are discarded at compile time. They are still parsed, so that the variables
+// only used in log messages do not trigger warnings.
+# ifndef SPYLOG_LEVEL
+#  define SPYLOG_LEVEL 6
+# endif
+
+# define __SL_LEVEL_LOG(level, log, loglevel, message) __FWCORE_EXPR_BLOCK( \
+        if constexpr(SPYLOG_LEVEL >= level){SL_LOG(log, loglevel, message); } \
+)
+
+#define SL_TRACE(log, message) __SL_LEVEL_LOG(6, log, trace, message);
+#define SL_TRACE_IF(log, message, cond) __FWCORE_IF(cond, __SL_LEVEL_LOG(6, log, trace, message); )
 
-#define SL_DEBUG(log, message) SL_LOG(log, debug, message);
-#define SL_DEBUG_IF(log, message, cond) __FWCORE_IF(cond, SL_LOG(log, debug, message); )
+#define SL_DEBUG(log, message) __SL_LEVEL_LOG(5, log, debug, message);
+#define SL_DEBUG_IF(log, message, cond) __FWCORE_IF(cond, __SL_LEVEL_LOG(5, log, debug, message); )
 
-#define SL_INFO(log, message) SL_LOG(log, info, message);
-#define SL_INFO_IF(log, message, cond) __FWCORE_IF(cond, SL_LOG(log, info, message); )
+#define SL_INFO(log, message) __SL_LEVEL_LOG(4, log, info, message);
+#define SL_INFO_IF(log, message, cond) __FWCORE_IF(cond, __SL_LEVEL_LOG(4, log, info, message); )
 
-#define SL_WARN(log, message) SL_LOG(log, warn, message);
-#define SL_WARN_IF(log, message, cond) __FWCORE_IF(cond, SL_LOG(log, warn, message); )
+#define SL_WARN(log, message) __SL_LEVEL_LOG(3, log, warn, message);
+#define SL_WARN_IF(log, message, cond) __FWCORE_IF(cond, __SL_LEVEL_LOG(3, log, warn, message); )
 
-#define SL_ERROR(log, message) SL_LOG(log, error, message);
-#define SL_ERROR_IF(log, message, cond) __FWCORE_IF(cond, SL_LOG(log, error, message); )
+#define SL_ERROR(log, message) __SL_LEVEL_LOG(2, log, error, message);
+#define SL_ERROR_IF(log, message, cond) __FWCORE_IF(cond, __SL_LEVEL_LOG(2, log, error, message); )
 
 #define SL_FATAL(log, message) SL_LOG(log, fatal, message); \
     SPYLOG_ABORT();
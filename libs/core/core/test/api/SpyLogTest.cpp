@@ -31,6 +31,7 @@
 #include <boost/algorithm/string/regex.hpp>
 #include <boost/algorithm/string/regex_find_format.hpp>
 
+#include <algorithm>
 #include <exception>
 #include <iostream>
 #include <regex>
@@ -54,13 +55,16 @@ static utest::Exception e("");
 void SpyLogTest::setUp()
 {
     core::log::SpyLogger& log = core::log::SpyLogger::getSpyLogger();
-    log.addStreamAppender(m_ostream);
+    m_appenderId = log.addStreamAppender(m_ostream);
 }
 
 //-----------------------------------------------------------------------------
 
 void SpyLogTest::tearDown()
 {
+    core::log::SpyLogger& log = core::log::SpyLogger::getSpyLogger();
+    log.removeAppender(m_appenderId);
+    log.setAsynchronous(false);
 }
 
 //-----------------------------------------------------------------------------
@@ -178,6 +182,125 @@ void SpyLogTest::threadSafetyTest()
 
 //-----------------------------------------------------------------------------
 
+void SpyLogTest::asynchronousTest()
+{
+    core::log::SpyLogger& log = core::log::SpyLogger::getSpyLogger();
+    log.setAsynchronous(true, 16, core::log::SpyLogger::OverflowPolicy::BLOCK);
+    CPPUNIT_ASSERT(log.isAsynchronous());
+
+    std::stringstream stream;
+    const auto appenderId = log.addStreamAppender(stream);
+
+    const size_t NB_THREAD(20);
+    const size_t NB_LOG(20);
+    LogProducerThread::LogContainerType logs(NB_THREAD * NB_LOG, "test");
+    std::vector<std::thread> tg;
+    for(size_t i = 0 ; i < NB_THREAD ; ++i)
+    {
+        LogProducerThread::sptr ct = std::make_shared<LogProducerThread>();
+        size_t offset              = i * NB_LOG;
+        tg.push_back(std::thread(std::bind(&LogProducerThread::run, ct, std::ref(logs), NB_LOG, offset)));
+    }
+
+    for(auto& t : tg)
+    {
+        t.join();
+    }
+
+    // The fatal messages are flushed immediately, no message can be lost with the blocking policy
+    LogProducerThread::LogContainerType logMessages = this->logToVector(stream);
+    std::sort(logMessages.begin(), logMessages.end(), regex_compare);
+    this->checkLog(logs, logMessages);
+
+    log.removeAppender(appenderId);
+
+    // The stream must not be modified anymore once the appender is removed
+    log.info("not logged", __FILE__, __LINE__);
+    log.flush();
+    CPPUNIT_ASSERT_EQUAL(logs.size(), this->logToVector(stream).size());
+}
+
+//-----------------------------------------------------------------------------
+
+void SpyLogTest::overflowTest()
+{
+    core::log::SpyLogger& log = core::log::SpyLogger::getSpyLogger();
+    log.setAsynchronous(true, 2, core::log::SpyLogger::OverflowPolicy::COUNT);
+
+    std::stringstream stream;
+    const auto appenderId = log.addStreamAppender(stream);
+
+    const std::uint64_t droppedCount = log.getDroppedCount();
+
+    const size_t NB_LOG(1000);
+    for(size_t i = 0 ; i < NB_LOG ; ++i)
+    {
+        log.info("overflow message", __FILE__, __LINE__);
+    }
+
+    log.flush();
+
+    // Each message is either written or counted as dropped
+    const size_t nbWritten = this->logToVector(stream).size();
+    CPPUNIT_ASSERT_EQUAL(NB_LOG, nbWritten + static_cast<size_t>(log.getDroppedCount() - droppedCount));
+
+    log.removeAppender(appenderId);
+}
+
+//-----------------------------------------------------------------------------
+
+void SpyLogTest::asynchronousOrderTest()
+{
+    core::log::SpyLogger& log = core::log::SpyLogger::getSpyLogger();
+    log.setAsynchronous(true, 64, core::log::SpyLogger::OverflowPolicy::BLOCK);
+
+    std::stringstream stream;
+    const auto appenderId = log.addStreamAppender(stream);
+
+    const size_t NB_THREAD(4);
+    const size_t NB_LOG(500);
+    std::vector<std::thread> tg;
+    for(size_t i = 0 ; i < NB_THREAD ; ++i)
+    {
+        tg.push_back(
+            std::thread(
+                [&log, i]
+            {
+                for(size_t j = 0 ; j < NB_LOG ; ++j)
+                {
+                    log.info("thread " + std::to_string(i) + " message " + std::to_string(j), __FILE__, __LINE__);
+                }
+            }));
+    }
+
+    for(auto& t : tg)
+    {
+        t.join();
+    }
+
+    // All the messages are written once the appender is removed
+    log.removeAppender(appenderId);
+
+    const std::vector<std::string> logMessages = this->logToVector(stream);
+    CPPUNIT_ASSERT_EQUAL(NB_THREAD * NB_LOG, logMessages.size());
+
+    // The messages of each thread are written in the order they were logged
+    const std::regex re(".*thread ([0-9]+) message ([0-9]+)$");
+    std::vector<size_t> nextMessage(NB_THREAD, 0);
+    for(const std::string& message : logMessages)
+    {
+        std::smatch match;
+        CPPUNIT_ASSERT_MESSAGE(message + " doesn't match regex.", std::regex_match(message, match, re));
+
+        const size_t thread = std::stoul(match[1].str());
+        CPPUNIT_ASSERT(thread < NB_THREAD);
+        CPPUNIT_ASSERT_EQUAL(nextMessage[thread], static_cast<size_t>(std::stoul(match[2].str())));
+        ++nextMessage[thread];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 std::vector<std::string> SpyLogTest::logToVector(const std::stringstream& logsStream)
 {
     std::vector<std::string> lines;
@@ -22,9 +22,12 @@
 
 #pragma once
 
+#include <core/log/SpyLogger.hpp>
+
 #include <cppunit/extensions/HelperMacros.h>
 
 #include <sstream>
+#include <vector>
 
 namespace sight::core
 {
@@ -37,6 +40,9 @@ class SpyLogTest : public CPPUNIT_NS::TestFixture
 CPPUNIT_TEST_SUITE(SpyLogTest);
 CPPUNIT_TEST(logMessageTest);
 CPPUNIT_TEST(threadSafetyTest);
+CPPUNIT_TEST(asynchronousTest);
+CPPUNIT_TEST(overflowTest);
+CPPUNIT_TEST(asynchronousOrderTest);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -47,6 +53,9 @@ public:
 
     void logMessageTest();
     void threadSafetyTest();
+    void asynchronousTest();
+    void overflowTest();
+    void asynchronousOrderTest();
 
 private:
 
@@ -54,6 +63,8 @@ private:
     void checkLog(const std::vector<std::string>& logMessagesRef, const std::vector<std::string>& logMessages);
 
     std::stringstream m_ostream;
+
+    core::log::SpyLogger::AppenderIdType m_appenderId {0};
 };
 
 } //namespace ut
@@ -129,6 +129,33 @@ void LoggerTest::simpleLoggerTest()
     CPPUNIT_ASSERT_EQUAL(std::size_t(0), logger->count());
 }
 
+//-----------------------------------------------------------------------------
+
+void LoggerTest::appendLoggerTest()
+{
+    core::log::Logger::sptr logger = core::log::Logger::New();
+    core::log::Logger::sptr other  = core::log::Logger::New();
+
+    const std::string info     = "This is an information message.";
+    const std::string warning  = "This is a warning message.";
+    const std::string critical = "This is a critical message.";
+
+    logger->information(info);
+    other->critical(critical);
+    other->warning(warning);
+
+    logger->append(*other);
+
+    // The appended logs are copied after the existing ones, in their order
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), logger->count());
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), other->count());
+    CPPUNIT_ASSERT_EQUAL(info, logger->getLog(0).getMessage());
+    CPPUNIT_ASSERT_EQUAL(critical, logger->getLog(1).getMessage());
+    CPPUNIT_ASSERT_EQUAL(warning, logger->getLog(2).getMessage());
+    CPPUNIT_ASSERT_EQUAL(core::log::Log::CRITICAL, logger->getLog(1).getLevel());
+    CPPUNIT_ASSERT_EQUAL(core::log::Log::WARNING, logger->getLog(2).getLevel());
+}
+
 //------------------------------------------------------------------------------
 
 } // namespace ut
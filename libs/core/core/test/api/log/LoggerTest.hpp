@@ -34,6 +34,7 @@ class LoggerTest : public CPPUNIT_NS::TestFixture
 {
 CPPUNIT_TEST_SUITE(LoggerTest);
 CPPUNIT_TEST(simpleLoggerTest);
+CPPUNIT_TEST(appendLoggerTest);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -43,6 +44,7 @@ public:
     void tearDown();
 
     void simpleLoggerTest();
+    void appendLoggerTest();
 };
 
 } // namespace ut
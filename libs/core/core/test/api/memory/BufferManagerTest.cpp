@@ -24,9 +24,14 @@
 
 #include <core/memory/BufferManager.hpp>
 #include <core/memory/BufferObject.hpp>
+#include <core/memory/exception/Memory.hpp>
+#include <core/tools/System.hpp>
 
 #include <utest/wait.hpp>
 
+#include <cstring>
+#include <fstream>
+
 // Registers the fixture into the 'registry'
 CPPUNIT_TEST_SUITE_REGISTRATION(sight::core::memory::ut::BufferManagerTest);
 
@@ -38,6 +43,40 @@ namespace ut
 
 //------------------------------------------------------------------------------
 
+static core::memory::BufferInfo getBufferInfo(const core::memory::BufferObject::sptr& bo)
+{
+    const auto infos = core::memory::BufferManager::getDefault()->getBufferInfos().get();
+    return infos.at(bo->getBufferPointer());
+}
+
+//------------------------------------------------------------------------------
+
+static void fillBuffer(const core::memory::BufferObject::sptr& bo)
+{
+    core::memory::BufferObject::Lock lock(bo->lock());
+    char* buf = static_cast<char*>(lock.getBuffer());
+
+    for(std::size_t i = 0 ; i < bo->getSize() ; ++i)
+    {
+        buf[i] = static_cast<char>((i / 1024) % 256);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+static void checkBuffer(const core::memory::BufferObject::sptr& bo)
+{
+    core::memory::BufferObject::Lock lock(bo->lock());
+    const char* buf = static_cast<const char*>(lock.getBuffer());
+
+    for(std::size_t i = 0 ; i < bo->getSize() ; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(static_cast<char>((i / 1024) % 256), buf[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+
 void BufferManagerTest::setUp()
 {
     // Set up context before running a test.
@@ -206,6 +245,463 @@ void BufferManagerTest::memoryInfoTest()
     SIGHT_INFO(manager->toString().get());
 }
 
+//------------------------------------------------------------------------------
+
+void BufferManagerTest::mappedDumpTest()
+{
+    core::memory::BufferManager::sptr manager = core::memory::BufferManager::getDefault();
+    manager->setDumpMode(core::memory::BufferManager::MAPPED);
+
+    const core::memory::BufferManager::SizeType threshold = manager->getMappingThreshold();
+    const std::size_t SIZE                                = 4 * threshold;
+    core::memory::BufferObject::sptr bo = core::memory::BufferObject::New();
+    bo->allocate(SIZE);
+
+    {
+        core::memory::BufferObject::Lock lock(bo->lock());
+        char* buf = static_cast<char*>(lock.getBuffer());
+
+        for(std::size_t i = 0 ; i < SIZE ; ++i)
+        {
+            buf[i] = static_cast<char>(i % 256);
+        }
+    }
+
+    fwTestWaitMacro(bo->lockCount() == 0);
+    CPPUNIT_ASSERT(manager->dumpBuffer(bo->getBufferPointer()).get());
+    CPPUNIT_ASSERT(!getBufferInfo(bo).loaded);
+
+    // The buffer is restored by mapping its dumped file
+    {
+        core::memory::BufferObject::Lock lock(bo->lock());
+        CPPUNIT_ASSERT(getBufferInfo(bo).mappedFile);
+        char* buf = static_cast<char*>(lock.getBuffer());
+
+        for(std::size_t i = 0 ; i < SIZE ; ++i)
+        {
+            CPPUNIT_ASSERT_EQUAL(static_cast<char>(i % 256), buf[i]);
+        }
+
+        buf[SIZE / 2] = 42;
+    }
+
+    // Dumping a mapped buffer keeps the modifications made through the mapping
+    fwTestWaitMacro(bo->lockCount() == 0);
+    CPPUNIT_ASSERT(manager->dumpBuffer(bo->getBufferPointer()).get());
+    CPPUNIT_ASSERT(!getBufferInfo(bo).loaded);
+
+    {
+        core::memory::BufferObject::Lock lock(bo->lock());
+        char* buf = static_cast<char*>(lock.getBuffer());
+        CPPUNIT_ASSERT_EQUAL(static_cast<char>(42), buf[SIZE / 2]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<char>((SIZE - 1) % 256), buf[SIZE - 1]);
+    }
+
+    // A mapped buffer is moved to an allocated memory when it is reallocated
+    bo->reallocate(SIZE * 2);
+    CPPUNIT_ASSERT(!getBufferInfo(bo).mappedFile);
+
+    {
+        core::memory::BufferObject::Lock lock(bo->lock());
+        char* buf = static_cast<char*>(lock.getBuffer());
+        CPPUNIT_ASSERT_EQUAL(static_cast<char>(0), buf[0]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<char>(42), buf[SIZE / 2]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<char>((SIZE - 1) % 256), buf[SIZE - 1]);
+    }
+
+    // Buffers smaller than the threshold are still read back
+    fwTestWaitMacro(bo->lockCount() == 0);
+    manager->setMappingThreshold(SIZE * 4);
+    CPPUNIT_ASSERT(manager->dumpBuffer(bo->getBufferPointer()).get());
+    CPPUNIT_ASSERT(manager->restoreBuffer(bo->getBufferPointer()).get());
+    CPPUNIT_ASSERT(!getBufferInfo(bo).mappedFile);
+
+    bo->destroy();
+    CPPUNIT_ASSERT(bo->isEmpty());
+
+    manager->setMappingThreshold(threshold);
+    manager->setDumpMode(core::memory::BufferManager::COPY);
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManagerTest::partialAccessTest()
+{
+    checkPartialAccess(core::memory::BufferManager::COPY);
+    checkPartialAccess(core::memory::BufferManager::MAPPED);
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManagerTest::checkPartialAccess(core::memory::BufferManager::DumpModeType mode)
+{
+    core::memory::BufferManager::sptr manager = core::memory::BufferManager::getDefault();
+    manager->setDumpMode(mode);
+
+    const std::size_t SIZE              = 64 * 1024 * 1024;
+    const std::size_t SLICE_SIZE        = 512 * 512;
+    core::memory::BufferObject::sptr bo = core::memory::BufferObject::New();
+    bo->allocate(SIZE);
+
+    {
+        core::memory::BufferObject::Lock lock(bo->lock());
+        std::memset(lock.getBuffer(), 1, SIZE);
+    }
+
+    fwTestWaitMacro(bo->lockCount() == 0);
+    CPPUNIT_ASSERT(manager->dumpBuffer(bo->getBufferPointer()).get());
+    CPPUNIT_ASSERT(!getBufferInfo(bo).loaded);
+
+    std::size_t sum = 0;
+    {
+        core::memory::BufferObject::Lock lock(bo->lock());
+
+        // Only the MAPPED mode restores the buffer by mapping its file
+        CPPUNIT_ASSERT_EQUAL(mode == core::memory::BufferManager::MAPPED, getBufferInfo(bo).mappedFile != nullptr);
+
+        const char* slice = static_cast<const char*>(lock.getBuffer()) + SIZE / 2;
+        for(std::size_t i = 0 ; i < SLICE_SIZE ; ++i)
+        {
+            sum += static_cast<std::size_t>(slice[i]);
+        }
+    }
+
+    CPPUNIT_ASSERT_EQUAL(SLICE_SIZE, sum);
+
+    bo->destroy();
+    manager->setDumpMode(core::memory::BufferManager::COPY);
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManagerTest::compressedDumpTest()
+{
+    core::memory::BufferManager::sptr manager = core::memory::BufferManager::getDefault();
+    manager->setDumpCompressionLevel(3);
+
+    const std::size_t SIZE              = 8 * 1024 * 1024;
+    core::memory::BufferObject::sptr bo = core::memory::BufferObject::New();
+    bo->allocate(SIZE);
+    fillBuffer(bo);
+
+    const core::memory::BufferManager::BufferStats initialStats = manager->getBufferStats().get();
+
+    // Synchronous dump
+    fwTestWaitMacro(bo->lockCount() == 0);
+    CPPUNIT_ASSERT(manager->dumpBuffer(bo->getBufferPointer()).get());
+    CPPUNIT_ASSERT(!getBufferInfo(bo).loaded);
+    CPPUNIT_ASSERT_EQUAL(core::memory::RAWZSTD, getBufferInfo(bo).fileFormat);
+
+    core::memory::BufferManager::BufferStats stats = manager->getBufferStats().get();
+    CPPUNIT_ASSERT_EQUAL(initialStats.dumpCount + 1, stats.dumpCount);
+    CPPUNIT_ASSERT_EQUAL(initialStats.dumpedBytes + SIZE, stats.dumpedBytes);
+    CPPUNIT_ASSERT(stats.dumpFileBytes - initialStats.dumpFileBytes < SIZE / 10);
+
+    checkBuffer(bo);
+    stats = manager->getBufferStats().get();
+    CPPUNIT_ASSERT_EQUAL(initialStats.restoreCount + 1, stats.restoreCount);
+    CPPUNIT_ASSERT_EQUAL(initialStats.restoredBytes + SIZE, stats.restoredBytes);
+
+    // Asynchronous dump, the buffer is released once its file is written, the dump is not reported as done before
+    manager->setAsynchronousDump(true);
+    fwTestWaitMacro(bo->lockCount() == 0);
+    CPPUNIT_ASSERT(!manager->dumpBuffer(bo->getBufferPointer()).get());
+    fwTestWaitMacro(!getBufferInfo(bo).loaded);
+    CPPUNIT_ASSERT(!getBufferInfo(bo).loaded);
+    CPPUNIT_ASSERT_EQUAL(initialStats.dumpCount + 2, manager->getBufferStats().get().dumpCount);
+    CPPUNIT_ASSERT_EQUAL(core::memory::BufferManager::SizeType(0), manager->getPendingDumpSize().get());
+
+    checkBuffer(bo);
+
+    // A lock drops the dump in progress
+    fwTestWaitMacro(bo->lockCount() == 0);
+    CPPUNIT_ASSERT(!manager->dumpBuffer(bo->getBufferPointer()).get());
+    {
+        core::memory::BufferObject::Lock lock(bo->lock());
+        static_cast<char*>(lock.getBuffer())[0] = 1;
+    }
+    CPPUNIT_ASSERT(getBufferInfo(bo).loaded);
+    {
+        core::memory::BufferObject::Lock lock(bo->lock());
+        CPPUNIT_ASSERT_EQUAL(static_cast<char>(1), static_cast<char*>(lock.getBuffer())[0]);
+    }
+
+    bo->destroy();
+
+    manager->setAsynchronousDump(false);
+    manager->setDumpCompressionLevel(0);
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManagerTest::prefetchTest()
+{
+    core::memory::BufferManager::sptr manager = core::memory::BufferManager::getDefault();
+
+    const std::size_t SIZE              = 8 * 1024 * 1024;
+    core::memory::BufferObject::sptr bo = core::memory::BufferObject::New();
+    bo->allocate(SIZE);
+    fillBuffer(bo);
+
+    fwTestWaitMacro(bo->lockCount() == 0);
+    CPPUNIT_ASSERT(manager->dumpBuffer(bo->getBufferPointer()).get());
+    CPPUNIT_ASSERT(!getBufferInfo(bo).loaded);
+
+    // The buffer is restored in the background, without any lock
+    bo->prefetch();
+    fwTestWaitMacro(getBufferInfo(bo).loaded);
+    CPPUNIT_ASSERT(getBufferInfo(bo).loaded);
+    checkBuffer(bo);
+
+    // A lock requested during the prefetch uses the prefetched buffer
+    fwTestWaitMacro(bo->lockCount() == 0);
+    CPPUNIT_ASSERT(manager->dumpBuffer(bo->getBufferPointer()).get());
+    bo->prefetch();
+    checkBuffer(bo);
+
+    // Destroying a buffer while it is prefetched
+    fwTestWaitMacro(bo->lockCount() == 0);
+    CPPUNIT_ASSERT(manager->dumpBuffer(bo->getBufferPointer()).get());
+    bo->prefetch();
+    bo->destroy();
+    CPPUNIT_ASSERT(bo->isEmpty());
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManagerTest::ownerStatsTest()
+{
+    core::memory::BufferManager::sptr manager = core::memory::BufferManager::getDefault();
+
+    const std::string OWNER = "sight::core::memory::ut::BufferManagerTest";
+    const std::size_t SIZE  = 1024 * 1024;
+
+    const core::memory::BufferManager::BufferStats initialStats = manager->getBufferStats().get();
+    CPPUNIT_ASSERT(initialStats.owners.find(OWNER) == initialStats.owners.end());
+
+    core::memory::BufferObject::sptr bo = core::memory::BufferObject::New();
+    bo->setOwner(OWNER, "ownerStatsTest");
+    bo->allocate(SIZE);
+    CPPUNIT_ASSERT_EQUAL(OWNER, getBufferInfo(bo).owner);
+    CPPUNIT_ASSERT_EQUAL(std::string("ownerStatsTest"), getBufferInfo(bo).ownerId);
+
+    core::memory::BufferManager::BufferStats stats = manager->getBufferStats().get();
+    CPPUNIT_ASSERT_EQUAL(initialStats.allocationCount + 1, stats.allocationCount);
+    CPPUNIT_ASSERT_EQUAL(initialStats.allocatedBytes + SIZE, stats.allocatedBytes);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), stats.owners.at(OWNER).count);
+    CPPUNIT_ASSERT_EQUAL(SIZE, stats.owners.at(OWNER).totalManaged);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), stats.owners.at(OWNER).totalDumped);
+
+    // A reallocation frees the previous buffer
+    bo->reallocate(2 * SIZE);
+    stats = manager->getBufferStats().get();
+    CPPUNIT_ASSERT_EQUAL(initialStats.allocationCount + 2, stats.allocationCount);
+    CPPUNIT_ASSERT_EQUAL(initialStats.allocatedBytes + 3 * SIZE, stats.allocatedBytes);
+    CPPUNIT_ASSERT_EQUAL(initialStats.freeCount + 1, stats.freeCount);
+    CPPUNIT_ASSERT_EQUAL(initialStats.freedBytes + SIZE, stats.freedBytes);
+    CPPUNIT_ASSERT_EQUAL(2 * SIZE, stats.owners.at(OWNER).totalManaged);
+
+    fwTestWaitMacro(bo->lockCount() == 0);
+    CPPUNIT_ASSERT(manager->dumpBuffer(bo->getBufferPointer()).get());
+    stats = manager->getBufferStats().get();
+    CPPUNIT_ASSERT_EQUAL(2 * SIZE, stats.owners.at(OWNER).totalDumped);
+
+    // The tag stays with the buffer object when its content is swapped
+    core::memory::BufferObject::sptr other = core::memory::BufferObject::New();
+    other->allocate(SIZE);
+    bo->swap(other);
+    CPPUNIT_ASSERT_EQUAL(OWNER, getBufferInfo(bo).owner);
+    stats = manager->getBufferStats().get();
+    CPPUNIT_ASSERT_EQUAL(SIZE, stats.owners.at(OWNER).totalManaged);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), stats.owners.at(OWNER).totalDumped);
+
+    bo->destroy();
+    other->destroy();
+    stats = manager->getBufferStats().get();
+    CPPUNIT_ASSERT_EQUAL(initialStats.freeCount + 3, stats.freeCount);
+    CPPUNIT_ASSERT_EQUAL(initialStats.freedBytes + 4 * SIZE, stats.freedBytes);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), stats.owners.at(OWNER).totalManaged);
+
+    bo.reset();
+    stats = manager->getBufferStats().get();
+    CPPUNIT_ASSERT(stats.owners.find(OWNER) == stats.owners.end());
+
+    // The owner of an empty buffer is only sent to the manager once the buffer is assigned
+    core::memory::BufferObject::sptr lazy = core::memory::BufferObject::New();
+    lazy->setOwner(OWNER);
+    CPPUNIT_ASSERT_EQUAL(OWNER, lazy->getOwner());
+    CPPUNIT_ASSERT(getBufferInfo(lazy).owner.empty());
+    lazy->allocate(SIZE);
+    CPPUNIT_ASSERT_EQUAL(OWNER, getBufferInfo(lazy).owner);
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManagerTest::copyOnWriteTest()
+{
+    core::memory::BufferManager::sptr manager = core::memory::BufferManager::getDefault();
+
+    const std::size_t SIZE              = 1024 * 1024;
+    core::memory::BufferObject::sptr bo = core::memory::BufferObject::New();
+    bo->allocate(SIZE);
+    fillBuffer(bo);
+
+    const core::memory::BufferManager::BufferStats initialStats = manager->getBufferStats().get();
+
+    // The copy shares the memory, it is accounted once
+    core::memory::BufferObject::sptr copy = core::memory::BufferObject::New();
+    copy->share(bo);
+    CPPUNIT_ASSERT_EQUAL(SIZE, copy->getSize());
+    CPPUNIT_ASSERT(bo->getBuffer() == copy->getBuffer());
+    CPPUNIT_ASSERT_EQUAL(initialStats.totalManaged, manager->getBufferStats().get().totalManaged);
+
+    // A read lock keeps the memory shared
+    {
+        core::memory::BufferObject::csptr constCopy = copy;
+        core::memory::BufferObject::ConstLock lock  = constCopy->lock();
+        CPPUNIT_ASSERT(bo->getBuffer() == lock.getBuffer());
+    }
+
+    // A write lock gives its own memory to the copy
+    {
+        core::memory::BufferObject::Lock lock = copy->lock();
+        CPPUNIT_ASSERT(bo->getBuffer() != lock.getBuffer());
+        static_cast<char*>(lock.getBuffer())[0] = 42;
+    }
+    CPPUNIT_ASSERT_EQUAL(initialStats.totalManaged + SIZE, manager->getBufferStats().get().totalManaged);
+    CPPUNIT_ASSERT_EQUAL(char(42), static_cast<const char*>(copy->getBuffer())[0]);
+    copy->destroy();
+    checkBuffer(bo);
+
+    // The last buffer using the memory takes it back
+    copy->share(bo);
+    const void* const memory = bo->getBuffer();
+    bo->destroy();
+    {
+        core::memory::BufferObject::Lock lock = copy->lock();
+        CPPUNIT_ASSERT(memory == lock.getBuffer());
+    }
+    checkBuffer(copy);
+
+    // A dumped buffer is restored to be shared, and the shared memory is kept while a buffer uses it
+    fwTestWaitMacro(copy->lockCount() == 0);
+    CPPUNIT_ASSERT(manager->dumpBuffer(copy->getBufferPointer()).get());
+    bo->share(copy);
+    CPPUNIT_ASSERT(getBufferInfo(copy).loaded);
+    CPPUNIT_ASSERT(bo->getBuffer() == copy->getBuffer());
+    CPPUNIT_ASSERT(manager->dumpBuffer(copy->getBufferPointer()).get());
+    checkBuffer(bo);
+    checkBuffer(copy);
+
+    // A locked buffer is copied
+    copy->destroy();
+    {
+        core::memory::BufferObject::Lock lock = bo->lock();
+        copy->share(bo);
+        CPPUNIT_ASSERT(lock.getBuffer() != copy->getBuffer());
+    }
+    checkBuffer(copy);
+
+    // Reallocating a shared buffer does not modify the other one
+    copy->destroy();
+    copy->share(bo);
+    copy->reallocate(SIZE / 2);
+    CPPUNIT_ASSERT(bo->getBuffer() != copy->getBuffer());
+    CPPUNIT_ASSERT_EQUAL(SIZE, bo->getSize());
+    checkBuffer(bo);
+    checkBuffer(copy);
+}
+
+//------------------------------------------------------------------------------
+
+void BufferManagerTest::mapFileTest()
+{
+    core::memory::BufferManager::sptr manager = core::memory::BufferManager::getDefault();
+
+    // The buffer is stored after a header which is not aligned on a page
+    const std::size_t OFFSET = 123;
+    const std::size_t SIZE   = 1024 * 1024;
+
+    const std::filesystem::path file = core::tools::System::getTemporaryFolder("BufferManagerTest") / "mapped.raw";
+    {
+        std::ofstream os(file, std::ios::binary | std::ios::trunc);
+        const std::string header(OFFSET, 'h');
+        os.write(header.data(), static_cast<std::streamsize>(header.size()));
+        for(std::size_t i = 0 ; i < SIZE ; ++i)
+        {
+            os.put(static_cast<char>(i % 256));
+        }
+    }
+
+    const auto readFileByte =
+        [&file](std::size_t position)
+        {
+            std::ifstream is(file, std::ios::binary);
+            is.seekg(static_cast<std::streamoff>(position));
+            return static_cast<char>(is.get());
+        };
+
+    core::memory::BufferObject::sptr bo = core::memory::BufferObject::New();
+    bo->mapFile(file, OFFSET, SIZE);
+    CPPUNIT_ASSERT_EQUAL(SIZE, bo->getSize());
+    CPPUNIT_ASSERT(getBufferInfo(bo).mappedFile);
+
+    {
+        core::memory::BufferObject::Lock lock(bo->lock());
+        char* buf = static_cast<char*>(lock.getBuffer());
+
+        for(std::size_t i = 0 ; i < SIZE ; ++i)
+        {
+            CPPUNIT_ASSERT_EQUAL(static_cast<char>(i % 256), buf[i]);
+        }
+
+        buf[SIZE / 2] = 42;
+    }
+
+    // The modifications are never written to the mapped file
+    CPPUNIT_ASSERT_EQUAL(static_cast<char>((SIZE / 2) % 256), readFileByte(OFFSET + SIZE / 2));
+
+    // Dumping the buffer keeps the modifications
+    fwTestWaitMacro(bo->lockCount() == 0);
+    CPPUNIT_ASSERT(manager->dumpBuffer(bo->getBufferPointer()).get());
+    CPPUNIT_ASSERT(!getBufferInfo(bo).loaded);
+    CPPUNIT_ASSERT(!getBufferInfo(bo).mappedFile);
+    CPPUNIT_ASSERT(std::filesystem::exists(file));
+
+    {
+        core::memory::BufferObject::Lock lock(bo->lock());
+        char* buf = static_cast<char*>(lock.getBuffer());
+        CPPUNIT_ASSERT_EQUAL(static_cast<char>(42), buf[SIZE / 2]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<char>((SIZE - 1) % 256), buf[SIZE - 1]);
+    }
+
+    // A mapped buffer is moved to an allocated memory when it is reallocated
+    core::memory::BufferObject::sptr other = core::memory::BufferObject::New();
+    other->mapFile(file, OFFSET, SIZE);
+    other->reallocate(SIZE * 2);
+    CPPUNIT_ASSERT(!getBufferInfo(other).mappedFile);
+
+    {
+        core::memory::BufferObject::Lock lock(other->lock());
+        char* buf = static_cast<char*>(lock.getBuffer());
+        CPPUNIT_ASSERT_EQUAL(static_cast<char>(0), buf[0]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<char>((SIZE - 1) % 256), buf[SIZE - 1]);
+    }
+
+    // The mapped file is kept when the buffer is destroyed
+    other->destroy();
+    bo->destroy();
+    CPPUNIT_ASSERT(std::filesystem::exists(file));
+    CPPUNIT_ASSERT_EQUAL('h', readFileByte(0));
+
+    // A file too small can not be mapped
+    core::memory::BufferObject::sptr tooSmall = core::memory::BufferObject::New();
+    CPPUNIT_ASSERT_THROW(tooSmall->mapFile(file, OFFSET + 1, SIZE), core::memory::exception::Memory);
+    CPPUNIT_ASSERT(tooSmall->isEmpty());
+
+    std::filesystem::remove(file);
+}
+
 } // namespace ut
 
 } // namespace sight::core::memory
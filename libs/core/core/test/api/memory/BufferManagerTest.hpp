@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <core/memory/BufferManager.hpp>
+
 #include <cppunit/extensions/HelperMacros.h>
 
 namespace sight::core::memory
@@ -35,6 +37,13 @@ class BufferManagerTest : public CPPUNIT_NS::TestFixture
 CPPUNIT_TEST_SUITE(BufferManagerTest);
 CPPUNIT_TEST(allocateTest);
 CPPUNIT_TEST(memoryInfoTest);
+CPPUNIT_TEST(mappedDumpTest);
+CPPUNIT_TEST(partialAccessTest);
+CPPUNIT_TEST(compressedDumpTest);
+CPPUNIT_TEST(prefetchTest);
+CPPUNIT_TEST(ownerStatsTest);
+CPPUNIT_TEST(copyOnWriteTest);
+CPPUNIT_TEST(mapFileTest);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -45,6 +54,18 @@ public:
 
     void allocateTest();
     void memoryInfoTest();
+    void mappedDumpTest();
+    void partialAccessTest();
+    void compressedDumpTest();
+    void prefetchTest();
+    void ownerStatsTest();
+    void copyOnWriteTest();
+    void mapFileTest();
+
+private:
+
+    /// Dumps a buffer in the given mode and checks one slice of it once it is restored
+    static void checkPartialAccess(core::memory::BufferManager::DumpModeType mode);
 };
 
 } // namespace ut
@@ -30,7 +30,10 @@
 
 #include <boost/thread/thread.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <thread>
@@ -268,6 +271,114 @@ void BufferObjectTest::lockThreadedStressTest()
     CPPUNIT_ASSERT_EQUAL(static_cast<long>(0), bo->lockCount());
 }
 
+//------------------------------------------------------------------------------
+
+static bool isAligned(const void* buffer, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(buffer) % alignment == 0;
+}
+
+//------------------------------------------------------------------------------
+
+void BufferObjectTest::alignedAllocationTest()
+{
+    const std::size_t hugePageThreshold = 4 * core::memory::BufferAlignedPolicy::HUGE_PAGE_SIZE;
+    const core::memory::BufferAllocationPolicy::sptr policy =
+        core::memory::BufferAlignedPolicy::New(64, hugePageThreshold);
+
+    core::memory::BufferObject::sptr bo = core::memory::BufferObject::New();
+
+    for(const std::size_t size : {std::size_t(1), std::size_t(1000), std::size_t(1 << 20), hugePageThreshold})
+    {
+        bo->allocate(size, policy);
+        {
+            core::memory::BufferObject::Lock lock(bo->lock());
+            CPPUNIT_ASSERT(isAligned(lock.getBuffer(), 64));
+            std::memset(lock.getBuffer(), 7, size);
+        }
+
+        // The content is kept and the buffer is still aligned once reallocated
+        bo->reallocate(size * 3);
+        {
+            core::memory::BufferObject::Lock lock(bo->lock());
+            CPPUNIT_ASSERT(isAligned(lock.getBuffer(), 64));
+            CPPUNIT_ASSERT_EQUAL(char(7), static_cast<char*>(lock.getBuffer())[size - 1]);
+        }
+
+        bo->destroy();
+    }
+
+    // Changes the policy used by default
+    const core::memory::BufferAllocationPolicy::sptr defaultPolicy = core::memory::BufferAllocationPolicy::getDefault();
+    core::memory::BufferAllocationPolicy::setDefault(core::memory::BufferAlignedPolicy::New(128));
+
+    bo->allocate(1000);
+    {
+        core::memory::BufferObject::Lock lock(bo->lock());
+        CPPUNIT_ASSERT(isAligned(lock.getBuffer(), 128));
+    }
+    bo->destroy();
+
+    core::memory::BufferAllocationPolicy::setDefault(defaultPolicy);
+}
+
+//------------------------------------------------------------------------------
+
+static void streamingKernel(const float* x, float* y, std::size_t size, int repeat)
+{
+    for(int r = 0 ; r < repeat ; ++r)
+    {
+        for(std::size_t i = 0 ; i < size ; ++i)
+        {
+            y[i] = 0.5f * x[i] + y[i];
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void BufferObjectTest::alignedStreamingTest()
+{
+    const std::size_t SIZE = 1024 * 1024;
+    const int REPEAT       = 2;
+
+    // One more float to shift the unaligned buffers
+    const std::size_t bufferSize = (SIZE + 1) * sizeof(float);
+
+    const core::memory::BufferAllocationPolicy::sptr policy = core::memory::BufferAlignedPolicy::New(
+        64,
+        core::memory::BufferAlignedPolicy::HUGE_PAGE_SIZE
+    );
+
+    core::memory::BufferObject::sptr boX = core::memory::BufferObject::New();
+    core::memory::BufferObject::sptr boY = core::memory::BufferObject::New();
+    boX->allocate(bufferSize, policy);
+    boY->allocate(bufferSize, policy);
+
+    core::memory::BufferObject::Lock lockX(boX->lock());
+    core::memory::BufferObject::Lock lockY(boY->lock());
+    float* x = static_cast<float*>(lockX.getBuffer());
+    float* y = static_cast<float*>(lockY.getBuffer());
+
+    // The buffers above the huge page size are aligned too
+    CPPUNIT_ASSERT(isAligned(x, 64));
+    CPPUNIT_ASSERT(isAligned(y, 64));
+
+    std::fill(x, x + SIZE + 1, 1.f);
+    std::fill(y, y + SIZE + 1, 0.f);
+
+    streamingKernel(x, y, SIZE, REPEAT);
+    streamingKernel(x + 1, y + 1, SIZE, REPEAT);
+
+    // The first float is only streamed by the aligned pass, the last one only by the unaligned pass
+    CPPUNIT_ASSERT_EQUAL(0.5f * REPEAT, y[0]);
+    CPPUNIT_ASSERT_EQUAL(0.5f * REPEAT, y[SIZE]);
+    CPPUNIT_ASSERT(std::all_of(y + 1, y + SIZE, [&](float value){return value == 1.f * REPEAT;}));
+
+    // The source is not modified
+    CPPUNIT_ASSERT(std::all_of(x, x + SIZE + 1, [](float value){return value == 1.f;}));
+}
+
 } // namespace ut
 
 } // namespace sight::core::memory
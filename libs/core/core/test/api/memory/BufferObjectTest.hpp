@@ -36,6 +36,8 @@ CPPUNIT_TEST_SUITE(BufferObjectTest);
 CPPUNIT_TEST(allocateTest);
 CPPUNIT_TEST(allocateZeroTest);
 CPPUNIT_TEST(lockThreadedStressTest);
+CPPUNIT_TEST(alignedAllocationTest);
+CPPUNIT_TEST(alignedStreamingTest);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -47,6 +49,8 @@ public:
     void allocateTest();
     void allocateZeroTest();
     void lockThreadedStressTest();
+    void alignedAllocationTest();
+    void alignedStreamingTest();
 };
 
 } // namespace ut
@@ -22,6 +22,11 @@
 
 #include "WorkerTest.hpp"
 
+#include <core/com/Signal.hpp>
+#include <core/com/Signal.hxx>
+#include <core/com/Slot.hpp>
+#include <core/com/Slot.hxx>
+#include <core/com/Slots.hpp>
 #include <core/spyLog.hpp>
 #include <core/thread/Timer.hpp>
 #include <core/thread/Worker.hpp>
@@ -30,6 +35,7 @@
 
 #include <atomic>
 #include <exception>
+#include <future>
 #include <iostream>
 
 // Registers the fixture into the 'registry'
@@ -311,6 +317,145 @@ void WorkerTest::timerTest()
 
 //-----------------------------------------------------------------------------
 
+static void noop()
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void WorkerTest::metricsTest()
+{
+    core::thread::Worker::sptr worker = core::thread::Worker::New();
+    WorkerMetrics::sptr metrics       = worker->getMetrics();
+    metrics->setPublicationPeriod(0);
+
+    // Nothing is recorded while the metrics are disabled
+    worker->postTask<void>([](){}).wait();
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(0), metrics->getSnapshot().m_runTime.m_count);
+
+    worker->setMetricsEnabled(true);
+    CPPUNIT_ASSERT(worker->isMetricsEnabled());
+
+    // Block the worker so that the next tasks wait in its queue
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future();
+    worker->post([released](){released.wait();}, "blocker");
+
+    for(int i = 0 ; i < 10 ; ++i)
+    {
+        worker->post(
+            []()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            },
+            "sleep");
+    }
+
+    CPPUNIT_ASSERT(metrics->getSnapshot().m_queueDepth >= 10);
+
+    // Hold the blocker for a measured duration: all the tasks above were posted before it is released
+    const WorkerMetrics::ClockType::time_point holdStart = WorkerMetrics::ClockType::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const std::chrono::duration<double, std::micro> held = WorkerMetrics::ClockType::now() - holdStart;
+    release.set_value();
+
+    // A named slot is recorded under its name
+    core::com::Slots slots;
+    core::com::Slot<void()>::sptr slot = core::com::newSlot(&noop);
+    slots("mySlot", slot);
+    slot->setWorker(worker);
+    slot->asyncRun().wait();
+
+    worker->stop();
+
+    const WorkerMetrics::Snapshot snapshot = metrics->getSnapshot();
+    CPPUNIT_ASSERT_EQUAL(std::int64_t(0), snapshot.m_queueDepth);
+    CPPUNIT_ASSERT(snapshot.m_maxQueueDepth >= 10);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(12), snapshot.m_runTime.m_count);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(12), snapshot.m_latency.m_count);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), snapshot.m_runTimeByName.size());
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), snapshot.m_runTimeByName.at("blocker").m_count);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(10), snapshot.m_runTimeByName.at("sleep").m_count);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), snapshot.m_runTimeByName.at("mySlot").m_count);
+
+    const WorkerMetrics::Histogram& sleep = snapshot.m_runTimeByName.at("sleep");
+    CPPUNIT_ASSERT(sleep.getMean() >= 1000.);
+    CPPUNIT_ASSERT(sleep.m_max >= sleep.getMean());
+    CPPUNIT_ASSERT(sleep.getPercentile(0.5) >= 1000.);
+    CPPUNIT_ASSERT(sleep.getPercentile(1.) <= sleep.m_max);
+
+    // The queued tasks waited at least as long as the blocker was held
+    CPPUNIT_ASSERT(snapshot.m_latency.m_max >= held.count());
+
+    // The metrics of a name can be moved out
+    const auto [extracted, extractedCPUTime] = metrics->extract("sleep");
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(10), extracted.m_count);
+    CPPUNIT_ASSERT(extractedCPUTime >= 0.);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), metrics->getSnapshot().m_runTimeByName.count("sleep"));
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(12), metrics->getSnapshot().m_runTime.m_count);
+
+    metrics->reset();
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(0), metrics->getSnapshot().m_runTime.m_count);
+    CPPUNIT_ASSERT(metrics->getSnapshot().m_runTimeByName.empty());
+}
+
+//-----------------------------------------------------------------------------
+
+struct MetricsReceiver
+{
+    //------------------------------------------------------------------------------
+
+    void receive(WorkerMetrics::Snapshot _snapshot)
+    {
+        if(m_first.exchange(false))
+        {
+            m_published.set_value(_snapshot);
+        }
+    }
+
+    std::promise<WorkerMetrics::Snapshot> m_published;
+    std::atomic_bool m_first {true};
+};
+
+//-----------------------------------------------------------------------------
+
+void WorkerTest::metricsSignalTest()
+{
+    core::thread::Worker::sptr worker   = core::thread::Worker::New();
+    core::thread::Worker::sptr receiver = core::thread::Worker::New();
+    WorkerMetrics::sptr metrics         = worker->getMetrics();
+    metrics->setPublicationPeriod(1);
+    worker->setMetricsEnabled(true);
+
+    MetricsReceiver metricsReceiver;
+    core::com::Slot<void(WorkerMetrics::Snapshot)>::sptr slot =
+        core::com::newSlot(&MetricsReceiver::receive, &metricsReceiver);
+    slot->setWorker(receiver);
+    metrics->getSignal()->connect(slot);
+
+    for(int i = 0 ; i < 5 ; ++i)
+    {
+        worker->post(
+            []()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            },
+            "sleep");
+    }
+
+    auto future = metricsReceiver.m_published.get_future();
+    CPPUNIT_ASSERT(future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    const WorkerMetrics::Snapshot snapshot = future.get();
+    CPPUNIT_ASSERT(snapshot.m_runTime.m_count >= 1);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), snapshot.m_runTimeByName.count("sleep"));
+
+    worker->stop();
+    metrics->getSignal()->disconnect(slot);
+    receiver->stop();
+}
+
+//-----------------------------------------------------------------------------
+
 } //namespace ut
 
 } //namespace sight::core::thread
@@ -34,6 +34,8 @@ class WorkerTest : public CPPUNIT_NS::TestFixture
 {
 CPPUNIT_TEST_SUITE(WorkerTest);
 CPPUNIT_TEST(basicTest);
+CPPUNIT_TEST(metricsTest);
+CPPUNIT_TEST(metricsSignalTest);
 // Disable timerTest because it fails randomly on a busy computer (see #253)
 //CPPUNIT_TEST( timerTest );
 CPPUNIT_TEST_SUITE_END();
@@ -46,6 +48,8 @@ public:
 
     void basicTest();
     void timerTest();
+    void metricsTest();
+    void metricsSignalTest();
 };
 
 } //namespace ut
@@ -0,0 +1,145 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "LRUCacheTest.hpp"
+
+#include <core/tools/LRUCache.hpp>
+
+#include <string>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::core::tools::ut::LRUCacheTest);
+
+namespace sight::core::tools
+{
+
+namespace ut
+{
+
+//------------------------------------------------------------------------------
+
+void LRUCacheTest::setUp()
+{
+    // Set up context before running a test.
+}
+
+//------------------------------------------------------------------------------
+
+void LRUCacheTest::tearDown()
+{
+    // Clean up after the test run.
+}
+
+//------------------------------------------------------------------------------
+
+void LRUCacheTest::insertTest()
+{
+    core::tools::LRUCache<int, std::string> cache(3);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), cache.getCapacity());
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), cache.size());
+    CPPUNIT_ASSERT(!cache.get(1));
+
+    cache.insert(1, "one");
+    cache.insert(2, "two");
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), cache.size());
+    CPPUNIT_ASSERT(cache.contains(1));
+    CPPUNIT_ASSERT_EQUAL(std::string("one"), *cache.get(1));
+    CPPUNIT_ASSERT_EQUAL(std::string("two"), *cache.get(2));
+
+    // Replace a value
+    cache.insert(1, "uno");
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), cache.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("uno"), *cache.get(1));
+
+    cache.erase(1);
+    CPPUNIT_ASSERT(!cache.contains(1));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), cache.size());
+
+    cache.clear();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), cache.size());
+    CPPUNIT_ASSERT(!cache.get(2));
+}
+
+//------------------------------------------------------------------------------
+
+void LRUCacheTest::evictionTest()
+{
+    core::tools::LRUCache<int, std::string> cache(3);
+    cache.insert(1, "one");
+    cache.insert(2, "two");
+    cache.insert(3, "three");
+
+    // The least recently inserted value is removed
+    cache.insert(4, "four");
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), cache.size());
+    CPPUNIT_ASSERT(!cache.contains(1));
+
+    // Getting a value marks it as used, contains() does not
+    CPPUNIT_ASSERT(cache.get(2));
+    CPPUNIT_ASSERT(cache.contains(3));
+    cache.insert(5, "five");
+    CPPUNIT_ASSERT(cache.contains(2));
+    CPPUNIT_ASSERT(!cache.contains(3));
+    CPPUNIT_ASSERT(cache.contains(4));
+    CPPUNIT_ASSERT(cache.contains(5));
+
+    // Replacing a value marks it as used
+    cache.insert(4, "FOUR");
+    cache.insert(6, "six");
+    CPPUNIT_ASSERT(!cache.contains(2));
+    CPPUNIT_ASSERT_EQUAL(std::string("FOUR"), *cache.get(4));
+}
+
+//------------------------------------------------------------------------------
+
+void LRUCacheTest::capacityTest()
+{
+    core::tools::LRUCache<int, int> cache(10);
+    for(int i = 0 ; i < 10 ; ++i)
+    {
+        cache.insert(i, i * i);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(std::size_t(10), cache.size());
+
+    // The least recently used values are removed
+    cache.setCapacity(4);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(4), cache.size());
+    for(int i = 0 ; i < 6 ; ++i)
+    {
+        CPPUNIT_ASSERT(!cache.contains(i));
+    }
+
+    for(int i = 6 ; i < 10 ; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(i * i, *cache.get(i));
+    }
+
+    cache.setCapacity(0);
+    cache.insert(1, 1);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), cache.size());
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace ut
+
+} // namespace sight::core::tools
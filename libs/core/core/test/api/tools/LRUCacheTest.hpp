@@ -0,0 +1,53 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace sight::core::tools
+{
+
+namespace ut
+{
+
+class LRUCacheTest : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(LRUCacheTest);
+CPPUNIT_TEST(insertTest);
+CPPUNIT_TEST(evictionTest);
+CPPUNIT_TEST(capacityTest);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // interface
+    void setUp();
+    void tearDown();
+
+    void insertTest();
+    void evictionTest();
+    void capacityTest();
+};
+
+} // namespace ut
+
+} // namespace sight::core::tools
@@ -0,0 +1,291 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "RecorderTest.hpp"
+
+#include <core/thread/Worker.hpp>
+#include <core/trace/Recorder.hpp>
+
+#include <future>
+#include <sstream>
+#include <thread>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::core::trace::ut::RecorderTest);
+
+namespace sight::core::trace
+{
+
+namespace ut
+{
+
+//------------------------------------------------------------------------------
+
+void RecorderTest::setUp()
+{
+    Recorder::clear();
+}
+
+//------------------------------------------------------------------------------
+
+void RecorderTest::tearDown()
+{
+    Recorder::setEnabled(false);
+    Recorder::clear();
+}
+
+//------------------------------------------------------------------------------
+
+static std::size_t countEvents(const std::vector<Recorder::ThreadEvents>& _threads)
+{
+    std::size_t count = 0;
+    for(const auto& thread : _threads)
+    {
+        count += thread.m_events.size();
+    }
+
+    return count;
+}
+
+//------------------------------------------------------------------------------
+
+void RecorderTest::disabledTest()
+{
+    Recorder::setEnabled(false);
+    CPPUNIT_ASSERT(!Recorder::isEnabled());
+
+    {
+        FW_TRACE_SCOPE("test", "scope");
+        FW_TRACE_INSTANT("test", "instant");
+        FW_TRACE_COUNTER("test", "counter", 1);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), countEvents(Recorder::collect()));
+
+    // A scope opened while the recorder is disabled must not record its end
+    {
+        FW_TRACE_SCOPE("test", "scope");
+        Recorder::setEnabled(true);
+    }
+    Recorder::setEnabled(false);
+
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), countEvents(Recorder::collect()));
+}
+
+//------------------------------------------------------------------------------
+
+void RecorderTest::scopeTest()
+{
+    Recorder::setEnabled(true);
+    {
+        FW_TRACE_SCOPE("test", "scope");
+        FW_TRACE_COUNTER("test", "counter", 42);
+        FW_TRACE_INSTANT("test", "instant");
+    }
+    Recorder::setEnabled(false);
+
+    const auto threads = Recorder::collect();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), threads.size());
+
+    const auto& events = threads[0].m_events;
+    CPPUNIT_ASSERT_EQUAL(std::size_t(4), events.size());
+    CPPUNIT_ASSERT(events[0].m_type == Recorder::EventType::BEGIN);
+    CPPUNIT_ASSERT(events[1].m_type == Recorder::EventType::COUNTER);
+    CPPUNIT_ASSERT(events[2].m_type == Recorder::EventType::INSTANT);
+    CPPUNIT_ASSERT(events[3].m_type == Recorder::EventType::END);
+    CPPUNIT_ASSERT_EQUAL(std::string("scope"), std::string(events[0].m_name));
+    CPPUNIT_ASSERT_EQUAL(std::string("test"), std::string(events[0].m_category));
+    CPPUNIT_ASSERT_EQUAL(std::string("scope"), std::string(events[3].m_name));
+    CPPUNIT_ASSERT_EQUAL(42., events[1].m_value);
+
+    for(std::size_t i = 1 ; i < events.size() ; ++i)
+    {
+        CPPUNIT_ASSERT(events[i - 1].m_timestamp <= events[i].m_timestamp);
+    }
+
+    Recorder::clear();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), countEvents(Recorder::collect()));
+}
+
+//------------------------------------------------------------------------------
+
+void RecorderTest::threadTest()
+{
+    static const std::size_t s_NB_THREADS = 4;
+    static const std::size_t s_NB_SCOPES  = 100;
+
+    Recorder::setEnabled(true);
+
+    std::vector<std::thread> threads;
+    for(std::size_t t = 0 ; t < s_NB_THREADS ; ++t)
+    {
+        threads.emplace_back(
+            [t]()
+            {
+                Recorder::setThreadName("thread " + std::to_string(t));
+                for(std::size_t i = 0 ; i < s_NB_SCOPES ; ++i)
+                {
+                    FW_TRACE_SCOPE("test", "scope");
+                }
+            });
+    }
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    Recorder::setEnabled(false);
+
+    const auto threadEvents = Recorder::collect();
+    CPPUNIT_ASSERT_EQUAL(s_NB_THREADS, threadEvents.size());
+
+    for(const auto& thread : threadEvents)
+    {
+        CPPUNIT_ASSERT_EQUAL(std::string("thread "), thread.m_threadName.substr(0, 7));
+        CPPUNIT_ASSERT_EQUAL(2 * s_NB_SCOPES, thread.m_events.size());
+    }
+
+    // The exited threads are forgotten
+    Recorder::clear();
+    CPPUNIT_ASSERT(Recorder::collect().empty());
+}
+
+//------------------------------------------------------------------------------
+
+void RecorderTest::ringBufferTest()
+{
+    const std::size_t capacity = Recorder::getBufferCapacity();
+    Recorder::setBufferCapacity(100);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(128), Recorder::getBufferCapacity());
+
+    // The capacity only applies to new threads
+    Recorder::setEnabled(true);
+    std::thread thread(
+        []()
+        {
+            for(int i = 0 ; i < 1000 ; ++i)
+            {
+                FW_TRACE_COUNTER("test", "counter", i);
+            }
+        });
+    thread.join();
+    Recorder::setEnabled(false);
+    Recorder::setBufferCapacity(capacity);
+
+    const auto threads = Recorder::collect();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), threads.size());
+
+    const auto& events = threads[0].m_events;
+    CPPUNIT_ASSERT_EQUAL(std::size_t(128), events.size());
+    for(std::size_t i = 0 ; i < events.size() ; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(static_cast<double>(1000 - 128 + i), events[i].m_value);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void RecorderTest::flowTest()
+{
+    core::thread::Worker::sptr worker = core::thread::Worker::New();
+
+    Recorder::setEnabled(true);
+
+    std::promise<void> promise;
+    worker->post(
+        traceFlow(
+            "test",
+            "task",
+            [&promise]()
+            {
+                promise.set_value();
+            }));
+    promise.get_future().wait();
+
+    worker->stop();
+    Recorder::setEnabled(false);
+
+    const auto threads = Recorder::collect();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), threads.size());
+
+    std::uint64_t beginId  = 0;
+    std::uint64_t endId    = 0;
+    std::uint64_t beginTid = 0;
+    std::uint64_t endTid   = 0;
+    for(const auto& thread : threads)
+    {
+        for(const auto& event : thread.m_events)
+        {
+            if(event.m_type == Recorder::EventType::FLOW_BEGIN)
+            {
+                beginId  = event.m_id;
+                beginTid = thread.m_threadId;
+            }
+            else if(event.m_type == Recorder::EventType::FLOW_END)
+            {
+                endId  = event.m_id;
+                endTid = thread.m_threadId;
+            }
+        }
+    }
+
+    CPPUNIT_ASSERT(beginId != 0);
+    CPPUNIT_ASSERT_EQUAL(beginId, endId);
+    CPPUNIT_ASSERT(beginTid != endTid);
+}
+
+//------------------------------------------------------------------------------
+
+void RecorderTest::chromeTraceTest()
+{
+    const char* const name = Recorder::intern("quoted \"name\"");
+    CPPUNIT_ASSERT(name == Recorder::intern("quoted \"name\""));
+
+    Recorder::setEnabled(true);
+    Recorder::setThreadName("main");
+    {
+        FW_TRACE_SCOPE("test", name);
+        FW_TRACE_COUNTER("test", "counter", 2.5);
+        const std::uint64_t id = Recorder::newFlowId();
+        Recorder::flowBegin("test", "flow", id);
+        Recorder::flowEnd("test", "flow", id);
+    }
+    Recorder::setEnabled(false);
+
+    std::stringstream stream;
+    Recorder::writeChromeTrace(stream);
+    const std::string json = stream.str();
+
+    CPPUNIT_ASSERT_EQUAL(std::string("{\"traceEvents\":["), json.substr(0, 16));
+    CPPUNIT_ASSERT(json.find("\"name\":\"thread_name\",\"ph\":\"M\"") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"args\":{\"name\":\"main\"}") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"name\":\"quoted \\\"name\\\"\",\"cat\":\"test\",\"ph\":\"B\"") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"ph\":\"E\"") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"args\":{\"value\":2.500}") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"ph\":\"s\"") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"bp\":\"e\"") != std::string::npos);
+    CPPUNIT_ASSERT_EQUAL(std::string("\n],\"displayTimeUnit\":\"ms\"}\n"), json.substr(json.rfind("\n]")));
+}
+
+} //namespace ut
+
+} //namespace sight::core::trace
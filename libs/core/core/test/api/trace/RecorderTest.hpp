@@ -0,0 +1,62 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace sight::core::trace
+{
+
+namespace ut
+{
+
+/**
+ * @brief Test the trace recorder.
+ */
+class RecorderTest : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(RecorderTest);
+CPPUNIT_TEST(disabledTest);
+CPPUNIT_TEST(scopeTest);
+CPPUNIT_TEST(threadTest);
+CPPUNIT_TEST(ringBufferTest);
+CPPUNIT_TEST(flowTest);
+CPPUNIT_TEST(chromeTraceTest);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // interface
+    void setUp();
+    void tearDown();
+
+    void disabledTest();
+    void scopeTest();
+    void threadTest();
+    void ringBufferTest();
+    void flowTest();
+    void chromeTraceTest();
+};
+
+} //namespace ut
+
+} //namespace sight::core::trace
@@ -22,9 +22,14 @@
 
 #include "core/thread/Worker.hpp"
 
+#include "core/tools/System.hpp"
+
 namespace sight::core::thread
 {
 
+/// Name of the task being posted by the current thread, read by Worker::instrument()
+static thread_local const char* s_postedTaskName = nullptr;
+
 //------------------------------------------------------------------------------
 
 ThreadIdType getCurrentThreadId()
@@ -32,6 +37,68 @@ ThreadIdType getCurrentThreadId()
     return std::this_thread::get_id();
 }
 
+//------------------------------------------------------------------------------
+
+void Worker::post(TaskType handler, const char* name)
+{
+    if(!this->isMetricsEnabled())
+    {
+        this->post(std::move(handler));
+        return;
+    }
+
+    // The name is forwarded to instrument() through a thread local variable, to keep post(TaskType) unchanged in the
+    // implementations
+    const char* const previousName = s_postedTaskName;
+    s_postedTaskName = name;
+    this->post(std::move(handler));
+    s_postedTaskName = previousName;
+}
+
+//------------------------------------------------------------------------------
+
+void Worker::setMetricsEnabled(bool enabled)
+{
+    m_metricsEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+
+SPTR(WorkerMetrics) Worker::getMetrics() const
+{
+    return m_metrics;
+}
+
+//------------------------------------------------------------------------------
+
+Worker::TaskType Worker::instrument(TaskType task)
+{
+    if(!this->isMetricsEnabled())
+    {
+        return task;
+    }
+
+    const char* const name = s_postedTaskName ? s_postedTaskName : "";
+
+    const SPTR(WorkerMetrics) metrics = m_metrics;
+    metrics->taskPosted();
+
+    const WorkerMetrics::ClockType::time_point posted = WorkerMetrics::ClockType::now();
+
+    return [metrics, name, posted, task = std::move(task)]()
+           {
+               const WorkerMetrics::ClockType::time_point started = WorkerMetrics::ClockType::now();
+               metrics->taskStarted(posted, started);
+
+               const double cpuStarted = core::tools::System::getThreadCPUTime();
+
+               task();
+
+               const double cpuTime = core::tools::System::getThreadCPUTime() - cpuStarted;
+               metrics->taskFinished(name, started, WorkerMetrics::ClockType::now(), cpuTime);
+           };
+}
+
 //SPTR(Worker) Worker::defaultFactory() => WorkerAsio.cpp
 
 } //namespace sight::core::thread
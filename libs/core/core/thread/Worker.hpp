@@ -29,6 +29,7 @@
 #include <core/HiResClock.hpp>
 
 #include "core/config.hpp"
+#include "core/thread/WorkerMetrics.hpp"
 
 namespace sight::core::thread
 {
@@ -56,7 +57,8 @@ public:
 
     SIGHT_DECLARE_CLASS(Worker, core::BaseObject, defaultFactory);
 
-    Worker()
+    Worker() :
+        m_metrics(std::make_shared<WorkerMetrics>())
     {
     }
 
@@ -66,6 +68,14 @@ public:
     /// Requests invocation of the given task handler and returns immediately.
     virtual void post(TaskType handler) = 0;
 
+    /**
+     * @brief Requests invocation of the given task handler and returns immediately.
+     *
+     * The name is used to sort the run times in the metrics. It is not copied, thus it must outlive the worker (a
+     * string literal or a string returned by core::trace::Recorder::intern()).
+     */
+    CORE_API void post(TaskType handler, const char* name);
+
     /**
      * @brief Requests invocation of the given callable and returns a shared future.
      *
@@ -115,8 +125,27 @@ public:
      */
     CORE_API virtual void processTasks() = 0;
 
+    /// Enables or disables the collection of the metrics of the posted tasks.
+    CORE_API void setMetricsEnabled(bool enabled);
+
+    /// Returns true if the metrics of the posted tasks are collected.
+    bool isMetricsEnabled() const
+    {
+        return m_metricsEnabled.load(std::memory_order_relaxed);
+    }
+
+    /// Returns the metrics of the posted tasks.
+    CORE_API SPTR(WorkerMetrics) getMetrics() const;
+
 protected:
 
+    /**
+     * @brief Wraps a posted task to record its metrics.
+     *
+     * Implementations of post() must call it on every task. The task is returned untouched if the metrics are disabled.
+     */
+    CORE_API TaskType instrument(TaskType task);
+
     /// Creates and returns a new instance of Worker default implementation
     /// (boost::Asio).
     CORE_API static SPTR(Worker) defaultFactory();
@@ -129,6 +158,12 @@ protected:
 
     /// Worker's loop future
     FutureType m_future;
+
+    /// Enables the collection of the metrics
+    std::atomic_bool m_metricsEnabled {false};
+
+    /// Metrics of the posted tasks
+    SPTR(WorkerMetrics) m_metrics;
 };
 
 } //namespace sight::core::thread
@@ -56,6 +56,8 @@ public:
 
     void stop();
 
+    using Worker::post;
+
     void post(TaskType handler);
 
     ThreadIdType getThreadId() const;
@@ -215,7 +217,7 @@ SPTR(core::thread::Timer) WorkerAsio::createTimer()
 
 void WorkerAsio::post(TaskType handler)
 {
-    m_ioService->post(handler);
+    m_ioService->post(this->instrument(std::move(handler)));
 }
 
 //------------------------------------------------------------------------------
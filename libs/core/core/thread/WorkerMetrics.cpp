@@ -0,0 +1,261 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "core/thread/WorkerMetrics.hpp"
+
+#include "core/com/Signal.hpp"
+#include "core/com/Signal.hxx"
+
+#include <algorithm>
+#include <cmath>
+
+namespace sight::core::thread
+{
+
+//------------------------------------------------------------------------------
+
+void WorkerMetrics::Histogram::add(double _duration)
+{
+    std::size_t bucket = 0;
+    if(_duration >= 1.)
+    {
+        bucket = std::min(static_cast<std::size_t>(std::log2(_duration)), s_NB_BUCKETS - 1);
+    }
+
+    ++m_buckets[bucket];
+    ++m_count;
+    m_total += _duration;
+    m_max    = std::max(m_max, _duration);
+}
+
+//------------------------------------------------------------------------------
+
+void WorkerMetrics::Histogram::merge(const Histogram& _other)
+{
+    for(std::size_t i = 0 ; i < s_NB_BUCKETS ; ++i)
+    {
+        m_buckets[i] += _other.m_buckets[i];
+    }
+
+    m_count += _other.m_count;
+    m_total += _other.m_total;
+    m_max    = std::max(m_max, _other.m_max);
+}
+
+//------------------------------------------------------------------------------
+
+double WorkerMetrics::Histogram::getMean() const
+{
+    return m_count > 0 ? m_total / static_cast<double>(m_count) : 0.;
+}
+
+//------------------------------------------------------------------------------
+
+double WorkerMetrics::Histogram::getPercentile(double _ratio) const
+{
+    if(m_count == 0)
+    {
+        return 0.;
+    }
+
+    const auto target = static_cast<std::uint64_t>(std::ceil(std::clamp(_ratio, 0., 1.) * static_cast<double>(m_count)));
+
+    std::uint64_t count = 0;
+    for(std::size_t i = 0 ; i < s_NB_BUCKETS ; ++i)
+    {
+        count += m_buckets[i];
+        if(count >= target && count > 0)
+        {
+            // Upper bound of the bucket, but never more than the longest duration
+            return std::min(std::ldexp(1., static_cast<int>(i + 1)), m_max);
+        }
+    }
+
+    return m_max;
+}
+
+//------------------------------------------------------------------------------
+
+WorkerMetrics::WorkerMetrics() :
+    m_lastPublication(ClockType::now()),
+    m_signal(UpdatedSignalType::New())
+{
+}
+
+//------------------------------------------------------------------------------
+
+WorkerMetrics::~WorkerMetrics()
+{
+}
+
+//------------------------------------------------------------------------------
+
+WorkerMetrics::Snapshot WorkerMetrics::getSnapshot() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return this->getSnapshotNoLock();
+}
+
+//------------------------------------------------------------------------------
+
+WorkerMetrics::Snapshot WorkerMetrics::getSnapshotNoLock() const
+{
+    Snapshot snapshot;
+    snapshot.m_queueDepth    = m_queueDepth.load(std::memory_order_relaxed);
+    snapshot.m_maxQueueDepth = m_maxQueueDepth.load(std::memory_order_relaxed);
+    snapshot.m_latency       = m_latency;
+    snapshot.m_runTime       = m_runTime;
+
+    // Several pointers may share the same name, e.g. identical string literals from different modules
+    for(const auto& [name, histogram] : m_runTimeByName)
+    {
+        snapshot.m_runTimeByName[name].merge(histogram);
+    }
+
+    for(const auto& [name, cpuTime] : m_cpuTimeByName)
+    {
+        snapshot.m_cpuTimeByName[name] += cpuTime;
+    }
+
+    return snapshot;
+}
+
+//------------------------------------------------------------------------------
+
+void WorkerMetrics::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxQueueDepth = m_queueDepth.load();
+    m_latency       = Histogram();
+    m_runTime       = Histogram();
+    m_runTimeByName.clear();
+    m_cpuTimeByName.clear();
+}
+
+//------------------------------------------------------------------------------
+
+std::pair<WorkerMetrics::Histogram, double> WorkerMetrics::extract(const std::string& _name)
+{
+    std::pair<Histogram, double> extracted {Histogram(), 0.};
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Several pointers may share the same name, e.g. identical string literals from different modules
+    for(auto it = m_runTimeByName.begin() ; it != m_runTimeByName.end() ; )
+    {
+        if(_name == it->first)
+        {
+            extracted.first.merge(it->second);
+            it = m_runTimeByName.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for(auto it = m_cpuTimeByName.begin() ; it != m_cpuTimeByName.end() ; )
+    {
+        if(_name == it->first)
+        {
+            extracted.second += it->second;
+            it = m_cpuTimeByName.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return extracted;
+}
+
+//------------------------------------------------------------------------------
+
+void WorkerMetrics::setPublicationPeriod(std::uint64_t _period)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_publicationPeriod = _period;
+}
+
+//------------------------------------------------------------------------------
+
+SPTR(WorkerMetrics::UpdatedSignalType) WorkerMetrics::getSignal() const
+{
+    return m_signal;
+}
+
+//------------------------------------------------------------------------------
+
+void WorkerMetrics::taskPosted() noexcept
+{
+    const std::int64_t depth = m_queueDepth.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    std::int64_t maxDepth = m_maxQueueDepth.load(std::memory_order_relaxed);
+    while(depth > maxDepth && !m_maxQueueDepth.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed))
+    {
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void WorkerMetrics::taskStarted(ClockType::time_point _posted, ClockType::time_point _started)
+{
+    m_queueDepth.fetch_sub(1, std::memory_order_relaxed);
+
+    const std::chrono::duration<double, std::micro> latency = _started - _posted;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_latency.add(latency.count());
+}
+
+//------------------------------------------------------------------------------
+
+void WorkerMetrics::taskFinished(
+    const char* _name,
+    ClockType::time_point _started,
+    ClockType::time_point _finished,
+    double _cpuTime
+)
+{
+    const std::chrono::duration<double, std::micro> runTime = _finished - _started;
+
+    Snapshot snapshot;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_runTime.add(runTime.count());
+        m_runTimeByName[_name].add(runTime.count());
+        m_cpuTimeByName[_name] += _cpuTime;
+
+        if(m_publicationPeriod == 0
+           || _finished - m_lastPublication < std::chrono::milliseconds(m_publicationPeriod))
+        {
+            return;
+        }
+
+        m_lastPublication = _finished;
+        snapshot          = this->getSnapshotNoLock();
+    }
+
+    m_signal->asyncEmit(snapshot);
+}
+
+} // namespace sight::core::thread
@@ -0,0 +1,207 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "core/config.hpp"
+#include "core/macros.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace sight::core::com
+{
+
+template<typename F>
+struct Signal;
+
+} // namespace sight::core::com
+
+namespace sight::core::thread
+{
+
+/**
+ * @brief Holds the queue and execution metrics of a worker.
+ *
+ * The metrics are only collected when they are enabled on the worker with Worker::setMetricsEnabled(). They are:
+ * - the current and maximum number of posted tasks waiting to be run,
+ * - the histogram of the latencies between the posting and the start of a task,
+ * - the histogram of the run times of the tasks, in total and per task name. Slots use their name as task name.
+ * - the CPU time consumed by the tasks, per task name.
+ *
+ * The metrics can be queried at any time with getSnapshot(). They are also published through the signal returned by
+ * getSignal(), at most once per publication period, when a task completes.
+ */
+class CORE_CLASS_API WorkerMetrics
+{
+public:
+
+    typedef std::shared_ptr<WorkerMetrics> sptr;
+    typedef std::chrono::steady_clock ClockType;
+
+    /// Number of buckets of the histograms.
+    static constexpr std::size_t s_NB_BUCKETS = 32;
+
+    /**
+     * @brief Histogram of durations, in microseconds.
+     *
+     * The bucket i counts the durations in [2^i, 2^(i+1)[, except the first that also counts the durations below 1 µs
+     * and the last that also counts the longer durations.
+     */
+    struct CORE_CLASS_API Histogram
+    {
+        /// Adds a duration.
+        CORE_API void add(double _duration);
+
+        /// Adds all the durations of another histogram.
+        CORE_API void merge(const Histogram& _other);
+
+        /// Returns the mean duration.
+        CORE_API double getMean() const;
+
+        /// Returns an upper bound of the given percentile, with _ratio in [0, 1].
+        CORE_API double getPercentile(double _ratio) const;
+
+        /// Number of durations in each bucket.
+        std::array<std::uint64_t, s_NB_BUCKETS> m_buckets {};
+
+        /// Number of durations.
+        std::uint64_t m_count {0};
+
+        /// Sum of the durations.
+        double m_total {0.};
+
+        /// Longest duration.
+        double m_max {0.};
+    };
+
+    /// Copy of the metrics at a given time.
+    struct Snapshot
+    {
+        /// Number of tasks waiting to be run.
+        std::int64_t m_queueDepth {0};
+
+        /// Maximum number of tasks that have been waiting to be run.
+        std::int64_t m_maxQueueDepth {0};
+
+        /// Latencies between the posting and the start of the tasks.
+        Histogram m_latency;
+
+        /// Run times of all tasks.
+        Histogram m_runTime;
+
+        /// Run times of the tasks, per task name.
+        std::map<std::string, Histogram> m_runTimeByName;
+
+        /// CPU time consumed by the tasks, per task name, in microseconds.
+        std::map<std::string, double> m_cpuTimeByName;
+    };
+
+    typedef core::com::Signal<void (Snapshot)> UpdatedSignalType;
+
+    CORE_API WorkerMetrics();
+    CORE_API ~WorkerMetrics();
+
+    /// Returns a copy of the current metrics.
+    CORE_API Snapshot getSnapshot() const;
+
+    /// Resets the histograms and the maximum queue depth. The current queue depth is kept.
+    CORE_API void reset();
+
+    /**
+     * @brief Removes the metrics recorded for a task name.
+     * @return the run times and the CPU time of the removed tasks
+     */
+    CORE_API std::pair<Histogram, double> extract(const std::string& _name);
+
+    /// Sets the minimum period between two publications of the metrics, in milliseconds. 0 disables the publication.
+    CORE_API void setPublicationPeriod(std::uint64_t _period);
+
+    /// Returns the signal used to publish the metrics.
+    CORE_API SPTR(UpdatedSignalType) getSignal() const;
+
+    /**
+     * @name Recording
+     * These functions are called by the worker.
+     * @{ */
+
+    /// Records that a task has been posted.
+    CORE_API void taskPosted() noexcept;
+
+    /// Records that a task has started.
+    CORE_API void taskStarted(ClockType::time_point _posted, ClockType::time_point _started);
+
+    /**
+     * @brief Records that a task has completed, and publishes the metrics if the publication period has elapsed.
+     * @param _cpuTime CPU time consumed by the task, in microseconds
+     */
+    CORE_API void taskFinished(
+        const char* _name,
+        ClockType::time_point _started,
+        ClockType::time_point _finished,
+        double _cpuTime
+    );
+    /**  @} */
+
+private:
+
+    /// Returns a copy of the current metrics, m_mutex must be locked.
+    Snapshot getSnapshotNoLock() const;
+
+    /// Number of tasks waiting to be run.
+    std::atomic_int64_t m_queueDepth {0};
+
+    /// Maximum number of tasks that have been waiting to be run.
+    std::atomic_int64_t m_maxQueueDepth {0};
+
+    /// Protects the histograms and the publication time.
+    mutable std::mutex m_mutex;
+
+    /// Latencies between the posting and the start of the tasks.
+    Histogram m_latency;
+
+    /// Run times of all tasks.
+    Histogram m_runTime;
+
+    /// Run times per task name. Task names are not copied, they must outlive the metrics.
+    std::map<const char*, Histogram> m_runTimeByName;
+
+    /// CPU time per task name.
+    std::map<const char*, double> m_cpuTimeByName;
+
+    /// Minimum period between two publications, in milliseconds.
+    std::uint64_t m_publicationPeriod {1000};
+
+    /// Time of the last publication.
+    ClockType::time_point m_lastPublication;
+
+    /// Signal used to publish the metrics.
+    SPTR(UpdatedSignalType) m_signal;
+};
+
+} // namespace sight::core::thread
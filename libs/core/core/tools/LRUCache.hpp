@@ -0,0 +1,143 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <optional>
+#include <utility>
+
+namespace sight::core::tools
+{
+
+/**
+ * @brief Bounded cache keeping the most recently used values.
+ *
+ * When the cache is full, inserting a new value removes the least recently used one. Inserting or getting a value
+ * marks it as the most recently used.
+ *
+ * This class is not thread-safe.
+ */
+template<typename KEY, typename VALUE>
+class LRUCache
+{
+public:
+
+    /// Builds a cache keeping at most _capacity values.
+    LRUCache(std::size_t _capacity) :
+        m_capacity(_capacity)
+    {
+    }
+
+    /// Inserts or replaces the value of a key.
+    void insert(const KEY& _key, const VALUE& _value)
+    {
+        this->erase(_key);
+
+        m_values.emplace_front(_key, _value);
+        m_index[_key] = m_values.begin();
+
+        this->shrink();
+    }
+
+    /// Returns the value of a key, if it is in the cache.
+    std::optional<VALUE> get(const KEY& _key)
+    {
+        const auto it = m_index.find(_key);
+        if(it == m_index.end())
+        {
+            return std::nullopt;
+        }
+
+        // Moves the value to the front
+        m_values.splice(m_values.begin(), m_values, it->second);
+        return it->second->second;
+    }
+
+    /// Returns true if the key is in the cache, it does not change its use.
+    bool contains(const KEY& _key) const
+    {
+        return m_index.find(_key) != m_index.end();
+    }
+
+    /// Removes the value of a key.
+    void erase(const KEY& _key)
+    {
+        const auto it = m_index.find(_key);
+        if(it != m_index.end())
+        {
+            m_values.erase(it->second);
+            m_index.erase(it);
+        }
+    }
+
+    /// Removes all the values.
+    void clear()
+    {
+        m_values.clear();
+        m_index.clear();
+    }
+
+    /// Returns the number of values.
+    std::size_t size() const
+    {
+        return m_values.size();
+    }
+
+    /// Returns the maximum number of values.
+    std::size_t getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /// Sets the maximum number of values, the least recently used ones are removed if needed.
+    void setCapacity(std::size_t _capacity)
+    {
+        m_capacity = _capacity;
+        this->shrink();
+    }
+
+private:
+
+    typedef std::list<std::pair<KEY, VALUE> > ValueListType;
+
+    /// Removes the least recently used values exceeding the capacity.
+    void shrink()
+    {
+        while(m_values.size() > m_capacity)
+        {
+            m_index.erase(m_values.back().first);
+            m_values.pop_back();
+        }
+    }
+
+    /// Maximum number of values.
+    std::size_t m_capacity;
+
+    /// Values, from the most recently used to the least recently used.
+    ValueListType m_values;
+
+    /// Position of the values in m_values.
+    std::map<KEY, typename ValueListType::iterator> m_index;
+};
+
+} // namespace sight::core::tools
@@ -38,6 +38,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <signal.h>
+#include <time.h>
 #endif
 
 #include <random>
@@ -93,6 +94,38 @@ int System::getPID() noexcept
 
 //------------------------------------------------------------------------------
 
+double System::getThreadCPUTime() noexcept
+{
+#ifdef WIN32
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if(!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+    {
+        return 0.;
+    }
+
+    // FILETIME values are expressed in 100 nanoseconds units
+    const auto toMicroSec = [](const FILETIME& _time)
+                            {
+                                ULARGE_INTEGER value;
+                                value.LowPart  = _time.dwLowDateTime;
+                                value.HighPart = _time.dwHighDateTime;
+                                return static_cast<double>(value.QuadPart) / 10.;
+                            };
+
+    return toMicroSec(kernelTime) + toMicroSec(userTime);
+#else
+    timespec time;
+    if(clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0)
+    {
+        return 0.;
+    }
+
+    return static_cast<double>(time.tv_sec) * 1e6 + static_cast<double>(time.tv_nsec) / 1e3;
+#endif
+}
+
+//------------------------------------------------------------------------------
+
 const std::filesystem::path& System::getTempPath() noexcept
 {
     namespace fs = std::filesystem;
@@ -82,6 +82,11 @@ public:
      */
     CORE_API static int getPID() noexcept;
 
+    /**
+     *  @brief  Returns the CPU time consumed by the calling thread, in microseconds
+     */
+    CORE_API static double getThreadCPUTime() noexcept;
+
     /**
      * @brief   Test if process is Active
      * @return  true if the process is running
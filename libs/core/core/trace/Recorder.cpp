@@ -0,0 +1,461 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "core/trace/Recorder.hpp"
+
+#include "core/exceptionmacros.hpp"
+#include "core/tools/System.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace sight::core::trace
+{
+
+std::atomic_bool Recorder::s_enabled {false};
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+
+/// Ring buffer of one thread. Only the owning thread writes, collect() reads.
+struct ThreadBuffer
+{
+    ThreadBuffer(std::size_t _capacity, std::uint64_t _threadId) :
+        m_events(_capacity),
+        m_mask(_capacity - 1),
+        m_threadId(_threadId)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    void push(const Recorder::Event& _event) noexcept
+    {
+        const std::uint64_t index = m_writeIndex.load(std::memory_order_relaxed);
+        m_events[index & m_mask] = _event;
+        m_writeIndex.store(index + 1, std::memory_order_release);
+    }
+
+    std::vector<Recorder::Event> m_events;
+    const std::uint64_t m_mask;
+    const std::uint64_t m_threadId;
+
+    /// Total number of events written since the creation of the buffer.
+    std::atomic_uint64_t m_writeIndex {0};
+    /// Events before this index have been discarded by clear().
+    std::atomic_uint64_t m_readIndex {0};
+    /// False once the owning thread has exited.
+    std::atomic_bool m_alive {true};
+
+    /// Name of the thread, protected by the registry mutex.
+    std::string m_threadName;
+};
+
+/// Holds the buffers of all threads and the interned strings.
+struct Registry
+{
+    std::mutex m_mutex;
+    std::vector<std::shared_ptr<ThreadBuffer> > m_buffers;
+    std::unordered_set<std::string> m_strings;
+    std::size_t m_capacity {1 << 15};
+    std::uint64_t m_nextThreadId {1};
+    std::atomic_uint64_t m_nextFlowId {1};
+    const std::chrono::steady_clock::time_point m_origin {std::chrono::steady_clock::now()};
+};
+
+//------------------------------------------------------------------------------
+
+Registry& registry()
+{
+    static Registry s_registry;
+    return s_registry;
+}
+
+/// Owns the buffer of the current thread and flags it as dead when the thread exits.
+struct LocalBuffer
+{
+    LocalBuffer()
+    {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.m_mutex);
+        m_buffer = std::make_shared<ThreadBuffer>(reg.m_capacity, reg.m_nextThreadId++);
+        reg.m_buffers.push_back(m_buffer);
+    }
+
+    ~LocalBuffer()
+    {
+        m_buffer->m_alive = false;
+    }
+
+    std::shared_ptr<ThreadBuffer> m_buffer;
+};
+
+//------------------------------------------------------------------------------
+
+ThreadBuffer& localBuffer()
+{
+    thread_local LocalBuffer s_local;
+    return *s_local.m_buffer;
+}
+
+//------------------------------------------------------------------------------
+
+inline void record(Recorder::EventType _type, const char* _category, const char* _name, double _value,
+                   std::uint64_t _id) noexcept
+{
+    const auto elapsed = std::chrono::steady_clock::now() - registry().m_origin;
+
+    Recorder::Event event;
+    event.m_timestamp = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                       elapsed).count());
+    event.m_category = _category;
+    event.m_name     = _name;
+    event.m_value    = _value;
+    event.m_id       = _id;
+    event.m_type     = _type;
+
+    localBuffer().push(event);
+}
+
+//------------------------------------------------------------------------------
+
+void writeJsonString(std::ostream& _stream, const char* _str)
+{
+    _stream << '"';
+    for(const char* c = _str ? _str : ""; *c != '\0'; ++c)
+    {
+        switch(*c)
+        {
+            case '"':
+                _stream << "\\\"";
+                break;
+
+            case '\\':
+                _stream << "\\\\";
+                break;
+
+            case '\n':
+                _stream << "\\n";
+                break;
+
+            case '\t':
+                _stream << "\\t";
+                break;
+
+            default:
+                if(static_cast<unsigned char>(*c) < 0x20)
+                {
+                    _stream << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                            << static_cast<int>(*c) << std::dec << std::setfill(' ');
+                }
+                else
+                {
+                    _stream << *c;
+                }
+        }
+    }
+
+    _stream << '"';
+}
+
+//------------------------------------------------------------------------------
+
+const char* phase(Recorder::EventType _type)
+{
+    switch(_type)
+    {
+        case Recorder::EventType::BEGIN:
+            return "B";
+
+        case Recorder::EventType::END:
+            return "E";
+
+        case Recorder::EventType::COUNTER:
+            return "C";
+
+        case Recorder::EventType::FLOW_BEGIN:
+            return "s";
+
+        case Recorder::EventType::FLOW_END:
+            return "f";
+
+        default:
+            return "i";
+    }
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+void Recorder::setEnabled(bool _enabled) noexcept
+{
+    s_enabled.store(_enabled, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+
+void Recorder::setBufferCapacity(std::size_t _capacity)
+{
+    std::size_t capacity = 1;
+    while(capacity < _capacity)
+    {
+        capacity <<= 1;
+    }
+
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.m_mutex);
+    reg.m_capacity = capacity;
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t Recorder::getBufferCapacity()
+{
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.m_mutex);
+    return reg.m_capacity;
+}
+
+//------------------------------------------------------------------------------
+
+void Recorder::begin(const char* _category, const char* _name) noexcept
+{
+    record(EventType::BEGIN, _category, _name, 0., 0);
+}
+
+//------------------------------------------------------------------------------
+
+void Recorder::end(const char* _category, const char* _name) noexcept
+{
+    record(EventType::END, _category, _name, 0., 0);
+}
+
+//------------------------------------------------------------------------------
+
+void Recorder::instant(const char* _category, const char* _name) noexcept
+{
+    record(EventType::INSTANT, _category, _name, 0., 0);
+}
+
+//------------------------------------------------------------------------------
+
+void Recorder::counter(const char* _category, const char* _name, double _value) noexcept
+{
+    record(EventType::COUNTER, _category, _name, _value, 0);
+}
+
+//------------------------------------------------------------------------------
+
+void Recorder::flowBegin(const char* _category, const char* _name, std::uint64_t _id) noexcept
+{
+    record(EventType::FLOW_BEGIN, _category, _name, 0., _id);
+}
+
+//------------------------------------------------------------------------------
+
+void Recorder::flowEnd(const char* _category, const char* _name, std::uint64_t _id) noexcept
+{
+    record(EventType::FLOW_END, _category, _name, 0., _id);
+}
+
+//------------------------------------------------------------------------------
+
+std::uint64_t Recorder::newFlowId() noexcept
+{
+    return registry().m_nextFlowId.fetch_add(1, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+
+const char* Recorder::intern(const std::string& _str)
+{
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.m_mutex);
+    return reg.m_strings.insert(_str).first->c_str();
+}
+
+//------------------------------------------------------------------------------
+
+void Recorder::setThreadName(const std::string& _name)
+{
+    ThreadBuffer& buffer = localBuffer();
+
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.m_mutex);
+    buffer.m_threadName = _name;
+}
+
+//------------------------------------------------------------------------------
+
+void Recorder::clear()
+{
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.m_mutex);
+
+    reg.m_buffers.erase(
+        std::remove_if(
+            reg.m_buffers.begin(),
+            reg.m_buffers.end(),
+            [](const std::shared_ptr<ThreadBuffer>& _buffer)
+        {
+            return !_buffer->m_alive;
+        }),
+        reg.m_buffers.end());
+
+    for(const auto& buffer : reg.m_buffers)
+    {
+        buffer->m_readIndex = buffer->m_writeIndex.load(std::memory_order_acquire);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<Recorder::ThreadEvents> Recorder::collect()
+{
+    std::vector<ThreadEvents> result;
+
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.m_mutex);
+
+    for(const auto& buffer : reg.m_buffers)
+    {
+        const std::uint64_t capacity = buffer->m_mask + 1;
+        const std::uint64_t end      = buffer->m_writeIndex.load(std::memory_order_acquire);
+        std::uint64_t begin          = std::max(buffer->m_readIndex.load(), end > capacity ? end - capacity : 0);
+
+        std::vector<Event> events;
+        events.reserve(static_cast<std::size_t>(end - begin));
+        for(std::uint64_t i = begin ; i < end ; ++i)
+        {
+            events.push_back(buffer->m_events[static_cast<std::size_t>(i & buffer->m_mask)]);
+        }
+
+        // The owning thread may have overwritten the oldest events while we were copying them
+        const std::uint64_t newEnd = buffer->m_writeIndex.load(std::memory_order_acquire);
+        if(newEnd > capacity && newEnd - capacity > begin)
+        {
+            const auto overwritten = std::min<std::uint64_t>(newEnd - capacity - begin, events.size());
+            events.erase(events.begin(), events.begin() + static_cast<std::ptrdiff_t>(overwritten));
+        }
+
+        if(!events.empty() || !buffer->m_threadName.empty())
+        {
+            ThreadEvents threadEvents;
+            threadEvents.m_threadId   = buffer->m_threadId;
+            threadEvents.m_threadName = buffer->m_threadName;
+            threadEvents.m_events     = std::move(events);
+            result.push_back(std::move(threadEvents));
+        }
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+void Recorder::writeChromeTrace(std::ostream& _stream)
+{
+    const int pid = core::tools::System::getPID();
+
+    const std::vector<ThreadEvents> threads = Recorder::collect();
+
+    const auto flags = _stream.flags();
+    _stream << std::fixed << std::setprecision(3);
+    _stream << "{\"traceEvents\":[";
+
+    bool first = true;
+    const auto separator =
+        [&]()
+        {
+            _stream << (first ? "\n" : ",\n");
+            first = false;
+        };
+
+    for(const auto& thread : threads)
+    {
+        if(!thread.m_threadName.empty())
+        {
+            separator();
+            _stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << thread.m_threadId
+                    << ",\"args\":{\"name\":";
+            writeJsonString(_stream, thread.m_threadName.c_str());
+            _stream << "}}";
+        }
+
+        for(const auto& event : thread.m_events)
+        {
+            separator();
+            _stream << "{\"name\":";
+            writeJsonString(_stream, event.m_name);
+            _stream << ",\"cat\":";
+            writeJsonString(_stream, event.m_category);
+            _stream << ",\"ph\":\"" << phase(event.m_type) << "\",\"ts\":"
+                    << static_cast<double>(event.m_timestamp) / 1000.
+                    << ",\"pid\":" << pid << ",\"tid\":" << thread.m_threadId;
+
+            switch(event.m_type)
+            {
+                case EventType::INSTANT:
+                    _stream << ",\"s\":\"t\"";
+                    break;
+
+                case EventType::COUNTER:
+                    _stream << ",\"args\":{\"value\":" << event.m_value << "}";
+                    break;
+
+                case EventType::FLOW_BEGIN:
+                    _stream << ",\"id\":" << event.m_id;
+                    break;
+
+                case EventType::FLOW_END:
+                    _stream << ",\"id\":" << event.m_id << ",\"bp\":\"e\"";
+                    break;
+
+                default:
+                    break;
+            }
+
+            _stream << "}";
+        }
+    }
+
+    _stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    _stream.flags(flags);
+}
+
+//------------------------------------------------------------------------------
+
+void Recorder::writeChromeTrace(const std::filesystem::path& _path)
+{
+    std::ofstream file(_path, std::ios::out | std::ios::trunc);
+    SIGHT_THROW_IF("Unable to open '" + _path.string() + "' for writing.", !file.good());
+    Recorder::writeChromeTrace(file);
+}
+
+} // namespace sight::core::trace
@@ -0,0 +1,270 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "core/config.hpp"
+
+#include <boost/preprocessor/cat.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Define FW_PROFILING_DISABLED before including this header if you need to remove the trace points at compile time
+
+namespace sight::core::trace
+{
+
+/**
+ * @brief Records timeline events into per-thread ring buffers and exports them as a Chrome trace.
+ *
+ * Recording is disabled by default and can be toggled at runtime with setEnabled(). When it is disabled, a trace
+ * point costs a single relaxed atomic load. When it is enabled, each thread writes into its own fixed-size ring
+ * buffer without any lock; the oldest events are overwritten when the buffer is full.
+ *
+ * The recorded events are:
+ * - scopes (begin/end pairs), usually recorded with FW_TRACE_SCOPE,
+ * - instant events,
+ * - counters, displayed as a graph over time,
+ * - flows, that link an event on one thread to an event on another thread (e.g. a signal emission and the
+ *   execution of the connected slot on a worker).
+ *
+ * Category and name strings are stored as raw pointers: they must outlive the recorder, which is the case for string
+ * literals. Dynamic strings must be passed through intern() first.
+ *
+ * The recorded events can be retrieved with collect() or written in the Chrome trace JSON format with
+ * writeChromeTrace(). The output can be loaded in chrome://tracing or https://ui.perfetto.dev.
+ */
+class CORE_CLASS_API Recorder
+{
+public:
+
+    /// Type of a recorded event.
+    enum class EventType : std::uint8_t
+    {
+        BEGIN,
+        END,
+        INSTANT,
+        COUNTER,
+        FLOW_BEGIN,
+        FLOW_END
+    };
+
+    /// A recorded event.
+    struct Event
+    {
+        /// Timestamp in nanoseconds, relative to the creation of the recorder.
+        std::uint64_t m_timestamp {0};
+        /// Category of the event.
+        const char* m_category {nullptr};
+        /// Name of the event.
+        const char* m_name {nullptr};
+        /// Value of a counter.
+        double m_value {0.};
+        /// Identifier of a flow.
+        std::uint64_t m_id {0};
+        /// Type of the event.
+        EventType m_type {EventType::INSTANT};
+    };
+
+    /// Events recorded by one thread.
+    struct ThreadEvents
+    {
+        /// Identifier of the thread in the trace.
+        std::uint64_t m_threadId {0};
+        /// Name of the thread, set with setThreadName().
+        std::string m_threadName;
+        /// Events, sorted by recording order.
+        std::vector<Event> m_events;
+    };
+
+    /// Returns true if the events are currently recorded.
+    static bool isEnabled() noexcept
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Enables or disables the recording of events.
+    CORE_API static void setEnabled(bool _enabled) noexcept;
+
+    /**
+     * @brief Sets the number of events kept per thread.
+     *
+     * The value is rounded up to the next power of two. It only applies to the threads that record their first event
+     * after this call.
+     */
+    CORE_API static void setBufferCapacity(std::size_t _capacity);
+
+    /// Returns the number of events kept per thread.
+    CORE_API static std::size_t getBufferCapacity();
+
+    /**
+     * @name Event recording
+     * These functions record an event on the calling thread, even if the recorder is disabled. Callers are expected
+     * to check isEnabled() first, which is what the FW_TRACE_* macros do.
+     * @{ */
+    CORE_API static void begin(const char* _category, const char* _name) noexcept;
+    CORE_API static void end(const char* _category, const char* _name) noexcept;
+    CORE_API static void instant(const char* _category, const char* _name) noexcept;
+    CORE_API static void counter(const char* _category, const char* _name, double _value) noexcept;
+    CORE_API static void flowBegin(const char* _category, const char* _name, std::uint64_t _id) noexcept;
+    CORE_API static void flowEnd(const char* _category, const char* _name, std::uint64_t _id) noexcept;
+    /**  @} */
+
+    /// Returns a new unique flow identifier.
+    CORE_API static std::uint64_t newFlowId() noexcept;
+
+    /// Returns a pointer to a copy of the given string that lives as long as the recorder.
+    CORE_API static const char* intern(const std::string& _str);
+
+    /// Sets the name of the calling thread, displayed in the trace.
+    CORE_API static void setThreadName(const std::string& _name);
+
+    /// Discards all the events recorded so far, and forgets the threads that have exited.
+    CORE_API static void clear();
+
+    /**
+     * @brief Returns a copy of the events recorded by every thread.
+     *
+     * It can be called while other threads are recording: events overwritten during the copy are discarded.
+     */
+    CORE_API static std::vector<ThreadEvents> collect();
+
+    /// Writes the recorded events in the Chrome trace JSON format.
+    CORE_API static void writeChromeTrace(std::ostream& _stream);
+
+    /// Writes the recorded events in the Chrome trace JSON format into a file.
+    CORE_API static void writeChromeTrace(const std::filesystem::path& _path);
+
+private:
+
+    /// Recording state, kept out of the functions to allow inlining isEnabled().
+    CORE_API static std::atomic_bool s_enabled;
+};
+
+/**
+ * @brief Records a scope (begin/end pair) from its construction to its destruction.
+ *
+ * The end is recorded if and only if the begin was, so the scopes stay balanced when the recorder is toggled.
+ */
+class Scope
+{
+public:
+
+    Scope(const char* _category, const char* _name) noexcept :
+        m_category(_category),
+        m_name(_name),
+        m_recording(Recorder::isEnabled())
+    {
+        if(m_recording)
+        {
+            Recorder::begin(m_category, m_name);
+        }
+    }
+
+    ~Scope()
+    {
+        if(m_recording)
+        {
+            Recorder::end(m_category, m_name);
+        }
+    }
+
+    Scope(const Scope&)            = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+
+    const char* m_category;
+    const char* m_name;
+    const bool m_recording;
+};
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Wraps a task that will be run on another thread, to link its execution to the current thread with a flow.
+ *
+ * When the recorder is enabled, a short "post" scope holding the beginning of the flow is recorded on the calling
+ * thread, and the returned task records its execution as a scope holding the end of the flow. Otherwise the task is
+ * returned untouched.
+ */
+inline std::function<void()> traceFlow(const char* _category, const char* _name, std::function<void()> _task)
+{
+    if(!Recorder::isEnabled())
+    {
+        return _task;
+    }
+
+    const std::uint64_t flowId = Recorder::newFlowId();
+
+    Recorder::begin(_category, "post");
+    Recorder::flowBegin(_category, _name, flowId);
+    Recorder::end(_category, "post");
+
+    return [_category, _name, flowId, task = std::move(_task)]()
+           {
+               Scope scope(_category, _name);
+               if(Recorder::isEnabled())
+               {
+                   Recorder::flowEnd(_category, _name, flowId);
+               }
+
+               task();
+           };
+}
+
+} // namespace sight::core::trace
+
+#ifndef FW_PROFILING_DISABLED
+/// Records a scope from this line to the end of the enclosing block
+#define FW_TRACE_SCOPE(_category, _name) \
+    sight::core::trace::Scope BOOST_PP_CAT(traceScope, __LINE__)(_category, _name);
+
+/// Records an instant event
+#define FW_TRACE_INSTANT(_category, _name) \
+    do \
+    { \
+        if(sight::core::trace::Recorder::isEnabled()) \
+        { \
+            sight::core::trace::Recorder::instant(_category, _name); \
+        } \
+    } while(0)
+
+/// Records the value of a counter
+#define FW_TRACE_COUNTER(_category, _name, _value) \
+    do \
+    { \
+        if(sight::core::trace::Recorder::isEnabled()) \
+        { \
+            sight::core::trace::Recorder::counter(_category, _name, static_cast<double>(_value)); \
+        } \
+    } while(0)
+#else // FW_PROFILING_DISABLED
+#define FW_TRACE_SCOPE(_category, _name)
+#define FW_TRACE_INSTANT(_category, _name) do {} while(0)
+#define FW_TRACE_COUNTER(_category, _name, _value) do {} while(0)
+#endif // FW_PROFILING_DISABLED
@@ -86,6 +86,7 @@ Array::Array(data::Object::Key) :
     m_nbOfComponents(0),
     m_isBufferOwner(true)
 {
+    m_bufferObject->setOwner(Array::classname());
 }
 
 //------------------------------------------------------------------------------
@@ -97,6 +98,19 @@ Array::~Array()
 
 //------------------------------------------------------------------------------
 
+void Array::setBuffersOwner(std::initializer_list<Array::sptr> arrays, const std::string& owner)
+{
+    for(const auto& array : arrays)
+    {
+        if(array)
+        {
+            array->m_bufferObject->setOwner(owner);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
 void Array::swap(Array::sptr _source)
 {
     m_fields.swap(_source->m_fields);
@@ -125,13 +139,25 @@ void Array::cachedDeepCopy(const Object::csptr& _source, DeepCopyCacheType& cach
 
     this->clear();
 
-    if(!other->m_bufferObject->isEmpty())
+    m_allocationPolicy = other->m_allocationPolicy;
+
+    if(!other->m_bufferObject->isEmpty() && other->m_isBufferOwner && m_bufferObject->isEmpty())
+    {
+        // The buffer is only copied when one of the arrays is locked for writing
+        m_strides        = other->m_strides;
+        m_type           = other->m_type;
+        m_size           = other->m_size;
+        m_nbOfComponents = other->m_nbOfComponents;
+        m_isBufferOwner  = true;
+        m_bufferObject->share(other->m_bufferObject);
+    }
+    else if(!other->m_bufferObject->isEmpty())
     {
         core::memory::BufferObject::Lock lockerDest(m_bufferObject);
         this->resizeTMP(other->m_type, other->m_size, other->m_nbOfComponents);
         char* buffDest = static_cast<char*>(lockerDest.getBuffer());
-        core::memory::BufferObject::Lock lockerSource(other->m_bufferObject);
-        char* buffSrc = static_cast<char*>(lockerSource.getBuffer());
+        core::memory::BufferObject::ConstLock lockerSource(other->m_bufferObject);
+        const char* buffSrc = static_cast<const char*>(lockerSource.getBuffer());
         std::copy(buffSrc, buffSrc + other->getSizeInBytes(), buffDest);
     }
     else
@@ -155,7 +181,7 @@ size_t Array::resize(const SizeType& size, bool reallocate)
     {
         if(m_bufferObject->isEmpty())
         {
-            m_bufferObject->allocate(bufSize);
+            m_bufferObject->allocate(bufSize, this->getAllocationPolicy());
         }
         else
         {
@@ -327,7 +353,7 @@ size_t Array::resize(
     {
         if(m_bufferObject->isEmpty())
         {
-            m_bufferObject->allocate(bufSize);
+            m_bufferObject->allocate(bufSize, this->getAllocationPolicy());
         }
         else
         {
@@ -379,6 +405,20 @@ const void* Array::getBuffer() const
 
 //------------------------------------------------------------------------------
 
+void Array::setAllocationPolicy(const core::memory::BufferAllocationPolicy::sptr& policy)
+{
+    m_allocationPolicy = policy;
+}
+
+//------------------------------------------------------------------------------
+
+core::memory::BufferAllocationPolicy::sptr Array::getAllocationPolicy() const
+{
+    return m_allocationPolicy ? m_allocationPolicy : core::memory::BufferAllocationPolicy::getDefault();
+}
+
+//------------------------------------------------------------------------------
+
 void Array::setBuffer(void* buf, bool takeOwnership, core::memory::BufferAllocationPolicy::sptr policy)
 {
     if(m_bufferObject)
@@ -432,14 +472,28 @@ const char* Array::getBufferPtr(const data::Array::IndexType& id) const
 
 //------------------------------------------------------------------------------
 
-core::memory::BufferObject::Lock Array::lock() const
+core::memory::BufferObject::Lock Array::lock()
 {
     return m_bufferObject->lock();
 }
 
 //------------------------------------------------------------------------------
 
+core::memory::BufferObject::ConstLock Array::lock() const
+{
+    return core::memory::BufferObject::csptr(m_bufferObject)->lock();
+}
+
+//------------------------------------------------------------------------------
+
 void Array::lockBuffer(std::vector<core::memory::BufferObject::Lock>& locks) const
+{
+    locks.push_back(m_bufferObject->lock());
+}
+
+//------------------------------------------------------------------------------
+
+void Array::lockBuffer(std::vector<core::memory::BufferObject::ConstLock>& locks) const
 {
     locks.push_back(this->lock());
 }
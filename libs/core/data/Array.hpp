@@ -31,6 +31,8 @@
 #include <core/memory/IBuffered.hpp>
 #include <core/tools/Type.hpp>
 
+#include <initializer_list>
+
 SIGHT_DECLARE_DATA_REFLECTION((sight) (data) (Array));
 
 namespace sight::data
@@ -317,6 +319,23 @@ public:
     /// Set buffer object
     void setBufferObject(const core::memory::BufferObject::sptr& bufferObj);
 
+    /**
+     * @brief Policy used to allocate the buffer when the array is resized
+     *
+     * When no policy is set, core::memory::BufferAllocationPolicy::getDefault() is used. A BufferAlignedPolicy allows
+     * the filters to assume aligned data.
+     * @{ */
+    DATA_API void setAllocationPolicy(const core::memory::BufferAllocationPolicy::sptr& policy);
+    DATA_API core::memory::BufferAllocationPolicy::sptr getAllocationPolicy() const;
+    /**  @} */
+
+    /**
+     * @brief Tags the buffers of the given arrays with the data that owns them, see BufferObject::setOwner()
+     *
+     * Null arrays are skipped.
+     */
+    DATA_API static void setBuffersOwner(std::initializer_list<Array::sptr> arrays, const std::string& owner);
+
     /// Exchanges the content of the Array with the content of _source.
     DATA_API void swap(Array::sptr _source);
 
@@ -407,7 +426,8 @@ public:
         /// allow to create a ConstIterator from an Iterator
         friend class IteratorBase<TYPE, true>;
 
-        core::memory::BufferObject::Lock m_lock;
+        typename std::conditional<isConstIterator, core::memory::BufferObject::ConstLock,
+                                  core::memory::BufferObject::Lock>::type m_lock;
         pointer m_pointer {nullptr};
         difference_type m_idx {0};
         difference_type m_numberOfElements {0};
@@ -447,8 +467,14 @@ public:
      * maintained, the buffer will not be dumped.
      *
      * An exception will be raised  if you try to access while the array is not locked.
+     *
+     * The lock of a non-const array gives a write access: a buffer shared with a copy of the array is copied first.
+     * The lock of a const array keeps the buffer shared.
+     * @{
      */
-    [[nodiscard]] DATA_API core::memory::BufferObject::Lock lock() const;
+    [[nodiscard]] DATA_API core::memory::BufferObject::Lock lock();
+    [[nodiscard]] DATA_API core::memory::BufferObject::ConstLock lock() const;
+    /// @}
 
     /**
      * @brief Get the value of an element
@@ -713,8 +739,11 @@ protected:
      * @brief Add a lock on the array in the given vector to prevent from dumping the buffer on the disk
      *
      * This is needed for IBuffered interface implementation
+     * @{
      */
     DATA_API void lockBuffer(std::vector<core::memory::BufferObject::Lock>& locks) const override;
+    DATA_API void lockBuffer(std::vector<core::memory::BufferObject::ConstLock>& locks) const override;
+    /// @}
 
     /**
      * @brief Compute strides for given parameters
@@ -763,6 +792,7 @@ private:
     SizeType m_size;
     size_t m_nbOfComponents;
     bool m_isBufferOwner;
+    core::memory::BufferAllocationPolicy::sptr m_allocationPolicy;
 };
 
 //-----------------------------------------------------------------------------
@@ -79,6 +79,27 @@ void BufferTL::pushObject(const SPTR(data::timeline::Object)& obj)
 
 //------------------------------------------------------------------------------
 
+void BufferTL::pushObjects(const std::vector<SPTR(data::timeline::Object)>& objects)
+{
+    core::mt::WriteLock writeLock(m_tlMutex);
+    for(const auto& obj : objects)
+    {
+        // This check is important for inherited classes
+        SIGHT_ASSERT("Trying to push not compatible Object in the BufferTL.", isObjectValid(obj));
+
+        if(m_timeline.size() >= m_maximumSize)
+        {
+            m_timeline.erase(m_timeline.begin());
+        }
+
+        // Sorted buffers are inserted at the end in constant time
+        SPTR(data::timeline::Buffer) srcObj = std::dynamic_pointer_cast<data::timeline::Buffer>(obj);
+        m_timeline.emplace_hint(m_timeline.end(), obj->getTimestamp(), srcObj);
+    }
+}
+
+//------------------------------------------------------------------------------
+
 SPTR(data::timeline::Object) BufferTL::popObject(TimestampType timestamp)
 {
     const auto itFind = m_timeline.find(timestamp);
@@ -29,6 +29,8 @@
 #include <boost/array.hpp>
 #include <boost/pool/poolfwd.hpp>
 
+#include <vector>
+
 SIGHT_DECLARE_DATA_REFLECTION((sight) (data) (BufferTL));
 
 namespace sight::data
@@ -81,6 +83,14 @@ public:
     /// Push a buffer to the timeline
     DATA_API void pushObject(const SPTR(data::timeline::Object)& obj) override;
 
+    /**
+     * @brief Push several buffers to the timeline at once
+     *
+     * The timeline is locked only once, which is faster than pushing the buffers one by one when many of them are
+     * available, i.e. when a recording is replayed. The buffers should be sorted by increasing timestamps.
+     */
+    DATA_API void pushObjects(const std::vector<SPTR(data::timeline::Object)>& objects);
+
     /// Remove a buffer to the timeline
     DATA_API SPTR(data::timeline::Object) popObject(TimestampType timestamp) override;
 
@@ -93,18 +93,13 @@ void DicomSeries::cachedDeepCopy(const data::Object::csptr& _source, DeepCopyCac
     for(const auto& elt : other->m_dicomContainer)
     {
         const core::memory::BufferObject::sptr& bufferSrc = elt.second;
-        core::memory::BufferObject::Lock lockerSource(bufferSrc);
 
         if(!bufferSrc->isEmpty())
         {
+            // The instance is only copied when one of the series modifies it
             core::memory::BufferObject::sptr bufferDest = core::memory::BufferObject::New();
-            core::memory::BufferObject::Lock lockerDest(bufferDest);
-
-            bufferDest->allocate(bufferSrc->getSize());
-
-            char* buffDest = static_cast<char*>(lockerDest.getBuffer());
-            char* buffSrc  = static_cast<char*>(lockerSource.getBuffer());
-            std::copy(buffSrc, buffSrc + bufferSrc->getSize(), buffDest);
+            bufferDest->setOwner(DicomSeries::classname());
+            bufferDest->share(bufferSrc);
 
             m_dicomContainer[elt.first] = bufferDest;
         }
@@ -128,6 +123,7 @@ void DicomSeries::addDicomPath(std::size_t _instanceIndex, const std::filesystem
 
     core::memory::BufferObject::sptr buffer = core::memory::BufferObject::New();
     const auto buffSize                     = std::filesystem::file_size(_path);
+    buffer->setOwner(DicomSeries::classname());
     buffer->setIStreamFactory(
         std::make_shared<core::memory::stream::in::Raw>(_path),
         static_cast<core::memory::BufferObject::SizeType>(buffSize),
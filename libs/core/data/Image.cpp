@@ -68,6 +68,8 @@ Image::Image(data::Object::Key) :
     newSignal<SliceTypeModifiedSignalType>(s_SLICE_TYPE_MODIFIED_SIG);
     newSignal<VisibilityModifiedSignalType>(s_VISIBILITY_MODIFIED_SIG);
     newSignal<TransparencyModifiedSignalType>(s_TRANSPARENCY_MODIFIED_SIG);
+
+    m_dataArray->getBufferObject()->setOwner(Image::classname());
 }
 
 //------------------------------------------------------------------------------
@@ -126,6 +128,7 @@ size_t Image::resize()
     if(!m_dataArray)
     {
         m_dataArray = data::Array::New();
+        m_dataArray->getBufferObject()->setOwner(Image::classname());
     }
 
     SIGHT_ASSERT("NumberOfComponents must be > 0", m_numberOfComponents > 0);
@@ -290,14 +293,28 @@ size_t Image::getAllocatedSizeInBytes() const
 
 //------------------------------------------------------------------------------
 
-core::memory::BufferObject::Lock Image::lock() const
+core::memory::BufferObject::Lock Image::lock()
 {
     return m_dataArray->lock();
 }
 
 //------------------------------------------------------------------------------
 
+core::memory::BufferObject::ConstLock Image::lock() const
+{
+    return data::Array::csptr(m_dataArray)->lock();
+}
+
+//------------------------------------------------------------------------------
+
 void Image::lockBuffer(std::vector<core::memory::BufferObject::Lock>& locks) const
+{
+    locks.push_back(m_dataArray->lock());
+}
+
+//------------------------------------------------------------------------------
+
+void Image::lockBuffer(std::vector<core::memory::BufferObject::ConstLock>& locks) const
 {
     locks.push_back(this->lock());
 }
@@ -468,6 +485,20 @@ core::memory::BufferObject::csptr Image::getBufferObject() const
 
 //------------------------------------------------------------------------------
 
+void Image::setAllocationPolicy(const core::memory::BufferAllocationPolicy::sptr& policy)
+{
+    m_dataArray->setAllocationPolicy(policy);
+}
+
+//------------------------------------------------------------------------------
+
+core::memory::BufferAllocationPolicy::sptr Image::getAllocationPolicy() const
+{
+    return m_dataArray->getAllocationPolicy();
+}
+
+//------------------------------------------------------------------------------
+
 void Image::setIStreamFactory(
     const SPTR(core::memory::stream::in::IFactory)& factory,
     const size_t size,
@@ -475,6 +506,36 @@ void Image::setIStreamFactory(
     const core::memory::FileFormatType format,
     const core::memory::BufferAllocationPolicy::sptr& policy
 )
+{
+    this->resizeArrayInformation();
+    m_dataArray->getBufferObject()->setIStreamFactory(
+        factory,
+        size,
+        sourceFile,
+        format,
+        policy ? policy : m_dataArray->getAllocationPolicy()
+    );
+}
+
+//------------------------------------------------------------------------------
+
+void Image::mapFile(const std::filesystem::path& file, size_t offset)
+{
+    // The previous buffer is released, like when a new buffer is set
+    this->setBuffer(nullptr, true, m_dataArray->getAllocationPolicy());
+
+    this->resizeArrayInformation();
+    m_dataArray->getBufferObject()->mapFile(
+        file,
+        offset,
+        m_dataArray->getSizeInBytes(),
+        m_dataArray->getAllocationPolicy()
+    );
+}
+
+//------------------------------------------------------------------------------
+
+void Image::resizeArrayInformation()
 {
     const auto imageDims = this->getNumberOfDimensions();
     data::Array::SizeType arraySize(imageDims);
@@ -493,7 +554,6 @@ void Image::setIStreamFactory(
     }
 
     m_dataArray->resize(arraySize, m_type, false);
-    m_dataArray->getBufferObject()->setIStreamFactory(factory, size, sourceFile, format, policy);
 }
 
 //------------------------------------------------------------------------------
@@ -553,14 +553,28 @@ public:
      * maintained, the buffer will not be dumped.
      *
      * An exception will be raised if you try to access while the array is not locked.
+     *
+     * The lock of a non-const image gives a write access: a buffer shared with a copy of the image is copied first.
+     * The lock of a const image keeps the buffer shared.
+     * @{
      */
-    [[nodiscard]] DATA_API core::memory::BufferObject::Lock lock() const;
+    [[nodiscard]] DATA_API core::memory::BufferObject::Lock lock();
+    [[nodiscard]] DATA_API core::memory::BufferObject::ConstLock lock() const;
+    /// @}
 
     /// Return the buffer object
     DATA_API core::memory::BufferObject::sptr getBufferObject();
 
     /// Return the buffer object
     DATA_API core::memory::BufferObject::csptr getBufferObject() const;
+
+    /**
+     * @brief Policy used to allocate the image buffer, see data::Array::setAllocationPolicy()
+     * @{ */
+    DATA_API void setAllocationPolicy(const core::memory::BufferAllocationPolicy::sptr& policy);
+    DATA_API core::memory::BufferAllocationPolicy::sptr getAllocationPolicy() const;
+    /**  @} */
+
     /**
      * @brief Set a stream factory for the image's buffer manager
      *
@@ -570,16 +584,29 @@ public:
      * @param size size of data provided by the stream
      * @param sourceFile Filesystem path of the source file, if applicable
      * @param format file format (RAW,RAWZ,OTHER), if sourceFile is provided
-     * @param policy Buffer allocation policy
+     * @param policy Buffer allocation policy, the image allocation policy if null
      */
     DATA_API void setIStreamFactory(
         const SPTR(core::memory::stream::in::IFactory)& factory,
         const size_t size,
         const std::filesystem::path& sourceFile                  = "",
         const core::memory::FileFormatType format                = core::memory::OTHER,
-        const core::memory::BufferAllocationPolicy::sptr& policy = core::memory::BufferMallocPolicy::New()
+        const core::memory::BufferAllocationPolicy::sptr& policy = nullptr
     );
 
+    /**
+     * @brief Maps the image's buffer on the pixels stored in a raw file
+     *
+     * The size, type and number of components of the image must be set. The pixels are read by the system when they
+     * are accessed, without any copy. The modifications of the image are never written to the file, but the file must
+     * not be modified or removed while the image uses it.
+     *
+     * @param file file holding the pixels in the image's type and in the native byte order
+     * @param offset position of the first pixel in the file
+     * @throw core::memory::exception::Memory if the file can not be mapped
+     */
+    DATA_API void mapFile(const std::filesystem::path& file, size_t offset = 0);
+
     // ---------------------------------------
     // Deprecated API
     // ---------------------------------------
@@ -688,11 +715,17 @@ protected:
      *
      * This is needed for IBuffered interface implementation
      * The buffer cannot be accessed if the image is not locked
+     * @{
      */
     DATA_API void lockBuffer(std::vector<core::memory::BufferObject::Lock>& locks) const override;
+    DATA_API void lockBuffer(std::vector<core::memory::BufferObject::ConstLock>& locks) const override;
+    /// @}
 
 private:
 
+    /// Resizes the array to the size of the image, with the components in the first dimension, without allocation.
+    void resizeArrayInformation();
+
     /**
      * @brief Protected setter for the array buffer.
      * An existing buffer will be released if the array own it.
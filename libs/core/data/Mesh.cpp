@@ -27,7 +27,9 @@
 
 #include <core/com/Signal.hxx>
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <numeric>
 
@@ -38,6 +40,40 @@ namespace sight::data
 #define CELL_REALLOC_STEP 1000
 #define CELLDATA_REALLOC_STEP 1000
 
+//------------------------------------------------------------------------------
+
+/// Returns the new capacity of an array holding 'allocated' elements that must store at least 'required' elements.
+/// The capacity grows by half of its size, thus n insertions only trigger O(log(n)) reallocations.
+inline static size_t computeCapacity(size_t allocated, size_t required, size_t minStep)
+{
+    return std::max(required, allocated + std::max(allocated / 2, minStep));
+}
+
+//------------------------------------------------------------------------------
+
+/// Returns the number of points of a cell type, or 0 if it is variable.
+inline static Mesh::Size getNumberOfPointsPerCell(Mesh::CellType type)
+{
+    switch(type)
+    {
+        case Mesh::CellType::POINT:
+            return 1;
+
+        case Mesh::CellType::EDGE:
+            return 2;
+
+        case Mesh::CellType::TRIANGLE:
+            return 3;
+
+        case Mesh::CellType::QUAD:
+        case Mesh::CellType::TETRA:
+            return 4;
+
+        default:
+            return 0;
+    }
+}
+
 SIGHT_REGISTER_DATA(sight::data::Mesh);
 
 //------------------------------------------------------------------------------
@@ -81,6 +117,13 @@ Mesh::Mesh(data::Object::Key) :
     m_cellTypes->setType(core::tools::Type::create<CellTypes>());
     m_cellData->setType(core::tools::Type::create<CellId>());
     m_cellDataOffsets->setType(core::tools::Type::create<CellId>());
+
+    data::Array::setBuffersOwner(
+        {m_points, m_cellTypes, m_cellData, m_cellDataOffsets, m_pointColors, m_cellColors, m_pointNormals,
+         m_cellNormals, m_pointTexCoords, m_cellTexCoords
+        },
+        Mesh::classname()
+    );
 }
 
 //------------------------------------------------------------------------------
@@ -157,6 +200,13 @@ void Mesh::cachedDeepCopy(const Object::csptr& _source, DeepCopyCacheType& cache
     m_cellTexCoords  = data::Object::copy(other->m_cellTexCoords, cache);
     m_pointTexCoords = data::Object::copy(other->m_pointTexCoords, cache);
 
+    data::Array::setBuffersOwner(
+        {m_points, m_cellTypes, m_cellData, m_cellDataOffsets, m_pointColors, m_cellColors, m_pointNormals,
+         m_cellNormals, m_pointTexCoords, m_cellTexCoords
+        },
+        Mesh::classname()
+    );
+
     m_arrayMap.clear();
     for(const ArrayMapType::value_type& element : other->m_arrayMap)
     {
@@ -613,14 +663,9 @@ size_t Mesh::getAllocatedSizeInBytes() const
 
 Mesh::PointId Mesh::pushPoint(const PointValueType p[3])
 {
-    Size nbPoints       = m_nbPoints;
-    size_t allocatedPts = m_points->empty() ? 0 : m_points->getSize().at(0);
-
-    if(allocatedPts <= nbPoints)
-    {
-        m_points->resizeTMP({allocatedPts + POINT_REALLOC_STEP}, 3);
-    }
+    const Size nbPoints = m_nbPoints;
 
+    this->growPointArrays(nbPoints + 1);
     this->setPoint(nbPoints, p);
 
     ++m_nbPoints;
@@ -722,37 +767,146 @@ Mesh::CellId Mesh::pushCell(
 
     Size nbCells = m_nbCells;
 
-    const size_t allocatedCellTypes       = m_cellTypes->empty() ? 0 : m_cellTypes->getSize().at(0);
-    const size_t allocatedCellDataOffsets = m_cellDataOffsets->empty() ? 0 : m_cellDataOffsets->getSize().at(0);
-    const size_t allocatedCellData        = m_cellData->empty() ? 0 : m_cellData->getSize().at(0);
+    this->growCellArrays(nbCells + 1, m_cellsDataSize + nbPoints);
 
-    if(allocatedCellTypes <= nbCells)
+    m_cellTypes->at<CellTypes>(nbCells) = static_cast<CellTypes>(type);
+    for(size_t i = 0 ; i < nbPoints ; ++i)
     {
-        m_cellTypes->resize({allocatedCellTypes + CELL_REALLOC_STEP});
+        const PointId cellValue = pointIds[i];
+        m_cellData->at<CellId>(m_cellsDataSize + i) = cellValue;
     }
 
-    if(allocatedCellDataOffsets <= nbCells)
+    m_cellDataOffsets->at<CellId>(nbCells) = m_cellsDataSize;
+
+    m_cellsDataSize += nbPoints;
+    ++m_nbCells;
+    return nbCells;
+}
+
+//------------------------------------------------------------------------------
+
+Mesh::PointId Mesh::pushPoints(const PointValueType* points, Size nbPoints)
+{
+    const Size firstId = m_nbPoints;
+    if(nbPoints == 0)
     {
-        m_cellDataOffsets->resize({allocatedCellDataOffsets + CELL_REALLOC_STEP});
+        return firstId;
     }
 
-    if(allocatedCellData < m_cellsDataSize + nbPoints)
+    this->growPointArrays(firstId + nbPoints);
+
+    auto* buffer = static_cast<PointValueType*>(m_points->getBuffer());
+    std::memcpy(buffer + 3 * size_t(firstId), points, 3 * size_t(nbPoints) * sizeof(PointValueType));
+
+    m_nbPoints += nbPoints;
+    return firstId;
+}
+
+//------------------------------------------------------------------------------
+
+Mesh::CellId Mesh::pushCells(CellType type, const PointId* pointIds, Size nbCells)
+{
+    const Size nbPointsPerCell = getNumberOfPointsPerCell(type);
+    SIGHT_THROW_EXCEPTION_IF(
+        data::Exception("Only cells with a fixed number of points can be pushed at once"),
+        nbPointsPerCell == 0
+    );
+
+    const Size firstId = m_nbCells;
+    if(nbCells == 0)
     {
-        m_cellData->resize({allocatedCellData + CELLDATA_REALLOC_STEP});
+        return firstId;
     }
 
-    m_cellTypes->at<CellTypes>(nbCells) = static_cast<CellTypes>(type);
-    for(size_t i = 0 ; i < nbPoints ; ++i)
+    const Size nbCellsData = nbCells * nbPointsPerCell;
+    this->growCellArrays(firstId + nbCells, m_cellsDataSize + nbCellsData);
+
+    auto* types   = static_cast<CellTypes*>(m_cellTypes->getBuffer()) + firstId;
+    auto* offsets = static_cast<CellId*>(m_cellDataOffsets->getBuffer()) + firstId;
+    auto* data    = static_cast<CellId*>(m_cellData->getBuffer()) + m_cellsDataSize;
+
+    std::fill(types, types + nbCells, static_cast<CellTypes>(type));
+    for(Size i = 0 ; i < nbCells ; ++i)
     {
-        const PointId cellValue = pointIds[i];
-        m_cellData->at<CellId>(m_cellsDataSize + i) = cellValue;
+        offsets[i] = m_cellsDataSize + i * nbPointsPerCell;
     }
 
-    m_cellDataOffsets->at<CellId>(nbCells) = m_cellsDataSize;
+    std::memcpy(data, pointIds, size_t(nbCellsData) * sizeof(CellId));
 
-    m_cellsDataSize += nbPoints;
-    ++m_nbCells;
-    return nbCells;
+    m_cellsDataSize += nbCellsData;
+    m_nbCells       += nbCells;
+    return firstId;
+}
+
+//------------------------------------------------------------------------------
+
+void Mesh::growPointArrays(Size nbPts)
+{
+    const size_t allocatedPts = m_points->empty() ? 0 : m_points->getSize().at(0);
+    if(allocatedPts >= nbPts)
+    {
+        return;
+    }
+
+    const size_t capacity = computeCapacity(allocatedPts, nbPts, POINT_REALLOC_STEP);
+    m_points->resizeTMP({capacity}, 3);
+
+    // Keep the allocated point attributes consistent with the points
+    if(static_cast<int>(m_attributes & Attributes::POINT_COLORS) && !m_pointColors->empty())
+    {
+        m_pointColors->resize({capacity});
+    }
+
+    if(static_cast<int>(m_attributes & Attributes::POINT_NORMALS) && !m_pointNormals->empty())
+    {
+        m_pointNormals->resize({capacity});
+    }
+
+    if(static_cast<int>(m_attributes & Attributes::POINT_TEX_COORDS) && !m_pointTexCoords->empty())
+    {
+        m_pointTexCoords->resize({capacity});
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void Mesh::growCellArrays(Size nbCells, Size nbCellsData)
+{
+    const size_t allocatedCellTypes       = m_cellTypes->empty() ? 0 : m_cellTypes->getSize().at(0);
+    const size_t allocatedCellDataOffsets = m_cellDataOffsets->empty() ? 0 : m_cellDataOffsets->getSize().at(0);
+    const size_t allocatedCellData        = m_cellData->empty() ? 0 : m_cellData->getSize().at(0);
+
+    if(allocatedCellTypes < nbCells || allocatedCellDataOffsets < nbCells)
+    {
+        const size_t capacity = computeCapacity(
+            std::min(allocatedCellTypes, allocatedCellDataOffsets),
+            nbCells,
+            CELL_REALLOC_STEP
+        );
+        m_cellTypes->resize({capacity});
+        m_cellDataOffsets->resize({capacity});
+
+        // Keep the allocated cell attributes consistent with the cells
+        if(static_cast<int>(m_attributes & Attributes::CELL_COLORS) && !m_cellColors->empty())
+        {
+            m_cellColors->resize({capacity});
+        }
+
+        if(static_cast<int>(m_attributes & Attributes::CELL_NORMALS) && !m_cellNormals->empty())
+        {
+            m_cellNormals->resize({capacity});
+        }
+
+        if(static_cast<int>(m_attributes & Attributes::CELL_TEX_COORDS) && !m_cellTexCoords->empty())
+        {
+            m_cellTexCoords->resize({capacity});
+        }
+    }
+
+    if(allocatedCellData < nbCellsData)
+    {
+        m_cellData->resize({computeCapacity(allocatedCellData, nbCellsData, CELLDATA_REALLOC_STEP)});
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -1005,20 +1159,19 @@ void Mesh::setCellTexCoord(
 
 //------------------------------------------------------------------------------
 
-Mesh::LocksType Mesh::lock() const
+Mesh::LocksType Mesh::lock()
 {
     LocksType locks;
-    locks.push_back(m_points->lock());
-    locks.push_back(m_cellTypes->lock());
-    locks.push_back(m_cellData->lock());
-    locks.push_back(m_cellDataOffsets->lock());
-    locks.push_back(m_pointColors->lock());
-    locks.push_back(m_cellColors->lock());
-    locks.push_back(m_pointNormals->lock());
-    locks.push_back(m_cellNormals->lock());
-    locks.push_back(m_cellTexCoords->lock());
-    locks.push_back(m_pointTexCoords->lock());
+    this->lockBuffer(locks);
+    return locks;
+}
+
+//------------------------------------------------------------------------------
 
+Mesh::ConstLocksType Mesh::lock() const
+{
+    ConstLocksType locks;
+    this->lockBuffer(locks);
     return locks;
 }
 
@@ -1040,8 +1193,26 @@ const Mesh::ColorValueType* Mesh::getCellColorsBuffer() const
 
 void Mesh::lockBuffer(std::vector<core::memory::BufferObject::Lock>& locks) const
 {
-    const LocksType& myLocks = this->lock();
-    locks.insert(std::end(locks), std::begin(myLocks), std::end(myLocks));
+    for(const data::Array::sptr& array : {m_points, m_cellTypes, m_cellData, m_cellDataOffsets, m_pointColors,
+                                          m_cellColors, m_pointNormals, m_cellNormals, m_cellTexCoords,
+                                          m_pointTexCoords
+    })
+    {
+        locks.push_back(array->lock());
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void Mesh::lockBuffer(std::vector<core::memory::BufferObject::ConstLock>& locks) const
+{
+    for(const data::Array::csptr& array : {m_points, m_cellTypes, m_cellData, m_cellDataOffsets, m_pointColors,
+                                           m_cellColors, m_pointNormals, m_cellNormals, m_cellTexCoords,
+                                           m_pointTexCoords
+    })
+    {
+        locks.push_back(array->lock());
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -1117,6 +1288,7 @@ size_t Mesh::allocateCellColors(ColorArrayTypes t)
     if(!m_cellColors)
     {
         m_cellColors = data::Array::New();
+        m_cellColors->getBufferObject()->setOwner(Mesh::classname());
     }
 
     allocatedSize += m_cellColors->resize(core::tools::Type::create<ColorValueType>(), {size_t(m_nbCells)}, t, true);
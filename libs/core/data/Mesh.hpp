@@ -98,7 +98,12 @@ namespace sight::data
  *
  * The pushPoint() and pushCell() methods add new points or cells, they increment the number of points/cells and
  * allocate more memory if needed. It is recommended to call reserve() method before it if you know the number of
- * points and cells, it avoids allocating more memory than needed.
+ * points and cells, it avoids allocating more memory than needed. When the memory must be reallocated, the capacity
+ * grows geometrically, thus building a mesh point by point only triggers a logarithmic number of reallocations. Call
+ * adjustAllocatedMemory() afterwards to release the extra memory.
+ *
+ * The pushPoints() and pushCells() methods add several points or cells of the same type at once from contiguous
+ * buffers, they should be preferred to build large meshes.
  *
  * The setPoint() and setCell() methods change the value of a point/cell at a given index.
  *
@@ -334,6 +339,7 @@ public:
     typedef data::iterator::Size Size;
 
     typedef std::vector<core::memory::BufferObject::Lock> LocksType;
+    typedef std::vector<core::memory::BufferObject::ConstLock> ConstLocksType;
     /**
      * @brief Constructor
      * @param key Private construction key
@@ -629,6 +635,35 @@ public:
     );
     /// @}
 
+    /**
+     * @brief Insert several points into the mesh.
+     *
+     * Reallocates the point arrays if needed.
+     *
+     * @param points contiguous point coordinates [x0, y0, z0, x1, y1, z1, ...]
+     * @param nbPoints number of points to insert
+     *
+     * @return The id of the first inserted point
+     *
+     * @throw data::Exception if the allocation failed
+     */
+    DATA_API PointId pushPoints(const PointValueType* points, Size nbPoints);
+
+    /**
+     * @brief Insert several cells of the same type into the mesh.
+     *
+     * Reallocates the mesh's concerned arrays if needed.
+     *
+     * @param type type of the cells, it must have a fixed number of points (POINT, EDGE, TRIANGLE, QUAD or TETRA)
+     * @param pointIds contiguous point indices of the cells [c0p0, c0p1, c0p2, c1p0, c1p1, c1p2, ...]
+     * @param nbCells number of cells to insert
+     *
+     * @return The id of the first inserted cell
+     *
+     * @throw data::Exception if the cell type does not have a fixed number of points or if the allocation failed
+     */
+    DATA_API CellId pushCells(CellType type, const PointId* pointIds, Size nbCells);
+
     /**
      * @brief Set a point's coordinates.
      *
@@ -793,8 +828,14 @@ public:
      * The buffer cannot be accessed if the mesh is not locked
      *
      * @warning You must allocate all the mesh's arrays before calling lock()
+     *
+     * The locks of a non-const mesh give a write access: the buffers shared with a copy of the mesh are copied first.
+     * The locks of a const mesh keep the buffers shared.
+     * @{
      */
-    [[nodiscard]] DATA_API LocksType lock() const;
+    [[nodiscard]] DATA_API LocksType lock();
+    [[nodiscard]] DATA_API ConstLocksType lock() const;
+    /// @}
 
     /// Return true if the mesh has point colors
     bool hasPointColors() const;
@@ -1016,8 +1057,17 @@ protected:
      * @brief Add a lock on the mesh in the given vector to prevent from dumping the buffer on the disk
      *
      * This is needed for IBuffered interface implementation
+     * @{
      */
     DATA_API void lockBuffer(std::vector<core::memory::BufferObject::Lock>& locks) const override;
+    DATA_API void lockBuffer(std::vector<core::memory::BufferObject::ConstLock>& locks) const override;
+    /// @}
+
+    /// Grows the point arrays geometrically, if needed, to be able to store at least nbPts points
+    void growPointArrays(Size nbPts);
+
+    /// Grows the cell arrays geometrically, if needed, to be able to store at least nbCells cells and nbCellsData ids
+    void growCellArrays(Size nbCells, Size nbCellsData);
 
     /// Number of points defined for the mesh
     Size m_nbPoints;
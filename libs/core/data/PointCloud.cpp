@@ -0,0 +1,360 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "data/PointCloud.hpp"
+
+#include "data/Exception.hpp"
+#include "data/registry/macros.hpp"
+
+#include <core/com/Signal.hxx>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+SIGHT_REGISTER_DATA(sight::data::PointCloud);
+
+namespace sight::data
+{
+
+const core::com::Signals::SignalKeyType PointCloud::s_VERTEX_MODIFIED_SIG        = "vertexModified";
+const core::com::Signals::SignalKeyType PointCloud::s_POINT_COLORS_MODIFIED_SIG  = "pointColorsModified";
+const core::com::Signals::SignalKeyType PointCloud::s_POINT_NORMALS_MODIFIED_SIG = "pointNormalsModified";
+
+//------------------------------------------------------------------------------
+
+PointCloud::PointCloud(data::Object::Key)
+{
+    newSignal<VertexModifiedSignalType>(s_VERTEX_MODIFIED_SIG);
+    newSignal<PointColorsModifiedSignalType>(s_POINT_COLORS_MODIFIED_SIG);
+    newSignal<PointNormalsModifiedSignalType>(s_POINT_NORMALS_MODIFIED_SIG);
+
+    m_points       = data::Array::New();
+    m_pointColors  = data::Array::New();
+    m_pointNormals = data::Array::New();
+
+    m_points->setType(core::tools::Type::create<PointValueType>());
+    m_pointColors->setType(core::tools::Type::create<ColorValueType>());
+    m_pointNormals->setType(core::tools::Type::create<NormalValueType>());
+
+    data::Array::setBuffersOwner({m_points, m_pointColors, m_pointNormals}, PointCloud::classname());
+}
+
+//------------------------------------------------------------------------------
+
+PointCloud::~PointCloud()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void PointCloud::shallowCopy(const Object::csptr& _source)
+{
+    PointCloud::csptr other = PointCloud::dynamicConstCast(_source);
+    SIGHT_THROW_EXCEPTION_IF(
+        data::Exception(
+            "Unable to copy" + (_source ? _source->getClassname() : std::string("<NULL>"))
+            + " to " + this->getClassname()
+        ),
+        !bool(other)
+    );
+    this->fieldShallowCopy(_source);
+
+    m_nbPoints     = other->m_nbPoints;
+    m_points       = other->m_points;
+    m_pointColors  = other->m_pointColors;
+    m_pointNormals = other->m_pointNormals;
+    m_attributes   = other->m_attributes;
+}
+
+//------------------------------------------------------------------------------
+
+void PointCloud::cachedDeepCopy(const Object::csptr& _source, DeepCopyCacheType& cache)
+{
+    PointCloud::csptr other = PointCloud::dynamicConstCast(_source);
+    SIGHT_THROW_EXCEPTION_IF(
+        data::Exception(
+            "Unable to copy" + (_source ? _source->getClassname() : std::string("<NULL>"))
+            + " to " + this->getClassname()
+        ),
+        !other
+    );
+    this->fieldDeepCopy(_source, cache);
+
+    m_nbPoints     = other->m_nbPoints;
+    m_attributes   = other->m_attributes;
+    m_points       = data::Object::copy(other->m_points, cache);
+    m_pointColors  = data::Object::copy(other->m_pointColors, cache);
+    m_pointNormals = data::Object::copy(other->m_pointNormals, cache);
+
+    data::Array::setBuffersOwner({m_points, m_pointColors, m_pointNormals}, PointCloud::classname());
+}
+
+//------------------------------------------------------------------------------
+
+size_t PointCloud::reserve(Size nbPts, Attributes arrayMask)
+{
+    SIGHT_THROW_EXCEPTION_IF(data::Exception("Cannot not allocate empty size"), nbPts == 0);
+
+    m_points->resizeTMP({nbPts}, 3);
+
+    if(static_cast<bool>(arrayMask & Attributes::POINT_COLORS))
+    {
+        m_pointColors->resizeTMP(core::tools::Type::s_UINT8, {nbPts}, 4);
+    }
+    else
+    {
+        m_pointColors->clear();
+    }
+
+    if(static_cast<bool>(arrayMask & Attributes::POINT_NORMALS))
+    {
+        m_pointNormals->resizeTMP(core::tools::Type::s_FLOAT, {nbPts}, 3);
+    }
+    else
+    {
+        m_pointNormals->clear();
+    }
+
+    m_attributes = arrayMask & (Attributes::POINT_COLORS | Attributes::POINT_NORMALS);
+    m_nbPoints   = std::min(m_nbPoints, nbPts);
+
+    return this->getAllocatedSizeInBytes();
+}
+
+//------------------------------------------------------------------------------
+
+size_t PointCloud::resize(Size nbPts, Attributes arrayMask)
+{
+    const size_t size = this->reserve(nbPts, arrayMask);
+    m_nbPoints = nbPts;
+    return size;
+}
+
+//------------------------------------------------------------------------------
+
+void PointCloud::clear()
+{
+    m_points->clear();
+    m_pointColors->clear();
+    m_pointNormals->clear();
+
+    m_nbPoints   = 0;
+    m_attributes = Attributes::NONE;
+}
+
+//------------------------------------------------------------------------------
+
+void PointCloud::setNumberOfPoints(Size nb)
+{
+    SIGHT_THROW_EXCEPTION_IF(
+        data::Exception(
+            "Number of points (" + std::to_string(nb) + ") exceeds the allocated capacity ("
+            + std::to_string(this->getCapacity()) + ")"
+        ),
+        nb > this->getCapacity()
+    );
+    m_nbPoints = nb;
+}
+
+//------------------------------------------------------------------------------
+
+PointCloud::Size PointCloud::getCapacity() const
+{
+    return m_points->empty() ? 0 : static_cast<Size>(m_points->getSize()[0]);
+}
+
+//------------------------------------------------------------------------------
+
+size_t PointCloud::getDataSizeInBytes() const
+{
+    size_t size = m_nbPoints * sizeof(PointType);
+
+    if(this->hasPointColors())
+    {
+        size += m_nbPoints * sizeof(ColorType);
+    }
+
+    if(this->hasPointNormals())
+    {
+        size += m_nbPoints * sizeof(NormalType);
+    }
+
+    return size;
+}
+
+//------------------------------------------------------------------------------
+
+size_t PointCloud::getAllocatedSizeInBytes() const
+{
+    return m_points->getSizeInBytes() + m_pointColors->getSizeInBytes() + m_pointNormals->getSizeInBytes();
+}
+
+//------------------------------------------------------------------------------
+
+PointCloud::LocksType PointCloud::lock()
+{
+    LocksType locks;
+    this->lockBuffer(locks);
+    return locks;
+}
+
+//------------------------------------------------------------------------------
+
+PointCloud::ConstLocksType PointCloud::lock() const
+{
+    ConstLocksType locks;
+    this->lockBuffer(locks);
+    return locks;
+}
+
+//------------------------------------------------------------------------------
+
+void PointCloud::lockBuffer(std::vector<core::memory::BufferObject::Lock>& locks) const
+{
+    locks.push_back(m_points->lock());
+    locks.push_back(m_pointColors->lock());
+    locks.push_back(m_pointNormals->lock());
+}
+
+//------------------------------------------------------------------------------
+
+void PointCloud::lockBuffer(std::vector<core::memory::BufferObject::ConstLock>& locks) const
+{
+    locks.push_back(data::Array::csptr(m_points)->lock());
+    locks.push_back(data::Array::csptr(m_pointColors)->lock());
+    locks.push_back(data::Array::csptr(m_pointNormals)->lock());
+}
+
+//------------------------------------------------------------------------------
+
+PointCloud::PointType* PointCloud::getPointsBuffer()
+{
+    return static_cast<PointType*>(m_points->getBuffer());
+}
+
+//------------------------------------------------------------------------------
+
+const PointCloud::PointType* PointCloud::getPointsBuffer() const
+{
+    return static_cast<const PointType*>(m_points->getBuffer());
+}
+
+//------------------------------------------------------------------------------
+
+PointCloud::ColorType* PointCloud::getPointColorsBuffer()
+{
+    return static_cast<ColorType*>(m_pointColors->getBuffer());
+}
+
+//------------------------------------------------------------------------------
+
+const PointCloud::ColorType* PointCloud::getPointColorsBuffer() const
+{
+    return static_cast<const ColorType*>(m_pointColors->getBuffer());
+}
+
+//------------------------------------------------------------------------------
+
+PointCloud::NormalType* PointCloud::getPointNormalsBuffer()
+{
+    return static_cast<NormalType*>(m_pointNormals->getBuffer());
+}
+
+//------------------------------------------------------------------------------
+
+const PointCloud::NormalType* PointCloud::getPointNormalsBuffer() const
+{
+    return static_cast<const NormalType*>(m_pointNormals->getBuffer());
+}
+
+//------------------------------------------------------------------------------
+
+data::Array::sptr PointCloud::getPointsArray() const
+{
+    return m_points;
+}
+
+//------------------------------------------------------------------------------
+
+data::Array::sptr PointCloud::getPointColorsArray() const
+{
+    return m_pointColors;
+}
+
+//------------------------------------------------------------------------------
+
+data::Array::sptr PointCloud::getPointNormalsArray() const
+{
+    return m_pointNormals;
+}
+
+//------------------------------------------------------------------------------
+
+void PointCloud::toMesh(const data::Mesh::sptr& _mesh) const
+{
+    SIGHT_ASSERT("Mesh is null", _mesh);
+
+    _mesh->clear();
+    if(m_nbPoints == 0)
+    {
+        return;
+    }
+
+    _mesh->resize(m_nbPoints, m_nbPoints, data::Mesh::CellType::POINT, m_attributes);
+
+    const auto locks     = this->lock();
+    const auto meshLocks = _mesh->lock();
+
+    std::memcpy(_mesh->getPointsArray()->getBuffer(), this->getPointsBuffer(), m_nbPoints * sizeof(PointType));
+
+    if(this->hasPointColors())
+    {
+        std::memcpy(
+            _mesh->getPointColorsArray()->getBuffer(),
+            this->getPointColorsBuffer(),
+            m_nbPoints * sizeof(ColorType)
+        );
+    }
+
+    if(this->hasPointNormals())
+    {
+        std::memcpy(
+            _mesh->getPointNormalsArray()->getBuffer(),
+            this->getPointNormalsBuffer(),
+            m_nbPoints * sizeof(NormalType)
+        );
+    }
+
+    // One cell per point: the cell arrays are filled directly, the cell iterators would read the offsets of the
+    // following cells before they are written
+    auto* types   = static_cast<data::Mesh::CellTypes*>(_mesh->getCellTypesArray()->getBuffer());
+    auto* offsets = static_cast<data::Mesh::CellId*>(_mesh->getCellDataOffsetsArray()->getBuffer());
+    auto* cells   = static_cast<data::Mesh::CellId*>(_mesh->getCellDataArray()->getBuffer());
+
+    std::fill(types, types + m_nbPoints, static_cast<data::Mesh::CellTypes>(data::Mesh::CellType::POINT));
+    std::iota(offsets, offsets + m_nbPoints, data::Mesh::CellId(0));
+    std::iota(cells, cells + m_nbPoints, data::Mesh::CellId(0));
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::data
@@ -0,0 +1,255 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "data/Array.hpp"
+#include "data/config.hpp"
+#include "data/factory/new.hpp"
+#include "data/Mesh.hpp"
+
+#include <core/com/Signal.hpp>
+#include <core/com/Signals.hpp>
+#include <core/memory/IBuffered.hpp>
+
+namespace sight::data
+{
+
+/**
+ * @brief   Data holding a point cloud, i.e. a set of points without any topology.
+ *
+ * Unlike a data::Mesh used as a point cloud, no cell types, cell offsets or cell data are stored: a point cloud only
+ * owns a point array (3 floats per point) and optionally a point color array (RGBA, 4 uint8 per point) and a point
+ * normal array (3 floats per point). The arrays have the same layout as the corresponding data::Mesh arrays, thus they
+ * can be shared with a mesh without any copy.
+ *
+ * The memory is allocated with reserve() or resize(). The number of valid points can then be set with
+ * setNumberOfPoints() without any reallocation, which allows producers such as depth sensors to reuse the same buffers
+ * for each frame, even if the number of valid points changes.
+ *
+ * @code{.cpp}
+    auto pointCloud = data::PointCloud::New();
+    pointCloud->reserve(640 * 480, data::PointCloud::Attributes::POINT_COLORS);
+
+    const auto dumpLock = pointCloud->lock();
+    auto* points        = pointCloud->getPointsBuffer();
+    auto* colors        = pointCloud->getPointColorsBuffer();
+    size_t nbPoints     = 0;
+    // ... fill points[nbPoints] and colors[nbPoints]
+    pointCloud->setNumberOfPoints(nbPoints);
+   @endcode
+ *
+ * Use toMesh() to convert it to a data::Mesh with one point cell per point, when a topology is really needed.
+ */
+class DATA_CLASS_API PointCloud : public data::Object,
+                                  public core::memory::IBuffered
+{
+public:
+
+    SIGHT_DECLARE_CLASS(PointCloud, data::Object, data::factory::New<PointCloud>);
+
+    /// Only Attributes::POINT_COLORS and Attributes::POINT_NORMALS are relevant for a point cloud
+    typedef data::Mesh::Attributes Attributes;
+
+    typedef data::Mesh::PointValueType PointValueType;
+    typedef data::Mesh::ColorValueType ColorValueType;
+    typedef data::Mesh::NormalValueType NormalValueType;
+    typedef data::Mesh::Size Size;
+
+    typedef data::iterator::Point PointType;
+    typedef data::iterator::RGBA ColorType;
+    typedef data::iterator::Normal NormalType;
+
+    typedef std::vector<core::memory::BufferObject::Lock> LocksType;
+    typedef std::vector<core::memory::BufferObject::ConstLock> ConstLocksType;
+
+    /**
+     * @brief Constructor
+     * @param key Private construction key
+     */
+    DATA_API PointCloud(data::Object::Key key);
+
+    /// Destructor
+    DATA_API ~PointCloud() override;
+
+    /// Defines shallow copy
+    DATA_API void shallowCopy(const Object::csptr& _source) override;
+
+    /// Defines deep copy
+    DATA_API void cachedDeepCopy(const Object::csptr& _source, DeepCopyCacheType& cache) override;
+
+    /**
+     * @brief Allocates the point cloud memory, without modifying the number of points.
+     *
+     * @param nbPts number of points to allocate
+     * @param arrayMask additional arrays to allocate (Attributes::POINT_COLORS and/or Attributes::POINT_NORMALS),
+     *        arrays that are not requested are released.
+     *
+     * @return the allocated memory
+     *
+     * @throw data::Exception if the memory can not be allocated.
+     */
+    DATA_API size_t reserve(Size nbPts, Attributes arrayMask = Attributes::NONE);
+
+    /**
+     * @brief Allocates the point cloud memory and sets the number of points.
+     * @see reserve()
+     */
+    DATA_API size_t resize(Size nbPts, Attributes arrayMask = Attributes::NONE);
+
+    /// Removes all the points and releases the memory
+    DATA_API void clear();
+
+    /// Sets the number of valid points, it must not exceed the allocated capacity
+    DATA_API void setNumberOfPoints(Size nb);
+
+    /// Returns the number of valid points
+    Size getNumberOfPoints() const;
+
+    /// Returns the number of points that can be stored without reallocation
+    DATA_API Size getCapacity() const;
+
+    /// Returns the point cloud attributes
+    Attributes getAttributes() const;
+
+    /// Returns true if the point cloud has point colors
+    bool hasPointColors() const;
+
+    /// Returns true if the point cloud has point normals
+    bool hasPointNormals() const;
+
+    /// Returns the memory used by the valid points
+    DATA_API size_t getDataSizeInBytes() const;
+
+    /// Returns the allocated memory
+    DATA_API size_t getAllocatedSizeInBytes() const;
+
+    /**
+     * @brief Locks the point cloud buffers to prevent them from being dumped on the disk.
+     * @warning The buffers must be locked before calling any get*Buffer() method.
+     *
+     * The locks of a non-const point cloud give a write access, the locks of a const point cloud keep the buffers
+     * shared with its copies.
+     * @{
+     */
+    [[nodiscard]] DATA_API LocksType lock();
+    [[nodiscard]] DATA_API ConstLocksType lock() const;
+    /// @}
+
+    /// Returns the point buffer, stored as [x0, y0, z0, x1, y1, z1, ...]
+    DATA_API PointType* getPointsBuffer();
+    DATA_API const PointType* getPointsBuffer() const;
+
+    /// Returns the point colors buffer, stored as [r0, g0, b0, a0, r1, g1, b1, a1, ...]
+    DATA_API ColorType* getPointColorsBuffer();
+    DATA_API const ColorType* getPointColorsBuffer() const;
+
+    /// Returns the point normals buffer, stored as [nx0, ny0, nz0, nx1, ny1, nz1, ...]
+    DATA_API NormalType* getPointNormalsBuffer();
+    DATA_API const NormalType* getPointNormalsBuffer() const;
+
+    /// Returns the internal arrays, they use the same layout as the corresponding data::Mesh arrays
+    DATA_API data::Array::sptr getPointsArray() const;
+    DATA_API data::Array::sptr getPointColorsArray() const;
+    DATA_API data::Array::sptr getPointNormalsArray() const;
+
+    /**
+     * @brief Converts the point cloud into a mesh, with one point cell per valid point.
+     * @param _mesh output mesh, its previous content is erased.
+     */
+    DATA_API void toMesh(const data::Mesh::sptr& _mesh) const;
+
+    /**
+     * @name Signals
+     * @{
+     */
+    /// Type of signal when vertex are modified
+    typedef core::com::Signal<void ()> VertexModifiedSignalType;
+    DATA_API static const core::com::Signals::SignalKeyType s_VERTEX_MODIFIED_SIG;
+
+    /// Type of signal when point colors are modified
+    typedef core::com::Signal<void ()> PointColorsModifiedSignalType;
+    DATA_API static const core::com::Signals::SignalKeyType s_POINT_COLORS_MODIFIED_SIG;
+
+    /// Type of signal when point normals are modified
+    typedef core::com::Signal<void ()> PointNormalsModifiedSignalType;
+    DATA_API static const core::com::Signals::SignalKeyType s_POINT_NORMALS_MODIFIED_SIG;
+    /**
+     * @}
+     */
+
+protected:
+
+    /// Adds the locks of the point cloud buffers to the given vector
+    /// @{
+    DATA_API void lockBuffer(std::vector<core::memory::BufferObject::Lock>& locks) const override;
+    DATA_API void lockBuffer(std::vector<core::memory::BufferObject::ConstLock>& locks) const override;
+    /// @}
+
+private:
+
+    /// Number of valid points
+    Size m_nbPoints {0};
+
+    /// Point array: 3-components 1-dimension float array
+    data::Array::sptr m_points;
+
+    /// Point colors array: 4-components 1-dimension uint8 array
+    data::Array::sptr m_pointColors;
+
+    /// Point normals array: 3-components 1-dimension float array
+    data::Array::sptr m_pointNormals;
+
+    /// Allocated attributes
+    Attributes m_attributes {Attributes::NONE};
+};
+
+//------------------------------------------------------------------------------
+
+inline PointCloud::Size PointCloud::getNumberOfPoints() const
+{
+    return m_nbPoints;
+}
+
+//------------------------------------------------------------------------------
+
+inline PointCloud::Attributes PointCloud::getAttributes() const
+{
+    return m_attributes;
+}
+
+//------------------------------------------------------------------------------
+
+inline bool PointCloud::hasPointColors() const
+{
+    return static_cast<bool>(m_attributes & Attributes::POINT_COLORS);
+}
+
+//------------------------------------------------------------------------------
+
+inline bool PointCloud::hasPointNormals() const
+{
+    return static_cast<bool>(m_attributes & Attributes::POINT_NORMALS);
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::data
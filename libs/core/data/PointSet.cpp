@@ -0,0 +1,293 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "data/PointSet.hpp"
+
+#include "data/Exception.hpp"
+#include "data/registry/macros.hpp"
+
+#include <core/base.hpp>
+#include <core/com/Signal.hxx>
+
+#include <cstring>
+
+static_assert(
+    sizeof(sight::data::PointSet::PointType) == 3 * sizeof(sight::data::PointSet::ValueType),
+    "Points coordinates must be stored contiguously"
+);
+
+SIGHT_REGISTER_DATA(sight::data::PointSet);
+
+namespace sight::data
+{
+
+const core::com::Signals::SignalKeyType PointSet::s_POINTS_ADDED_SIG    = "pointsAdded";
+const core::com::Signals::SignalKeyType PointSet::s_POINT_REMOVED_SIG   = "pointRemoved";
+const core::com::Signals::SignalKeyType PointSet::s_VERTEX_MODIFIED_SIG = "vertexModified";
+
+//------------------------------------------------------------------------------
+
+PointSet::PointSet(data::Object::Key)
+{
+    newSignal<PointsAddedSignalType>(s_POINTS_ADDED_SIG);
+    newSignal<PointRemovedSignalType>(s_POINT_REMOVED_SIG);
+    newSignal<VertexModifiedSignalType>(s_VERTEX_MODIFIED_SIG);
+}
+
+//------------------------------------------------------------------------------
+
+PointSet::~PointSet()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void PointSet::shallowCopy(const Object::csptr& _source)
+{
+    PointSet::csptr other = PointSet::dynamicConstCast(_source);
+    SIGHT_THROW_EXCEPTION_IF(
+        data::Exception(
+            "Unable to copy" + (_source ? _source->getClassname() : std::string("<NULL>"))
+            + " to " + this->getClassname()
+        ),
+        !bool(other)
+    );
+    this->fieldShallowCopy(_source);
+
+    // Points are plain values, there is nothing to share
+    m_points     = other->m_points;
+    m_attributes = other->m_attributes;
+}
+
+//------------------------------------------------------------------------------
+
+void PointSet::cachedDeepCopy(const Object::csptr& _source, DeepCopyCacheType& _cache)
+{
+    PointSet::csptr other = PointSet::dynamicConstCast(_source);
+    SIGHT_THROW_EXCEPTION_IF(
+        data::Exception(
+            "Unable to copy" + (_source ? _source->getClassname() : std::string("<NULL>"))
+            + " to " + this->getClassname()
+        ),
+        !bool(other)
+    );
+    this->fieldDeepCopy(_source, _cache);
+
+    m_points     = other->m_points;
+    m_attributes = other->m_attributes;
+}
+
+//------------------------------------------------------------------------------
+
+void PointSet::reserve(size_t _size)
+{
+    m_points.reserve(_size);
+    for(auto& [name, attribute] : m_attributes)
+    {
+        attribute.values.reserve(_size * attribute.numberOfComponents);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void PointSet::resize(size_t _size)
+{
+    m_points.resize(_size, {0., 0., 0.});
+    for(auto& [name, attribute] : m_attributes)
+    {
+        attribute.values.resize(_size * attribute.numberOfComponents, 0.f);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void PointSet::clear()
+{
+    m_points.clear();
+    for(auto& [name, attribute] : m_attributes)
+    {
+        attribute.values.clear();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+size_t PointSet::pushBack(const PointType& _point)
+{
+    const size_t index = m_points.size();
+    m_points.push_back(_point);
+    for(auto& [name, attribute] : m_attributes)
+    {
+        attribute.values.resize(m_points.size() * attribute.numberOfComponents, 0.f);
+    }
+
+    return index;
+}
+
+//------------------------------------------------------------------------------
+
+size_t PointSet::append(const ValueType* _coords, size_t _count)
+{
+    const size_t index = m_points.size();
+    m_points.resize(index + _count);
+    if(_count > 0)
+    {
+        SIGHT_ASSERT("Coordinates buffer is null", _coords);
+        std::memcpy(m_points[index].data(), _coords, _count * sizeof(PointType));
+    }
+
+    for(auto& [name, attribute] : m_attributes)
+    {
+        attribute.values.resize(m_points.size() * attribute.numberOfComponents, 0.f);
+    }
+
+    return index;
+}
+
+//------------------------------------------------------------------------------
+
+void PointSet::remove(size_t _index)
+{
+    SIGHT_THROW_EXCEPTION_IF(
+        data::Exception("Index " + std::to_string(_index) + " is out of bounds"),
+        _index >= m_points.size()
+    );
+
+    m_points.erase(m_points.begin() + static_cast<std::ptrdiff_t>(_index));
+    for(auto& [name, attribute] : m_attributes)
+    {
+        const auto nbComponents = static_cast<std::ptrdiff_t>(attribute.numberOfComponents);
+        const auto first        = attribute.values.begin() + static_cast<std::ptrdiff_t>(_index) * nbComponents;
+        attribute.values.erase(first, first + nbComponents);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+PointSet::Attribute& PointSet::addAttribute(const std::string& _name, size_t _nbComponents)
+{
+    SIGHT_THROW_EXCEPTION_IF(
+        data::Exception("Attribute '" + _name + "' must have at least one component"),
+        _nbComponents == 0
+    );
+    SIGHT_THROW_EXCEPTION_IF(
+        data::Exception("Attribute '" + _name + "' already exists"),
+        m_attributes.find(_name) != m_attributes.end()
+    );
+
+    Attribute& attribute         = m_attributes[_name];
+    attribute.numberOfComponents = _nbComponents;
+    attribute.values.resize(m_points.size() * _nbComponents, 0.f);
+    return attribute;
+}
+
+//------------------------------------------------------------------------------
+
+void PointSet::removeAttribute(const std::string& _name)
+{
+    m_attributes.erase(_name);
+}
+
+//------------------------------------------------------------------------------
+
+bool PointSet::hasAttribute(const std::string& _name) const
+{
+    return m_attributes.find(_name) != m_attributes.end();
+}
+
+//------------------------------------------------------------------------------
+
+PointSet::Attribute* PointSet::getAttribute(const std::string& _name)
+{
+    const auto it = m_attributes.find(_name);
+    return it != m_attributes.end() ? &it->second : nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+const PointSet::Attribute* PointSet::getAttribute(const std::string& _name) const
+{
+    const auto it = m_attributes.find(_name);
+    return it != m_attributes.end() ? &it->second : nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<std::string> PointSet::getAttributeNames() const
+{
+    std::vector<std::string> names;
+    names.reserve(m_attributes.size());
+    for(const auto& [name, attribute] : m_attributes)
+    {
+        names.push_back(name);
+    }
+
+    return names;
+}
+
+//------------------------------------------------------------------------------
+
+void PointSet::fromPointList(const data::PointList::csptr& _pointList)
+{
+    SIGHT_ASSERT("Point list is null", _pointList);
+
+    const auto& points = _pointList->getPoints();
+    this->clear();
+    this->resize(points.size());
+
+    for(size_t i = 0 ; i < points.size() ; ++i)
+    {
+        m_points[i] = points[i]->getCoord();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+data::PointList::sptr PointSet::toPointList() const
+{
+    auto pointList = data::PointList::New();
+    auto& points   = pointList->getPoints();
+    points.reserve(m_points.size());
+
+    for(const auto& point : m_points)
+    {
+        points.push_back(data::Point::New(point));
+    }
+
+    return pointList;
+}
+
+//------------------------------------------------------------------------------
+
+size_t PointSet::getDataSizeInBytes() const
+{
+    size_t size = m_points.size() * sizeof(PointType);
+    for(const auto& [name, attribute] : m_attributes)
+    {
+        size += attribute.values.size() * sizeof(AttributeValueType);
+    }
+
+    return size;
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::data
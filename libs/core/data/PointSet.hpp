@@ -0,0 +1,265 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "data/config.hpp"
+#include "data/factory/new.hpp"
+#include "data/Object.hpp"
+#include "data/PointList.hpp"
+
+#include <core/com/Signal.hpp>
+#include <core/com/Signals.hpp>
+
+#include <array>
+#include <map>
+#include <vector>
+
+namespace sight::data
+{
+
+/**
+ * @brief   This class defines a compact set of 3D points.
+ *
+ * Unlike data::PointList, points are not data::Object: coordinates are stored contiguously as [x0, y0, z0, x1, y1,
+ * z1, ...] and signals only exist at the container level. Optional per-point attributes (e.g. a scalar value, a
+ * color, a radius) can be attached by name, each one being stored in its own contiguous array of
+ * size() * numberOfComponents values.
+ *
+ * Use this class instead of data::PointList when dealing with a large number of points. Conversion from and to
+ * data::PointList is provided through fromPointList() and toPointList().
+ *
+ * @see     data::PointList
+ */
+class DATA_CLASS_API PointSet : public Object
+{
+public:
+
+    SIGHT_DECLARE_CLASS(PointSet, data::Object, data::factory::New<PointSet>);
+
+    typedef double ValueType;
+    typedef std::array<ValueType, 3> PointType;
+    typedef std::vector<PointType> ContainerType;
+
+    typedef float AttributeValueType;
+
+    /// Per-point attribute, values are stored as [a0_0, ..., a0_n, a1_0, ..., a1_n, ...]
+    struct Attribute
+    {
+        size_t numberOfComponents {1};
+        std::vector<AttributeValueType> values;
+    };
+
+    typedef std::map<std::string, Attribute> AttributeMapType;
+
+    /**
+     * @brief Constructor
+     * @param[in] _key Private construction key
+     */
+    DATA_API PointSet(data::Object::Key _key);
+
+    /// Destructor
+    DATA_API ~PointSet() override;
+
+    /// Defines shallow copy
+    DATA_API void shallowCopy(const Object::csptr& _source) override;
+
+    /// Defines deep copy
+    DATA_API void cachedDeepCopy(const Object::csptr& _source, DeepCopyCacheType& _cache) override;
+
+    /// Returns the number of points
+    size_t size() const;
+
+    /// Returns true if the set does not contain any point
+    bool empty() const;
+
+    /// Reserves memory for _size points (and their attributes)
+    DATA_API void reserve(size_t _size);
+
+    /// Resizes the set, new points and attribute values are initialized to 0
+    DATA_API void resize(size_t _size);
+
+    /// Removes all points and attribute values, attributes definitions are kept
+    DATA_API void clear();
+
+    /// Returns the point container
+    ContainerType& getPoints();
+    const ContainerType& getPoints() const;
+
+    /// Returns a pointer on the coordinates, stored as [x0, y0, z0, x1, y1, z1, ...]
+    ValueType* getCoordinates();
+    const ValueType* getCoordinates() const;
+
+    /// Returns the point at the given index
+    const PointType& getPoint(size_t _index) const;
+
+    /// Sets the point at the given index
+    void setPoint(size_t _index, const PointType& _point);
+
+    /**
+     * @brief Adds a point at the end of the set, its attribute values are initialized to 0.
+     * @return the index of the new point
+     */
+    DATA_API size_t pushBack(const PointType& _point);
+
+    /**
+     * @brief Appends _count points at the end of the set in a single call.
+     * @param[in] _coords contiguous coordinates, stored as [x0, y0, z0, x1, y1, z1, ...]
+     * @param[in] _count number of points to append
+     * @return the index of the first appended point
+     */
+    DATA_API size_t append(const ValueType* _coords, size_t _count);
+
+    /// Removes the point at the given index, along with its attribute values
+    DATA_API void remove(size_t _index);
+
+    /**
+     * @name Attributes
+     * @{
+     */
+    /// Adds a new attribute with _nbComponents components per point, values are initialized to 0
+    DATA_API Attribute& addAttribute(const std::string& _name, size_t _nbComponents = 1);
+
+    /// Removes the attribute with the given name
+    DATA_API void removeAttribute(const std::string& _name);
+
+    /// Returns true if an attribute with the given name exists
+    DATA_API bool hasAttribute(const std::string& _name) const;
+
+    /// Returns the attribute with the given name, nullptr if it does not exist
+    DATA_API Attribute* getAttribute(const std::string& _name);
+    DATA_API const Attribute* getAttribute(const std::string& _name) const;
+
+    /// Returns the names of all the attributes
+    DATA_API std::vector<std::string> getAttributeNames() const;
+
+    /// Returns all the attributes
+    const AttributeMapType& getAttributes() const;
+    /// @}
+
+    /**
+     * @name Conversion
+     * @{
+     */
+    /// Replaces the content of the set by the points of a data::PointList
+    DATA_API void fromPointList(const data::PointList::csptr& _pointList);
+
+    /// Creates a data::PointList containing a data::Point for each point of the set
+    DATA_API data::PointList::sptr toPointList() const;
+    /// @}
+
+    /// Returns the memory used by the coordinates and the attributes
+    DATA_API size_t getDataSizeInBytes() const;
+
+    /**
+     * @name Signals
+     * @{
+     */
+    /// Signal emitted when points are added, gives the index of the first added point and the number of points
+    typedef core::com::Signal<void (size_t, size_t)> PointsAddedSignalType;
+    DATA_API static const core::com::Signals::SignalKeyType s_POINTS_ADDED_SIG;
+
+    /// Signal emitted when a point is removed, gives the index of the removed point
+    typedef core::com::Signal<void (size_t)> PointRemovedSignalType;
+    DATA_API static const core::com::Signals::SignalKeyType s_POINT_REMOVED_SIG;
+
+    /// Signal emitted when point coordinates are modified
+    typedef core::com::Signal<void ()> VertexModifiedSignalType;
+    DATA_API static const core::com::Signals::SignalKeyType s_VERTEX_MODIFIED_SIG;
+    /**
+     * @}
+     */
+
+private:
+
+    /// Points coordinates
+    ContainerType m_points;
+
+    /// Per-point attributes, sorted by name
+    AttributeMapType m_attributes;
+};
+
+//-----------------------------------------------------------------------------
+
+inline size_t PointSet::size() const
+{
+    return m_points.size();
+}
+
+//-----------------------------------------------------------------------------
+
+inline bool PointSet::empty() const
+{
+    return m_points.empty();
+}
+
+//-----------------------------------------------------------------------------
+
+inline PointSet::ContainerType& PointSet::getPoints()
+{
+    return m_points;
+}
+
+//-----------------------------------------------------------------------------
+
+inline const PointSet::ContainerType& PointSet::getPoints() const
+{
+    return m_points;
+}
+
+//-----------------------------------------------------------------------------
+
+inline PointSet::ValueType* PointSet::getCoordinates()
+{
+    return m_points.empty() ? nullptr : m_points.front().data();
+}
+
+//-----------------------------------------------------------------------------
+
+inline const PointSet::ValueType* PointSet::getCoordinates() const
+{
+    return m_points.empty() ? nullptr : m_points.front().data();
+}
+
+//-----------------------------------------------------------------------------
+
+inline const PointSet::PointType& PointSet::getPoint(size_t _index) const
+{
+    SIGHT_ASSERT("Index " << _index << " is out of bounds [0-" << m_points.size() << "[", _index < m_points.size());
+    return m_points[_index];
+}
+
+//-----------------------------------------------------------------------------
+
+inline void PointSet::setPoint(size_t _index, const PointType& _point)
+{
+    SIGHT_ASSERT("Index " << _index << " is out of bounds [0-" << m_points.size() << "[", _index < m_points.size());
+    m_points[_index] = _point;
+}
+
+//-----------------------------------------------------------------------------
+
+inline const PointSet::AttributeMapType& PointSet::getAttributes() const
+{
+    return m_attributes;
+}
+
+} // end namespace sight::data
@@ -171,7 +171,8 @@ protected:
     /// allow to create a ConstIterator from an Iterator
     friend class ImageIteratorBase<FORMAT, true>;
 
-    core::memory::BufferObject::Lock m_lock;
+    typename std::conditional<isConstIterator, core::memory::BufferObject::ConstLock,
+                              core::memory::BufferObject::Lock>::type m_lock;
     pointer m_pointer {nullptr};
     difference_type m_idx {0};
     difference_type m_numberOfElements {0};
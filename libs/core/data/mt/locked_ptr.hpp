@@ -172,7 +172,9 @@ private:
         }
     }
 
-    std::vector<core::memory::BufferObject::Lock> m_Locks;
+    /// Read locks if the data is const, write locks otherwise
+    std::vector<std::conditional_t<std::is_const<C>::value, core::memory::BufferObject::ConstLock,
+                                   core::memory::BufferObject::Lock> > m_Locks;
     };
 
     template<class C>
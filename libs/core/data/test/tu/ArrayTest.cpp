@@ -22,6 +22,8 @@
 
 #include "ArrayTest.hpp"
 
+#include <core/memory/BufferManager.hpp>
+
 #include <data/Array.hpp>
 #include <data/Exception.hpp>
 
@@ -627,6 +629,105 @@ void ArrayTest::emptyIteratorTest()
 
 //-----------------------------------------------------------------------------
 
+void ArrayTest::allocationPolicyTest()
+{
+    data::Array::sptr array = data::Array::New();
+    CPPUNIT_ASSERT(array->getAllocationPolicy() == core::memory::BufferAllocationPolicy::getDefault());
+
+    const core::memory::BufferAllocationPolicy::sptr policy = core::memory::BufferAlignedPolicy::New(64);
+    array->setAllocationPolicy(policy);
+    CPPUNIT_ASSERT(array->getAllocationPolicy() == policy);
+
+    array->resize({1001}, core::tools::Type::s_UINT8);
+    {
+        const auto lock = array->lock();
+        CPPUNIT_ASSERT_EQUAL(std::uintptr_t(0), reinterpret_cast<std::uintptr_t>(array->getBuffer()) % 64);
+        std::fill(array->begin<std::uint8_t>(), array->end<std::uint8_t>(), std::uint8_t(12));
+    }
+
+    // The policy is kept when the array is reallocated
+    array->resize({5003}, core::tools::Type::s_UINT8);
+    {
+        const auto lock = array->lock();
+        CPPUNIT_ASSERT_EQUAL(std::uintptr_t(0), reinterpret_cast<std::uintptr_t>(array->getBuffer()) % 64);
+        CPPUNIT_ASSERT_EQUAL(std::uint8_t(12), array->at<std::uint8_t>({1000}));
+    }
+
+    // The policy is copied with the array
+    data::Array::sptr copy = data::Object::copy(array);
+    CPPUNIT_ASSERT(copy->getAllocationPolicy() == policy);
+
+    array->setAllocationPolicy(nullptr);
+    CPPUNIT_ASSERT(array->getAllocationPolicy() == core::memory::BufferAllocationPolicy::getDefault());
+    CPPUNIT_ASSERT(copy->getAllocationPolicy() == policy);
+}
+
+//-----------------------------------------------------------------------------
+
+void ArrayTest::copyOnWriteTest()
+{
+    data::Array::sptr array = data::Array::New();
+    array->resize({1000}, core::tools::Type::s_UINT32, true);
+    {
+        const auto lock     = array->lock();
+        std::uint32_t count = 0;
+        const auto iterEnd  = array->end<std::uint32_t>();
+        for(auto iter = array->begin<std::uint32_t>() ; iter != iterEnd ; ++iter)
+        {
+            *iter = count++;
+        }
+    }
+
+    // The copy shares the buffer until it is locked
+    data::Array::sptr copy = data::Object::copy(array);
+    CPPUNIT_ASSERT(array->getBufferObject()->getBuffer() == copy->getBufferObject()->getBuffer());
+    CPPUNIT_ASSERT(array->getSize() == copy->getSize());
+    CPPUNIT_ASSERT(array->getType() == copy->getType());
+    CPPUNIT_ASSERT(copy->getIsBufferOwner());
+
+    // Reading the copy keeps the buffer shared, nothing is allocated
+    const core::memory::BufferManager::sptr manager = core::memory::BufferManager::getDefault();
+    const std::size_t allocationCount               = manager->getBufferStats().get().allocationCount;
+    {
+        const data::Array::csptr constCopy = copy;
+        const auto lock                    = constCopy->lock();
+        CPPUNIT_ASSERT(array->getBufferObject()->getBuffer() == constCopy->getBuffer());
+
+        std::uint32_t count = 0;
+        const auto iterEnd  = constCopy->end<std::uint32_t>();
+        for(auto iter = constCopy->begin<std::uint32_t>() ; iter != iterEnd ; ++iter)
+        {
+            CPPUNIT_ASSERT_EQUAL(count++, *iter);
+        }
+    }
+    CPPUNIT_ASSERT_EQUAL(allocationCount, manager->getBufferStats().get().allocationCount);
+    CPPUNIT_ASSERT(array->getBufferObject()->getBuffer() == copy->getBufferObject()->getBuffer());
+
+    {
+        const auto lock = copy->lock();
+        CPPUNIT_ASSERT(array->getBufferObject()->getBuffer() != copy->getBuffer());
+        CPPUNIT_ASSERT_EQUAL(std::uint32_t(999), copy->at<std::uint32_t>(999));
+        copy->at<std::uint32_t>(0) = 42;
+    }
+
+    {
+        const auto lock = array->lock();
+        CPPUNIT_ASSERT_EQUAL(std::uint32_t(0), array->at<std::uint32_t>(0));
+        CPPUNIT_ASSERT_EQUAL(std::uint32_t(999), array->at<std::uint32_t>(999));
+    }
+
+    // An array with an external buffer is copied
+    std::vector<std::uint32_t> external(10, 7);
+    data::Array::sptr externalArray = data::Array::New();
+    externalArray->setBuffer(external.data(), false, {10}, core::tools::Type::s_UINT32);
+    data::Array::sptr externalCopy = data::Object::copy(externalArray);
+    CPPUNIT_ASSERT(externalCopy->getBufferObject()->getBuffer() != external.data());
+    const auto lock = externalCopy->lock();
+    CPPUNIT_ASSERT_EQUAL(std::uint32_t(7), externalCopy->at<std::uint32_t>(9));
+}
+
+//-----------------------------------------------------------------------------
+
 } //namespace ut
 
 } //namespace sight::data
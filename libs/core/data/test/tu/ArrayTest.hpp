@@ -43,6 +43,8 @@ private:
     CPPUNIT_TEST(bufferAccessTest);
     CPPUNIT_TEST(constArrayTest);
     CPPUNIT_TEST(emptyIteratorTest);
+    CPPUNIT_TEST(allocationPolicyTest);
+    CPPUNIT_TEST(copyOnWriteTest);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -59,6 +61,8 @@ public:
     void bufferAccessTest();
     void constArrayTest();
     void emptyIteratorTest();
+    void allocationPolicyTest();
+    void copyOnWriteTest();
 };
 
 } //namespace ut
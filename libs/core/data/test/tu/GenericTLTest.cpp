@@ -286,6 +286,43 @@ void GenericTLTest::pushPopTest()
 
 //------------------------------------------------------------------------------
 
+void GenericTLTest::pushObjectsTest()
+{
+    data::Float4TL::sptr timeline = data::Float4TL::New();
+    timeline->initPoolSize(2);
+    timeline->setMaximumSize(3);
+
+    const core::HiResClock::HiResClockType time = core::HiResClock::getTimeInMilliSec();
+
+    std::vector<SPTR(data::timeline::Object)> objects;
+    for(unsigned int i = 0 ; i < 5 ; ++i)
+    {
+        const float4 values = {float(i), 1.f, 2.f, 3.f};
+
+        SPTR(data::Float4TL::BufferType) data = timeline->createBuffer(time + i);
+        data->setElement(values, i % 2);
+        objects.push_back(data);
+    }
+
+    timeline->pushObjects(objects);
+
+    // The oldest buffers are removed to respect the maximum size
+    CPPUNIT_ASSERT(timeline->getObject(time) == nullptr);
+    CPPUNIT_ASSERT(timeline->getObject(time + 1) == nullptr);
+
+    for(unsigned int i = 2 ; i < 5 ; ++i)
+    {
+        CSPTR(data::Float4TL::BufferType) obj = timeline->getClosestBuffer(time + i);
+        CPPUNIT_ASSERT(obj == objects[i]);
+        CPPUNIT_ASSERT_EQUAL(true, obj->isPresent(i % 2));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(double(i), obj->getElement(i % 2)[0], 0.00001);
+    }
+
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(time + 4, timeline->getNewerTimestamp(), 0.00001);
+}
+
+//------------------------------------------------------------------------------
+
 void GenericTLTest::pushClassTest()
 {
     data::TestClassTL::sptr timeline = data::TestClassTL::New();
@@ -36,6 +36,7 @@ public:
 
     CPPUNIT_TEST_SUITE(GenericTLTest);
     CPPUNIT_TEST(pushPopTest);
+    CPPUNIT_TEST(pushObjectsTest);
     CPPUNIT_TEST(pushClassTest);
     CPPUNIT_TEST(copyTest);
     CPPUNIT_TEST(iteratorTest);
@@ -49,6 +50,7 @@ public:
     void tearDown();
 
     void pushPopTest();
+    void pushObjectsTest();
     void pushClassTest();
     void copyTest();
     void iteratorTest();
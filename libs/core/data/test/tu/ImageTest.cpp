@@ -22,6 +22,7 @@
 
 #include "ImageTest.hpp"
 
+#include <core/memory/BufferManager.hpp>
 #include <core/memory/stream/in/Raw.hpp>
 #include <core/tools/System.hpp>
 
@@ -963,6 +964,30 @@ void ImageTest::imageDeepCopy()
 
         CPPUNIT_ASSERT_EQUAL(true, imagesEqual(img, imgCopy));
     }
+
+    {
+        const data::Image::sptr generated = data::Image::New();
+        utestData::generator::Image::generateRandomImage(generated, core::tools::Type::s_UINT8);
+
+        // Reading an image and its copy through const images keeps the buffer shared, nothing is allocated
+        const data::Image::csptr img                    = generated;
+        const data::Image::csptr imgCopy                = data::Object::copy(img);
+        const core::memory::BufferManager::sptr manager = core::memory::BufferManager::getDefault();
+        const std::size_t allocationCount               = manager->getBufferStats().get().allocationCount;
+        {
+            const auto imgLock     = img->lock();
+            const auto imgCopyLock = imgCopy->lock();
+            CPPUNIT_ASSERT(img->getBuffer() == imgCopy->getBuffer());
+
+            auto iter          = img->begin<std::uint8_t>();
+            const auto iterEnd = imgCopy->end<std::uint8_t>();
+            for(auto copyIter = imgCopy->begin<std::uint8_t>() ; copyIter != iterEnd ; ++copyIter, ++iter)
+            {
+                CPPUNIT_ASSERT_EQUAL(*iter, *copyIter);
+            }
+        }
+        CPPUNIT_ASSERT_EQUAL(allocationCount, manager->getBufferStats().get().allocationCount);
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -22,6 +22,8 @@
 
 #include "MeshTest.hpp"
 
+
+#include <data/Exception.hpp>
 #include <data/Mesh.hpp>
 #include <data/ObjectLock.hpp>
 
@@ -1783,6 +1785,154 @@ void MeshTest::iteratorCopyTest()
     }
 }
 
+//------------------------------------------------------------------------------
+
+void MeshTest::bulkInsertion()
+{
+    data::Mesh::sptr mesh = data::Mesh::New();
+    const auto lock       = mesh->lock();
+
+    mesh->pushPoint(1.f, 2.f, 3.f);
+
+    const data::Mesh::PointValueType points[] = {
+        10.f, 11.f, 12.f,
+        20.f, 21.f, 22.f,
+        30.f, 31.f, 32.f,
+        40.f, 41.f, 42.f
+    };
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::PointId(1), mesh->pushPoints(points, 4));
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::Size(5), mesh->getNumberOfPoints());
+
+    auto pointIt = mesh->begin<data::iterator::ConstPointIterator>();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.f, pointIt->point->x, EPSILON);
+    pointIt += 4;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(40.f, pointIt->point->x, EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(41.f, pointIt->point->y, EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(42.f, pointIt->point->z, EPSILON);
+
+    mesh->pushCell(0, 1);
+
+    const data::Mesh::PointId triangles[] = {0, 1, 2, 2, 3, 4};
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::CellId(1), mesh->pushCells(data::Mesh::CellType::TRIANGLE, triangles, 2));
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::Size(3), mesh->getNumberOfCells());
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::Size(8), mesh->getCellDataSize());
+
+    // Cells with a variable number of points can not be pushed at once
+    CPPUNIT_ASSERT_THROW(mesh->pushCells(data::Mesh::CellType::POLY, triangles, 1), data::Exception);
+
+    auto cellIt = mesh->begin<data::iterator::ConstCellIterator>();
+    CPPUNIT_ASSERT(data::Mesh::CellType::EDGE == static_cast<data::Mesh::CellType>(*cellIt->type));
+    ++cellIt;
+    CPPUNIT_ASSERT(data::Mesh::CellType::TRIANGLE == static_cast<data::Mesh::CellType>(*cellIt->type));
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::CellId(2), *cellIt->offset);
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::PointId(2), cellIt->pointIdx[2]);
+    ++cellIt;
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::CellId(5), *cellIt->offset);
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::Size(3), cellIt.nbPoints());
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::PointId(2), cellIt->pointIdx[0]);
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::PointId(3), cellIt->pointIdx[1]);
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::PointId(4), cellIt->pointIdx[2]);
+
+    // Allocated point attributes follow the growth of the points
+    data::Mesh::sptr coloredMesh = data::Mesh::New();
+    const auto coloredLock       = coloredMesh->lock();
+    coloredMesh->reserve(1, 1, data::Mesh::CellType::TRIANGLE, data::Mesh::Attributes::POINT_COLORS);
+    for(data::Mesh::PointId i = 0 ; i < 10 ; ++i)
+    {
+        const auto id = coloredMesh->pushPoint(0.f, 0.f, static_cast<float>(i));
+        coloredMesh->setPointColor(id, 1, 2, 3, 4);
+    }
+
+    CPPUNIT_ASSERT(coloredMesh->getPointColorsArray()->getSize()[0] >= 10);
+    CPPUNIT_ASSERT(coloredMesh->adjustAllocatedMemory());
+    CPPUNIT_ASSERT_EQUAL(size_t(10), coloredMesh->getPointColorsArray()->getSize()[0]);
+}
+
+//------------------------------------------------------------------------------
+
+void MeshTest::bulkInsertionTest()
+{
+    const data::Mesh::Size gridSize = 50;
+    const data::Mesh::Size nbPoints = gridSize * gridSize;
+
+    std::vector<data::Mesh::PointValueType> points(3 * size_t(nbPoints));
+    std::vector<data::Mesh::PointId> triangles;
+    triangles.reserve(6 * size_t(gridSize - 1) * size_t(gridSize - 1));
+    for(data::Mesh::Size y = 0 ; y < gridSize ; ++y)
+    {
+        for(data::Mesh::Size x = 0 ; x < gridSize ; ++x)
+        {
+            const data::Mesh::PointId id = y * gridSize + x;
+            points[3 * id]     = static_cast<float>(x);
+            points[3 * id + 1] = static_cast<float>(y);
+            points[3 * id + 2] = static_cast<float>((x + y) % 7);
+
+            if(x + 1 < gridSize && y + 1 < gridSize)
+            {
+                triangles.insert(triangles.end(), {id, id + 1, id + gridSize});
+                triangles.insert(triangles.end(), {id + 1, id + gridSize + 1, id + gridSize});
+            }
+        }
+    }
+
+    const auto nbTriangles = static_cast<data::Mesh::Size>(triangles.size() / 3);
+
+    // Incremental construction, without any reservation
+    data::Mesh::sptr incrementalMesh = data::Mesh::New();
+    const auto incrementalLock       = incrementalMesh->lock();
+    for(data::Mesh::PointId i = 0 ; i < nbPoints ; ++i)
+    {
+        incrementalMesh->pushPoint(&points[3 * size_t(i)]);
+    }
+
+    for(data::Mesh::CellId i = 0 ; i < nbTriangles ; ++i)
+    {
+        incrementalMesh->pushCell(triangles[3 * i], triangles[3 * i + 1], triangles[3 * i + 2]);
+    }
+
+    // Bulk construction
+    data::Mesh::sptr bulkMesh = data::Mesh::New();
+    const auto bulkLock       = bulkMesh->lock();
+    bulkMesh->pushPoints(points.data(), nbPoints);
+    bulkMesh->pushCells(data::Mesh::CellType::TRIANGLE, triangles.data(), nbTriangles);
+
+    CPPUNIT_ASSERT_EQUAL(nbPoints, incrementalMesh->getNumberOfPoints());
+    CPPUNIT_ASSERT_EQUAL(nbPoints, bulkMesh->getNumberOfPoints());
+    CPPUNIT_ASSERT_EQUAL(nbTriangles, incrementalMesh->getNumberOfCells());
+    CPPUNIT_ASSERT_EQUAL(nbTriangles, bulkMesh->getNumberOfCells());
+
+    // Each point and cell of both meshes is the one inserted
+    auto pointIt1 = incrementalMesh->begin<data::iterator::ConstPointIterator>();
+    auto pointIt2 = bulkMesh->begin<data::iterator::ConstPointIterator>();
+    for(data::Mesh::PointId i = 0 ; i < nbPoints ; ++i, ++pointIt1, ++pointIt2)
+    {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(points[3 * size_t(i)], pointIt1->point->x, EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(points[3 * size_t(i) + 1], pointIt1->point->y, EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(points[3 * size_t(i) + 2], pointIt1->point->z, EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(points[3 * size_t(i)], pointIt2->point->x, EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(points[3 * size_t(i) + 1], pointIt2->point->y, EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(points[3 * size_t(i) + 2], pointIt2->point->z, EPSILON);
+    }
+
+    auto cellIt1 = incrementalMesh->begin<data::iterator::ConstCellIterator>();
+    auto cellIt2 = bulkMesh->begin<data::iterator::ConstCellIterator>();
+    for(data::Mesh::CellId i = 0 ; i < nbTriangles ; ++i, ++cellIt1, ++cellIt2)
+    {
+        CPPUNIT_ASSERT(*cellIt1->type == data::Mesh::CellType::TRIANGLE);
+        CPPUNIT_ASSERT(*cellIt2->type == data::Mesh::CellType::TRIANGLE);
+        CPPUNIT_ASSERT_EQUAL(*cellIt1->offset, *cellIt2->offset);
+        CPPUNIT_ASSERT_EQUAL(static_cast<data::Mesh::Size>(3), cellIt2->nbPoints);
+
+        for(std::size_t j = 0 ; j < 3 ; ++j)
+        {
+            CPPUNIT_ASSERT_EQUAL(triangles[3 * i + j], cellIt1->pointIdx[j]);
+            CPPUNIT_ASSERT_EQUAL(triangles[3 * i + j], cellIt2->pointIdx[j]);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
 } //namespace ut
 
 } //namespace sight::data
@@ -41,6 +41,8 @@ private:
     CPPUNIT_TEST(insertion);
     CPPUNIT_TEST(iteratorTest);
     CPPUNIT_TEST(iteratorCopyTest);
+    CPPUNIT_TEST(bulkInsertion);
+    CPPUNIT_TEST(bulkInsertionTest);
     CPPUNIT_TEST_SUITE_END();
 
     const float EPSILON = std::numeric_limits<float>::epsilon();
@@ -57,6 +59,8 @@ public:
     void insertion();
     void iteratorTest();
     void iteratorCopyTest();
+    void bulkInsertion();
+    void bulkInsertionTest();
 };
 
 } //namespace ut
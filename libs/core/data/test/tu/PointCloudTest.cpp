@@ -0,0 +1,215 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "PointCloudTest.hpp"
+
+#include <data/Exception.hpp>
+#include <data/Mesh.hpp>
+#include <data/PointCloud.hpp>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::data::ut::PointCloudTest);
+
+namespace sight::data
+{
+
+namespace ut
+{
+
+//------------------------------------------------------------------------------
+
+void PointCloudTest::setUp()
+{
+    // Set up context before running a test.
+}
+
+//------------------------------------------------------------------------------
+
+void PointCloudTest::tearDown()
+{
+    // Clean up after the test run.
+}
+
+//------------------------------------------------------------------------------
+
+void PointCloudTest::allocationTest()
+{
+    const data::PointCloud::Size nbPoints = 100;
+
+    data::PointCloud::sptr pointCloud = data::PointCloud::New();
+    CPPUNIT_ASSERT_EQUAL(data::PointCloud::Size(0), pointCloud->getNumberOfPoints());
+    CPPUNIT_ASSERT_EQUAL(data::PointCloud::Size(0), pointCloud->getCapacity());
+    CPPUNIT_ASSERT_THROW(pointCloud->reserve(0), data::Exception);
+
+    pointCloud->reserve(nbPoints, data::PointCloud::Attributes::POINT_COLORS);
+    CPPUNIT_ASSERT_EQUAL(data::PointCloud::Size(0), pointCloud->getNumberOfPoints());
+    CPPUNIT_ASSERT_EQUAL(nbPoints, pointCloud->getCapacity());
+    CPPUNIT_ASSERT(pointCloud->hasPointColors());
+    CPPUNIT_ASSERT(!pointCloud->hasPointNormals());
+    CPPUNIT_ASSERT_EQUAL(size_t(nbPoints * (3 * sizeof(float) + 4)), pointCloud->getAllocatedSizeInBytes());
+    CPPUNIT_ASSERT_EQUAL(size_t(0), pointCloud->getDataSizeInBytes());
+
+    pointCloud->setNumberOfPoints(nbPoints / 2);
+    CPPUNIT_ASSERT_EQUAL(nbPoints / 2, pointCloud->getNumberOfPoints());
+    CPPUNIT_ASSERT_EQUAL(size_t(nbPoints / 2 * (3 * sizeof(float) + 4)), pointCloud->getDataSizeInBytes());
+    CPPUNIT_ASSERT_THROW(pointCloud->setNumberOfPoints(nbPoints + 1), data::Exception);
+
+    // Arrays that are not requested anymore are released
+    pointCloud->resize(nbPoints, data::PointCloud::Attributes::POINT_NORMALS);
+    CPPUNIT_ASSERT_EQUAL(nbPoints, pointCloud->getNumberOfPoints());
+    CPPUNIT_ASSERT(!pointCloud->hasPointColors());
+    CPPUNIT_ASSERT(pointCloud->hasPointNormals());
+    CPPUNIT_ASSERT(pointCloud->getPointColorsArray()->empty());
+    CPPUNIT_ASSERT_EQUAL(size_t(nbPoints * 6 * sizeof(float)), pointCloud->getAllocatedSizeInBytes());
+
+    pointCloud->clear();
+    CPPUNIT_ASSERT_EQUAL(data::PointCloud::Size(0), pointCloud->getNumberOfPoints());
+    CPPUNIT_ASSERT_EQUAL(data::PointCloud::Size(0), pointCloud->getCapacity());
+    CPPUNIT_ASSERT_EQUAL(size_t(0), pointCloud->getAllocatedSizeInBytes());
+}
+
+//------------------------------------------------------------------------------
+
+void PointCloudTest::copyTest()
+{
+    data::PointCloud::sptr pointCloud = data::PointCloud::New();
+    pointCloud->resize(10, data::PointCloud::Attributes::POINT_COLORS);
+    {
+        const auto lock = pointCloud->lock();
+        pointCloud->getPointsBuffer()[0] = {1.f, 2.f, 3.f};
+    }
+
+    data::PointCloud::sptr deepCopy = data::PointCloud::New();
+    CPPUNIT_ASSERT_NO_THROW(deepCopy->deepCopy(pointCloud));
+    CPPUNIT_ASSERT_EQUAL(pointCloud->getNumberOfPoints(), deepCopy->getNumberOfPoints());
+    CPPUNIT_ASSERT(deepCopy->hasPointColors());
+    CPPUNIT_ASSERT(pointCloud->getPointsArray() != deepCopy->getPointsArray());
+    {
+        const auto lock = deepCopy->lock();
+        CPPUNIT_ASSERT_EQUAL(2.f, deepCopy->getPointsBuffer()[0].y);
+    }
+
+    data::PointCloud::sptr shallowCopy = data::PointCloud::New();
+    CPPUNIT_ASSERT_NO_THROW(shallowCopy->shallowCopy(pointCloud));
+    CPPUNIT_ASSERT(pointCloud->getPointsArray() == shallowCopy->getPointsArray());
+    CPPUNIT_ASSERT(pointCloud->getPointColorsArray() == shallowCopy->getPointColorsArray());
+
+    CPPUNIT_ASSERT_THROW(shallowCopy->shallowCopy(data::Mesh::New()), data::Exception);
+}
+
+//------------------------------------------------------------------------------
+
+void PointCloudTest::bufferTest()
+{
+    const data::PointCloud::Size nbPoints = 50;
+
+    data::PointCloud::sptr pointCloud = data::PointCloud::New();
+    pointCloud->reserve(
+        nbPoints,
+        data::PointCloud::Attributes::POINT_COLORS | data::PointCloud::Attributes::POINT_NORMALS
+    );
+
+    const auto lock = pointCloud->lock();
+
+    auto* points  = pointCloud->getPointsBuffer();
+    auto* colors  = pointCloud->getPointColorsBuffer();
+    auto* normals = pointCloud->getPointNormalsBuffer();
+    for(data::PointCloud::Size i = 0 ; i < nbPoints ; ++i)
+    {
+        const float f = static_cast<float>(i);
+        points[i]  = {f, f + 1.f, f + 2.f};
+        colors[i]  = {static_cast<std::uint8_t>(i), 0, 0, 255};
+        normals[i] = {0.f, 0.f, 1.f};
+    }
+
+    pointCloud->setNumberOfPoints(nbPoints);
+
+    // The buffers are contiguous and have the same layout as the mesh arrays
+    const auto* rawPoints = static_cast<const float*>(pointCloud->getPointsArray()->getBuffer());
+    CPPUNIT_ASSERT_EQUAL(49.f, rawPoints[3 * 49]);
+    CPPUNIT_ASSERT_EQUAL(51.f, rawPoints[3 * 49 + 2]);
+
+    const auto* rawColors = static_cast<const std::uint8_t*>(pointCloud->getPointColorsArray()->getBuffer());
+    CPPUNIT_ASSERT_EQUAL(std::uint8_t(12), rawColors[4 * 12]);
+    CPPUNIT_ASSERT_EQUAL(std::uint8_t(255), rawColors[4 * 12 + 3]);
+
+    const auto* rawNormals = static_cast<const float*>(pointCloud->getPointNormalsArray()->getBuffer());
+    CPPUNIT_ASSERT_EQUAL(1.f, rawNormals[3 * 20 + 2]);
+}
+
+//------------------------------------------------------------------------------
+
+void PointCloudTest::toMeshTest()
+{
+    const data::PointCloud::Size nbPoints = 20;
+
+    data::PointCloud::sptr pointCloud = data::PointCloud::New();
+    pointCloud->reserve(2 * nbPoints, data::PointCloud::Attributes::POINT_COLORS);
+    {
+        const auto lock = pointCloud->lock();
+        auto* points    = pointCloud->getPointsBuffer();
+        auto* colors    = pointCloud->getPointColorsBuffer();
+        for(data::PointCloud::Size i = 0 ; i < nbPoints ; ++i)
+        {
+            const float f = static_cast<float>(i);
+            points[i] = {f, 2.f * f, 3.f * f};
+            colors[i] = {static_cast<std::uint8_t>(i), 1, 2, 3};
+        }
+    }
+    pointCloud->setNumberOfPoints(nbPoints);
+
+    data::Mesh::sptr mesh = data::Mesh::New();
+    pointCloud->toMesh(mesh);
+
+    CPPUNIT_ASSERT_EQUAL(nbPoints, mesh->getNumberOfPoints());
+    CPPUNIT_ASSERT_EQUAL(nbPoints, mesh->getNumberOfCells());
+    CPPUNIT_ASSERT(mesh->hasPointColors());
+    CPPUNIT_ASSERT(!mesh->hasPointNormals());
+
+    const auto lock = mesh->lock();
+
+    auto pointItr = mesh->begin<data::iterator::ConstPointIterator>();
+    auto cellItr  = mesh->begin<data::iterator::ConstCellIterator>();
+    for(data::PointCloud::Size i = 0 ; i < nbPoints ; ++i, ++pointItr, ++cellItr)
+    {
+        const float f = static_cast<float>(i);
+        CPPUNIT_ASSERT_EQUAL(f, pointItr->point->x);
+        CPPUNIT_ASSERT_EQUAL(2.f * f, pointItr->point->y);
+        CPPUNIT_ASSERT_EQUAL(3.f * f, pointItr->point->z);
+        CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(i), pointItr->rgba->r);
+
+        CPPUNIT_ASSERT(data::Mesh::CellType::POINT == *cellItr->type);
+        CPPUNIT_ASSERT_EQUAL(static_cast<data::Mesh::CellId>(i), *cellItr->offset);
+        CPPUNIT_ASSERT_EQUAL(data::Mesh::Size(1), cellItr->nbPoints);
+        CPPUNIT_ASSERT_EQUAL(static_cast<data::Mesh::CellId>(i), cellItr->pointIdx[0]);
+    }
+
+    // An empty point cloud gives an empty mesh
+    data::PointCloud::New()->toMesh(mesh);
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::Size(0), mesh->getNumberOfPoints());
+    CPPUNIT_ASSERT_EQUAL(data::Mesh::Size(0), mesh->getNumberOfCells());
+}
+
+//------------------------------------------------------------------------------
+
+} //namespace ut
+
+} //namespace sight::data
@@ -0,0 +1,61 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace sight::data
+{
+
+namespace ut
+{
+
+/**
+ * @brief The PointCloudTest class
+ * This class is used to test data::PointCloud
+ */
+class PointCloudTest : public CPPUNIT_NS::TestFixture
+{
+private:
+
+    CPPUNIT_TEST_SUITE(PointCloudTest);
+    CPPUNIT_TEST(allocationTest);
+    CPPUNIT_TEST(copyTest);
+    CPPUNIT_TEST(bufferTest);
+    CPPUNIT_TEST(toMeshTest);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // interface
+    void setUp();
+    void tearDown();
+
+    void allocationTest();
+    void copyTest();
+    void bufferTest();
+    void toMeshTest();
+};
+
+} //namespace ut
+
+} //namespace sight::data
@@ -0,0 +1,200 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "PointSetTest.hpp"
+
+#include <data/Exception.hpp>
+#include <data/Point.hpp>
+#include <data/PointList.hpp>
+#include <data/PointSet.hpp>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::data::ut::PointSetTest);
+
+namespace sight::data
+{
+
+namespace ut
+{
+
+//------------------------------------------------------------------------------
+
+void PointSetTest::setUp()
+{
+    // Set up context before running a test.
+}
+
+//------------------------------------------------------------------------------
+
+void PointSetTest::tearDown()
+{
+    // Clean up after the test run.
+}
+
+//------------------------------------------------------------------------------
+
+void PointSetTest::copyTest()
+{
+    data::PointSet::sptr ps1 = data::PointSet::New();
+    ps1->pushBack({1., 2., 3.});
+    ps1->addAttribute("radius").values[0] = 4.f;
+
+    data::PointSet::sptr ps2 = data::PointSet::New();
+    CPPUNIT_ASSERT_NO_THROW(ps2->deepCopy(ps1));
+    CPPUNIT_ASSERT_EQUAL(size_t(1), ps2->size());
+    CPPUNIT_ASSERT(ps1->getPoint(0) == ps2->getPoint(0));
+    CPPUNIT_ASSERT(ps2->hasAttribute("radius"));
+    CPPUNIT_ASSERT_EQUAL(4.f, ps2->getAttribute("radius")->values[0]);
+
+    // The copy must not share its storage with the source
+    ps2->setPoint(0, {5., 6., 7.});
+    CPPUNIT_ASSERT_EQUAL(1., ps1->getPoint(0)[0]);
+
+    data::PointSet::sptr ps3 = data::PointSet::New();
+    CPPUNIT_ASSERT_NO_THROW(ps3->shallowCopy(ps1));
+    CPPUNIT_ASSERT(ps1->getPoint(0) == ps3->getPoint(0));
+
+    CPPUNIT_ASSERT_THROW(ps3->shallowCopy(data::PointList::New()), data::Exception);
+}
+
+//------------------------------------------------------------------------------
+
+void PointSetTest::pushTest()
+{
+    data::PointSet::sptr ps = data::PointSet::New();
+    CPPUNIT_ASSERT(ps->empty());
+    CPPUNIT_ASSERT(ps->getCoordinates() == nullptr);
+
+    CPPUNIT_ASSERT_EQUAL(size_t(0), ps->pushBack({1., 2., 3.}));
+    CPPUNIT_ASSERT_EQUAL(size_t(1), ps->pushBack({4., 5., 6.}));
+    CPPUNIT_ASSERT_EQUAL(size_t(2), ps->size());
+
+    // Coordinates are stored contiguously
+    const double* coords = ps->getCoordinates();
+    for(size_t i = 0 ; i < 6 ; ++i)
+    {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(static_cast<double>(i + 1), coords[i], 10e-6);
+    }
+
+    ps->clear();
+    CPPUNIT_ASSERT(ps->empty());
+}
+
+//------------------------------------------------------------------------------
+
+void PointSetTest::appendTest()
+{
+    data::PointSet::sptr ps = data::PointSet::New();
+    ps->addAttribute("color", 3);
+    ps->pushBack({0., 0., 0.});
+
+    const std::vector<double> coords = {1., 2., 3., 4., 5., 6., 7., 8., 9.};
+    CPPUNIT_ASSERT_EQUAL(size_t(1), ps->append(coords.data(), 3));
+    CPPUNIT_ASSERT_EQUAL(size_t(4), ps->size());
+    CPPUNIT_ASSERT_EQUAL(size_t(12), ps->getAttribute("color")->values.size());
+
+    for(size_t i = 0 ; i < 3 ; ++i)
+    {
+        for(size_t j = 0 ; j < 3 ; ++j)
+        {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(coords[i * 3 + j], ps->getPoint(i + 1)[j], 10e-6);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void PointSetTest::removeTest()
+{
+    data::PointSet::sptr ps = data::PointSet::New();
+    auto& attribute         = ps->addAttribute("id");
+    for(size_t i = 0 ; i < 4 ; ++i)
+    {
+        const double value = static_cast<double>(i);
+        ps->pushBack({value, value, value});
+    }
+
+    attribute.values = {0.f, 1.f, 2.f, 3.f};
+
+    ps->remove(1);
+    CPPUNIT_ASSERT_EQUAL(size_t(3), ps->size());
+    CPPUNIT_ASSERT_EQUAL(2., ps->getPoint(1)[0]);
+
+    const std::vector<float> expected = {0.f, 2.f, 3.f};
+    CPPUNIT_ASSERT(expected == ps->getAttribute("id")->values);
+
+    CPPUNIT_ASSERT_THROW(ps->remove(3), data::Exception);
+}
+
+//------------------------------------------------------------------------------
+
+void PointSetTest::attributeTest()
+{
+    data::PointSet::sptr ps = data::PointSet::New();
+    ps->resize(5);
+
+    auto& normals = ps->addAttribute("normals", 3);
+    CPPUNIT_ASSERT_EQUAL(size_t(3), normals.numberOfComponents);
+    CPPUNIT_ASSERT_EQUAL(size_t(15), normals.values.size());
+    CPPUNIT_ASSERT_THROW(ps->addAttribute("normals", 3), data::Exception);
+    CPPUNIT_ASSERT_THROW(ps->addAttribute("empty", 0), data::Exception);
+
+    ps->addAttribute("scalar");
+    const std::vector<std::string> expected = {"normals", "scalar"};
+    CPPUNIT_ASSERT(expected == ps->getAttributeNames());
+
+    CPPUNIT_ASSERT_EQUAL(5 * (3 * sizeof(double) + 4 * sizeof(float)), ps->getDataSizeInBytes());
+
+    ps->removeAttribute("normals");
+    CPPUNIT_ASSERT(!ps->hasAttribute("normals"));
+    CPPUNIT_ASSERT(ps->getAttribute("normals") == nullptr);
+}
+
+//------------------------------------------------------------------------------
+
+void PointSetTest::pointListConversionTest()
+{
+    data::PointList::sptr pl = data::PointList::New();
+    pl->pushBack(data::Point::New(1., 2., 3.));
+    pl->pushBack(data::Point::New(4., 5., 6.));
+
+    data::PointSet::sptr ps = data::PointSet::New();
+    ps->fromPointList(pl);
+    CPPUNIT_ASSERT_EQUAL(pl->getPoints().size(), ps->size());
+
+    const auto pl2 = ps->toPointList();
+    CPPUNIT_ASSERT_EQUAL(pl->getPoints().size(), pl2->getPoints().size());
+
+    for(size_t i = 0 ; i < ps->size() ; ++i)
+    {
+        for(size_t j = 0 ; j < 3 ; ++j)
+        {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(pl->getPoints()[i]->getCoord()[j], ps->getPoint(i)[j], 10e-6);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(pl->getPoints()[i]->getCoord()[j], pl2->getPoints()[i]->getCoord()[j], 10e-6);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+} //namespace ut
+
+} //namespace sight::data
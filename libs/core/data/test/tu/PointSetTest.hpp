@@ -0,0 +1,65 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace sight::data
+{
+
+namespace ut
+{
+
+/**
+ * @brief The PointSetTest class
+ * This class is used to test data::PointSet
+ */
+class PointSetTest : public CPPUNIT_NS::TestFixture
+{
+private:
+
+    CPPUNIT_TEST_SUITE(PointSetTest);
+    CPPUNIT_TEST(copyTest);
+    CPPUNIT_TEST(pushTest);
+    CPPUNIT_TEST(appendTest);
+    CPPUNIT_TEST(removeTest);
+    CPPUNIT_TEST(attributeTest);
+    CPPUNIT_TEST(pointListConversionTest);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // interface
+    void setUp();
+    void tearDown();
+
+    void copyTest();
+    void pushTest();
+    void appendTest();
+    void removeTest();
+    void attributeTest();
+    void pointListConversionTest();
+};
+
+} //namespace ut
+
+} //namespace sight::data
@@ -24,6 +24,7 @@
 
 #include "core/thread/ActiveWorkers.hpp"
 
+#include "service/Profiler.hpp"
 #include "service/registry/ObjectService.hpp"
 #include "service/registry/Proxy.hpp"
 
@@ -35,6 +36,7 @@
 #include <core/runtime/EConfigurationElement.hpp>
 #include <core/thread/Worker.hpp>
 #include <core/tools/fwID.hpp>
+#include <core/trace/Recorder.hpp>
 
 #include <functional>
 #include <regex>
@@ -594,11 +596,22 @@ IService::SharedFutureType IService::internalStart(bool _async)
 
     this->connectToConfig();
 
+    // The profiler names the slots itself, when it is enabled now or later
+    if(core::trace::Recorder::isEnabled())
+    {
+        this->nameSlots();
+    }
+
+    Profiler::registerService(*this);
+
     m_globalState = STARTING;
 
     PackagedTaskType task(std::bind(&IService::starting, this));
     SharedFutureType future = task.get_future();
-    task();
+    {
+        Profiler::Scope profilerScope(*this, Profiler::Operation::START);
+        task();
+    }
 
     try
     {
@@ -611,6 +624,7 @@ IService::SharedFutureType IService::internalStart(bool _async)
         SIGHT_ERROR("Service '" + this->getID() + "' is still STOPPED.");
         m_globalState = STOPPED;
         this->disconnectFromConfig();
+        Profiler::unregisterService(*this);
 
         if(!_async)
         {
@@ -653,7 +667,10 @@ IService::SharedFutureType IService::internalStop(bool _async)
     SharedFutureType future = task.get_future();
 
     m_globalState = STOPPING;
-    task();
+    {
+        Profiler::Scope profilerScope(*this, Profiler::Operation::STOP);
+        task();
+    }
 
     try
     {
@@ -679,6 +696,7 @@ IService::SharedFutureType IService::internalStop(bool _async)
         }
     }
     m_globalState = STOPPED;
+    Profiler::unregisterService(*this);
 
     auto sig = this->signal<StoppedSignalType>(s_STOPPED_SIG);
     sig->asyncEmit();
@@ -713,7 +731,10 @@ IService::SharedFutureType IService::internalSwapKey(const KeyType& _key, data::
     this->autoDisconnect();
 
     m_globalState = SWAPPING;
-    task();
+    {
+        Profiler::Scope profilerScope(*this, Profiler::Operation::SWAP);
+        task();
+    }
     m_globalState = STARTED;
 
     try
@@ -774,7 +795,10 @@ IService::SharedFutureType IService::internalUpdate(bool _async)
     PackagedTaskType task(std::bind(&IService::updating, this));
     SharedFutureType future = task.get_future();
     m_updatingState = UPDATING;
-    task();
+    {
+        Profiler::Scope profilerScope(*this, Profiler::Operation::UPDATE);
+        task();
+    }
 
     try
     {
@@ -1018,6 +1042,16 @@ void IService::disconnectFromConfig()
 
 //-----------------------------------------------------------------------------
 
+void IService::nameSlots()
+{
+    for(const auto& key : m_slots.getSlotKeys())
+    {
+        m_slots[key]->setName(Profiler::getSlotName(this->getID(), key));
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void IService::autoDisconnect()
 {
     m_autoConnections.disconnect();
@@ -102,6 +102,7 @@ class SERVICE_CLASS_API IService : public core::tools::Object,
 friend class registry::ObjectService;
 friend class AppConfigManager;
 friend class AppManager;
+friend class Profiler;
 
 public:
 
@@ -1030,6 +1031,9 @@ private:
     /// Disconnect the service from configuration services and objects
     void disconnectFromConfig();
 
+    /// Name the slots after the service, to identify their executions in the worker metrics and in the traces
+    void nameSlots();
+
     /// Connect the service with its data
     void autoConnect();
 
@@ -0,0 +1,453 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "service/Profiler.hpp"
+
+#include "service/IService.hpp"
+
+#include <core/thread/Worker.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <mutex>
+
+namespace sight::service
+{
+
+std::atomic_bool Profiler::s_enabled {false};
+
+namespace
+{
+
+/// Holds the recorded statistics and the registered services.
+struct ProfilerRegistry
+{
+    std::mutex m_mutex;
+
+    /// Statistics of the start, stop, update and swap operations, per service identifier
+    std::map<std::string, Profiler::ServiceStatistics> m_services;
+
+    /// Service identifier and class name, per slot name
+    std::map<std::string, std::pair<std::string, std::string> > m_slotOwners;
+
+    /// Workers of the profiled services
+    std::map<const core::thread::Worker*, core::thread::Worker::wptr> m_workers;
+
+    /// Started services, associated with true once they are profiled
+    std::map<IService*, bool> m_startedServices;
+};
+
+//------------------------------------------------------------------------------
+
+ProfilerRegistry& profilerRegistry()
+{
+    static ProfilerRegistry s_profilerRegistry;
+    return s_profilerRegistry;
+}
+
+//------------------------------------------------------------------------------
+
+Profiler::ServiceStatistics& getServiceStatistics(
+    ProfilerRegistry& _registry,
+    const std::string& _id,
+    const std::string& _classname
+)
+{
+    Profiler::ServiceStatistics& statistics = _registry.m_services[_id];
+    if(statistics.m_id.empty())
+    {
+        statistics.m_id        = _id;
+        statistics.m_classname = _classname;
+    }
+
+    return statistics;
+}
+
+//------------------------------------------------------------------------------
+
+void writeCSVField(std::ostream& _stream, const std::string& _field)
+{
+    if(_field.find_first_of(",\"\n") == std::string::npos)
+    {
+        _stream << _field;
+        return;
+    }
+
+    _stream << '"';
+    for(const char c : _field)
+    {
+        if(c == '"')
+        {
+            _stream << '"';
+        }
+
+        _stream << c;
+    }
+
+    _stream << '"';
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+double Profiler::ServiceStatistics::getWallTime() const
+{
+    double time = 0.;
+    for(const auto& operation : m_operations)
+    {
+        time += operation.m_wallTime;
+    }
+
+    return time;
+}
+
+//------------------------------------------------------------------------------
+
+double Profiler::ServiceStatistics::getCPUTime() const
+{
+    double time = 0.;
+    for(const auto& operation : m_operations)
+    {
+        time += operation.m_cpuTime;
+    }
+
+    return time;
+}
+
+//------------------------------------------------------------------------------
+
+void Profiler::setEnabled(bool _enabled)
+{
+    ProfilerRegistry& reg = profilerRegistry();
+    std::lock_guard<std::mutex> lock(reg.m_mutex);
+
+    s_enabled = _enabled;
+
+    if(_enabled)
+    {
+        // Profile the services started while the profiling was disabled
+        for(auto& service : reg.m_startedServices)
+        {
+            if(!service.second)
+            {
+                Profiler::profileService(*service.first);
+                service.second = true;
+            }
+        }
+    }
+
+    for(const auto& worker : reg.m_workers)
+    {
+        if(const auto lockedWorker = worker.second.lock())
+        {
+            lockedWorker->setMetricsEnabled(_enabled);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void Profiler::record(const IService& _service, Operation _operation, double _wallTime, double _cpuTime)
+{
+    ProfilerRegistry& reg = profilerRegistry();
+    std::lock_guard<std::mutex> lock(reg.m_mutex);
+
+    OperationStatistics& statistics =
+        getServiceStatistics(reg, _service.getID(), _service.getClassname())
+        .m_operations[static_cast<std::size_t>(_operation)];
+
+    ++statistics.m_count;
+    statistics.m_wallTime   += _wallTime;
+    statistics.m_cpuTime    += _cpuTime;
+    statistics.m_maxWallTime = std::max(statistics.m_maxWallTime, _wallTime);
+}
+
+//------------------------------------------------------------------------------
+
+void Profiler::registerService(IService& _service)
+{
+    ProfilerRegistry& reg = profilerRegistry();
+    std::lock_guard<std::mutex> lock(reg.m_mutex);
+
+    const bool enabled = s_enabled;
+    if(enabled)
+    {
+        Profiler::profileService(_service);
+    }
+
+    reg.m_startedServices[&_service] = enabled;
+}
+
+//------------------------------------------------------------------------------
+
+void Profiler::unregisterService(IService& _service)
+{
+    ProfilerRegistry& reg = profilerRegistry();
+    std::lock_guard<std::mutex> lock(reg.m_mutex);
+
+    const auto started = reg.m_startedServices.find(&_service);
+    if(started == reg.m_startedServices.end())
+    {
+        return;
+    }
+
+    const bool profiled = started->second;
+    reg.m_startedServices.erase(started);
+    if(!profiled)
+    {
+        return;
+    }
+
+    const std::string id = _service.getID();
+    const auto worker    = _service.getWorker();
+
+    for(const auto& key : _service.m_slots.getSlotKeys())
+    {
+        const std::string name = Profiler::getSlotName(id, key);
+        const auto owner       = reg.m_slotOwners.find(name);
+        if(owner == reg.m_slotOwners.end())
+        {
+            continue;
+        }
+
+        // Keep the executions of the slot once its name is no longer associated with the service
+        if(worker)
+        {
+            const auto [runTime, cpuTime] = worker->getMetrics()->extract(name);
+            if(runTime.m_count > 0)
+            {
+                OperationStatistics& slot =
+                    getServiceStatistics(reg, owner->second.first, owner->second.second)
+                    .m_operations[static_cast<std::size_t>(Operation::SLOT)];
+                slot.m_count      += runTime.m_count;
+                slot.m_wallTime   += runTime.m_total;
+                slot.m_cpuTime    += cpuTime;
+                slot.m_maxWallTime = std::max(slot.m_maxWallTime, runTime.m_max);
+            }
+        }
+
+        reg.m_slotOwners.erase(owner);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void Profiler::profileService(IService& _service)
+{
+    const std::string id        = _service.getID();
+    const std::string classname = _service.getClassname();
+    const auto worker           = _service.getWorker();
+
+    ProfilerRegistry& reg = profilerRegistry();
+
+    // Name the slots after the service, to identify their executions in the metrics of its worker
+    _service.nameSlots();
+
+    for(const auto& key : _service.m_slots.getSlotKeys())
+    {
+        // These slots are already measured as operations
+        if(key != IService::s_START_SLOT && key != IService::s_STOP_SLOT && key != IService::s_UPDATE_SLOT
+           && key != IService::s_SWAPKEY_SLOT)
+        {
+            reg.m_slotOwners[Profiler::getSlotName(id, key)] = std::make_pair(id, classname);
+        }
+    }
+
+    if(worker)
+    {
+        reg.m_workers[worker.get()] = worker;
+        worker->setMetricsEnabled(true);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+std::string Profiler::getSlotName(const std::string& _serviceID, const std::string& _slotKey)
+{
+    return _serviceID + "/" + _slotKey;
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<Profiler::ServiceStatistics> Profiler::getStatistics(std::size_t _count)
+{
+    std::map<std::string, ServiceStatistics> services;
+    std::vector<core::thread::WorkerMetrics::Snapshot> snapshots;
+    std::map<std::string, std::pair<std::string, std::string> > slotOwners;
+    {
+        ProfilerRegistry& reg = profilerRegistry();
+        std::lock_guard<std::mutex> lock(reg.m_mutex);
+
+        services   = reg.m_services;
+        slotOwners = reg.m_slotOwners;
+
+        for(auto it = reg.m_workers.begin() ; it != reg.m_workers.end() ; )
+        {
+            if(const auto worker = it->second.lock())
+            {
+                snapshots.push_back(worker->getMetrics()->getSnapshot());
+                ++it;
+            }
+            else
+            {
+                it = reg.m_workers.erase(it);
+            }
+        }
+    }
+
+    // Gather the slot executions measured by the workers
+    for(const auto& snapshot : snapshots)
+    {
+        for(const auto& [name, runTime] : snapshot.m_runTimeByName)
+        {
+            const auto owner = slotOwners.find(name);
+            if(owner == slotOwners.end())
+            {
+                continue;
+            }
+
+            ServiceStatistics& service = services[owner->second.first];
+            if(service.m_id.empty())
+            {
+                service.m_id        = owner->second.first;
+                service.m_classname = owner->second.second;
+            }
+
+            OperationStatistics& slot = service.m_operations[static_cast<std::size_t>(Operation::SLOT)];
+            slot.m_count      += runTime.m_count;
+            slot.m_wallTime   += runTime.m_total;
+            slot.m_maxWallTime = std::max(slot.m_maxWallTime, runTime.m_max);
+
+            const auto cpuTime = snapshot.m_cpuTimeByName.find(name);
+            if(cpuTime != snapshot.m_cpuTimeByName.end())
+            {
+                slot.m_cpuTime += cpuTime->second;
+            }
+        }
+    }
+
+    std::vector<ServiceStatistics> statistics;
+    statistics.reserve(services.size());
+    for(auto& service : services)
+    {
+        statistics.push_back(std::move(service.second));
+    }
+
+    std::sort(
+        statistics.begin(),
+        statistics.end(),
+        [](const ServiceStatistics& _a, const ServiceStatistics& _b)
+        {
+            return _a.getWallTime() > _b.getWallTime();
+        });
+
+    if(statistics.size() > _count)
+    {
+        statistics.resize(_count);
+    }
+
+    return statistics;
+}
+
+//------------------------------------------------------------------------------
+
+void Profiler::reset()
+{
+    ProfilerRegistry& reg = profilerRegistry();
+    std::lock_guard<std::mutex> lock(reg.m_mutex);
+
+    reg.m_services.clear();
+
+    for(const auto& worker : reg.m_workers)
+    {
+        if(const auto lockedWorker = worker.second.lock())
+        {
+            lockedWorker->getMetrics()->reset();
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void Profiler::writeCSV(std::ostream& _stream, std::size_t _count)
+{
+    const std::vector<ServiceStatistics> statistics = Profiler::getStatistics(_count);
+
+    _stream << "service,class,wall time (ms),cpu time (ms)";
+    for(std::size_t i = 0 ; i < s_NB_OPERATIONS ; ++i)
+    {
+        const std::string name = Profiler::getOperationName(static_cast<Operation>(i));
+        _stream << "," << name << " count," << name << " wall time (ms)," << name << " cpu time (ms),"
+                << name << " max wall time (ms)";
+    }
+
+    _stream << "\n";
+
+    const auto flags = _stream.flags();
+    _stream << std::fixed << std::setprecision(3);
+
+    for(const auto& service : statistics)
+    {
+        writeCSVField(_stream, service.m_id);
+        _stream << ",";
+        writeCSVField(_stream, service.m_classname);
+        _stream << "," << service.getWallTime() / 1000. << "," << service.getCPUTime() / 1000.;
+
+        for(const auto& operation : service.m_operations)
+        {
+            _stream << "," << operation.m_count << "," << operation.m_wallTime / 1000. << ","
+                    << operation.m_cpuTime / 1000. << "," << operation.m_maxWallTime / 1000.;
+        }
+
+        _stream << "\n";
+    }
+
+    _stream.flags(flags);
+}
+
+//------------------------------------------------------------------------------
+
+std::string Profiler::getOperationName(Operation _operation)
+{
+    switch(_operation)
+    {
+        case Operation::START:
+            return "start";
+
+        case Operation::STOP:
+            return "stop";
+
+        case Operation::UPDATE:
+            return "update";
+
+        case Operation::SWAP:
+            return "swap";
+
+        case Operation::SLOT:
+            return "slot";
+    }
+
+    return "";
+}
+
+} // namespace sight::service
@@ -0,0 +1,208 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "service/config.hpp"
+
+#include <core/tools/System.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace sight::service
+{
+
+class IService;
+
+/**
+ * @brief Records the time spent by each service in its start, stop, update, swap and slots.
+ *
+ * The profiling is disabled by default and can be toggled at runtime with setEnabled(). When it is disabled, it costs
+ * a single relaxed atomic load per operation.
+ *
+ * Start, stop, update and swap operations are measured by IService itself, in wall and CPU time. The executions of
+ * the other slots are measured by the worker of the service: every started service is registered, and once the
+ * profiling is enabled, at its start or later, its slots are named after it, the metrics of its worker are enabled
+ * (see core::thread::WorkerMetrics), and the slot run times are read from them when the statistics are requested.
+ * When a profiled service stops, the run times of its slots are moved from its worker into its statistics.
+ *
+ * The statistics can be retrieved, sorted by decreasing wall time, with getStatistics(), or written as CSV with
+ * writeCSV().
+ */
+class SERVICE_CLASS_API Profiler
+{
+public:
+
+    /// Profiled operations
+    enum class Operation : std::uint8_t
+    {
+        START = 0,
+        STOP,
+        UPDATE,
+        SWAP,
+        SLOT
+    };
+
+    /// Number of profiled operations
+    static constexpr std::size_t s_NB_OPERATIONS = 5;
+
+    /// Statistics of one operation, times are expressed in microseconds
+    struct OperationStatistics
+    {
+        /// Number of executions
+        std::uint64_t m_count {0};
+        /// Total wall time
+        double m_wallTime {0.};
+        /// Total CPU time
+        double m_cpuTime {0.};
+        /// Longest wall time
+        double m_maxWallTime {0.};
+    };
+
+    /// Statistics of one service
+    struct SERVICE_CLASS_API ServiceStatistics
+    {
+        /// Returns the total wall time of all operations, in microseconds
+        SERVICE_API double getWallTime() const;
+
+        /// Returns the total CPU time of all operations, in microseconds
+        SERVICE_API double getCPUTime() const;
+
+        /// Service identifier
+        std::string m_id;
+        /// Service class name
+        std::string m_classname;
+        /// Statistics per operation, indexed by Operation
+        std::array<OperationStatistics, s_NB_OPERATIONS> m_operations;
+    };
+
+    /**
+     * @brief Measures an operation of a service from its construction to its destruction.
+     */
+    class Scope
+    {
+    public:
+
+        Scope(const IService& _service, Operation _operation) noexcept :
+            m_service(_service),
+            m_operation(_operation),
+            m_enabled(Profiler::isEnabled())
+        {
+            if(m_enabled)
+            {
+                m_cpuStart  = core::tools::System::getThreadCPUTime();
+                m_wallStart = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~Scope()
+        {
+            if(m_enabled)
+            {
+                const std::chrono::duration<double, std::micro> wallTime = std::chrono::steady_clock::now()
+                                                                           - m_wallStart;
+                const double cpuTime = core::tools::System::getThreadCPUTime() - m_cpuStart;
+                Profiler::record(m_service, m_operation, wallTime.count(), cpuTime);
+            }
+        }
+
+        Scope(const Scope&)            = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+
+        const IService& m_service;
+        const Operation m_operation;
+        const bool m_enabled;
+        std::chrono::steady_clock::time_point m_wallStart;
+        double m_cpuStart {0.};
+    };
+
+    /// Returns true if the services are profiled.
+    static bool isEnabled() noexcept
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Enables or disables the profiling of the services, and the metrics of their workers. Enabling it profiles the
+    /// services already started.
+    SERVICE_API static void setEnabled(bool _enabled);
+
+    /// Records an operation of a service, times are expressed in microseconds.
+    SERVICE_API static void record(const IService& _service, Operation _operation, double _wallTime, double _cpuTime);
+
+    /**
+     * @brief Registers a service being started.
+     *
+     * The service is profiled now if the profiling is enabled, otherwise when it is enabled with setEnabled().
+     */
+    SERVICE_API static void registerService(IService& _service);
+
+    /**
+     * @brief Unregisters a service registered with registerService(), once it is stopped.
+     *
+     * If it was profiled, the run times of its slots are removed from the metrics of its worker and added to its
+     * statistics.
+     */
+    SERVICE_API static void unregisterService(IService& _service);
+
+    /// Returns the name given to the slot of a service, used to identify its executions.
+    SERVICE_API static std::string getSlotName(const std::string& _serviceID, const std::string& _slotKey);
+
+    /// Returns the statistics of the most expensive services, sorted by decreasing wall time.
+    SERVICE_API static std::vector<ServiceStatistics> getStatistics(
+        std::size_t _count = std::numeric_limits<std::size_t>::max()
+    );
+
+    /// Clears the statistics, and the metrics of the registered workers.
+    SERVICE_API static void reset();
+
+    /// Writes the statistics of the most expensive services in CSV format, times are expressed in milliseconds.
+    SERVICE_API static void writeCSV(
+        std::ostream& _stream,
+        std::size_t _count = std::numeric_limits<std::size_t>::max()
+    );
+
+    /// Returns the name of an operation.
+    SERVICE_API static std::string getOperationName(Operation _operation);
+
+private:
+
+    /**
+     * @brief Profiles a started service, the registry must be locked by the caller.
+     *
+     * Its slots are named after it, the ones not measured as operations are associated with the service, and the
+     * metrics of its worker are enabled.
+     */
+    static void profileService(IService& _service);
+
+    /// Profiling state, kept out of the functions to allow inlining isEnabled().
+    SERVICE_API static std::atomic_bool s_enabled;
+};
+
+} // namespace sight::service
@@ -0,0 +1,268 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "ProfilerTest.hpp"
+
+#include "TestService.hpp"
+
+#include <core/thread/Worker.hpp>
+
+#include <service/op/Add.hpp>
+#include <service/Profiler.hpp>
+#include <service/registry/ObjectService.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::service::ut::ProfilerTest);
+
+namespace sight::service
+{
+
+namespace ut
+{
+
+//------------------------------------------------------------------------------
+
+void ProfilerTest::setUp()
+{
+    Profiler::reset();
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerTest::tearDown()
+{
+    Profiler::setEnabled(false);
+    Profiler::reset();
+}
+
+//------------------------------------------------------------------------------
+
+static const Profiler::ServiceStatistics* findStatistics(
+    const std::vector<Profiler::ServiceStatistics>& _statistics,
+    const std::string& _id
+)
+{
+    for(const auto& statistics : _statistics)
+    {
+        if(statistics.m_id == _id)
+        {
+            return &statistics;
+        }
+    }
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+static std::uint64_t getCount(const Profiler::ServiceStatistics& _statistics, Profiler::Operation _operation)
+{
+    return _statistics.m_operations[static_cast<std::size_t>(_operation)].m_count;
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerTest::disabledTest()
+{
+    Profiler::setEnabled(false);
+    CPPUNIT_ASSERT(!Profiler::isEnabled());
+
+    auto service = service::add<service::ut::TestService>("::sight::service::ut::TestServiceImplementation");
+    service->start().wait();
+    service->update().wait();
+    service->stop().wait();
+
+    CPPUNIT_ASSERT(findStatistics(Profiler::getStatistics(), service->getID()) == nullptr);
+
+    // The slots are not named when neither the profiling nor the tracing is enabled
+    CPPUNIT_ASSERT_EQUAL(
+        std::string(),
+        std::string(service->slot(TestServiceImplementation::s_UPDATE2_SLOT)->getName())
+    );
+
+    service::OSR::unregisterService(service);
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerTest::operationsTest()
+{
+    Profiler::setEnabled(true);
+
+    core::thread::Worker::sptr worker = core::thread::Worker::New();
+
+    auto service = service::add<service::ut::TestService>("::sight::service::ut::TestServiceImplementation");
+    service->setWorker(worker);
+
+    service->start().wait();
+    for(int i = 0 ; i < 3 ; ++i)
+    {
+        service->update().wait();
+    }
+
+    service->slot(TestServiceImplementation::s_UPDATE2_SLOT)->asyncRun().wait();
+    CPPUNIT_ASSERT(service->getIsUpdated2());
+
+    service->stop().wait();
+
+    // Ensures the slot execution has been recorded by the worker
+    worker->stop();
+
+    const auto allStatistics = Profiler::getStatistics();
+    const auto* statistics   = findStatistics(allStatistics, service->getID());
+    CPPUNIT_ASSERT(statistics != nullptr);
+    CPPUNIT_ASSERT_EQUAL(service->getClassname(), statistics->m_classname);
+
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), getCount(*statistics, Profiler::Operation::START));
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(3), getCount(*statistics, Profiler::Operation::UPDATE));
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(0), getCount(*statistics, Profiler::Operation::SWAP));
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), getCount(*statistics, Profiler::Operation::STOP));
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), getCount(*statistics, Profiler::Operation::SLOT));
+
+    CPPUNIT_ASSERT(statistics->getWallTime() > 0.);
+    CPPUNIT_ASSERT(statistics->getCPUTime() >= 0.);
+
+    // The slots are named after the service
+    CPPUNIT_ASSERT_EQUAL(
+        Profiler::getSlotName(service->getID(), TestServiceImplementation::s_UPDATE2_SLOT),
+        std::string(service->slot(TestServiceImplementation::s_UPDATE2_SLOT)->getName())
+    );
+
+    // The statistics are sorted by decreasing wall time
+    for(std::size_t i = 1 ; i < allStatistics.size() ; ++i)
+    {
+        CPPUNIT_ASSERT(allStatistics[i - 1].getWallTime() >= allStatistics[i].getWallTime());
+    }
+
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), Profiler::getStatistics(1).size());
+
+    Profiler::reset();
+    CPPUNIT_ASSERT(findStatistics(Profiler::getStatistics(), service->getID()) == nullptr);
+
+    service::OSR::unregisterService(service);
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerTest::restartTest()
+{
+    Profiler::setEnabled(true);
+
+    core::thread::Worker::sptr worker = core::thread::Worker::New();
+
+    auto service = service::add<service::ut::TestService>("::sight::service::ut::TestServiceImplementation");
+    service->setWorker(worker);
+
+    for(int i = 0 ; i < 2 ; ++i)
+    {
+        service->start().wait();
+        service->slot(TestServiceImplementation::s_UPDATE2_SLOT)->asyncRun().wait();
+        service->stop().wait();
+
+        // The slot executions are kept once the service is stopped, and are not counted twice after a restart
+        const auto* statistics = findStatistics(Profiler::getStatistics(), service->getID());
+        CPPUNIT_ASSERT(statistics != nullptr);
+        CPPUNIT_ASSERT_EQUAL(std::uint64_t(i + 1), getCount(*statistics, Profiler::Operation::START));
+        CPPUNIT_ASSERT_EQUAL(std::uint64_t(i + 1), getCount(*statistics, Profiler::Operation::SLOT));
+    }
+
+    // The slots of a stopped service are no longer associated with it
+    const std::string slotName = Profiler::getSlotName(service->getID(), TestServiceImplementation::s_UPDATE2_SLOT);
+    CPPUNIT_ASSERT(worker->getMetrics()->getSnapshot().m_runTimeByName.count(slotName) == 0);
+
+    worker->stop();
+    service::OSR::unregisterService(service);
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerTest::enableWhileStartedTest()
+{
+    Profiler::setEnabled(false);
+
+    core::thread::Worker::sptr worker = core::thread::Worker::New();
+
+    auto service = service::add<service::ut::TestService>("::sight::service::ut::TestServiceImplementation");
+    service->setWorker(worker);
+    service->start().wait();
+
+    // Not profiled yet
+    service->slot(TestServiceImplementation::s_UPDATE2_SLOT)->asyncRun().wait();
+    CPPUNIT_ASSERT(findStatistics(Profiler::getStatistics(), service->getID()) == nullptr);
+
+    // The running service is profiled as soon as the profiling is enabled
+    Profiler::setEnabled(true);
+    CPPUNIT_ASSERT_EQUAL(
+        Profiler::getSlotName(service->getID(), TestServiceImplementation::s_UPDATE2_SLOT),
+        std::string(service->slot(TestServiceImplementation::s_UPDATE2_SLOT)->getName())
+    );
+
+    service->slot(TestServiceImplementation::s_UPDATE2_SLOT)->asyncRun().wait();
+    service->stop().wait();
+
+    const auto* statistics = findStatistics(Profiler::getStatistics(), service->getID());
+    CPPUNIT_ASSERT(statistics != nullptr);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(0), getCount(*statistics, Profiler::Operation::START));
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), getCount(*statistics, Profiler::Operation::SLOT));
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), getCount(*statistics, Profiler::Operation::STOP));
+
+    worker->stop();
+    service::OSR::unregisterService(service);
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerTest::csvTest()
+{
+    Profiler::setEnabled(true);
+
+    auto service = service::add<service::ut::TestService>("::sight::service::ut::TestServiceImplementation");
+    service->setID("csv,\"service\"");
+    service->start().wait();
+    service->update().wait();
+    service->stop().wait();
+
+    std::stringstream stream;
+    Profiler::writeCSV(stream);
+
+    std::string line;
+    std::getline(stream, line);
+    CPPUNIT_ASSERT_EQUAL(std::string("service,class,wall time (ms),cpu time (ms),start count,"), line.substr(0, 55));
+
+    std::getline(stream, line);
+    const std::string expectedStart = "\"csv,\"\"service\"\"\"," + service->getClassname() + ",";
+    CPPUNIT_ASSERT_EQUAL(expectedStart, line.substr(0, expectedStart.size()));
+
+    // 4 columns for the service, 4 per operation, plus the comma escaped in the identifier
+    CPPUNIT_ASSERT_EQUAL(
+        std::ptrdiff_t(3 + 4 * Profiler::s_NB_OPERATIONS + 1),
+        std::count(line.begin(), line.end(), ',')
+    );
+
+    service::OSR::unregisterService(service);
+}
+
+} //namespace ut
+
+} //namespace sight::service
@@ -0,0 +1,60 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace sight::service
+{
+
+namespace ut
+{
+
+/**
+ * @brief Test the profiling of the services.
+ */
+class ProfilerTest : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(ProfilerTest);
+CPPUNIT_TEST(disabledTest);
+CPPUNIT_TEST(operationsTest);
+CPPUNIT_TEST(restartTest);
+CPPUNIT_TEST(enableWhileStartedTest);
+CPPUNIT_TEST(csvTest);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // interface
+    void setUp();
+    void tearDown();
+
+    void disabledTest();
+    void operationsTest();
+    void restartTest();
+    void enableWhileStartedTest();
+    void csvTest();
+};
+
+} //namespace ut
+
+} //namespace sight::service
@@ -0,0 +1,260 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "CompressedImageDiff.hpp"
+
+#include <core/exceptionmacros.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include <zlib.h>
+
+namespace sight::filter::image
+{
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+
+/// Gathers the bytes of the same rank of each value, then compresses them. Returns the compressed size.
+size_t compressValues(
+    const std::vector<std::uint8_t>& _values,
+    size_t _valueSize,
+    std::vector<std::uint8_t>& _dst
+)
+{
+    const size_t nbValues = _valueSize > 0 ? _values.size() / _valueSize : 0;
+
+    std::vector<std::uint8_t> shuffled(_values.size());
+    for(size_t i = 0 ; i < nbValues ; ++i)
+    {
+        for(size_t j = 0 ; j < _valueSize ; ++j)
+        {
+            shuffled[j * nbValues + i] = _values[i * _valueSize + j];
+        }
+    }
+
+    const size_t offset = _dst.size();
+    uLongf size         = compressBound(static_cast<uLong>(shuffled.size()));
+    _dst.resize(offset + size);
+
+    const int result = compress2(
+        _dst.data() + offset,
+        &size,
+        shuffled.data(),
+        static_cast<uLong>(shuffled.size()),
+        Z_BEST_SPEED
+    );
+    SIGHT_THROW_IF("Unable to compress the image diff values (zlib error " << result << ").", result != Z_OK);
+
+    _dst.resize(offset + size);
+    return size;
+}
+
+//------------------------------------------------------------------------------
+
+/// Uncompresses the values compressed by compressValues().
+std::vector<std::uint8_t> uncompressValues(
+    const std::uint8_t* _src,
+    size_t _srcSize,
+    size_t _nbValues,
+    size_t _valueSize
+)
+{
+    std::vector<std::uint8_t> shuffled(_nbValues * _valueSize);
+
+    uLongf size      = static_cast<uLongf>(shuffled.size());
+    const int result = uncompress(shuffled.data(), &size, _src, static_cast<uLong>(_srcSize));
+    SIGHT_THROW_IF(
+        "Unable to uncompress the image diff values (zlib error " << result << ").",
+        result != Z_OK || size != shuffled.size()
+    );
+
+    std::vector<std::uint8_t> values(shuffled.size());
+    for(size_t i = 0 ; i < _nbValues ; ++i)
+    {
+        for(size_t j = 0 ; j < _valueSize ; ++j)
+        {
+            values[i * _valueSize + j] = shuffled[j * _nbValues + i];
+        }
+    }
+
+    return values;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+CompressedImageDiff::CompressedImageDiff(const ImageDiff& diff) :
+    m_imgEltSize(diff.getImageElementSize())
+{
+    const size_t nbDiffElts = diff.getNumberOfElements();
+    if(nbDiffElts == 0)
+    {
+        return;
+    }
+
+    // Sort the pixel diffs by image index, keeping the insertion order of the pixels changed several times.
+    std::vector<size_t> order(nbDiffElts);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(
+        order.begin(),
+        order.end(),
+        [&diff](size_t _a, size_t _b)
+        {
+            return diff.getElementDiffIndex(_a) < diff.getElementDiffIndex(_b);
+        });
+
+    std::vector<std::uint8_t> oldValues;
+    std::vector<std::uint8_t> newValues;
+    oldValues.reserve(nbDiffElts * m_imgEltSize);
+    newValues.reserve(nbDiffElts * m_imgEltSize);
+
+    for(size_t i = 0 ; i < nbDiffElts ; )
+    {
+        const data::Image::IndexType index = diff.getElementDiffIndex(order[i]);
+
+        // The first old value and the last new value of a pixel are kept.
+        size_t last = i;
+        while(last + 1 < nbDiffElts && diff.getElementDiffIndex(order[last + 1]) == index)
+        {
+            ++last;
+        }
+
+        const ImageDiff::ElementType firstElt = diff.getElement(order[i]);
+        const ImageDiff::ElementType lastElt  = diff.getElement(order[last]);
+        oldValues.insert(oldValues.end(), firstElt.m_oldValue, firstElt.m_oldValue + m_imgEltSize);
+        newValues.insert(newValues.end(), lastElt.m_newValue, lastElt.m_newValue + m_imgEltSize);
+
+        if(!m_spans.empty() && m_spans.back().m_first + m_spans.back().m_count == index)
+        {
+            ++m_spans.back().m_count;
+        }
+        else
+        {
+            m_spans.push_back({index, 1});
+        }
+
+        ++m_nbElts;
+        i = last + 1;
+    }
+
+    m_spans.shrink_to_fit();
+
+    std::vector<std::uint8_t> compressed;
+    m_oldValuesSize = compressValues(oldValues, m_imgEltSize, compressed);
+    m_newValuesSize = compressValues(newValues, m_imgEltSize, compressed);
+
+    m_values = core::memory::BufferObject::New();
+    m_values->allocate(compressed.size());
+    const auto lock = m_values->lock();
+    std::memcpy(lock.getBuffer(), compressed.data(), compressed.size());
+}
+
+//------------------------------------------------------------------------------
+
+CompressedImageDiff::~CompressedImageDiff()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void CompressedImageDiff::applyDiff(const data::Image::sptr& img) const
+{
+    this->writeValues(img, true);
+}
+
+//------------------------------------------------------------------------------
+
+void CompressedImageDiff::revertDiff(const data::Image::sptr& img) const
+{
+    this->writeValues(img, false);
+}
+
+//------------------------------------------------------------------------------
+
+size_t CompressedImageDiff::getSize() const
+{
+    return m_spans.capacity() * sizeof(Span) + m_oldValuesSize + m_newValuesSize;
+}
+
+//------------------------------------------------------------------------------
+
+size_t CompressedImageDiff::getNumberOfElements() const
+{
+    return m_nbElts;
+}
+
+//------------------------------------------------------------------------------
+
+size_t CompressedImageDiff::getNumberOfSpans() const
+{
+    return m_spans.size();
+}
+
+//------------------------------------------------------------------------------
+
+void CompressedImageDiff::writeValues(const data::Image::sptr& img, bool newValues) const
+{
+    if(m_nbElts == 0)
+    {
+        return;
+    }
+
+    std::vector<std::uint8_t> values;
+    {
+        const auto lock                 = m_values->lock();
+        const std::uint8_t* const start = static_cast<const std::uint8_t*>(lock.getBuffer());
+        values = newValues
+                 ? uncompressValues(start + m_oldValuesSize, m_newValuesSize, m_nbElts, m_imgEltSize)
+                 : uncompressValues(start, m_oldValuesSize, m_nbElts, m_imgEltSize);
+    }
+
+    const auto dumpLock = img->lock();
+
+    // Like data::Image::setPixelBuffer(), only the size of an image pixel is written for each element.
+    const size_t pixelSize                = img->getType().sizeOf() * img->getNumberOfComponents();
+    data::Image::BufferType* const buffer = static_cast<data::Image::BufferType*>(img->getBuffer());
+
+    const std::uint8_t* value = values.data();
+    for(const Span& span : m_spans)
+    {
+        data::Image::BufferType* pixel = buffer + span.m_first * pixelSize;
+        if(pixelSize == m_imgEltSize)
+        {
+            std::memcpy(pixel, value, span.m_count * pixelSize);
+            value += span.m_count * pixelSize;
+        }
+        else
+        {
+            for(data::Image::IndexType i = 0 ; i < span.m_count ; ++i, pixel += pixelSize, value += m_imgEltSize)
+            {
+                std::memcpy(pixel, value, std::min(pixelSize, m_imgEltSize));
+            }
+        }
+    }
+}
+
+} // namespace sight::filter::image
@@ -0,0 +1,102 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "filter/image/config.hpp"
+#include "filter/image/ImageDiff.hpp"
+
+#include <core/memory/BufferObject.hpp>
+
+#include <data/Image.hpp>
+
+#include <vector>
+
+namespace sight::filter::image
+{
+
+/**
+ * @brief Compact, read-only encoding of an ImageDiff, meant to keep long edit histories in memory.
+ *
+ * The changed pixels are sorted and stored as spans of consecutive indices. Their old and new values are compressed
+ * with zlib, after gathering the bytes of the same rank of each value. The compressed values are held by a
+ * core::memory::BufferObject, so the BufferManager may dump them on the disk like any other buffer.
+ *
+ * When a pixel is changed several times in the source diff, revertDiff() restores its first old value and
+ * applyDiff() writes its last new value.
+ */
+class FILTER_IMAGE_CLASS_API CompressedImageDiff
+{
+public:
+
+    /// Encodes the given diff.
+    FILTER_IMAGE_API CompressedImageDiff(const ImageDiff& diff = ImageDiff());
+
+    /// Destructor
+    FILTER_IMAGE_API ~CompressedImageDiff();
+
+    /// Write the new values in the image.
+    FILTER_IMAGE_API void applyDiff(const data::Image::sptr& img) const;
+
+    /// Write the old values back in the image.
+    FILTER_IMAGE_API void revertDiff(const data::Image::sptr& img) const;
+
+    /// Return the amount of memory used by the spans and the compressed values.
+    FILTER_IMAGE_API size_t getSize() const;
+
+    /// Returns the number of distinct pixels changed by the diff.
+    FILTER_IMAGE_API size_t getNumberOfElements() const;
+
+    /// Returns the number of spans of consecutive pixels.
+    FILTER_IMAGE_API size_t getNumberOfSpans() const;
+
+private:
+
+    /// Consecutive changed pixels.
+    struct Span
+    {
+        data::Image::IndexType m_first;
+        data::Image::IndexType m_count;
+    };
+
+    /// Write the old or new values in the image.
+    void writeValues(const data::Image::sptr& img, bool newValues) const;
+
+    /// The size of the old and new values of a pixel.
+    size_t m_imgEltSize {0};
+
+    /// Number of distinct changed pixels.
+    size_t m_nbElts {0};
+
+    /// Sorted spans of changed pixels.
+    std::vector<Span> m_spans;
+
+    /// Compressed size of the old values, stored at the beginning of m_values.
+    size_t m_oldValuesSize {0};
+
+    /// Compressed size of the new values, stored after the old values in m_values.
+    size_t m_newValuesSize {0};
+
+    /// The compressed old and new values.
+    core::memory::BufferObject::sptr m_values;
+};
+
+} // namespace sight::filter::image
@@ -189,6 +189,13 @@ size_t ImageDiff::getNumberOfElements() const
 
 //------------------------------------------------------------------------------
 
+size_t ImageDiff::getImageElementSize() const
+{
+    return m_imgEltSize;
+}
+
+//------------------------------------------------------------------------------
+
 void ImageDiff::clear()
 {
     m_nbElts = 0;
@@ -83,6 +83,9 @@ public:
     /// Returns the number of stored pixel diffs.
     FILTER_IMAGE_API size_t getNumberOfElements() const;
 
+    /// Returns the size of the old and new values of a pixel diff.
+    FILTER_IMAGE_API size_t getImageElementSize() const;
+
     /// Set the number of elements to 0.
     FILTER_IMAGE_API void clear();
 
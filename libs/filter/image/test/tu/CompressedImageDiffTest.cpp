@@ -0,0 +1,230 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "CompressedImageDiffTest.hpp"
+
+#include <core/tools/Type.hpp>
+
+#include <data/Image.hpp>
+
+#include <filter/image/CompressedImageDiff.hpp>
+#include <filter/image/ImageDiff.hpp>
+
+#include <utestData/generator/Image.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::filter::image::ut::CompressedImageDiffTest);
+
+namespace sight::filter::image
+{
+
+namespace ut
+{
+
+//------------------------------------------------------------------------------
+
+static data::Image::sptr createImage()
+{
+    const data::Image::Size SIZE          = {{64, 64, 64}};
+    const data::Image::Spacing SPACING    = {{1., 1., 1.}};
+    const data::Image::Origin ORIGIN      = {{0., 0., 0.}};
+    const core::tools::Type TYPE          = core::tools::Type::s_INT16;
+    const data::Image::PixelFormat FORMAT = data::Image::PixelFormat::GRAY_SCALE;
+
+    data::Image::sptr image = data::Image::New();
+    utestData::generator::Image::generateImage(image, SIZE, SPACING, ORIGIN, TYPE, FORMAT);
+
+    const auto dumpLock = image->lock();
+    auto* const buffer  = static_cast<std::int16_t*>(image->getBuffer());
+    for(size_t i = 0 ; i < image->getSizeInBytes() / sizeof(std::int16_t) ; ++i)
+    {
+        buffer[i] = static_cast<std::int16_t>(i % 251);
+    }
+
+    return image;
+}
+
+//------------------------------------------------------------------------------
+
+/// Paints a cube of the given value in the image and records the changes in the diff.
+static void paintCube(
+    const data::Image::sptr& image,
+    ImageDiff& diff,
+    data::Image::IndexType origin,
+    data::Image::IndexType size,
+    std::int16_t value
+)
+{
+    const auto& imageSize = image->getSize2();
+    const auto* newValue  = reinterpret_cast<const data::Image::BufferType*>(&value);
+
+    for(data::Image::IndexType z = origin ; z < origin + size ; ++z)
+    {
+        for(data::Image::IndexType y = origin ; y < origin + size ; ++y)
+        {
+            for(data::Image::IndexType x = origin ; x < origin + size ; ++x)
+            {
+                const data::Image::IndexType index = x + imageSize[0] * (y + imageSize[1] * z);
+                const auto* oldValue               =
+                    static_cast<const data::Image::BufferType*>(image->getPixelBuffer(index));
+                diff.addDiff(index, oldValue, newValue);
+                image->setPixelBuffer(index, const_cast<data::Image::BufferType*>(newValue));
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+static void assertImageEqual(const data::Image::sptr& image, const std::vector<std::int16_t>& values)
+{
+    const auto* const buffer = static_cast<const std::int16_t*>(image->getBuffer());
+    for(size_t i = 0 ; i < values.size() ; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("index: " + std::to_string(i), values[i], buffer[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void CompressedImageDiffTest::setUp()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void CompressedImageDiffTest::tearDown()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void CompressedImageDiffTest::undoRedoTest()
+{
+    const data::Image::sptr image = createImage();
+    const auto dumpLock           = image->lock();
+
+    const auto* const buffer = static_cast<const std::int16_t*>(image->getBuffer());
+    const size_t nbPixels    = image->getSizeInBytes() / sizeof(std::int16_t);
+    const std::vector<std::int16_t> before(buffer, buffer + nbPixels);
+
+    ImageDiff diff(image->getType().sizeOf());
+    paintCube(image, diff, 10, 8, 1000);
+
+    // Some scattered pixels, added in a random order.
+    const std::vector<data::Image::IndexType> indices = {{70000, 51, 23456, 6, 9999, 7}};
+    const std::int16_t value                          = -5;
+    for(const auto index : indices)
+    {
+        diff.addDiff(
+            index,
+            static_cast<const data::Image::BufferType*>(image->getPixelBuffer(index)),
+            reinterpret_cast<const data::Image::BufferType*>(&value)
+        );
+        image->setPixelBuffer(index, reinterpret_cast<data::Image::BufferType*>(const_cast<std::int16_t*>(&value)));
+    }
+
+    const std::vector<std::int16_t> after(buffer, buffer + nbPixels);
+
+    const CompressedImageDiff compressedDiff(diff);
+    CPPUNIT_ASSERT_EQUAL(diff.getNumberOfElements(), compressedDiff.getNumberOfElements());
+
+    // One span per row of the cube, 6 and 7 are consecutive.
+    CPPUNIT_ASSERT_EQUAL(size_t(8 * 8 + 5), compressedDiff.getNumberOfSpans());
+
+    compressedDiff.revertDiff(image);
+    assertImageEqual(image, before);
+
+    compressedDiff.applyDiff(image);
+    assertImageEqual(image, after);
+
+    // Both diffs must give the same result.
+    diff.revertDiff(image);
+    assertImageEqual(image, before);
+    compressedDiff.applyDiff(image);
+    diff.revertDiff(image);
+    assertImageEqual(image, before);
+}
+
+//------------------------------------------------------------------------------
+
+void CompressedImageDiffTest::duplicatePixelsTest()
+{
+    const data::Image::sptr image = createImage();
+    const auto dumpLock           = image->lock();
+
+    const auto* const buffer = static_cast<const std::int16_t*>(image->getBuffer());
+    const size_t nbPixels    = image->getSizeInBytes() / sizeof(std::int16_t);
+    const std::vector<std::int16_t> before(buffer, buffer + nbPixels);
+
+    // Two overlapping strokes.
+    ImageDiff diff(image->getType().sizeOf());
+    paintCube(image, diff, 4, 6, 300);
+    paintCube(image, diff, 7, 6, 400);
+
+    const std::vector<std::int16_t> after(buffer, buffer + nbPixels);
+
+    const CompressedImageDiff compressedDiff(diff);
+    CPPUNIT_ASSERT_EQUAL(size_t(2 * 6 * 6 * 6 - 3 * 3 * 3), compressedDiff.getNumberOfElements());
+
+    compressedDiff.revertDiff(image);
+    assertImageEqual(image, before);
+
+    compressedDiff.applyDiff(image);
+    assertImageEqual(image, after);
+}
+
+//------------------------------------------------------------------------------
+
+void CompressedImageDiffTest::compressionTest()
+{
+    const data::Image::sptr image = createImage();
+    const auto dumpLock           = image->lock();
+
+    ImageDiff diff(image->getType().sizeOf());
+    paintCube(image, diff, 2, 60, 42);
+
+    const CompressedImageDiff compressedDiff(diff);
+    CPPUNIT_ASSERT_EQUAL(size_t(60 * 60 * 60), compressedDiff.getNumberOfElements());
+
+    // The indices are stored as spans and the values are highly redundant.
+    CPPUNIT_ASSERT_MESSAGE(
+        "compressed size: " + std::to_string(compressedDiff.getSize()) + ", raw size: "
+        + std::to_string(diff.getSize()),
+        compressedDiff.getSize() * 10 < diff.getSize()
+    );
+
+    // Empty diff.
+    const CompressedImageDiff emptyDiff;
+    CPPUNIT_ASSERT_EQUAL(size_t(0), emptyDiff.getNumberOfElements());
+    CPPUNIT_ASSERT_EQUAL(size_t(0), emptyDiff.getSize());
+    CPPUNIT_ASSERT_NO_THROW(emptyDiff.applyDiff(image));
+    CPPUNIT_ASSERT_NO_THROW(emptyDiff.revertDiff(image));
+}
+
+//------------------------------------------------------------------------------
+
+} //namespace ut
+
+} //namespace sight::filter::image
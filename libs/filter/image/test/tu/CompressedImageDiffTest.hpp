@@ -0,0 +1,60 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace sight::filter::image
+{
+
+namespace ut
+{
+
+/**
+ * @brief Test CompressedImageDiff encoding and application.
+ */
+class CompressedImageDiffTest : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(CompressedImageDiffTest);
+CPPUNIT_TEST(undoRedoTest);
+CPPUNIT_TEST(duplicatePixelsTest);
+CPPUNIT_TEST(compressionTest);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    void setUp();
+    void tearDown();
+
+    /// Test CompressedImageDiff revert/apply methods against ImageDiff ones.
+    void undoRedoTest();
+
+    /// Test that a pixel changed several times is reverted to its first value.
+    void duplicatePixelsTest();
+
+    /// Test that a large stroke takes less memory once compressed.
+    void compressionTest();
+};
+
+} //namespace ut
+
+} //namespace sight::filter::image
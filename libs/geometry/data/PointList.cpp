@@ -28,7 +28,9 @@
 #include <geometry/data/Matrix4.hpp>
 
 #include <glm/geometric.hpp>
+#include <glm/mat4x4.hpp>
 #include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
 
 #include <list>
 
@@ -215,6 +217,138 @@ const ::sight::data::Point::sptr PointList::removeClosestPoint(
     return nullptr;
 }
 
+//------------------------------------------------------------------------------
+
+::sight::data::Array::sptr PointList::computeDistance(
+    const ::sight::data::PointSet::csptr& _pointSet1,
+    const ::sight::data::PointSet::csptr& _pointSet2
+)
+{
+    SIGHT_ASSERT(
+        "the 2 point sets must have the same number of points",
+        _pointSet1->size() == _pointSet2->size()
+    );
+
+    const auto& points1 = _pointSet1->getPoints();
+    const auto& points2 = _pointSet2->getPoints();
+    const size_t size   = points1.size();
+
+    ::sight::data::Array::sptr outputArray = ::sight::data::Array::New();
+    outputArray->resize({size}, sight::core::tools::Type::s_DOUBLE);
+    const auto dumpLock   = outputArray->lock();
+    auto distanceArrayItr = outputArray->begin<double>();
+
+    for(size_t i = 0 ; i < size ; ++i)
+    {
+        const ::glm::dvec3 pt1 = ::glm::dvec3(points1[i][0], points1[i][1], points1[i][2]);
+        const ::glm::dvec3 pt2 = ::glm::dvec3(points2[i][0], points2[i][1], points2[i][2]);
+        *distanceArrayItr = ::glm::distance(pt1, pt2);
+        ++distanceArrayItr;
+    }
+
+    return outputArray;
+}
+
+//------------------------------------------------------------------------------
+
+void PointList::transform(
+    const ::sight::data::PointSet::sptr& _pointSet,
+    const ::sight::data::Matrix4::csptr& _matrix
+)
+{
+    const ::glm::dmat4x4 matrix = ::sight::geometry::data::getMatrixFromTF3D(_matrix);
+
+    for(auto& point : _pointSet->getPoints())
+    {
+        const ::glm::dvec4 pt = matrix * ::glm::dvec4(point[0], point[1], point[2], 1.);
+        point = {pt.x, pt.y, pt.z};
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void PointList::associate(
+    const ::sight::data::PointSet::csptr& _pointSet1,
+    const ::sight::data::PointSet::sptr& _pointSet2
+)
+{
+    SIGHT_ASSERT(
+        "the 2 point sets must have the same number of points",
+        _pointSet1->size() == _pointSet2->size()
+    );
+
+    const auto& points1 = _pointSet1->getPoints();
+    auto& points2       = _pointSet2->getPoints();
+
+    // Copy the second set since its points are overwritten in place, and keep track of already matched points
+    const ::sight::data::PointSet::ContainerType candidates = points2;
+    std::vector<bool> matched(candidates.size(), false);
+
+    for(size_t index = 0 ; index < points1.size() ; ++index)
+    {
+        const ::glm::dvec3 point1(points1[index][0], points1[index][1], points1[index][2]);
+
+        // Identify the closest point
+        double distanceMin  = std::numeric_limits<double>::max();
+        size_t closestIndex = 0;
+
+        for(size_t j = 0 ; j < candidates.size() ; ++j)
+        {
+            if(!matched[j])
+            {
+                const ::glm::dvec3 point2(candidates[j][0], candidates[j][1], candidates[j][2]);
+                const double distance = ::glm::distance(point1, point2);
+                if(distance < distanceMin)
+                {
+                    distanceMin  = distance;
+                    closestIndex = j;
+                }
+            }
+        }
+
+        points2[index]        = candidates[closestIndex];
+        matched[closestIndex] = true;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+std::optional< ::sight::data::PointSet::PointType> PointList::removeClosestPoint(
+    const ::sight::data::PointSet::sptr& _pointSet,
+    const ::sight::data::PointSet::PointType& _point,
+    float _delta
+)
+{
+    const auto& points = _pointSet->getPoints();
+    const ::glm::dvec3 p1(_point[0], _point[1], _point[2]);
+
+    // Data to find the closest point
+    double closest = std::numeric_limits<double>::max();
+    std::optional<size_t> index;
+
+    // Find the closest one
+    for(size_t i = 0 ; i < points.size() ; ++i)
+    {
+        const ::glm::dvec3 p2(points[i][0], points[i][1], points[i][2]);
+        const double distance = ::glm::distance(p1, p2);
+        if(distance < _delta && distance < closest)
+        {
+            closest = distance;
+            index   = i;
+        }
+    }
+
+    // Remove the closest point if it has been found
+    if(index)
+    {
+        const auto point = points[*index];
+        _pointSet->remove(*index);
+        return point;
+    }
+
+    return std::nullopt;
+}
+
 //-----------------------------------------------------------------------------
 
 } // namespace sight::geometry::data
@@ -27,9 +27,12 @@
 #include <data/Array.hpp>
 #include <data/Matrix4.hpp>
 #include <data/PointList.hpp>
+#include <data/PointSet.hpp>
 
 #include <core/data/PointList.hpp>
 
+#include <optional>
+
 namespace sight::geometry::data
 {
 
@@ -91,6 +94,58 @@ public:
         const ::sight::data::Point::csptr& _point,
         float _delta
     );
+
+    /**
+     * @name data::PointSet overloads
+     * These functions work directly on the contiguous coordinates of the point set.
+     * @{
+     */
+    /**
+     * @brief Computes the point-to-point distance between 2 point sets
+     * @param[in] _pointSet1 first point set
+     * @param[in] _pointSet2 second point set
+     * @return array of the size of one the point sets (they must have the same size)
+     */
+    GEOMETRY_DATA_API static ::sight::data::Array::sptr computeDistance(
+        const ::sight::data::PointSet::csptr& _pointSet1,
+        const ::sight::data::PointSet::csptr& _pointSet2
+    );
+
+    /**
+     * @brief Transform a point set with a transformation matrix
+     * @param[in,out] _pointSet point set to be transformed
+     * @param[in] _matrix transformation to apply to each points in the set
+     */
+    GEOMETRY_DATA_API static void transform(
+        const ::sight::data::PointSet::sptr& _pointSet,
+        const ::sight::data::Matrix4::csptr& _matrix
+    );
+
+    /**
+     * @brief Associate 2 point sets:
+     * Take 2 point sets as input and re-order the second one, so that the points at the
+     * same index on both sets are the closest to each other. Attributes of the second set are not re-ordered.
+     * @param[in] _pointSet1 first point set
+     * @param[in,out] _pointSet2 point set that will be re-ordered
+     */
+    GEOMETRY_DATA_API static void associate(
+        const ::sight::data::PointSet::csptr& _pointSet1,
+        const ::sight::data::PointSet::sptr& _pointSet2
+    );
+
+    /**
+     * @brief removeClosestPoint: removes the closest point from a reference point
+     * @param[in] _pointSet: the point set
+     * @param[in] _point: used to find the closest point in the set
+     * @param[in] _delta: the maximum tolerance  between the reference point and the point to find
+     * @return the removed point or std::nullopt if no point has been removed
+     */
+    GEOMETRY_DATA_API static std::optional< ::sight::data::PointSet::PointType> removeClosestPoint(
+        const ::sight::data::PointSet::sptr& _pointSet,
+        const ::sight::data::PointSet::PointType& _point,
+        float _delta
+    );
+    /// @}
 };
 
 } // namespace sight::geometry::data
@@ -25,12 +25,15 @@
 #include <core/Exception.hpp>
 
 #include <data/Point.hpp>
+#include <data/PointSet.hpp>
 
 #include <geometry/data/PointList.hpp>
 
 #include <glm/geometric.hpp>
 #include <glm/vec3.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <random>
 
 // Registers the fixture into the 'registry'
@@ -528,6 +531,63 @@ void PointListTest::removeClosestPointExtreme()
     }
 }
 
+//------------------------------------------------------------------------------
+
+void PointListTest::pointSet()
+{
+    // Build a cube and its translated copy
+    sight::data::PointSet::sptr ps1 = sight::data::PointSet::New();
+    sight::data::PointSet::sptr ps2 = sight::data::PointSet::New();
+    for(size_t i = 0 ; i < 8 ; ++i)
+    {
+        ps1->pushBack({double(i & 1), double((i >> 1) & 1), double((i >> 2) & 1)});
+    }
+
+    ps2->deepCopy(ps1);
+
+    const auto tf = sight::data::Matrix4::New();
+    tf->setCoefficient(0, 3, 8.);
+    tf->setCoefficient(1, 3, 16.);
+    tf->setCoefficient(2, 3, 32.);
+    geometry::data::PointList::transform(ps2, tf);
+
+    auto distances = geometry::data::PointList::computeDistance(ps1, ps2);
+    {
+        const auto dumpLock  = distances->lock();
+        const double refDist = std::sqrt(8. * 8. + 16. * 16. + 32. * 32.);
+        for(auto it = distances->begin<double>() ; it != distances->end<double>() ; ++it)
+        {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(refDist, *it, 1e-8);
+        }
+    }
+
+    // Reverse the translation and shuffle the points, then associate them back
+    tf->setCoefficient(0, 3, -8.);
+    tf->setCoefficient(1, 3, -16.);
+    tf->setCoefficient(2, 3, -32.);
+    geometry::data::PointList::transform(ps2, tf);
+    std::reverse(ps2->getPoints().begin(), ps2->getPoints().end());
+
+    geometry::data::PointList::associate(ps1, ps2);
+    distances = geometry::data::PointList::computeDistance(ps1, ps2);
+    {
+        const auto dumpLock = distances->lock();
+        for(auto it = distances->begin<double>() ; it != distances->end<double>() ; ++it)
+        {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(0., *it, 1e-8);
+        }
+    }
+
+    // Remove the closest point
+    CPPUNIT_ASSERT(!geometry::data::PointList::removeClosestPoint(ps1, {5., 5., 5.}, 1.f));
+    const auto removed = geometry::data::PointList::removeClosestPoint(ps1, {0.9, 0.9, 0.9}, 1.f);
+    CPPUNIT_ASSERT(removed);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1., (*removed)[0], 1e-8);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1., (*removed)[1], 1e-8);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1., (*removed)[2], 1e-8);
+    CPPUNIT_ASSERT_EQUAL(size_t(7), ps1->size());
+}
+
 } //namespace ut
 
 } //namespace sight::geometry::data
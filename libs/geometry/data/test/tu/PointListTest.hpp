@@ -42,6 +42,7 @@ private:
     CPPUNIT_TEST(associate);
     CPPUNIT_TEST(removeClosestPointNominal);
     CPPUNIT_TEST(removeClosestPointExtreme);
+    CPPUNIT_TEST(pointSet);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -59,6 +60,8 @@ public:
     void removeClosestPointNominal();
 
     void removeClosestPointExtreme();
+
+    void pointSet();
 };
 
 } //namespace ut
@@ -0,0 +1,371 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/base/detail/GzBlocks.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <ios>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sight::io::base
+{
+
+namespace detail
+{
+
+namespace gzBlocks
+{
+
+/// Size of the uncompressed data of a gzip member
+static constexpr std::size_t s_BLOCK_SIZE = 1024 * 1024;
+
+/// Size of the header of a gzip member, including the extra field storing the size of the member
+static constexpr std::size_t s_HEADER_SIZE = 20;
+
+/// Size of the trailer of a gzip member (CRC32 and size of the uncompressed data)
+static constexpr std::size_t s_TRAILER_SIZE = 8;
+
+/// Header of a gzip member: FEXTRA flag, unknown OS and a 'SB' subfield holding the size of the member
+static constexpr std::array<std::uint8_t, s_HEADER_SIZE - 4> s_HEADER =
+{
+    0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x08, 0x00, 'S', 'B', 0x04, 0x00
+};
+
+//------------------------------------------------------------------------------
+
+static void putUInt32(char* dest, std::uint32_t value)
+{
+    for(std::size_t i = 0 ; i < 4 ; ++i)
+    {
+        dest[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+static std::uint32_t getUInt32(const char* src)
+{
+    std::uint32_t value = 0;
+    for(std::size_t i = 0 ; i < 4 ; ++i)
+    {
+        value |= static_cast<std::uint32_t>(static_cast<std::uint8_t>(src[i])) << (8 * i);
+    }
+
+    return value;
+}
+
+//------------------------------------------------------------------------------
+
+static bool isBlockHeader(const char* header)
+{
+    return std::equal(
+        s_HEADER.begin(),
+        s_HEADER.end(),
+        header,
+        [](std::uint8_t expected, char value)
+        {
+            return expected == static_cast<std::uint8_t>(value);
+        });
+}
+
+//------------------------------------------------------------------------------
+
+static std::size_t getConcurrency(std::size_t threadCount)
+{
+    return std::max<std::size_t>(1, threadCount > 0 ? threadCount : std::thread::hardware_concurrency());
+}
+
+//------------------------------------------------------------------------------
+
+static void throwFailure(const std::string& message, const std::filesystem::path& file)
+{
+    throw std::ios_base::failure(message + file.string());
+}
+
+//------------------------------------------------------------------------------
+
+static std::vector<char> compressBlock(const char* data, std::size_t size)
+{
+    z_stream stream {};
+    if(deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        throw std::ios_base::failure("Unable to initialize the gzip compression");
+    }
+
+    const uLong bound = deflateBound(&stream, static_cast<uLong>(size));
+    std::vector<char> member(s_HEADER_SIZE + bound + s_TRAILER_SIZE);
+
+    stream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    stream.avail_in  = static_cast<uInt>(size);
+    stream.next_out  = reinterpret_cast<Bytef*>(member.data() + s_HEADER_SIZE);
+    stream.avail_out = static_cast<uInt>(bound);
+
+    const int result = deflate(&stream, Z_FINISH);
+    deflateEnd(&stream);
+
+    if(result != Z_STREAM_END)
+    {
+        throw std::ios_base::failure("Unable to compress a gzip block");
+    }
+
+    member.resize(s_HEADER_SIZE + stream.total_out + s_TRAILER_SIZE);
+
+    std::copy(s_HEADER.begin(), s_HEADER.end(), member.begin());
+    putUInt32(member.data() + s_HEADER.size(), static_cast<std::uint32_t>(member.size()));
+
+    const uLong crc = crc32(crc32(0, Z_NULL, 0), reinterpret_cast<const Bytef*>(data), static_cast<uInt>(size));
+    putUInt32(member.data() + member.size() - s_TRAILER_SIZE, static_cast<std::uint32_t>(crc));
+    putUInt32(member.data() + member.size() - 4, static_cast<std::uint32_t>(size));
+
+    return member;
+}
+
+//------------------------------------------------------------------------------
+
+static void decompressBlock(const std::vector<char>& member, char* dest, std::size_t size)
+{
+    // zlib refuses a null output even if there is nothing to write
+    char empty = 0;
+
+    z_stream stream {};
+    if(inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+    {
+        throw std::ios_base::failure("Unable to initialize the gzip decompression");
+    }
+
+    stream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(member.data() + s_HEADER_SIZE));
+    stream.avail_in  = static_cast<uInt>(member.size() - s_HEADER_SIZE - s_TRAILER_SIZE);
+    stream.next_out  = reinterpret_cast<Bytef*>(size > 0 ? dest : &empty);
+    stream.avail_out = static_cast<uInt>(size);
+
+    const int result = inflate(&stream, Z_FINISH);
+    inflateEnd(&stream);
+
+    if(result != Z_STREAM_END || stream.total_out != size)
+    {
+        throw std::ios_base::failure("Unable to decompress a gzip block");
+    }
+
+    const uLong crc = crc32(crc32(0, Z_NULL, 0), reinterpret_cast<const Bytef*>(dest), static_cast<uInt>(size));
+    if(static_cast<std::uint32_t>(crc) != getUInt32(member.data() + member.size() - s_TRAILER_SIZE))
+    {
+        throw std::ios_base::failure("Corrupted gzip block");
+    }
+}
+
+//------------------------------------------------------------------------------
+
+static std::size_t readStream(const std::filesystem::path& file, void* buffer, std::size_t size)
+{
+    gzFile rawFile = gzopen(file.string().c_str(), "rb");
+    if(rawFile == 0)
+    {
+        throwFailure("Unable to open ", file);
+    }
+
+    char* ptr = static_cast<char*>(buffer);
+
+    int uncompressedBytesRead = 0;
+    std::size_t readBytes     = 0;
+
+    // gzread() takes the size as an unsigned int, the buffer is read by chunks
+    while(readBytes < size
+          && (uncompressedBytesRead =
+                  gzread(
+                      rawFile,
+                      ptr + readBytes,
+                      static_cast<unsigned int>(std::min<std::size_t>(
+                                                    size - readBytes,
+                                                    std::numeric_limits<int>::max()
+                      ))
+                  )) > 0)
+    {
+        readBytes += static_cast<std::size_t>(uncompressedBytesRead);
+    }
+
+    gzclose(rawFile);
+
+    if(uncompressedBytesRead == -1)
+    {
+        throwFailure("Unable to read ", file);
+    }
+
+    return readBytes;
+}
+
+//------------------------------------------------------------------------------
+
+void write(const std::filesystem::path& file, const void* buffer, std::size_t size, std::size_t threadCount)
+{
+    std::ofstream output(file, std::ios::binary | std::ios::trunc);
+    if(!output)
+    {
+        throwFailure("Unable to open ", file);
+    }
+
+    const char* ptr = static_cast<const char*>(buffer);
+
+    // The blocks are written in order while the next ones are compressed, at most one block per thread is held in
+    // memory. An empty buffer is still written as an empty gzip member.
+    const std::size_t concurrency = getConcurrency(threadCount);
+    const auto policy             = concurrency > 1 ? std::launch::async : std::launch::deferred;
+    std::deque<std::future<std::vector<char> > > pending;
+
+    const auto writeFront =
+        [&]()
+        {
+            const std::vector<char> member = pending.front().get();
+            pending.pop_front();
+
+            output.write(member.data(), static_cast<std::streamsize>(member.size()));
+            if(!output)
+            {
+                throwFailure("Unable to write ", file);
+            }
+        };
+
+    std::size_t offset = 0;
+    do
+    {
+        const std::size_t blockSize = std::min(s_BLOCK_SIZE, size - offset);
+        pending.push_back(std::async(policy, compressBlock, ptr + offset, blockSize));
+        offset += blockSize;
+
+        if(pending.size() >= concurrency)
+        {
+            writeFront();
+        }
+    }
+    while(offset < size);
+
+    while(!pending.empty())
+    {
+        writeFront();
+    }
+
+    output.close();
+    if(!output)
+    {
+        throwFailure("Unable to write ", file);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t read(const std::filesystem::path& file, void* buffer, std::size_t size, std::size_t threadCount)
+{
+    std::ifstream input(file, std::ios::binary);
+    if(!input)
+    {
+        throwFailure("Unable to open ", file);
+    }
+
+    std::array<char, s_HEADER_SIZE> header;
+    input.read(header.data(), static_cast<std::streamsize>(header.size()));
+
+    if(input.gcount() != static_cast<std::streamsize>(header.size()) || !isBlockHeader(header.data()))
+    {
+        // Not written by write(), the members can not be found without decompressing them
+        input.close();
+        return readStream(file, buffer, size);
+    }
+
+    char* ptr = static_cast<char*>(buffer);
+
+    // The members are read in order and decompressed concurrently in their own part of the buffer, at most one
+    // compressed member per thread is held in memory.
+    const std::size_t concurrency = getConcurrency(threadCount);
+    const auto policy             = concurrency > 1 ? std::launch::async : std::launch::deferred;
+    std::deque<std::future<void> > pending;
+
+    const auto waitFront =
+        [&]()
+        {
+            pending.front().get();
+            pending.pop_front();
+        };
+
+    std::size_t offset = 0;
+    do
+    {
+        if(input.gcount() != static_cast<std::streamsize>(header.size()) || !isBlockHeader(header.data()))
+        {
+            throwFailure("Corrupted gzip block in ", file);
+        }
+
+        const std::size_t memberSize = getUInt32(header.data() + s_HEADER.size());
+        if(memberSize < s_HEADER_SIZE + s_TRAILER_SIZE)
+        {
+            throwFailure("Corrupted gzip block in ", file);
+        }
+
+        std::vector<char> member(memberSize);
+        std::copy(header.begin(), header.end(), member.begin());
+        input.read(member.data() + s_HEADER_SIZE, static_cast<std::streamsize>(memberSize - s_HEADER_SIZE));
+        if(input.gcount() != static_cast<std::streamsize>(memberSize - s_HEADER_SIZE))
+        {
+            throwFailure("Unable to read ", file);
+        }
+
+        const std::size_t blockSize = getUInt32(member.data() + memberSize - 4);
+        if(blockSize > size - offset)
+        {
+            throwFailure("Unexpected size of the data in ", file);
+        }
+
+        pending.push_back(std::async(policy, decompressBlock, std::move(member), ptr + offset, blockSize));
+        offset += blockSize;
+
+        if(pending.size() >= concurrency)
+        {
+            waitFront();
+        }
+
+        input.read(header.data(), static_cast<std::streamsize>(header.size()));
+    }
+    while(input.gcount() > 0);
+
+    while(!pending.empty())
+    {
+        waitFront();
+    }
+
+    return offset;
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace gzBlocks
+
+} // namespace detail
+
+} // namespace sight::io::base
@@ -0,0 +1,75 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "io/base/config.hpp"
+
+#include <cstddef>
+#include <filesystem>
+
+namespace sight::io::base
+{
+
+namespace detail
+{
+
+/**
+ * @brief Helpers to write and read '.raw.gz' files on several threads.
+ *
+ * The buffer is split in blocks of fixed size, each one compressed in its own gzip member. Like in the BGZF format,
+ * the header of each member holds the compressed size of the member in an extra field, thus the members can be found
+ * without decompressing the file, and then decompressed concurrently. The concatenated members remain a valid gzip
+ * file, it can still be read by zlib (gzread()), gunzip or an older version of the readers.
+ */
+namespace gzBlocks
+{
+
+/**
+ * @brief Compresses the buffer in the file, the blocks are compressed concurrently.
+ *
+ * @param file path of the written file
+ * @param buffer data to compress
+ * @param size size of the data in bytes
+ * @param threadCount number of threads compressing the blocks, 0 uses the number of hardware threads
+ * @throw std::ios_base::failure if the file can not be written
+ */
+void write(const std::filesystem::path& file, const void* buffer, std::size_t size, std::size_t threadCount);
+
+/**
+ * @brief Decompresses the file in the buffer, the blocks are decompressed concurrently.
+ *
+ * A gzip file which was not written by write() is decompressed with zlib on the current thread.
+ *
+ * @param file path of the read file
+ * @param buffer destination of the decompressed data
+ * @param size size of the buffer in bytes
+ * @param threadCount number of threads decompressing the blocks, 0 uses the number of hardware threads
+ * @return the number of decompressed bytes, at most size
+ * @throw std::ios_base::failure if the file can not be read or is corrupted
+ */
+std::size_t read(const std::filesystem::path& file, void* buffer, std::size_t size, std::size_t threadCount);
+
+} // namespace gzBlocks
+
+} // namespace detail
+
+} // namespace sight::io::base
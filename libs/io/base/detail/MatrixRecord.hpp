@@ -0,0 +1,69 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sight::io::base
+{
+
+namespace detail
+{
+
+/**
+ * @brief Layout of the binary matrix timeline files, written by writer::MatrixRecordWriter and read by
+ * reader::MatrixRecordReader.
+ *
+ * The file starts with a header of 16 bytes: the signature "SMTL", the format version and the number of matrices of
+ * each record (32 bits unsigned integers), and 4 reserved bytes. The records follow, sorted by timestamp. A record holds
+ * the timestamp (double), the presence mask of the matrices (64 bits unsigned integer) and the 16 floats of each matrix.
+ * All the records have the same size, thus the position of a record is known from its index, and the file is its own
+ * index of timestamps. Values are stored in the native byte order, a file written with another byte order is detected
+ * by its version.
+ */
+namespace matrixRecord
+{
+
+/// Signature of the files
+static constexpr char s_SIGNATURE[4] = {'S', 'M', 'T', 'L'};
+
+/// Version of the format
+static constexpr std::uint32_t s_VERSION = 1;
+
+/// Size of the header in bytes
+static constexpr std::size_t s_HEADER_SIZE = 16;
+
+/// Maximum number of matrices in a record, limited by the presence mask
+static constexpr std::uint32_t s_MAX_MATRICES = 64;
+
+/// Returns the size of a record in bytes
+inline std::size_t recordSize(std::uint32_t numberOfMatrices)
+{
+    return sizeof(double) + sizeof(std::uint64_t) + numberOfMatrices * 16 * sizeof(float);
+}
+
+} // namespace matrixRecord
+
+} // namespace detail
+
+} // namespace sight::io::base
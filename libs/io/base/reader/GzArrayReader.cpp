@@ -22,10 +22,9 @@
 
 #include "io/base/reader/GzArrayReader.hpp"
 
+#include "io/base/detail/GzBlocks.hpp"
 #include "io/base/reader/registry/macros.hpp"
 
-#include <zlib.h>
-
 #include <iostream>
 
 SIGHT_REGISTER_IO_READER(::sight::io::base::reader::GzArrayReader);
@@ -60,20 +59,9 @@ void GzArrayReader::read()
     size_t arraySizeInBytes = array->resize(array->getSize());
     const auto dumpLock     = array->lock();
 
-    void* buff = array->getBuffer();
-
-    gzFile rawFile = gzopen(file.string().c_str(), "rb");
-    if(rawFile == 0)
-    {
-        gzclose(rawFile);
-        std::string str = "Unable to open ";
-        str += file.string();
-        throw std::ios_base::failure(str);
-    }
-
-    const int uncompressedBytesReaded = gzread(rawFile, buff, static_cast<unsigned int>(arraySizeInBytes));
-    gzclose(rawFile);
-    if(uncompressedBytesReaded != static_cast<int>(arraySizeInBytes))
+    const size_t uncompressedBytesRead =
+        io::base::detail::gzBlocks::read(file, array->getBuffer(), arraySizeInBytes, m_threadCount);
+    if(uncompressedBytesRead != arraySizeInBytes)
     {
         std::string str = "Unable to read ";
         str += file.string();
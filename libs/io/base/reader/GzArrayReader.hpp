@@ -29,6 +29,7 @@
 
 #include <data/Array.hpp>
 
+#include <cstddef>
 #include <filesystem>
 
 namespace sight::io::base
@@ -61,11 +62,22 @@ public:
     /// Destructor. Does nothing.
     IO_BASE_API virtual ~GzArrayReader();
 
-    /// Reads the file using the zlib API.
+    /// Reads the file using zlib, the blocks of data are decompressed concurrently.
     IO_BASE_API void read() override;
 
     /// Defines extensions supported by this reader. Here: ".raw.gz"
     IO_BASE_API std::string extension() override;
+
+    /// Sets the number of threads decompressing the blocks of data, 0 uses the number of hardware threads.
+    void setThreadCount(std::size_t threadCount)
+    {
+        m_threadCount = threadCount;
+    }
+
+private:
+
+    /// Number of threads decompressing the blocks of data, 0 means the number of hardware threads
+    std::size_t m_threadCount {0};
 };
 
 } // namespace reader
@@ -22,14 +22,11 @@
 
 #include "io/base/reader/GzBufferImageReader.hpp"
 
+#include "io/base/detail/GzBlocks.hpp"
 #include "io/base/reader/registry/macros.hpp"
 
 #include <data/Image.hpp>
 
-#include <zlib.h>
-
-#include <iostream>
-
 SIGHT_REGISTER_IO_READER(::sight::io::base::reader::GzBufferImageReader);
 
 namespace sight::io::base
@@ -63,35 +60,8 @@ void GzBufferImageReader::read()
 
     image->resize();
     const auto dumpLock = image->lock();
-    char* ptr           = static_cast<char*>(image->getBuffer());
-
-    gzFile rawFile = gzopen(file.string().c_str(), "rb");
-
-    SIGHT_ASSERT("rawFile not instanced", rawFile);
-    if(rawFile == 0)
-    {
-        std::string str = "Unable to open ";
-        str += file.string();
-        throw std::ios_base::failure(str);
-    }
-
-    int uncompressedbytesreaded;
-    size_t readBytes = 0;
-
-    while((uncompressedbytesreaded =
-               gzread(rawFile, ptr + readBytes, static_cast<unsigned int>(imageSizeInBytes - readBytes))) > 0)
-    {
-        readBytes += static_cast<size_t>(uncompressedbytesreaded);
-    }
-
-    gzclose(rawFile);
-
-    if(uncompressedbytesreaded == -1)
-    {
-        std::string str = "Unable to read ";
-        str += file.string();
-        throw std::ios_base::failure(str);
-    }
+
+    io::base::detail::gzBlocks::read(file, image->getBuffer(), imageSizeInBytes, m_threadCount);
 }
 
 //------------------------------------------------------------------------------
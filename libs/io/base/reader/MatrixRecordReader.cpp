@@ -0,0 +1,162 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/base/reader/MatrixRecordReader.hpp"
+
+#include "io/base/detail/MatrixRecord.hpp"
+
+#include <core/Exception.hpp>
+#include <core/exceptionmacros.hpp>
+#include <core/memory/FileHolder.hpp>
+#include <core/memory/MappedFile.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <system_error>
+
+namespace sight::io::base
+{
+
+namespace reader
+{
+
+using namespace detail::matrixRecord;
+
+//------------------------------------------------------------------------------
+
+MatrixRecordReader::MatrixRecordReader(const std::filesystem::path& file)
+{
+    std::ifstream input(file, std::ios::binary);
+    char header[s_HEADER_SIZE];
+    input.read(header, static_cast<std::streamsize>(s_HEADER_SIZE));
+
+    std::uint32_t version = 0;
+    std::memcpy(&version, header + 4, sizeof(version));
+    std::memcpy(&m_numberOfMatrices, header + 8, sizeof(m_numberOfMatrices));
+
+    SIGHT_THROW_IF(
+        "The file '" << file.string() << "' is not a matrix timeline file.",
+        input.gcount() != static_cast<std::streamsize>(s_HEADER_SIZE)
+        || std::memcmp(header, s_SIGNATURE, sizeof(s_SIGNATURE)) != 0 || version != s_VERSION
+        || m_numberOfMatrices == 0 || m_numberOfMatrices > s_MAX_MATRICES
+    );
+
+    input.close();
+
+    std::error_code error;
+    const std::uintmax_t fileSize = std::filesystem::file_size(file, error);
+    SIGHT_THROW_IF("The file '" << file.string() << "' can not be read: " << error.message(), error);
+
+    m_recordSize      = recordSize(m_numberOfMatrices);
+    m_numberOfRecords = static_cast<std::size_t>((fileSize - s_HEADER_SIZE) / m_recordSize);
+
+    // The header is mapped too, the records are then aligned like in the file
+    m_mapping = std::make_unique<core::memory::MappedFile>(
+        core::memory::FileHolder(file),
+        s_HEADER_SIZE + m_numberOfRecords * m_recordSize,
+        0,
+        true
+    );
+}
+
+//------------------------------------------------------------------------------
+
+MatrixRecordReader::~MatrixRecordReader()
+{
+}
+
+//------------------------------------------------------------------------------
+
+bool MatrixRecordReader::isMatrixRecord(const std::filesystem::path& file)
+{
+    std::ifstream input(file, std::ios::binary);
+    char signature[sizeof(s_SIGNATURE)];
+    input.read(signature, static_cast<std::streamsize>(sizeof(signature)));
+
+    return input.gcount() == static_cast<std::streamsize>(sizeof(signature))
+           && std::memcmp(signature, s_SIGNATURE, sizeof(s_SIGNATURE)) == 0;
+}
+
+//------------------------------------------------------------------------------
+
+core::HiResClock::HiResClockType MatrixRecordReader::getTimestamp(std::size_t index) const
+{
+    core::HiResClock::HiResClockType timestamp = 0.;
+    std::memcpy(&timestamp, this->getRecord(index), sizeof(timestamp));
+    return timestamp;
+}
+
+//------------------------------------------------------------------------------
+
+std::uint64_t MatrixRecordReader::getMask(std::size_t index) const
+{
+    std::uint64_t mask = 0;
+    std::memcpy(&mask, this->getRecord(index) + sizeof(double), sizeof(mask));
+    return mask;
+}
+
+//------------------------------------------------------------------------------
+
+const float* MatrixRecordReader::getMatrix(std::size_t index, std::uint32_t matrix) const
+{
+    SIGHT_ASSERT("Matrix index out of bounds", matrix < m_numberOfMatrices);
+
+    const char* matrices = this->getRecord(index) + sizeof(double) + sizeof(std::uint64_t);
+    return reinterpret_cast<const float*>(matrices) + matrix * 16;
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t MatrixRecordReader::find(core::HiResClock::HiResClockType timestamp) const
+{
+    std::size_t first = 0;
+    std::size_t count = m_numberOfRecords;
+    while(count > 0)
+    {
+        const std::size_t step = count / 2;
+        if(this->getTimestamp(first + step) < timestamp)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return first;
+}
+
+//------------------------------------------------------------------------------
+
+const char* MatrixRecordReader::getRecord(std::size_t index) const
+{
+    SIGHT_ASSERT("Record index out of bounds", index < m_numberOfRecords);
+
+    return static_cast<const char*>(m_mapping->getBuffer()) + s_HEADER_SIZE + index * m_recordSize;
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace reader
+
+} // namespace sight::io::base
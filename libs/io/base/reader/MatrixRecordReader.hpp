@@ -0,0 +1,119 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "io/base/config.hpp"
+
+#include <core/HiResClock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+namespace sight::core::memory
+{
+
+class MappedFile;
+
+}
+
+namespace sight::io::base
+{
+
+namespace reader
+{
+
+/**
+ * @brief Reads the timestamped matrices of a binary matrix timeline file ('.smtl'), written by
+ * writer::MatrixRecordWriter.
+ *
+ * The file is mapped in memory: nothing is parsed nor copied, the records are loaded by the system when they are
+ * accessed. Since all the records have the same size, any record is reached directly from its index, and the record
+ * closest to a timestamp is found by a binary search on the timestamps.
+ */
+class IO_BASE_CLASS_API MatrixRecordReader
+{
+public:
+
+    /**
+     * @brief Maps the file in memory.
+     *
+     * An incomplete last record, i.e. left by an interrupted recording, is ignored. The file must not be modified
+     * as long as it is mapped.
+     *
+     * @param file path of the matrix timeline file
+     * @throw core::Exception if the file is not a matrix timeline file or can not be mapped
+     */
+    IO_BASE_API MatrixRecordReader(const std::filesystem::path& file);
+
+    /// Unmaps the file.
+    IO_BASE_API ~MatrixRecordReader();
+
+    /// Returns true if the file starts with the signature of the matrix timeline files.
+    IO_BASE_API static bool isMatrixRecord(const std::filesystem::path& file);
+
+    /// Returns the number of matrices of each record.
+    std::uint32_t getNumberOfMatrices() const
+    {
+        return m_numberOfMatrices;
+    }
+
+    /// Returns the number of records.
+    std::size_t getNumberOfRecords() const
+    {
+        return m_numberOfRecords;
+    }
+
+    /// Returns the timestamp of a record.
+    IO_BASE_API core::HiResClock::HiResClockType getTimestamp(std::size_t index) const;
+
+    /// Returns the presence mask of a record, the bit i is set if the matrix i is valid.
+    IO_BASE_API std::uint64_t getMask(std::size_t index) const;
+
+    /// Returns the 16 values of a matrix of a record.
+    IO_BASE_API const float* getMatrix(std::size_t index, std::uint32_t matrix) const;
+
+    /**
+     * @brief Finds the first record whose timestamp is not older than the given one, in logarithmic time.
+     * @return the index of the record, or the number of records if all of them are older
+     */
+    IO_BASE_API std::size_t find(core::HiResClock::HiResClockType timestamp) const;
+
+private:
+
+    /// Returns the address of a record in the mapped file
+    const char* getRecord(std::size_t index) const;
+
+    std::unique_ptr<core::memory::MappedFile> m_mapping;
+
+    std::uint32_t m_numberOfMatrices {0};
+
+    std::size_t m_numberOfRecords {0};
+
+    /// Size of a record in bytes
+    std::size_t m_recordSize {0};
+};
+
+} // namespace reader
+
+} // namespace sight::io::base
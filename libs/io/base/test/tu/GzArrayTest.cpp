@@ -0,0 +1,184 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "GzArrayTest.hpp"
+
+#include <core/tools/System.hpp>
+#include <core/tools/Type.hpp>
+
+#include <data/Array.hpp>
+
+#include <io/base/reader/GzArrayReader.hpp>
+#include <io/base/writer/GzArrayWriter.hpp>
+
+#include <zlib.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(::sight::io::base::ut::GzArrayTest);
+
+namespace sight::io::base
+{
+
+namespace ut
+{
+
+//------------------------------------------------------------------------------
+
+static data::Array::sptr generateArray()
+{
+    // Several blocks of compressed data, the last one being incomplete
+    data::Array::sptr array = data::Array::New();
+    array->resize({3 * 1024 * 1024 + 17}, core::tools::Type::s_UINT32, true);
+
+    const auto lock = array->lock();
+    auto* buffer    = static_cast<std::uint32_t*>(array->getBuffer());
+    for(std::size_t i = 0 ; i < array->getSize()[0] ; ++i)
+    {
+        buffer[i] = static_cast<std::uint32_t>((i / 100) % 1000 + i % 7);
+    }
+
+    return array;
+}
+
+//------------------------------------------------------------------------------
+
+static data::Array::sptr readArray(const std::filesystem::path& file, std::size_t size, std::size_t threadCount)
+{
+    data::Array::sptr array = data::Array::New();
+    array->resize({size}, core::tools::Type::s_UINT32, false);
+
+    auto reader = io::base::reader::GzArrayReader::New();
+    reader->setObject(array);
+    reader->setFile(file);
+    reader->setThreadCount(threadCount);
+    CPPUNIT_ASSERT_NO_THROW(reader->read());
+
+    return array;
+}
+
+//------------------------------------------------------------------------------
+
+static void compareArrays(const data::Array::csptr& expected, const data::Array::csptr& actual)
+{
+    CPPUNIT_ASSERT_EQUAL(expected->getSizeInBytes(), actual->getSizeInBytes());
+
+    const auto expectedLock = expected->lock();
+    const auto actualLock   = actual->lock();
+    CPPUNIT_ASSERT_EQUAL(
+        0,
+        std::memcmp(expected->getBuffer(), actual->getBuffer(), expected->getSizeInBytes())
+    );
+}
+
+//------------------------------------------------------------------------------
+
+void GzArrayTest::setUp()
+{
+    // Set up context before running a test.
+}
+
+//------------------------------------------------------------------------------
+
+void GzArrayTest::tearDown()
+{
+    // Clean up after the test run.
+}
+
+//------------------------------------------------------------------------------
+
+void GzArrayTest::writeReadTest()
+{
+    const std::filesystem::path file = core::tools::System::getTemporaryFolder("GzArrayTest") / "array.raw.gz";
+
+    const data::Array::sptr array = generateArray();
+
+    auto writer = io::base::writer::GzArrayWriter::New();
+    writer->setObject(array);
+    writer->setFile(file);
+    writer->setThreadCount(4);
+    CPPUNIT_ASSERT_NO_THROW(writer->write());
+
+    // The blocks are decompressed on one thread or on all the available threads
+    compareArrays(array, readArray(file, array->getSize()[0], 1));
+    compareArrays(array, readArray(file, array->getSize()[0], 0));
+
+    // The data must fit the array
+    data::Array::sptr smallArray = data::Array::New();
+    smallArray->resize({array->getSize()[0] - 1}, core::tools::Type::s_UINT32, false);
+
+    auto reader = io::base::reader::GzArrayReader::New();
+    reader->setObject(smallArray);
+    reader->setFile(file);
+    CPPUNIT_ASSERT_THROW(reader->read(), std::ios_base::failure);
+}
+
+//------------------------------------------------------------------------------
+
+void GzArrayTest::compatibilityTest()
+{
+    const std::filesystem::path folder = core::tools::System::getTemporaryFolder("GzArrayTest");
+
+    const data::Array::sptr array = generateArray();
+    const auto lock               = array->lock();
+    const auto size               = static_cast<unsigned int>(array->getSizeInBytes());
+
+    // The written file is a plain gzip file
+    {
+        const std::filesystem::path file = folder / "written.raw.gz";
+
+        auto writer = io::base::writer::GzArrayWriter::New();
+        writer->setObject(array);
+        writer->setFile(file);
+        CPPUNIT_ASSERT_NO_THROW(writer->write());
+
+        std::vector<char> buffer(size + 1);
+        gzFile rawFile = gzopen(file.string().c_str(), "rb");
+        CPPUNIT_ASSERT(rawFile != nullptr);
+        const int readBytes = gzread(rawFile, buffer.data(), size + 1);
+        gzclose(rawFile);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<int>(size), readBytes);
+        CPPUNIT_ASSERT_EQUAL(0, std::memcmp(array->getBuffer(), buffer.data(), size));
+    }
+
+    // A file written by zlib in a single stream is still read
+    {
+        const std::filesystem::path file = folder / "zlib.raw.gz";
+
+        gzFile rawFile = gzopen(file.string().c_str(), "wb1");
+        CPPUNIT_ASSERT(rawFile != nullptr);
+        CPPUNIT_ASSERT_EQUAL(static_cast<int>(size), gzwrite(rawFile, array->getBuffer(), size));
+        gzclose(rawFile);
+
+        compareArrays(array, readArray(file, array->getSize()[0], 0));
+    }
+}
+
+//------------------------------------------------------------------------------
+
+} //namespace ut
+
+} //namespace sight::io::base
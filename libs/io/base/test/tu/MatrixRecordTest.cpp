@@ -0,0 +1,213 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "MatrixRecordTest.hpp"
+
+#include <core/Exception.hpp>
+#include <core/tools/System.hpp>
+
+#include <io/base/reader/MatrixRecordReader.hpp>
+#include <io/base/writer/MatrixRecordWriter.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(::sight::io::base::ut::MatrixRecordTest);
+
+namespace sight::io::base
+{
+
+namespace ut
+{
+
+//------------------------------------------------------------------------------
+
+static core::HiResClock::HiResClockType getTimestamp(std::size_t index)
+{
+    return 1000. + static_cast<double>(index) * 16.5;
+}
+
+//------------------------------------------------------------------------------
+
+static std::vector<float> getMatrices(std::size_t index, std::uint32_t numberOfMatrices)
+{
+    std::vector<float> matrices(numberOfMatrices * 16);
+    for(std::size_t i = 0 ; i < matrices.size() ; ++i)
+    {
+        matrices[i] = static_cast<float>(index * 1000 + i) * 0.5f;
+    }
+
+    return matrices;
+}
+
+//------------------------------------------------------------------------------
+
+static void writeRecords(
+    io::base::writer::MatrixRecordWriter& writer,
+    std::size_t first,
+    std::size_t last
+)
+{
+    for(std::size_t index = first ; index < last ; ++index)
+    {
+        const std::vector<float> matrices = getMatrices(index, writer.getNumberOfMatrices());
+        writer.write(getTimestamp(index), index % 8, matrices.data());
+    }
+}
+
+//------------------------------------------------------------------------------
+
+static void checkRecord(const io::base::reader::MatrixRecordReader& reader, std::size_t index)
+{
+    CPPUNIT_ASSERT_EQUAL(getTimestamp(index), reader.getTimestamp(index));
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(index % 8), reader.getMask(index));
+
+    const std::vector<float> matrices = getMatrices(index, reader.getNumberOfMatrices());
+    for(std::uint32_t m = 0 ; m < reader.getNumberOfMatrices() ; ++m)
+    {
+        const float* matrix = reader.getMatrix(index, m);
+        for(std::size_t v = 0 ; v < 16 ; ++v)
+        {
+            CPPUNIT_ASSERT_EQUAL(matrices[m * 16 + v], matrix[v]);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void MatrixRecordTest::setUp()
+{
+    // Set up context before running a test.
+}
+
+//------------------------------------------------------------------------------
+
+void MatrixRecordTest::tearDown()
+{
+    // Clean up after the test run.
+}
+
+//------------------------------------------------------------------------------
+
+void MatrixRecordTest::writeReadTest()
+{
+    const std::filesystem::path file = core::tools::System::getTemporaryFolder("MatrixRecordTest") / "matrices.smtl";
+
+    // Enough records to be written in several blocks
+    const std::size_t numberOfRecords = 5000;
+    {
+        io::base::writer::MatrixRecordWriter writer(file, 3);
+        writeRecords(writer, 0, numberOfRecords);
+
+        // Older records are ignored
+        const std::vector<float> matrices = getMatrices(0, 3);
+        writer.write(getTimestamp(0), 0, matrices.data());
+    }
+
+    CPPUNIT_ASSERT(io::base::reader::MatrixRecordReader::isMatrixRecord(file));
+
+    io::base::reader::MatrixRecordReader reader(file);
+    CPPUNIT_ASSERT_EQUAL(std::uint32_t(3), reader.getNumberOfMatrices());
+    CPPUNIT_ASSERT_EQUAL(numberOfRecords, reader.getNumberOfRecords());
+
+    for(std::size_t index = 0 ; index < numberOfRecords ; index += 7)
+    {
+        checkRecord(reader, index);
+    }
+
+    checkRecord(reader, numberOfRecords - 1);
+
+    // Seeking
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), reader.find(0.));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), reader.find(getTimestamp(0)));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1234), reader.find(getTimestamp(1234)));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1235), reader.find(getTimestamp(1234) + 1.));
+    CPPUNIT_ASSERT_EQUAL(numberOfRecords - 1, reader.find(getTimestamp(numberOfRecords - 1)));
+    CPPUNIT_ASSERT_EQUAL(numberOfRecords, reader.find(getTimestamp(numberOfRecords)));
+
+    // Other files are rejected
+    const std::filesystem::path csvFile = file.parent_path() / "matrices.csv";
+    {
+        std::ofstream csv(csvFile);
+        csv << "1000;1;0;0;0;0;1;0;0;0;0;1;0;0;0;0;1;" << std::endl;
+    }
+
+    CPPUNIT_ASSERT(!io::base::reader::MatrixRecordReader::isMatrixRecord(csvFile));
+    CPPUNIT_ASSERT_THROW(io::base::reader::MatrixRecordReader csvReader(csvFile), core::Exception);
+}
+
+//------------------------------------------------------------------------------
+
+void MatrixRecordTest::appendTest()
+{
+    const std::filesystem::path file = core::tools::System::getTemporaryFolder("MatrixRecordTest") / "append.smtl";
+
+    {
+        io::base::writer::MatrixRecordWriter writer(file, 2);
+        writeRecords(writer, 0, 10);
+    }
+
+    // Simulates an interrupted recording, the incomplete record is discarded
+    std::filesystem::resize_file(file, std::filesystem::file_size(file) - 7);
+    {
+        io::base::reader::MatrixRecordReader reader(file);
+        CPPUNIT_ASSERT_EQUAL(std::size_t(9), reader.getNumberOfRecords());
+    }
+
+    {
+        io::base::writer::MatrixRecordWriter writer(file, 2, true);
+        writeRecords(writer, 9, 20);
+    }
+
+    {
+        io::base::reader::MatrixRecordReader reader(file);
+        CPPUNIT_ASSERT_EQUAL(std::uint32_t(2), reader.getNumberOfMatrices());
+        CPPUNIT_ASSERT_EQUAL(std::size_t(20), reader.getNumberOfRecords());
+
+        for(std::size_t index = 0 ; index < 20 ; ++index)
+        {
+            checkRecord(reader, index);
+        }
+    }
+
+    // The records of a file must have the same number of matrices
+    CPPUNIT_ASSERT_THROW(io::base::writer::MatrixRecordWriter writer(file, 3, true), core::Exception);
+
+    // Without append, the file is replaced
+    {
+        io::base::writer::MatrixRecordWriter writer(file, 3);
+        writeRecords(writer, 0, 2);
+    }
+
+    io::base::reader::MatrixRecordReader reader(file);
+    CPPUNIT_ASSERT_EQUAL(std::uint32_t(3), reader.getNumberOfMatrices());
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), reader.getNumberOfRecords());
+    checkRecord(reader, 1);
+}
+
+//------------------------------------------------------------------------------
+
+} //namespace ut
+
+} //namespace sight::io::base
@@ -22,13 +22,9 @@
 
 #include "io/base/writer/GzArrayWriter.hpp"
 
+#include "io/base/detail/GzBlocks.hpp"
 #include "io/base/writer/registry/macros.hpp"
 
-#include <zlib.h>
-
-#include <filesystem>
-#include <iostream>
-
 SIGHT_REGISTER_IO_WRITER(::sight::io::base::writer::GzArrayWriter);
 
 namespace sight::io::base
@@ -57,30 +53,9 @@ void GzArrayWriter::write()
 
     data::Array::csptr array = this->getConcreteObject();
 
-    /// test if can open archive
-    gzFile rawFile = gzopen(this->getFile().string().c_str(), "wb1");
-    if(rawFile == 0)
-    {
-        std::string str = "GzArrayWriter::write unable to open ";
-        str += getFile().string();
-        gzclose(rawFile);
-        throw std::ios_base::failure(str);
-    }
-
     const auto dumpLock = array->lock();
 
-    // file is OK : process now
-    const size_t arraySizeInBytes = array->getSizeInBytes();
-
-    const int uncompressedbyteswrited =
-        gzwrite(rawFile, array->getBuffer(), static_cast<unsigned int>(arraySizeInBytes));
-    gzclose(rawFile);
-    if(uncompressedbyteswrited != static_cast<int>(arraySizeInBytes))
-    {
-        std::string str = "GzArrayWriter::write unable to write ";
-        str += getFile().string();
-        throw std::ios_base::failure(str);
-    }
+    io::base::detail::gzBlocks::write(this->getFile(), array->getBuffer(), array->getSizeInBytes(), m_threadCount);
 }
 
 //------------------------------------------------------------------------------
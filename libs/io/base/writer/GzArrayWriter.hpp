@@ -29,6 +29,8 @@
 
 #include <data/Array.hpp>
 
+#include <cstddef>
+
 namespace sight::io::base
 {
 
@@ -59,11 +61,22 @@ public:
     /// Destructor. Does nothing.
     IO_BASE_API virtual ~GzArrayWriter();
 
-    /// Writes the file using zlib API.
+    /// Writes the file using zlib, the blocks of data are compressed concurrently.
     IO_BASE_API void write() override;
 
     /// Defines the extensions supported by this writer. Here: ".raw.gz"
     IO_BASE_API std::string extension() override;
+
+    /// Sets the number of threads compressing the blocks of data, 0 uses the number of hardware threads.
+    void setThreadCount(std::size_t threadCount)
+    {
+        m_threadCount = threadCount;
+    }
+
+private:
+
+    /// Number of threads compressing the blocks of data, 0 means the number of hardware threads
+    std::size_t m_threadCount {0};
 };
 
 } // namespace writer
@@ -22,14 +22,11 @@
 
 #include "io/base/writer/GzBufferImageWriter.hpp"
 
+#include "io/base/detail/GzBlocks.hpp"
 #include "io/base/writer/registry/macros.hpp"
 
 #include <data/Image.hpp>
 
-#include <zlib.h>
-
-#include <iostream>
-
 SIGHT_REGISTER_IO_WRITER(::sight::io::base::writer::GzBufferImageWriter);
 
 namespace sight::io::base
@@ -58,44 +55,9 @@ void GzBufferImageWriter::write()
 
     data::Image::csptr image = getConcreteObject();
 
-    /// test if can open archive
-    gzFile rawFile = gzopen(getFile().string().c_str(), "wb1");
-    SIGHT_ASSERT("rawFile not instanced", rawFile);
-    if(rawFile == 0)
-    {
-        std::string str = "GzBufferImageWriter::write unable to open ";
-        str += getFile().string();
-        gzclose(rawFile);
-        throw std::ios_base::failure(str);
-    }
-
     const auto dumpLock = image->lock();
 
-    // file is OK : process now
-    const size_t imageSizeInBytes = image->getSizeInBytes();
-
-    const char* ptr     = static_cast<char*>(image->getBuffer());
-    size_t writtenBytes = 0;
-
-    int uncompressedbyteswrited = 0;
-
-    while(writtenBytes < imageSizeInBytes
-          && (uncompressedbyteswrited =
-                  gzwrite(rawFile, ptr + writtenBytes, static_cast<unsigned int>(imageSizeInBytes - writtenBytes))) > 0)
-    {
-        writtenBytes += static_cast<size_t>(uncompressedbyteswrited);
-    }
-
-    gzclose(rawFile);
-
-    assert(uncompressedbyteswrited != 0 && writtenBytes == imageSizeInBytes);
-
-    if(uncompressedbyteswrited != 0 && writtenBytes == imageSizeInBytes)
-    {
-        std::string str = "GzBufferImageWriter::write unable to write ";
-        str += getFile().string();
-        throw std::ios_base::failure(str);
-    }
+    io::base::detail::gzBlocks::write(getFile(), image->getBuffer(), image->getSizeInBytes(), m_threadCount);
 }
 
 //------------------------------------------------------------------------------
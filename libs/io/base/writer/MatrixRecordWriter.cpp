@@ -0,0 +1,222 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/base/writer/MatrixRecordWriter.hpp"
+
+#include "io/base/detail/MatrixRecord.hpp"
+
+#include <core/Exception.hpp>
+#include <core/exceptionmacros.hpp>
+#include <core/spyLog.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <system_error>
+
+namespace sight::io::base
+{
+
+namespace writer
+{
+
+using namespace detail::matrixRecord;
+
+/// Approximate size of the blocks of records written at once
+static constexpr std::size_t s_BLOCK_SIZE = 64 * 1024;
+
+//------------------------------------------------------------------------------
+
+MatrixRecordWriter::MatrixRecordWriter(
+    const std::filesystem::path& file,
+    std::uint32_t numberOfMatrices,
+    bool append
+) :
+    m_file(file),
+    m_numberOfMatrices(numberOfMatrices),
+    m_recordSize(recordSize(numberOfMatrices)),
+    m_blockRecords(std::max<std::size_t>(1, s_BLOCK_SIZE / m_recordSize)),
+    m_lastTimestamp(0.)
+{
+    SIGHT_THROW_IF(
+        "The number of matrices of a record must be between 1 and " << s_MAX_MATRICES << ".",
+        numberOfMatrices == 0 || numberOfMatrices > s_MAX_MATRICES
+    );
+
+    std::error_code error;
+    std::uintmax_t fileSize = 0;
+    if(append)
+    {
+        fileSize = std::filesystem::file_size(file, error);
+        fileSize = error ? 0 : fileSize;
+    }
+
+    if(fileSize > 0)
+    {
+        // The existing records are kept, except an incomplete last one
+        std::ifstream input(file, std::ios::binary);
+        char header[s_HEADER_SIZE];
+        input.read(header, static_cast<std::streamsize>(s_HEADER_SIZE));
+
+        std::uint32_t version = 0;
+        std::uint32_t count   = 0;
+        std::memcpy(&version, header + 4, sizeof(version));
+        std::memcpy(&count, header + 8, sizeof(count));
+
+        SIGHT_THROW_IF(
+            "The file '" << file.string() << "' is not a matrix timeline file.",
+            input.gcount() != static_cast<std::streamsize>(s_HEADER_SIZE)
+            || std::memcmp(header, s_SIGNATURE, sizeof(s_SIGNATURE)) != 0 || version != s_VERSION
+        );
+        SIGHT_THROW_IF(
+            "The file '" << file.string() << "' records " << count << " matrices instead of "
+            << numberOfMatrices << ".",
+            count != numberOfMatrices
+        );
+
+        const std::uintmax_t records = (fileSize - s_HEADER_SIZE) / m_recordSize;
+        if(records > 0)
+        {
+            input.seekg(static_cast<std::streamoff>(s_HEADER_SIZE + (records - 1) * m_recordSize));
+            input.read(reinterpret_cast<char*>(&m_lastTimestamp), sizeof(m_lastTimestamp));
+            m_hasRecords = true;
+        }
+
+        input.close();
+
+        std::filesystem::resize_file(file, s_HEADER_SIZE + records * m_recordSize, error);
+        SIGHT_THROW_IF("The file '" << file.string() << "' can not be written: " << error.message(), error);
+
+        m_stream.open(file, std::ios::binary | std::ios::app);
+    }
+    else
+    {
+        char header[s_HEADER_SIZE] = {0};
+        std::memcpy(header, s_SIGNATURE, sizeof(s_SIGNATURE));
+        std::memcpy(header + 4, &s_VERSION, sizeof(s_VERSION));
+        std::memcpy(header + 8, &numberOfMatrices, sizeof(numberOfMatrices));
+
+        m_stream.open(file, std::ios::binary | std::ios::trunc);
+        m_stream.write(header, static_cast<std::streamsize>(s_HEADER_SIZE));
+    }
+
+    SIGHT_THROW_IF("The file '" << file.string() << "' can not be written.", !m_stream);
+
+    m_block.reserve(m_blockRecords * m_recordSize);
+}
+
+//------------------------------------------------------------------------------
+
+MatrixRecordWriter::~MatrixRecordWriter()
+{
+    try
+    {
+        this->flush();
+    }
+    catch(const std::exception& e)
+    {
+        SIGHT_ERROR(e.what());
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void MatrixRecordWriter::write(
+    core::HiResClock::HiResClockType timestamp,
+    std::uint64_t mask,
+    const float* matrices
+)
+{
+    if(m_hasRecords && timestamp < m_lastTimestamp)
+    {
+        SIGHT_WARN(
+            "The matrices at " << timestamp << " are older than the last record (" << m_lastTimestamp
+            << "), they are not recorded."
+        );
+        return;
+    }
+
+    const std::size_t offset = m_block.size();
+    m_block.resize(offset + m_recordSize);
+
+    char* record = m_block.data() + offset;
+    std::memcpy(record, &timestamp, sizeof(timestamp));
+    std::memcpy(record + sizeof(timestamp), &mask, sizeof(mask));
+    std::memcpy(record + sizeof(timestamp) + sizeof(mask), matrices, m_numberOfMatrices * 16 * sizeof(float));
+
+    m_lastTimestamp = timestamp;
+    m_hasRecords    = true;
+
+    if(m_block.size() >= m_blockRecords * m_recordSize)
+    {
+        this->writeBlock();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void MatrixRecordWriter::flush()
+{
+    this->writeBlock();
+    this->waitBlock();
+
+    m_stream.flush();
+    SIGHT_THROW_IF("The records can not be written in '" << m_file.string() << "'.", !m_stream);
+}
+
+//------------------------------------------------------------------------------
+
+void MatrixRecordWriter::writeBlock()
+{
+    if(m_block.empty())
+    {
+        return;
+    }
+
+    // Only one block is written at a time, the records are kept in order
+    this->waitBlock();
+
+    m_pending = std::async(
+        std::launch::async,
+        [this, block = std::move(m_block)]
+        {
+            m_stream.write(block.data(), static_cast<std::streamsize>(block.size()));
+            SIGHT_THROW_IF("The records can not be written in '" << m_file.string() << "'.", !m_stream);
+        });
+
+    m_block = std::vector<char>();
+    m_block.reserve(m_blockRecords * m_recordSize);
+}
+
+//------------------------------------------------------------------------------
+
+void MatrixRecordWriter::waitBlock()
+{
+    if(m_pending.valid())
+    {
+        m_pending.get();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace writer
+
+} // namespace sight::io::base
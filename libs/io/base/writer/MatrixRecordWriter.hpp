@@ -0,0 +1,130 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "io/base/config.hpp"
+
+#include <core/HiResClock.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <vector>
+
+namespace sight::io::base
+{
+
+namespace writer
+{
+
+/**
+ * @brief Records timestamped matrices in a binary matrix timeline file ('.smtl').
+ *
+ * Each record holds a timestamp, a presence mask and a fixed number of 4x4 matrices. The records are buffered and the
+ * full blocks are written on a separate thread, so a recording at a high rate does not wait for the disk. The records
+ * must be written by increasing timestamps, they can then be found by reader::MatrixRecordReader without any parsing.
+ * The file is complete once the writer is flushed or destroyed.
+ */
+class IO_BASE_CLASS_API MatrixRecordWriter
+{
+public:
+
+    /**
+     * @brief Opens the file to record the matrices.
+     *
+     * @param file path of the recorded file
+     * @param numberOfMatrices number of matrices of each record, between 1 and 64
+     * @param append if true and the file exists, the records are appended to the existing ones. An incomplete last
+     * record, i.e. left by an interrupted recording, is discarded.
+     * @throw core::Exception if the file can not be written, or if the existing file is not a matrix timeline file with
+     * the same number of matrices
+     */
+    IO_BASE_API MatrixRecordWriter(
+        const std::filesystem::path& file,
+        std::uint32_t numberOfMatrices,
+        bool append = false
+    );
+
+    /// Writes the remaining records and closes the file.
+    IO_BASE_API ~MatrixRecordWriter();
+
+    /**
+     * @brief Records timestamped matrices.
+     *
+     * A record older than the last one is ignored, since the records are sorted by timestamp.
+     *
+     * @param timestamp timestamp of the matrices
+     * @param mask presence mask, the bit i is set if the matrix i is valid
+     * @param matrices the 16 values of each matrix, one after another
+     * @throw core::Exception if a previous block of records could not be written
+     */
+    IO_BASE_API void write(core::HiResClock::HiResClockType timestamp, std::uint64_t mask, const float* matrices);
+
+    /**
+     * @brief Writes all the buffered records in the file.
+     * @throw core::Exception if the records can not be written
+     */
+    IO_BASE_API void flush();
+
+    /// Returns the number of matrices of each record.
+    std::uint32_t getNumberOfMatrices() const
+    {
+        return m_numberOfMatrices;
+    }
+
+private:
+
+    /// Hands the buffered records to the writing thread, after the previous block is written
+    void writeBlock();
+
+    /// Waits for the block being written, rethrows its error if any
+    void waitBlock();
+
+    std::filesystem::path m_file;
+
+    std::ofstream m_stream;
+
+    std::uint32_t m_numberOfMatrices;
+
+    /// Size of a record in bytes
+    std::size_t m_recordSize;
+
+    /// Number of records buffered before being written
+    std::size_t m_blockRecords;
+
+    /// Records waiting to be written
+    std::vector<char> m_block;
+
+    /// Block being written by the writing thread
+    std::future<void> m_pending;
+
+    /// Timestamp of the last record
+    core::HiResClock::HiResClockType m_lastTimestamp;
+
+    /// True if at least one record exists
+    bool m_hasRecords {false};
+};
+
+} // namespace writer
+
+} // namespace sight::io::base
@@ -37,6 +37,7 @@
 #include <boost/date_time/gregorian/gregorian.hpp>
 #include <boost/exception/all.hpp>
 #include <boost/range/algorithm/for_each.hpp>
+#include <boost/scope_exit.hpp>
 
 #include <gdcmGlobal.h>
 #include <gdcmReader.h>
@@ -63,7 +64,8 @@ DicomAnonymizer::DicomAnonymizer() :
     m_observer(core::jobs::Observer::New("Anonymization process")),
     m_archiving(false),
     m_fileIndex(0),
-    m_referenceDate(::boost::gregorian::from_undelimited_string(c_MIN_DATE_STRING))
+    m_referenceDate(::boost::gregorian::from_undelimited_string(c_MIN_DATE_STRING)),
+    m_emptyFile(new ::gdcm::File)
 {
     const std::filesystem::path tagsPathStr = core::runtime::getLibraryResourceFilePath(
         "io_dicom/tags.csv"
@@ -321,14 +323,38 @@ void DicomAnonymizer::anonymize(std::istream& inputStream, std::ostream& outputS
     reader.SetStream(inputStream);
     SIGHT_THROW_IF("Unable to anonymize (file read failed)", !reader.Read());
 
+    {
+        // Only the processing of the tags is serialized. The file is released before unlocking, even on error, since
+        // the other threads would otherwise update its reference count when setting their own file.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        BOOST_SCOPE_EXIT_ALL(this)
+        {
+            m_stringFilter.SetFile(*m_emptyFile);
+            m_anonymizer.SetFile(*m_emptyFile);
+        };
+
+        this->processTags(reader.GetFile());
+    }
+
+    // Write file
+    ::gdcm::Writer writer;
+    writer.SetStream(outputStream);
+    writer.SetFile(reader.GetFile());
+
+    SIGHT_THROW_IF("Unable to anonymize (file write failed)", !writer.Write());
+}
+
+//------------------------------------------------------------------------------
+
+void DicomAnonymizer::processTags(const ::gdcm::File& datasetFile)
+{
     // String filter
-    m_stringFilter.SetFile(reader.GetFile());
+    m_stringFilter.SetFile(datasetFile);
 
     // Objects used to scan groups of elements
     ::gdcm::Tag tag;
     ::gdcm::DataElement dataElement;
-    const ::gdcm::File& datasetFile = reader.GetFile();
-    ::gdcm::DataSet dataset         = datasetFile.GetDataSet();
+    ::gdcm::DataSet dataset = datasetFile.GetDataSet();
 
     std::vector< ::gdcm::DataElement> preservedTags;
     for(const ::gdcm::Tag& t : m_privateTags)
@@ -422,13 +448,6 @@ void DicomAnonymizer::anonymize(std::istream& inputStream, std::ostream& outputS
     {
         dataset.Insert(de);
     }
-
-    // Write file
-    ::gdcm::Writer writer;
-    writer.SetStream(outputStream);
-    writer.SetFile(datasetFile);
-
-    SIGHT_THROW_IF("Unable to anonymize (file write failed)", !writer.Write());
 }
 
 //------------------------------------------------------------------------------
@@ -36,6 +36,7 @@
 #include <filesystem>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -85,6 +86,12 @@ public:
     /// Anonymize a folder containing Dicom files
     IO_DICOM_API void anonymize(const std::filesystem::path& dirPath);
 
+    /**
+     * @brief Anonymize a Dicom file from a stream to another one.
+     *
+     * It can be called concurrently: the files are read and written in parallel, only the processing of the tags is
+     * serialized, so that the UIDs stay consistent across the files.
+     */
     IO_DICOM_API void anonymize(std::istream& inputStream, std::ostream& outputStream);
 
     /// Add an exceptional value for a tag
@@ -196,6 +203,9 @@ private:
     /// Generate a value consistent with the VR
     void generateDummyValue(const ::gdcm::Tag& tag);
 
+    /// Apply the anonymization actions on the tags of the file, m_mutex must be locked
+    void processTags(const ::gdcm::File& datasetFile);
+
     /// Anonymizer
     ::gdcm::Anonymizer m_anonymizer;
 
@@ -244,6 +254,13 @@ private:
 
     /// List of private tags to be preserved from anonymisation
     io::dicom::helper::PrivateTagVecType m_privateTags;
+
+    /// Empty file set in the anonymizer and the string filter when they are not used, so they do not hold a file
+    /// being read or written by another thread
+    ::gdcm::SmartPointer< ::gdcm::File> m_emptyFile;
+
+    /// Mutex protecting the processing of the tags
+    std::mutex m_mutex;
 };
 
 } // namespace helper
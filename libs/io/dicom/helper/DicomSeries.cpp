@@ -42,7 +42,12 @@
 #include <gdcmReader.h>
 
 #include <algorithm>
+#include <atomic>
 #include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace sight::io::dicom
 {
@@ -79,6 +84,25 @@ static const ::gdcm::Tag s_ReferringPhysicianNameTag(0x0008, 0x0090);
 static const ::gdcm::Tag s_StudyDescriptionTag(0x0008, 0x1030);
 static const ::gdcm::Tag s_PatientAgeTag(0x0010, 0x1010);
 
+// Number of files scanned at once by a thread
+static const std::size_t s_SCAN_CHUNK_SIZE = 64;
+
+//------------------------------------------------------------------------------
+
+static void addSeriesTags(::gdcm::Scanner& scanner)
+{
+    scanner.AddTag(s_SpecificCharacterSetTag);
+    scanner.AddTag(s_SeriesInstanceUIDTag);
+    scanner.AddTag(s_ModalityTag);
+    scanner.AddTag(s_SeriesDateTag);
+    scanner.AddTag(s_SeriesTimeTag);
+    scanner.AddTag(s_SeriesDescriptionTag);
+    scanner.AddTag(s_PerformingPhysicianNameTag);
+    scanner.AddTag(s_SOPClassUIDTag);
+    scanner.AddTag(s_SOPInstanceUIDTag);
+    scanner.AddTag(s_MediaStorageSOPClassUID);
+}
+
 //------------------------------------------------------------------------------
 
 std::string getStringValue(
@@ -234,54 +258,132 @@ DicomSeries::DicomSeriesContainerType DicomSeries::splitFiles(
     const core::jobs::Observer::sptr& readerObserver
 )
 {
-    ::gdcm::Scanner seriesScanner;
-    seriesScanner.AddTag(s_SpecificCharacterSetTag);
-    seriesScanner.AddTag(s_SeriesInstanceUIDTag);
-    seriesScanner.AddTag(s_ModalityTag);
-    seriesScanner.AddTag(s_SeriesDateTag);
-    seriesScanner.AddTag(s_SeriesTimeTag);
-    seriesScanner.AddTag(s_SeriesDescriptionTag);
-    seriesScanner.AddTag(s_PerformingPhysicianNameTag);
-    seriesScanner.AddTag(s_SOPClassUIDTag);
-    seriesScanner.AddTag(s_SOPInstanceUIDTag);
-    seriesScanner.AddTag(s_MediaStorageSOPClassUID);
-    readerObserver->setTotalWorkUnits(filenames.size());
-    readerObserver->doneWork(0);
-
-    std::vector<std::string> fileVec;
-    for(auto file : filenames)
+    const std::uint64_t fileCount = filenames.size();
+    if(readerObserver)
     {
-        fileVec.push_back(file.string());
+        readerObserver->setTotalWorkUnits(2 * fileCount);
+        readerObserver->doneWork(0);
     }
 
-    bool status = seriesScanner.Scan(fileVec);
-    SIGHT_THROW_IF("Unable to read the files.", !status);
+    // Scan the files by chunks, each chunk has its own scanner so that the chunks can be scanned concurrently.
+    // A scanner only parses a file up to the greatest requested tag, the pixel data are thus never read.
+    const std::size_t chunkCount = (filenames.size() + s_SCAN_CHUNK_SIZE - 1) / s_SCAN_CHUNK_SIZE;
+    std::vector<std::unique_ptr< ::gdcm::Scanner> > scanners(chunkCount);
+
+    std::size_t threadCount = m_threadCount > 0 ? m_threadCount : std::thread::hardware_concurrency();
+    threadCount = std::max<std::size_t>(1, std::min(threadCount, chunkCount));
 
-    ::gdcm::Directory::FilenamesType keys = seriesScanner.GetKeys();
+    std::atomic<std::size_t> nextChunk {0};
+    std::atomic<bool> canceled {false};
 
-    unsigned int progress = 0;
+    // Progress is reported under a mutex so that the done work units never decrease
+    std::mutex progressMutex;
+    std::uint64_t scannedFiles = 0;
+
+    const auto scanChunks =
+        [&]()
+        {
+            for(std::size_t chunk = nextChunk++ ; chunk < chunkCount && !canceled ; chunk = nextChunk++)
+            {
+                const std::size_t begin = chunk * s_SCAN_CHUNK_SIZE;
+                const std::size_t end   = std::min(begin + s_SCAN_CHUNK_SIZE, filenames.size());
+
+                std::vector<std::string> fileVec;
+                fileVec.reserve(end - begin);
+                for(std::size_t i = begin ; i < end ; ++i)
+                {
+                    fileVec.push_back(filenames[i].string());
+                }
+
+                auto scanner = std::make_unique< ::gdcm::Scanner>();
+                addSeriesTags(*scanner);
+
+                const bool status = scanner->Scan(fileVec);
+                SIGHT_THROW_IF("Unable to read the files.", !status);
+
+                scanners[chunk] = std::move(scanner);
+
+                if(readerObserver)
+                {
+                    std::lock_guard<std::mutex> lock(progressMutex);
+                    scannedFiles += end - begin;
+                    readerObserver->doneWork(scannedFiles);
+                    canceled = canceled || readerObserver->cancelRequested();
+                }
+            }
+        };
+
+    std::vector<std::future<void> > futures;
+    for(std::size_t i = 1 ; i < threadCount ; ++i)
+    {
+        futures.push_back(std::async(std::launch::async, scanChunks));
+    }
+
+    // The current thread also scans, then waits for the other ones; the first error is rethrown once all are done
+    std::exception_ptr error;
+    try
+    {
+        scanChunks();
+    }
+    catch(...)
+    {
+        canceled = true;
+        error    = std::current_exception();
+    }
+
+    for(auto& future : futures)
+    {
+        try
+        {
+            future.get();
+        }
+        catch(...)
+        {
+            canceled = true;
+            if(!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    if(error)
+    {
+        std::rethrow_exception(error);
+    }
 
     DicomSeriesContainerType seriesDB;
 
-    //Loop through every files available in the scanner
-    std::map<std::string, std::filesystem::path> orderedFilenames;
-    for(const std::filesystem::path& dicomFile : filenames)
+    if(canceled)
     {
-        orderedFilenames[dicomFile.filename().string()] = dicomFile;
+        return seriesDB;
+    }
+
+    // Loop through every files in the order of their names, so the series do not depend on the scanning order
+    std::map<std::string, std::size_t> orderedFilenames;
+    for(std::size_t i = 0 ; i < filenames.size() ; ++i)
+    {
+        orderedFilenames[filenames[i].filename().string()] = i;
     }
 
     std::set<std::string> previousSOPInstanceUIDs;
 
+    std::uint64_t progress = 0;
+
     for(const auto& dicomFile : orderedFilenames)
     {
-        auto filename = dicomFile.second.string();
+        const std::filesystem::path& path    = filenames[dicomFile.second];
+        const ::gdcm::Scanner& seriesScanner = *scanners[dicomFile.second / s_SCAN_CHUNK_SIZE];
+        const auto filename                  = path.string();
 
         SIGHT_ASSERT(
-            "The file \"" << dicomFile.second << "\" is not a key of the gdcm scanner",
+            "The file \"" << path << "\" is not a key of the gdcm scanner",
             seriesScanner.IsKey(filename.c_str())
         );
 
-        const std::string& sopInstanceUID = getStringValue(seriesScanner, filename, s_SOPInstanceUIDTag);
+        const std::string& sopInstanceUID          = getStringValue(seriesScanner, filename, s_SOPInstanceUIDTag);
+        const std::string& sopClassUID             = getStringValue(seriesScanner, filename, s_SOPClassUIDTag);
+        const std::string& mediaStorageSopClassUID = getStringValue(seriesScanner, filename, s_MediaStorageSOPClassUID);
 
         if(previousSOPInstanceUIDs.find(sopInstanceUID) != previousSOPInstanceUIDs.end())
         {
@@ -290,27 +392,24 @@ DicomSeries::DicomSeriesContainerType DicomSeries::splitFiles(
                 << sopInstanceUID
                 << " has already been read, which usually means DICOM files are corrupted."
             );
-
-            continue;
         }
-
-        const std::string& sopClassUID             = getStringValue(seriesScanner, filename, s_SOPClassUIDTag);
-        const std::string& mediaStorageSopClassUID = getStringValue(seriesScanner, filename, s_MediaStorageSOPClassUID);
-
-        if(sopClassUID != ::gdcm::MediaStorage::GetMSString(::gdcm::MediaStorage::MediaStorageDirectoryStorage)
-           && mediaStorageSopClassUID
-           != ::gdcm::MediaStorage::GetMSString(::gdcm::MediaStorage::MediaStorageDirectoryStorage))
+        else if(sopClassUID != ::gdcm::MediaStorage::GetMSString(::gdcm::MediaStorage::MediaStorageDirectoryStorage)
+                && mediaStorageSopClassUID
+                != ::gdcm::MediaStorage::GetMSString(::gdcm::MediaStorage::MediaStorageDirectoryStorage))
         {
-            this->createSeries(seriesDB, seriesScanner, dicomFile.second);
+            this->createSeries(seriesDB, seriesScanner, path);
             previousSOPInstanceUIDs.insert(sopInstanceUID);
         }
 
-        if(!readerObserver || readerObserver->cancelRequested())
+        if(readerObserver)
         {
-            break;
-        }
+            if(readerObserver->cancelRequested())
+            {
+                break;
+            }
 
-        readerObserver->doneWork(static_cast<std::uint64_t>(++progress * 100 / keys.size()));
+            readerObserver->doneWork(fileCount + ++progress);
+        }
     }
 
     return seriesDB;
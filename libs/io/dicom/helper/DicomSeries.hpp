@@ -29,6 +29,7 @@
 #include <gdcmDataSet.h>
 #include <gdcmScanner.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <vector>
@@ -83,6 +84,11 @@ public:
 
     /**
      * @brief Read DicomSeries from paths.
+     *
+     * The files are scanned concurrently, by chunks, on several threads (see setThreadCount()). Each file is only
+     * parsed up to the series tags, the pixel data is never read. The series are then built in the order of the
+     * filenames, so the result does not depend on the number of threads.
+     *
      * @param[in] filenames instance paths
      * @param[in] readerObserver reader observer
      * @param[in] completeSeriesObserver complete series observer
@@ -103,6 +109,21 @@ public:
         const SPTR(core::jobs::Observer)& completeSeriesObserver
     );
 
+    /**
+     * @brief Set the number of threads used to scan the files in read().
+     * @param[in] threadCount number of threads, 0 uses the number of hardware threads
+     */
+    void setThreadCount(std::size_t threadCount)
+    {
+        m_threadCount = threadCount;
+    }
+
+    /// Return the number of threads used to scan the files in read(), 0 means the number of hardware threads
+    std::size_t getThreadCount() const
+    {
+        return m_threadCount;
+    }
+
 protected:
 
     /**
@@ -115,6 +136,8 @@ protected:
     /**
      * @brief Create DicomSeries from list of files. Every instance is read in
      * order to retrieve instance information regarding the matching series.
+     * The readerObserver receives two work units per file: one when it is scanned and one when it is added to its
+     * series.
      * @param[in] filenames List of files
      * @param[in] readerObserver reader observer
      */
@@ -165,6 +188,9 @@ protected:
 
     ///Equipment Map
     EquipmentMapType m_equipmentMap;
+
+    /// Number of threads used to scan the files, 0 means the number of hardware threads
+    std::size_t m_threadCount {0};
 };
 
 } //helper
@@ -94,6 +94,13 @@ void DicomSeriesDBWriter::enableZippedArchive(bool enable)
 
 //------------------------------------------------------------------------------
 
+void DicomSeriesDBWriter::setThreadCount(std::size_t threadCount)
+{
+    m_threadCount = threadCount;
+}
+
+//------------------------------------------------------------------------------
+
 std::string getSubPath(int index)
 {
     std::stringstream ss;
@@ -140,6 +147,7 @@ void DicomSeriesDBWriter::write()
                         io::dicom::helper::DicomSeriesWriter::sptr writer = io::dicom::helper::DicomSeriesWriter::New();
                         writer->setObject(dicomSeries);
                         writer->setAnonymizer(m_anonymizer);
+                        writer->setThreadCount(m_threadCount);
                         writer->setOutputArchive(writeArchive, nbSeries > 1 ? getSubPath(processedSeries++) : "");
 
                         runningJob.addCancelHook(
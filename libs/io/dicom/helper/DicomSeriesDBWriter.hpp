@@ -29,6 +29,7 @@
 
 #include <io/base/writer/GenericObjectWriter.hpp>
 
+#include <cstddef>
 #include <string>
 
 namespace sight::data
@@ -92,6 +93,14 @@ public:
     /// Set Producer
     IO_DICOM_API void setProducer(std::string producer);
 
+    /**
+     * @brief Set the number of threads used to write the instances of each series, 0 uses all the available cores
+     *
+     * The series are still written one after the other since they may share the same archive.
+     * @see DicomSeriesWriter::setThreadCount()
+     */
+    IO_DICOM_API void setThreadCount(std::size_t threadCount);
+
 private:
 
     /// Job observer
@@ -105,6 +114,9 @@ private:
 
     /// Producer
     std::string m_producer;
+
+    /// Number of threads used to write each series, 0 to use all the cores
+    std::size_t m_threadCount {0};
 };
 
 } // namespace helper
@@ -35,6 +35,13 @@
 
 #include <boost/foreach.hpp>
 
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <thread>
+
 SIGHT_REGISTER_IO_WRITER(::sight::io::dicom::helper::DicomSeriesWriter);
 
 namespace sight::io::dicom
@@ -114,6 +121,25 @@ void DicomSeriesWriter::processStream(std::istream& inputStream, std::ostream& o
 
 //------------------------------------------------------------------------------
 
+void DicomSeriesWriter::processInstance(const core::memory::BufferObject::sptr& buffer, std::ostream& outputStream)
+{
+    core::memory::BufferObject::Lock sourceLocker(buffer);
+    const core::memory::BufferManager::StreamInfo& streamInfo = buffer->getStreamInfo();
+    SPTR(std::istream) stream = streamInfo.stream;
+
+    this->processStream(*(stream.get()), outputStream);
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t DicomSeriesWriter::getConcurrency() const
+{
+    const std::size_t threadCount = m_threadCount > 0 ? m_threadCount : std::thread::hardware_concurrency();
+    return std::max<std::size_t>(1, threadCount);
+}
+
+//------------------------------------------------------------------------------
+
 void DicomSeriesWriter::processWrite()
 {
     data::DicomSeries::csptr dicomSeries = this->getConcreteObject();
@@ -133,41 +159,70 @@ void DicomSeriesWriter::processWrite()
         std::filesystem::create_directories(folder);
     }
 
+    const std::filesystem::path dest_dir = m_anonymizer ? folder / m_subPath : folder;
+
+    if(!std::filesystem::exists(dest_dir))
+    {
+        std::filesystem::create_directories(dest_dir);
+    }
+
     std::size_t nbInstances = dicomSeries->getNumberOfInstances();
 
     m_job->setTotalWorkUnits(nbInstances);
     unsigned int count = 0;
 
+    // The instances are written concurrently, in a window of at most one instance per thread to bound the memory use.
+    // With a single thread, each instance is written by the current thread when it leaves the window.
+    const std::size_t concurrency = this->getConcurrency();
+    const auto policy             = concurrency > 1 ? std::launch::async : std::launch::deferred;
+    std::deque<std::future<void> > pending;
+
+    const auto waitFront =
+        [&]()
+        {
+            pending.front().get();
+            pending.pop_front();
+            m_job->doneWork(++count);
+        };
+
     // Write binary files
     for(const auto& value : dicomSeries->getDicomContainer())
     {
         if(m_job->cancelRequested())
         {
-            return;
+            break;
         }
 
-        const std::string filename = this->getFilename(value.first);
-
+        // The filenames are computed in the order of the instances
+        const std::filesystem::path dest_file               = dest_dir / this->getFilename(value.first);
         const core::memory::BufferObject::sptr sourceBuffer = value.second;
-        core::memory::BufferObject::Lock sourceLocker(sourceBuffer);
-        const core::memory::BufferManager::StreamInfo& streamInfo = sourceBuffer->getStreamInfo();
-        SPTR(std::istream) stream = streamInfo.stream;
 
-        const std::filesystem::path& dest_dir = m_anonymizer ? folder / m_subPath : folder;
+        pending.push_back(
+            std::async(
+                policy,
+                [this, sourceBuffer, dest_file]()
+            {
+                std::ofstream fs(dest_file, std::ios::binary | std::ios::trunc);
+                SIGHT_THROW_IF("Can't open '" << dest_file.string() << "' for write.", !fs.good());
 
-        if(!std::filesystem::exists(dest_dir))
+                this->processInstance(sourceBuffer, fs);
+            })
+        );
+
+        if(pending.size() >= concurrency)
         {
-            std::filesystem::create_directories(dest_dir);
+            waitFront();
         }
+    }
 
-        const std::filesystem::path& dest_file = dest_dir / filename;
-
-        std::ofstream fs(dest_file, std::ios::binary | std::ios::trunc);
-        SIGHT_THROW_IF("Can't open '" << dest_file.string() << "' for write.", !fs.good());
-
-        this->processStream(*(stream.get()), fs);
+    while(!pending.empty())
+    {
+        waitFront();
+    }
 
-        m_job->doneWork(++count);
+    if(m_job->cancelRequested())
+    {
+        return;
     }
 
     m_job->finish();
@@ -187,6 +242,27 @@ void DicomSeriesWriter::processWriteArchive()
 
     m_job->setTotalWorkUnits(nbInstances);
 
+    // The archive is written by the current thread in the order of the instances. Without anonymization, the instances
+    // are directly streamed into it. Otherwise they are anonymized concurrently into memory, in a window of at most
+    // one instance per thread to bound the memory use.
+    const std::size_t concurrency = this->getConcurrency();
+    const auto policy             = concurrency > 1 ? std::launch::async : std::launch::deferred;
+    std::deque<std::pair<std::filesystem::path, std::future<std::string> > > pending;
+
+    const auto writeFront =
+        [&]()
+        {
+            const std::filesystem::path dest_file = pending.front().first;
+            const std::string instance            = pending.front().second.get();
+            pending.pop_front();
+
+            SPTR(std::ostream) fs = m_archive->createFile(dest_file);
+            SIGHT_THROW_IF("Can't open '" << dest_file.string() << "' for write.", !fs->good());
+            fs->write(instance.data(), static_cast<std::streamsize>(instance.size()));
+
+            m_job->doneWork(++count);
+        };
+
     for(const auto& value : dicomSeries->getDicomContainer())
     {
         if(m_job->cancelRequested())
@@ -197,20 +273,44 @@ void DicomSeriesWriter::processWriteArchive()
         const std::string filename = this->getFilename(value.first);
 
         const core::memory::BufferObject::sptr sourceBuffer = value.second;
-        core::memory::BufferObject::Lock sourceLocker(sourceBuffer);
-        const core::memory::BufferManager::StreamInfo& streamInfo = sourceBuffer->getStreamInfo();
-        SPTR(std::istream) stream = streamInfo.stream;
 
         const std::filesystem::path& dest_dir =
             m_anonymizer ? m_subPath : "";
 
         const std::filesystem::path& dest_file = dest_dir / filename;
-        SPTR(std::ostream) fs = m_archive->createFile(dest_file);
-        SIGHT_THROW_IF("Can't open '" << dest_file.string() << "' for write.", !fs->good());
 
-        this->processStream(*(stream.get()), *fs);
+        if(!m_anonymizer)
+        {
+            SPTR(std::ostream) fs = m_archive->createFile(dest_file);
+            SIGHT_THROW_IF("Can't open '" << dest_file.string() << "' for write.", !fs->good());
+
+            this->processInstance(sourceBuffer, *fs);
+
+            m_job->doneWork(++count);
+            continue;
+        }
 
-        m_job->doneWork(++count);
+        pending.emplace_back(
+            dest_file,
+            std::async(
+                policy,
+                [this, sourceBuffer]()
+            {
+                std::ostringstream os;
+                this->processInstance(sourceBuffer, os);
+                return os.str();
+            })
+        );
+
+        if(pending.size() >= concurrency)
+        {
+            writeFront();
+        }
+    }
+
+    while(!pending.empty())
+    {
+        writeFront();
     }
 
     m_job->done();
@@ -28,6 +28,7 @@
 
 #include <io/base/writer/GenericObjectWriter.hpp>
 
+#include <cstddef>
 #include <string>
 
 namespace sight::core::jobs
@@ -38,6 +39,13 @@ class IJob;
 
 }
 
+namespace sight::core::memory
+{
+
+class BufferObject;
+
+}
+
 namespace sight::data
 {
 
@@ -108,6 +116,19 @@ public:
         const std::string& subPath = ""
     );
 
+    /**
+     * @brief Set the number of instances processed concurrently.
+     *
+     * The instances are written to a folder in parallel. In an archive, they are written one after another in their
+     * order, only their anonymization is done in parallel. At most this number of instances is held in memory.
+     *
+     * @param threadCount number of instances, 0 uses the number of hardware threads
+     */
+    void setThreadCount(std::size_t threadCount)
+    {
+        m_threadCount = threadCount;
+    }
+
 protected:
 
     /// Compute DICOM filename according to anonymizer or return default filename.
@@ -116,6 +137,12 @@ protected:
     /// Process inputStream to outputStream with anonymization management.
     void processStream(std::istream& inputStream, std::ostream& outputStream);
 
+    /// Process the instance stored in the buffer to outputStream with anonymization management.
+    void processInstance(const SPTR(core::memory::BufferObject)& buffer, std::ostream& outputStream);
+
+    /// Return the number of instances processed concurrently
+    std::size_t getConcurrency() const;
+
     /// Process write on archive
     void processWriteArchive();
 
@@ -136,6 +163,9 @@ protected:
 
     /// Optional subPath (related to write archive
     std::string m_subPath;
+
+    /// Number of instances processed concurrently, 0 means the number of hardware threads
+    std::size_t m_threadCount {0};
 };
 
 } // namespace helper
@@ -230,6 +230,41 @@ data::Series::sptr Series::read(const data::DicomSeries::csptr& dicomSeries)
 
 //------------------------------------------------------------------------------
 
+data::ImageSeries::sptr Series::getReferencedImageSeries(const data::DicomSeries::csptr& dicomSeries)
+{
+    data::ImageSeries::sptr result;
+
+    const data::DicomSeries::SOPClassUIDContainerType sopClassUIDContainer = dicomSeries->getSOPClassUIDs();
+    if(dicomSeries->getDicomContainer().empty() || sopClassUIDContainer.empty())
+    {
+        return result;
+    }
+
+    const std::string sopClassUID = *sopClassUIDContainer.begin();
+    const auto msType             = ::gdcm::MediaStorage::GetMSType(sopClassUID.c_str());
+
+    SPTR(io::dicom::container::DicomInstance) referencedInstance;
+    if(msType == ::gdcm::MediaStorage::SpacialFiducialsStorage)
+    {
+        referencedInstance = this->getSpatialFiducialsReferencedSeriesInstance(dicomSeries);
+    }
+    else if(msType == ::gdcm::MediaStorage::EnhancedSR || msType == ::gdcm::MediaStorage::ComprehensiveSR
+            || sopClassUID == "1.2.840.10008.5.1.4.1.1.88.34") // Comprehensive3DSR
+    {
+        referencedInstance = this->getStructuredReportReferencedSeriesInstance(dicomSeries);
+    }
+
+    const auto iter = m_seriesContainerMap.find(referencedInstance);
+    if(referencedInstance && iter != m_seriesContainerMap.end())
+    {
+        result = data::ImageSeries::dynamicCast(iter->second);
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
 SPTR(io::dicom::container::DicomInstance) Series::getSpatialFiducialsReferencedSeriesInstance(
     const data::DicomSeries::csptr& dicomSeries
 )
@@ -26,6 +26,8 @@
 
 #include <core/log/Logger.hpp>
 
+#include <data/ImageSeries.hpp>
+
 namespace sight::io::dicom
 {
 
@@ -93,6 +95,28 @@ public:
         m_enableBufferRotation = enabled;
     }
 
+    /// Get the series read so far, the series referencing them (Spatial Fiducials, Structured Report) can be read
+    const SeriesContainerMapType& getSeriesContainerMap() const
+    {
+        return m_seriesContainerMap;
+    }
+
+    /**
+     * @brief Get the image series read so far which is referenced by a Spatial Fiducials or a Structured Report
+     * @param[in] dicomSeries DICOM series referencing another series
+     * @return the referenced image series, or null if the series does not reference a known image series
+     */
+    IO_DICOM_API data::ImageSeries::sptr getReferencedImageSeries(const data::DicomSeries::csptr& dicomSeries);
+
+    /**
+     * @brief Add series read by another reader, so that the series referencing them can be read
+     * @param[in] seriesContainerMap Series read by another reader
+     */
+    void addSeriesContainerMap(const SeriesContainerMapType& seriesContainerMap)
+    {
+        m_seriesContainerMap.insert(seriesContainerMap.begin(), seriesContainerMap.end());
+    }
+
 protected:
 
     /// Get referenced series when dealing with Spatial Fiducials
@@ -34,6 +34,8 @@
 #include <core/thread/ActiveWorkers.hpp>
 
 #include <data/helper/SeriesDB.hpp>
+#include <data/Image.hpp>
+#include <data/ImageSeries.hpp>
 
 #include <filter/dicom/factory/new.hpp>
 #include <filter/dicom/helper/Filter.hpp>
@@ -46,6 +48,12 @@
 #include <gdcmMediaStorage.h>
 #include <gdcmUIDs.h>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
 SIGHT_REGISTER_IO_READER(::sight::io::dicom::reader::SeriesDB);
 
 namespace sight::io::dicom
@@ -56,6 +64,26 @@ namespace reader
 
 //------------------------------------------------------------------------------
 
+/// Return true if the series references another series, i.e. it is a Spatial Fiducials or a Structured Report
+static bool isReferencingSeries(const data::DicomSeries::csptr& dicomSeries)
+{
+    const data::DicomSeries::SOPClassUIDContainerType& sopClassUIDContainer = dicomSeries->getSOPClassUIDs();
+    if(sopClassUIDContainer.empty())
+    {
+        return false;
+    }
+
+    const std::string& sopClassUID = *sopClassUIDContainer.begin();
+    const auto type                = ::gdcm::MediaStorage::GetMSType(sopClassUID.c_str());
+
+    return type == ::gdcm::MediaStorage::SpacialFiducialsStorage
+           || type == ::gdcm::MediaStorage::EnhancedSR
+           || type == ::gdcm::MediaStorage::ComprehensiveSR
+           || sopClassUID == "1.2.840.10008.5.1.4.1.1.88.34"; // Comprehensive3DSR
+}
+
+//------------------------------------------------------------------------------
+
 SeriesDB::SeriesDB(io::base::reader::IObjectReader::Key key) :
     m_isDicomdirActivated(false),
     m_dicomFilterType(""),
@@ -74,12 +102,15 @@ SeriesDB::SeriesDB(io::base::reader::IObjectReader::Key key) :
 
 SeriesDB::~SeriesDB()
 {
+    this->waitForConversion();
 }
 
 //------------------------------------------------------------------------------
 
 void SeriesDB::read()
 {
+    this->waitForConversion();
+
     // Clear DicomSeries container
     m_dicomSeriesContainer.clear();
 
@@ -151,6 +182,8 @@ void SeriesDB::read()
 
 void SeriesDB::readDicomSeries()
 {
+    this->waitForConversion();
+
     // Clear DicomSeries container
     m_dicomSeriesContainer.clear();
 
@@ -274,6 +307,8 @@ void SeriesDB::readFromDicomSeriesDB(
     const service::IService::sptr& notifier
 )
 {
+    this->waitForConversion();
+
     // Clear DicomSeries container
     m_dicomSeriesContainer.clear();
 
@@ -338,88 +373,312 @@ void SeriesDB::convertDicomSeries(const service::IService::sptr& notifier)
     // Sort DicomSeries
     std::sort(m_dicomSeriesContainer.begin(), m_dicomSeriesContainer.end(), SeriesDB::dicomSeriesComparator);
 
-    // Create reader
-    SPTR(io::dicom::reader::Series) seriesReader = std::make_shared<io::dicom::reader::Series>();
-    seriesReader->setBufferRotationEnabled(m_enableBufferRotation);
-    seriesReader->setLogger(m_logger);
-
-    m_converterJob->setTotalWorkUnits(m_dicomSeriesContainer.size());
+    // Convert the awaited series first, the series referencing other series stay after all the other ones
+    const std::set<std::string> awaitedSeries = m_awaitedSeries;
+    std::stable_partition(
+        m_dicomSeriesContainer.begin(),
+        m_dicomSeriesContainer.end(),
+        [&awaitedSeries](const data::DicomSeries::sptr& dicomSeries)
+        {
+            return !isReferencingSeries(dicomSeries) && awaitedSeries.count(dicomSeries->getInstanceUID()) > 0;
+        });
+
+    // The container is copied as the conversion may continue in the background
+    const DicomSeriesContainerType dicomSeriesContainer = m_dicomSeriesContainer;
+    const std::size_t seriesCount                       = dicomSeriesContainer.size();
+    const std::size_t independentCount                  = static_cast<std::size_t>(
+        std::find_if(dicomSeriesContainer.begin(), dicomSeriesContainer.end(), isReferencingSeries)
+        - dicomSeriesContainer.begin()
+    );
+
+    // Number of series added to the SeriesDB before returning
+    std::size_t awaitedCount = seriesCount;
+    if(m_backgroundConversionEnabled)
+    {
+        awaitedCount = std::min<std::size_t>(1, seriesCount);
+        for(std::size_t i = 0 ; i < seriesCount ; ++i)
+        {
+            if(awaitedSeries.count(dicomSeriesContainer[i]->getInstanceUID()) > 0)
+            {
+                awaitedCount = std::max(awaitedCount, i + 1);
+            }
+        }
+    }
 
     // Compute total work units
     // We do not use an Aggregator here as the jobs
     // are created after updating the main aggregator.
     std::uint64_t totalWorkUnits = 0;
-    for(const data::DicomSeries::sptr& dicomSeries : m_dicomSeriesContainer)
+    for(const data::DicomSeries::sptr& dicomSeries : dicomSeriesContainer)
     {
         totalWorkUnits += dicomSeries->getDicomContainer().size();
     }
 
     m_converterJob->setTotalWorkUnits(totalWorkUnits);
 
-    std::uint64_t completedProgress = 0;
-    auto progressCallback = [&](std::uint64_t progress)
-                            {
-                                m_converterJob->doneWork(completedProgress + progress);
-                            };
+    // The progress of each series is stored, their sum is reported under a mutex so that it never decreases. The
+    // progress is no longer reported once the job is finished, the series converted in the background are not tracked.
+    const auto converterJob  = m_converterJob;
+    const auto job           = m_job;
+    const auto progressMutex = std::make_shared<std::mutex>();
+    const auto progress      = std::make_shared<std::vector<std::uint64_t> >(seriesCount, 0);
+    const auto reporting     = std::make_shared<bool>(true);
+    const auto progressCallback =
+        [converterJob, progressMutex, progress, reporting](std::size_t index)
+        -> io::dicom::reader::Series::ProgressCallback
+        {
+            return [converterJob, progressMutex, progress, reporting, index](std::uint64_t seriesProgress)
+                   {
+                       std::lock_guard<std::mutex> lock(*progressMutex);
+                       (*progress)[index] = seriesProgress;
+                       if(*reporting)
+                       {
+                           converterJob->doneWork(
+                               std::accumulate(progress->begin(), progress->end(), std::uint64_t(0))
+                           );
+                       }
+                   };
+        };
+
+    // Convert a series with the given reader
+    const SupportedSOPClassContainerType supportedSOPClassContainer = m_supportedSOPClassContainer;
+    const auto convert =
+        [supportedSOPClassContainer](const data::DicomSeries::csptr& dicomSeries,
+                                     io::dicom::reader::Series& seriesReader) -> data::Series::sptr
+        {
+            data::DicomSeries::SOPClassUIDContainerType sopClassUIDContainer = dicomSeries->getSOPClassUIDs();
+            SIGHT_THROW_IF(
+                "The series contains several SOPClassUIDs. Try to apply a filter in order to split the series.",
+                sopClassUIDContainer.size() != 1
+            );
+            const std::string sopClassUID = sopClassUIDContainer.begin()->c_str();
+
+            const auto bIt = supportedSOPClassContainer.begin();
+            const auto eIt = supportedSOPClassContainer.end();
+
+            data::Series::sptr series;
+            if(supportedSOPClassContainer.empty() || std::find(bIt, eIt, sopClassUID) != eIt)
+            {
+                try
+                {
+                    series = seriesReader.read(dicomSeries);
+                }
+                catch(io::dicom::exception::Failed& e)
+                {
+                    seriesReader.getLogger()->critical("Unable to read series : " + dicomSeries->getInstanceUID());
+                }
+            }
+            else
+            {
+                const std::string sopClassName = io::dicom::helper::SOPClass::getSOPClassName(sopClassUID);
+                seriesReader.getLogger()->critical(
+                    "DICOM SOP Class \"" + sopClassName + "\" is not supported by the selected reader."
+                );
+            }
 
-    // Read series
-    for(const data::DicomSeries::csptr dicomSeries : m_dicomSeriesContainer)
+            return series;
+        };
+
+    // The series that do not reference another series are converted concurrently, each with its own reader and
+    // logger. The results are then added to the SeriesDB in the order of the container.
+    struct Conversion
     {
-        data::DicomSeries::SOPClassUIDContainerType sopClassUIDContainer = dicomSeries->getSOPClassUIDs();
-        SIGHT_THROW_IF(
-            "The series contains several SOPClassUIDs. Try to apply a filter in order to split the series.",
-            sopClassUIDContainer.size() != 1
-        );
-        const std::string sopClassUID = sopClassUIDContainer.begin()->c_str();
+        data::Series::sptr series;
+        core::log::Logger::sptr logger;
+        io::dicom::reader::Series::SeriesContainerMapType seriesContainerMap;
+    };
+
+    const auto promises = std::make_shared<std::vector<std::promise<Conversion> > >(independentCount);
+    const auto futures  = std::make_shared<std::vector<std::future<Conversion> > >();
+    for(auto& promise : *promises)
+    {
+        futures->push_back(promise.get_future());
+    }
+
+    const bool enableBufferRotation = m_enableBufferRotation;
+    const auto nextSeries           = std::make_shared<std::atomic<std::size_t> >(0);
+    const auto stopped              = std::make_shared<std::atomic<bool> >(false);
+    const auto convertSeries =
+        [ = ]()
+        {
+            for(std::size_t index = (*nextSeries)++ ; index < independentCount ; index = (*nextSeries)++)
+            {
+                Conversion conversion;
+                conversion.logger = core::log::Logger::New();
+
+                io::dicom::reader::Series seriesReader;
+                seriesReader.setBufferRotationEnabled(enableBufferRotation);
+                seriesReader.setLogger(conversion.logger);
+                seriesReader.setProgressCallback(progressCallback(index));
+                seriesReader.setCancelRequestedCallback(converterJob->cancelRequestedCallback());
+
+                try
+                {
+                    if(!*stopped && !job->cancelRequested())
+                    {
+                        conversion.series             = convert(dicomSeriesContainer[index], seriesReader);
+                        conversion.seriesContainerMap = seriesReader.getSeriesContainerMap();
+                    }
 
-        const SupportedSOPClassContainerType::iterator bIt = m_supportedSOPClassContainer.begin();
-        const SupportedSOPClassContainerType::iterator eIt = m_supportedSOPClassContainer.end();
+                    (*promises)[index].set_value(conversion);
+                }
+                catch(...)
+                {
+                    (*promises)[index].set_exception(std::current_exception());
+                }
+            }
+        };
+
+    const std::size_t maxThreads = m_maxConcurrentConversions > 0
+                                   ? m_maxConcurrentConversions : std::thread::hardware_concurrency();
+    const std::size_t threadCount = std::max<std::size_t>(1, std::min(maxThreads, independentCount));
+
+    std::vector<std::future<void> > workers;
+    for(std::size_t i = 0 ; i < threadCount && i < independentCount ; ++i)
+    {
+        workers.push_back(std::async(std::launch::async, convertSeries));
+    }
 
-        if(m_supportedSOPClassContainer.empty() || std::find(bIt, eIt, sopClassUID) != eIt)
+    // Add the series to the SeriesDB in order, the series referencing other ones are read with a reader knowing all
+    // the series read before
+    const auto referencingReader = std::make_shared<io::dicom::reader::Series>();
+    referencingReader->setBufferRotationEnabled(enableBufferRotation);
+    referencingReader->setCancelRequestedCallback(converterJob->cancelRequestedCallback());
+
+    const auto publish =
+        [ = ](std::size_t begin, std::size_t end, const core::log::Logger::sptr& logger, bool background)
         {
-            seriesReader->setProgressCallback(progressCallback);
-            seriesReader->setCancelRequestedCallback(m_converterJob->cancelRequestedCallback());
             try
             {
-                data::Series::sptr series = seriesReader->read(dicomSeries);
-
-                if(series)
+                for(std::size_t index = begin ; index < end && !job->cancelRequested() ; ++index)
                 {
-                    // Add the series to the DB
-                    data::helper::SeriesDB seriesDBHelper(seriesDB);
-                    seriesDBHelper.add(series);
+                    data::Series::sptr series;
+                    if(index < independentCount)
+                    {
+                        Conversion conversion = (*futures)[index].get();
+                        logger->append(*conversion.logger);
+                        referencingReader->addSeriesContainerMap(conversion.seriesContainerMap);
+                        series = conversion.series;
+                    }
+                    else
+                    {
+                        referencingReader->setLogger(logger);
+                        referencingReader->setProgressCallback(progressCallback(index));
+
+                        // In the background, the referenced image is already in the SeriesDB: it is locked while the
+                        // landmarks are read into its fields, and its observers are then notified
+                        data::Image::sptr image;
+                        if(background)
+                        {
+                            const auto imageSeries =
+                                referencingReader->getReferencedImageSeries(dicomSeriesContainer[index]);
+                            image = imageSeries ? imageSeries->getImage() : nullptr;
+                        }
+
+                        if(image)
+                        {
+                            {
+                                core::mt::WriteLock lock(image->getMutex());
+                                series = convert(dicomSeriesContainer[index], *referencingReader);
+                            }
+
+                            auto sig = image->signal<data::Object::ModifiedSignalType>(data::Object::s_MODIFIED_SIG);
+                            sig->asyncEmit();
+                        }
+                        else
+                        {
+                            series = convert(dicomSeriesContainer[index], *referencingReader);
+                        }
+                    }
 
-                    if(notifier)
+                    if(series)
                     {
-                        seriesDBHelper.notify();
+                        // Add the series to the DB
+                        if(background)
+                        {
+                            core::mt::WriteLock lock(seriesDB->getMutex());
+                            data::helper::SeriesDB seriesDBHelper(seriesDB);
+                            seriesDBHelper.add(series);
+                            seriesDBHelper.notify();
+                        }
+                        else
+                        {
+                            data::helper::SeriesDB seriesDBHelper(seriesDB);
+                            seriesDBHelper.add(series);
+
+                            if(notifier)
+                            {
+                                seriesDBHelper.notify();
+                            }
+                        }
                     }
                 }
             }
-            catch(io::dicom::exception::Failed& e)
+            catch(...)
             {
-                m_logger->critical("Unable to read series : " + dicomSeries->getInstanceUID());
+                *stopped = true;
+                throw;
             }
-        }
-        else
-        {
-            const std::string sopClassName = io::dicom::helper::SOPClass::getSOPClassName(sopClassUID);
-            m_logger->critical("DICOM SOP Class \"" + sopClassName + "\" is not supported by the selected reader.");
-        }
+        };
+
+    publish(0, awaitedCount, m_logger, false);
 
-        if(m_job->cancelRequested())
+    if(awaitedCount < seriesCount && !m_job->cancelRequested())
+    {
+        // The awaited series are ready, the other ones are added in the background
         {
-            break;
+            std::lock_guard<std::mutex> lock(*progressMutex);
+            *reporting = false;
         }
+        m_converterJob->done();
+        m_converterJob->finish();
+
+        const auto backgroundLogger = core::log::Logger::New();
+        m_backgroundLogger     = backgroundLogger;
+        m_backgroundConversion = std::async(
+            std::launch::async,
+            [publish, awaitedCount, seriesCount, backgroundLogger, workers = std::move(workers)]() mutable
+            {
+                try
+                {
+                    publish(awaitedCount, seriesCount, backgroundLogger, true);
+                }
+                catch(const std::exception& e)
+                {
+                    backgroundLogger->critical(
+                        "An error has occurred during the conversion of the series : " + std::string(e.what())
+                    );
+                }
 
-        completedProgress = m_converterJob->getDoneWorkUnits();
+                // Wait for the remaining conversions, they stop at once if the job was canceled
+                workers.clear();
+            });
+
+        return;
     }
 
+    // Stop the remaining conversions if the job was canceled
+    *stopped = true;
+    workers.clear();
+
     m_converterJob->done();
     m_converterJob->finish();
 }
 
 //------------------------------------------------------------------------------
 
+void SeriesDB::waitForConversion()
+{
+    if(m_backgroundConversion.valid())
+    {
+        m_backgroundConversion.get();
+        m_logger->append(*m_backgroundLogger);
+        m_backgroundLogger.reset();
+    }
+}
+
+//------------------------------------------------------------------------------
+
 bool SeriesDB::dicomSeriesComparator(
     const SPTR(data::DicomSeries)& a,
     const SPTR(data::DicomSeries)& b
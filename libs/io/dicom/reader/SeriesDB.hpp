@@ -36,6 +36,9 @@
 
 #include <service/IService.hpp>
 
+#include <future>
+#include <set>
+
 namespace sight::core::jobs
 {
 
@@ -159,6 +162,46 @@ public:
         m_enableBufferRotation = enabled;
     }
 
+    /**
+     * @brief Set the maximum number of series converted concurrently
+     * @param[in] count maximum number of series, 0 uses the number of hardware threads
+     */
+    void setMaxConcurrentConversions(std::size_t count)
+    {
+        m_maxConcurrentConversions = count;
+    }
+
+    /**
+     * @brief Set the series converted first, they are added to the SeriesDB before the other ones
+     * @param[in] instanceUIDs instance UIDs of the series
+     */
+    void setAwaitedSeries(const std::set<std::string>& instanceUIDs)
+    {
+        m_awaitedSeries = instanceUIDs;
+    }
+
+    /**
+     * @brief Enable the conversion in the background
+     *
+     * When enabled, the reading functions return as soon as the awaited series (or the first series if none is set,
+     * see setAwaitedSeries()) are added to the SeriesDB. The other series are converted and added in the background,
+     * the SeriesDB is locked and notified for each of them. The Spatial Fiducials and Structured Reports read in the
+     * background lock the image they reference while adding their landmarks, then notify it. Call waitForConversion()
+     * to wait for them. The job is finished when the reading returns, the progress of the background conversion is not
+     * reported.
+     */
+    void setBackgroundConversionEnabled(bool enabled)
+    {
+        m_backgroundConversionEnabled = enabled;
+    }
+
+    /**
+     * @brief Wait for the series converted in the background
+     *
+     * The logs of these series are added to the logger once they are all converted.
+     */
+    IO_DICOM_API void waitForConversion();
+
 private:
 
     /**
@@ -208,6 +251,21 @@ private:
     SPTR(core::jobs::Observer) m_readerJob;
     SPTR(core::jobs::Observer) m_completeDicomSeriesJob;
     SPTR(core::jobs::Observer) m_converterJob;
+
+    /// Maximum number of series converted concurrently, 0 means the number of hardware threads
+    std::size_t m_maxConcurrentConversions {0};
+
+    /// Instance UIDs of the series converted first
+    std::set<std::string> m_awaitedSeries;
+
+    /// True if the series that are not awaited are converted in the background
+    bool m_backgroundConversionEnabled {false};
+
+    /// Conversion of the series running in the background
+    std::future<void> m_backgroundConversion;
+
+    /// Logs of the series converted in the background, added to the logger by waitForConversion()
+    core::log::Logger::sptr m_backgroundLogger;
 };
 
 } // namespace reader
@@ -0,0 +1,192 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "DicomSeriesTest.hpp"
+
+#include <core/jobs/Observer.hpp>
+#include <core/tools/System.hpp>
+
+#include <data/DicomSeries.hpp>
+
+#include <io/dicom/helper/DicomSeries.hpp>
+
+#include <utest/Filter.hpp>
+
+#include <utestData/Data.hpp>
+
+#include <gdcmAnonymizer.h>
+#include <gdcmReader.h>
+#include <gdcmUIDGenerator.h>
+#include <gdcmWriter.h>
+
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(::sight::io::dicom::ut::DicomSeriesTest);
+
+namespace sight::io::dicom
+{
+
+namespace ut
+{
+
+//------------------------------------------------------------------------------
+
+void DicomSeriesTest::setUp()
+{
+    // Set up context before running a test.
+    if(utest::Filter::ignoreSlowTests())
+    {
+        std::cout << std::endl << "Ignoring slow " << std::endl;
+    }
+    else
+    {
+        std::cout << std::endl << "Executing slow tests.." << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void DicomSeriesTest::tearDown()
+{
+    // Clean up after the test run.
+}
+
+//------------------------------------------------------------------------------
+
+void DicomSeriesTest::readLargeStudyTest()
+{
+    if(utest::Filter::ignoreSlowTests())
+    {
+        return;
+    }
+
+    const std::filesystem::path srcPath = utestData::Data::dir() / "sight/Patient/Dicom/DicomDB/01-CT-DICOM_LIVER";
+    CPPUNIT_ASSERT_MESSAGE(
+        "The dicom directory '" + srcPath.string() + "' does not exist",
+        std::filesystem::exists(srcPath)
+    );
+
+    std::vector<std::filesystem::path> srcFiles;
+    for(const auto& entry : std::filesystem::directory_iterator(srcPath))
+    {
+        if(entry.is_regular_file())
+        {
+            srcFiles.push_back(entry.path());
+        }
+    }
+
+    CPPUNIT_ASSERT(!srcFiles.empty());
+
+    // Generate the study: every copy of the source series is a new series. The pixel data are removed to keep the
+    // study small on disk, they are not read by the scan anyway.
+    const std::size_t seriesCount         = 40;
+    const std::filesystem::path studyPath = core::tools::System::getTemporaryFolder("DicomSeriesTest") / "largeStudy";
+    std::filesystem::create_directories(studyPath);
+
+    ::gdcm::UIDGenerator generator;
+    std::vector<std::filesystem::path> filenames;
+    for(const auto& srcFile : srcFiles)
+    {
+        ::gdcm::Reader reader;
+        reader.SetFileName(srcFile.string().c_str());
+        CPPUNIT_ASSERT_MESSAGE("Unable to read '" + srcFile.string() + "'", reader.Read());
+
+        ::gdcm::Anonymizer anonymizer;
+        anonymizer.SetFile(reader.GetFile());
+        anonymizer.Remove(::gdcm::Tag(0x7fe0, 0x0010));
+
+        for(std::size_t series = 0 ; series < seriesCount ; ++series)
+        {
+            // The series UIDs only depend on the series index
+            const std::string seriesUID = "1.2.826.0.1.3680043.2.1125.9." + std::to_string(series + 1);
+            anonymizer.Replace(::gdcm::Tag(0x0020, 0x000e), seriesUID.c_str());
+            anonymizer.Replace(::gdcm::Tag(0x0008, 0x0018), generator.Generate());
+
+            std::stringstream filename;
+            filename << std::setw(3) << std::setfill('0') << series << "_" << srcFile.filename().string();
+            const std::filesystem::path dstFile = studyPath / filename.str();
+
+            ::gdcm::Writer writer;
+            writer.SetFileName(dstFile.string().c_str());
+            writer.SetFile(reader.GetFile());
+            CPPUNIT_ASSERT_MESSAGE("Unable to write '" + dstFile.string() + "'", writer.Write());
+
+            filenames.push_back(dstFile);
+        }
+    }
+
+    // Read the study with one thread, then with all the available threads. The durations are compared by the
+    // DicomBenchmark utility.
+    const auto scan =
+        [&filenames](std::size_t threadCount)
+        {
+            auto observer = core::jobs::Observer::New("Reading DICOM files");
+            io::dicom::helper::DicomSeries helper;
+            helper.setThreadCount(threadCount);
+
+            auto seriesDB = helper.read(filenames, observer);
+
+            CPPUNIT_ASSERT_EQUAL(observer->getTotalWorkUnits(), observer->getDoneWorkUnits());
+            observer->finish();
+
+            return seriesDB;
+        };
+
+    const auto sequentialSeriesDB = scan(1);
+    const auto concurrentSeriesDB = scan(0);
+
+    // The result must not depend on the number of threads
+    CPPUNIT_ASSERT_EQUAL(seriesCount, sequentialSeriesDB.size());
+    CPPUNIT_ASSERT_EQUAL(seriesCount, concurrentSeriesDB.size());
+
+    for(std::size_t i = 0 ; i < seriesCount ; ++i)
+    {
+        const auto& sequentialSeries = sequentialSeriesDB[i];
+        const auto& concurrentSeries = concurrentSeriesDB[i];
+
+        CPPUNIT_ASSERT_EQUAL(sequentialSeries->getInstanceUID(), concurrentSeries->getInstanceUID());
+        CPPUNIT_ASSERT_EQUAL(srcFiles.size(), sequentialSeries->getNumberOfInstances());
+        CPPUNIT_ASSERT_EQUAL(srcFiles.size(), concurrentSeries->getNumberOfInstances());
+
+        const auto& sequentialContainer = sequentialSeries->getDicomContainer();
+        const auto& concurrentContainer = concurrentSeries->getDicomContainer();
+        CPPUNIT_ASSERT_EQUAL(sequentialContainer.size(), concurrentContainer.size());
+
+        for(const auto& instance : sequentialContainer)
+        {
+            CPPUNIT_ASSERT(concurrentContainer.find(instance.first) != concurrentContainer.end());
+            const std::filesystem::path sequentialPath = instance.second->getStreamInfo().fsFile;
+            const std::filesystem::path concurrentPath = concurrentContainer.at(instance.first)->getStreamInfo().fsFile;
+            CPPUNIT_ASSERT_EQUAL(sequentialPath.string(), concurrentPath.string());
+        }
+    }
+
+    std::filesystem::remove_all(studyPath);
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace ut
+
+} // namespace sight::io::dicom
@@ -211,6 +211,63 @@ void DicomSeriesWriterTest::writeReadDirArchiveTest()
 
 //------------------------------------------------------------------------------
 
+void DicomSeriesWriterTest::writeReadConcurrentTest()
+{
+    if(utest::Filter::ignoreSlowTests())
+    {
+        return;
+    }
+
+    CPPUNIT_ASSERT_MESSAGE("Failed to set up source Dicom series", m_srcDicomSeries);
+
+    // Write the anonymized series with one thread, then with all the available threads. The durations are compared
+    // by the DicomBenchmark utility.
+    const auto writeFolder =
+        [this](std::size_t threadCount, const std::string& label)
+        {
+            io::dicom::helper::DicomAnonymizer::sptr anonymizer = io::dicom::helper::DicomAnonymizer::New();
+            anonymizer->addExceptionTag(0x0010, 0x0010, "ANONYMIZED^ANONYMIZED "); // Patient's name
+
+            const std::filesystem::path destPath =
+                core::tools::System::getTemporaryFolder("writeReadConcurrentTest") / label;
+            std::filesystem::create_directories(destPath);
+
+            io::dicom::helper::DicomSeriesWriter::sptr writer = io::dicom::helper::DicomSeriesWriter::New();
+            writer->setObject(m_srcDicomSeries);
+            writer->setFolder(destPath);
+            writer->setAnonymizer(anonymizer);
+            writer->setThreadCount(threadCount);
+
+            CPPUNIT_ASSERT_NO_THROW(writer->write());
+
+            this->checkDicomSeries(destPath, true);
+        };
+
+    writeFolder(1, "sequential");
+    writeFolder(0, "concurrent");
+
+    // The archive entries are written in order while the instances are anonymized concurrently
+    const std::filesystem::path destPath =
+        core::tools::System::getTemporaryFolder("writeReadConcurrentTest") / "archive";
+    std::filesystem::create_directories(destPath);
+
+    io::dicom::helper::DicomAnonymizer::sptr anonymizer = io::dicom::helper::DicomAnonymizer::New();
+    anonymizer->addExceptionTag(0x0010, 0x0010, "ANONYMIZED^ANONYMIZED "); // Patient's name
+
+    io::zip::WriteDirArchive::sptr writeArchive = io::zip::WriteDirArchive::New(destPath);
+
+    io::dicom::helper::DicomSeriesWriter::sptr writer = io::dicom::helper::DicomSeriesWriter::New();
+    writer->setObject(m_srcDicomSeries);
+    writer->setAnonymizer(anonymizer);
+    writer->setOutputArchive(writeArchive);
+    writer->setThreadCount(0);
+    CPPUNIT_ASSERT_NO_THROW(writer->write());
+
+    this->checkDicomSeries(destPath, true);
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace ut
 
 } // namespace sight::io::dicom
@@ -43,6 +43,7 @@ CPPUNIT_TEST_SUITE(DicomSeriesWriterTest);
 CPPUNIT_TEST(writeReadTest);
 CPPUNIT_TEST(writeReadAnonymiseTest);
 CPPUNIT_TEST(writeReadDirArchiveTest);
+CPPUNIT_TEST(writeReadConcurrentTest);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -54,6 +55,7 @@ public:
     void writeReadTest();
     void writeReadAnonymiseTest();
     void writeReadDirArchiveTest();
+    void writeReadConcurrentTest();
 
 private:
 
@@ -22,6 +22,7 @@
 
 #include "SeriesDBReaderTest.hpp"
 
+#include <core/jobs/IJob.hpp>
 #include <core/log/Logger.hpp>
 #include <core/memory/BufferManager.hpp>
 
@@ -59,6 +60,8 @@
 
 #include <cppunit/extensions/HelperMacros.h>
 
+#include <atomic>
+
 CPPUNIT_TEST_SUITE_REGISTRATION(::sight::io::dicom::ut::SeriesDBReaderTest);
 
 namespace sight::io::dicom
@@ -435,6 +438,105 @@ void SeriesDBReaderTest::readCTSeriesDBIssue01Test()
 
 //------------------------------------------------------------------------------
 
+void SeriesDBReaderTest::readConcurrentSeriesDBTest()
+{
+    if(utest::Filter::ignoreSlowTests())
+    {
+        return;
+    }
+
+    core::memory::BufferManager::getDefault()->setLoadingMode(core::memory::BufferManager::DIRECT);
+
+    const std::filesystem::path dicomDB = utestData::Data::dir() / "sight/Patient/Dicom/DicomDB";
+    const std::filesystem::path segPath = dicomDB / "71-CT-DICOM_SEG";
+    const std::filesystem::path srPath  = dicomDB / "71-CT-DICOM_SR";
+
+    CPPUNIT_ASSERT_MESSAGE(
+        "The dicom directory '" + segPath.string() + "' does not exist",
+        std::filesystem::exists(segPath)
+    );
+    CPPUNIT_ASSERT_MESSAGE(
+        "The dicom directory '" + srPath.string() + "' does not exist",
+        std::filesystem::exists(srPath)
+    );
+
+    const auto read =
+        [](const std::filesystem::path& path, std::size_t maxConcurrentConversions, bool background)
+        {
+            data::SeriesDB::sptr seriesDB = data::SeriesDB::New();
+
+            io::dicom::reader::SeriesDB::sptr reader = io::dicom::reader::SeriesDB::New();
+            reader->setObject(seriesDB);
+            reader->setFolder(path);
+            reader->setDicomFilterType("sight::filter::dicom::custom::DefaultDicomFilter");
+            reader->setMaxConcurrentConversions(maxConcurrentConversions);
+            reader->setBackgroundConversionEnabled(background);
+
+            // The progress never goes backwards, even once the job is finished and the conversion goes on
+            const auto decreased = std::make_shared<std::atomic<bool> >(false);
+            reader->getJob()->addDoneWorkHook(
+                [decreased](core::jobs::IJob& job, std::uint64_t oldDoneWork)
+                {
+                    if(job.getDoneWorkUnits() < oldDoneWork)
+                    {
+                        *decreased = true;
+                    }
+                });
+
+            CPPUNIT_ASSERT_NO_THROW(reader->read());
+
+            if(background)
+            {
+                // At least the first series is available when the reading returns
+                {
+                    core::mt::ReadLock lock(seriesDB->getMutex());
+                    CPPUNIT_ASSERT(!seriesDB->empty());
+                }
+                reader->waitForConversion();
+            }
+
+            CPPUNIT_ASSERT(!*decreased);
+
+            return seriesDB;
+        };
+
+    // The image and the segmentation are converted concurrently, they are added in the same order as sequentially
+    const data::SeriesDB::sptr sequentialSeriesDB = read(segPath, 1, false);
+    const data::SeriesDB::sptr concurrentSeriesDB = read(segPath, 0, false);
+    const data::SeriesDB::sptr backgroundSeriesDB = read(segPath, 0, true);
+
+    CPPUNIT_ASSERT_EQUAL(size_t(2), sequentialSeriesDB->size());
+    CPPUNIT_ASSERT_EQUAL(sequentialSeriesDB->size(), concurrentSeriesDB->size());
+    CPPUNIT_ASSERT_EQUAL(sequentialSeriesDB->size(), backgroundSeriesDB->size());
+
+    for(std::size_t i = 0 ; i < sequentialSeriesDB->size() ; ++i)
+    {
+        const data::Series::sptr sequentialSeries = (*sequentialSeriesDB)[i];
+        CPPUNIT_ASSERT_EQUAL(sequentialSeries->getInstanceUID(), (*concurrentSeriesDB)[i]->getInstanceUID());
+        CPPUNIT_ASSERT_EQUAL(sequentialSeries->getClassname(), (*concurrentSeriesDB)[i]->getClassname());
+        CPPUNIT_ASSERT_EQUAL(sequentialSeries->getInstanceUID(), (*backgroundSeriesDB)[i]->getInstanceUID());
+        CPPUNIT_ASSERT_EQUAL(sequentialSeries->getClassname(), (*backgroundSeriesDB)[i]->getClassname());
+    }
+
+    // The structured report is read once the image it references is converted
+    const data::SeriesDB::sptr srSeriesDB = read(srPath, 0, false);
+    CPPUNIT_ASSERT_EQUAL(size_t(1), srSeriesDB->size());
+
+    data::ImageSeries::sptr series = data::ImageSeries::dynamicCast(srSeriesDB->front());
+    CPPUNIT_ASSERT(series);
+    data::PointList::sptr landmarkPointList =
+        series->getImage()->getField<data::PointList>(data::fieldHelper::Image::m_imageLandmarksId);
+    CPPUNIT_ASSERT(landmarkPointList);
+    CPPUNIT_ASSERT(!landmarkPointList->getPoints().empty());
+    const data::Point::sptr& point = landmarkPointList->getPoints()[0];
+    CPPUNIT_ASSERT_EQUAL(
+        std::string("Label1"),
+        point->getField<data::String>(data::fieldHelper::Image::m_labelId)->value()
+    );
+}
+
+//------------------------------------------------------------------------------
+
 void SeriesDBReaderTest::readJMSSeries()
 {
     data::SeriesDB::sptr seriesDB = data::SeriesDB::New();
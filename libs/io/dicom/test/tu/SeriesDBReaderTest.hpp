@@ -49,6 +49,7 @@ CPPUNIT_TEST(readMultipleRescaleSeriesDBTest);
 CPPUNIT_TEST(readCTWithSurviewSeriesDBTest);
 CPPUNIT_TEST(readMRWithTemporalPositionSeriesDBTest);
 CPPUNIT_TEST(readCTSeriesDBIssue01Test);
+CPPUNIT_TEST(readConcurrentSeriesDBTest);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -98,6 +99,9 @@ public:
     /// Read CT image 01 for stability issue (86-CT-Skull)
     void readCTSeriesDBIssue01Test();
 
+    /// Read SEG and SR Series with concurrent and background conversions (71-CT-DICOM_SEG, 71-CT-DICOM_SR)
+    void readConcurrentSeriesDBTest();
+
 protected:
 
     /// Read and check JMS series
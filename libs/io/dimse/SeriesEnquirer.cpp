@@ -36,7 +36,9 @@
 #include <dcmtk/dcmdata/dcfilefo.h>
 #include <dcmtk/dcmnet/diutil.h>
 
+#include <algorithm>
 #include <filesystem>
+#include <future>
 
 namespace sight::io::dimse
 {
@@ -46,7 +48,8 @@ const core::com::Slots::SlotKeyType SeriesEnquirer::s_PROGRESS_CALLBACK_SLOT = "
 //------------------------------------------------------------------------------
 
 SeriesEnquirer::SeriesEnquirer() :
-    m_progressCallback(ProgressCallbackSlotType::sptr())
+    m_progressCallback(ProgressCallbackSlotType::sptr()),
+    m_instanceIndex(std::make_shared<std::atomic<unsigned int> >(0))
 {
 }
 
@@ -151,6 +154,15 @@ void SeriesEnquirer::initialize(
 
 //------------------------------------------------------------------------------
 
+void SeriesEnquirer::setAssociationProgressCallback(
+    AssociationProgressCallbackSlotType::sptr _associationProgressCallback
+)
+{
+    m_associationProgressCallback = _associationProgressCallback;
+}
+
+//------------------------------------------------------------------------------
+
 bool SeriesEnquirer::connect()
 {
     SIGHT_INFO(
@@ -769,61 +781,167 @@ std::string SeriesEnquirer::findSOPInstanceUID(const std::string& _seriesInstanc
 void SeriesEnquirer::pullSeriesUsingMoveRetrieveMethod(InstanceUIDContainer _instanceUIDContainer)
 {
     // Reset instance count.
-    m_instanceIndex = 0;
+    *m_instanceIndex           = 0;
+    m_associationInstanceCount = 0;
 
-    DcmDataset dataset;
-    OFCondition result;
+    for(const std::string& seriesInstanceUID : _instanceUIDContainer)
+    {
+        this->pullSeries(seriesInstanceUID, RetrieveMethod::MOVE);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SeriesEnquirer::pullSeriesUsingGetRetrieveMethod(InstanceUIDContainer _instanceUIDContainer)
+{
+    // Reset instance count.
+    *m_instanceIndex           = 0;
+    m_associationInstanceCount = 0;
 
-    for(std::string seriesInstanceUID : _instanceUIDContainer)
+    for(const std::string& seriesInstanceUID : _instanceUIDContainer)
     {
-        dataset.putAndInsertOFStringArray(DCM_QueryRetrieveLevel, "SERIES");
-        dataset.putAndInsertOFStringArray(DCM_SeriesInstanceUID, seriesInstanceUID.c_str());
+        this->pullSeries(seriesInstanceUID, RetrieveMethod::GET);
+    }
+}
 
-        // Fetches all images of this particular study.
-        result = this->sendMoveRequest(dataset);
+//------------------------------------------------------------------------------
 
-        if(result.good())
-        {
-        }
-        else
-        {
-            const std::string msg = "Unable to send a C-MOVE request to the server. "
-                                    "(Series instance UID =" + std::string(seriesInstanceUID.c_str()) + ") : "
-                                    + std::string(result.text());
-            throw io::dimse::exceptions::RequestFailure(msg);
-        }
+void SeriesEnquirer::pullSeries(const std::string& _seriesInstanceUID, RetrieveMethod _method)
+{
+    DcmDataset dataset;
+    dataset.putAndInsertOFStringArray(DCM_QueryRetrieveLevel, "SERIES");
+    dataset.putAndInsertOFStringArray(DCM_SeriesInstanceUID, _seriesInstanceUID.c_str());
+
+    // Fetches all images of this particular study.
+    const bool move          = _method == RetrieveMethod::MOVE;
+    const OFCondition result = move ? this->sendMoveRequest(dataset) : this->sendGetRequest(dataset);
+
+    if(result.bad())
+    {
+        const std::string msg = "Unable to send a " + std::string(move ? "C-MOVE" : "C-GET")
+                                + " request to the server. "
+                                  "(Series instance UID =" + _seriesInstanceUID + ") : "
+                                + std::string(result.text());
+        throw io::dimse::exceptions::RequestFailure(msg);
     }
 }
 
 //------------------------------------------------------------------------------
 
-void SeriesEnquirer::pullSeriesUsingGetRetrieveMethod(InstanceUIDContainer _instanceUIDContainer)
+void SeriesEnquirer::pullSeriesConcurrently(
+    InstanceUIDContainer _instanceUIDContainer,
+    std::size_t _associationCount,
+    RetrieveMethod _method
+)
 {
+    SIGHT_ASSERT("At least one association is required", _associationCount > 0);
+
     // Reset instance count.
-    m_instanceIndex = 0;
+    *m_instanceIndex           = 0;
+    m_associationInstanceCount = 0;
 
-    DcmDataset dataset;
-    OFCondition result;
+    // Index of the next series to pull, shared by the associations.
+    std::atomic<std::size_t> nextSeries(0);
+
+    // There is no need for more associations than series.
+    std::size_t associationCount = std::min(_associationCount, _instanceUIDContainer.size());
+
+    // The move destination accepts one association at a time, more associations would wait for it.
+    if(_method == RetrieveMethod::MOVE && associationCount > 1)
+    {
+        SIGHT_WARN("C-MOVE requests are sent on a single association, the move destination accepts only one.");
+        associationCount = 1;
+    }
 
-    for(std::string seriesInstanceUID : _instanceUIDContainer)
+    const auto pull =
+        [&](SeriesEnquirer& _enquirer)
+        {
+            try
+            {
+                for(std::size_t i = nextSeries++ ; i < _instanceUIDContainer.size() ; i = nextSeries++)
+                {
+                    _enquirer.pullSeries(_instanceUIDContainer[i], _method);
+                }
+            }
+            catch(...)
+            {
+                // Stop the other associations.
+                nextSeries = _instanceUIDContainer.size();
+                throw;
+            }
+        };
+
+    // Open the other associations.
+    std::vector<std::future<void> > results;
+    for(std::size_t association = 1 ; association < associationCount ; ++association)
     {
-        dataset.putAndInsertOFStringArray(DCM_QueryRetrieveLevel, "SERIES");
-        dataset.putAndInsertOFStringArray(DCM_SeriesInstanceUID, seriesInstanceUID.c_str());
+        results.push_back(
+            std::async(
+                std::launch::async,
+                [&, association]
+            {
+                SeriesEnquirer::sptr enquirer = SeriesEnquirer::New();
+                enquirer->initialize(
+                    this->getAETitle().c_str(),
+                    this->getPeerHostName().c_str(),
+                    this->getPeerPort(),
+                    this->getPeerAETitle().c_str(),
+                    m_moveApplicationTitle,
+                    m_progressCallback
+                );
+                enquirer->m_path                        = m_path;
+                enquirer->m_instanceIndex               = m_instanceIndex;
+                enquirer->m_associationProgressCallback = m_associationProgressCallback;
+                enquirer->m_association                 = association;
+
+                enquirer->connect();
+                try
+                {
+                    pull(*enquirer);
+                }
+                catch(...)
+                {
+                    // Release the association before reporting the error.
+                    enquirer->disconnect();
+                    throw;
+                }
+
+                enquirer->disconnect();
+            })
+        );
+    }
 
-        // Fetches all images of this particular study.
-        result = this->sendGetRequest(dataset);
+    // This association pulls series too.
+    std::exception_ptr error;
+    try
+    {
+        pull(*this);
+    }
+    catch(...)
+    {
+        error = std::current_exception();
+    }
 
-        if(result.good())
+    // Wait for all the associations, the first error is thrown.
+    for(std::future<void>& result : results)
+    {
+        try
         {
+            result.get();
         }
-        else
+        catch(...)
         {
-            const std::string msg = "Unable to send a C-GET request to the server. "
-                                    "(Series instance UID =" + std::string(seriesInstanceUID.c_str()) + ") : "
-                                    + std::string(result.text());
-            throw io::dimse::exceptions::RequestFailure(msg);
+            if(!error)
+            {
+                error = std::current_exception();
+            }
         }
     }
+
+    if(error)
+    {
+        std::rethrow_exception(error);
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -834,7 +952,8 @@ void SeriesEnquirer::pullInstanceUsingMoveRetrieveMethod(
 )
 {
     // Reset instance count.
-    m_instanceIndex = 0;
+    *m_instanceIndex           = 0;
+    m_associationInstanceCount = 0;
 
     DcmDataset dataset;
     OFCondition result;
@@ -867,7 +986,8 @@ void SeriesEnquirer::pullInstanceUsingGetRetrieveMethod(
 )
 {
     // Reset instance count.
-    m_instanceIndex = 0;
+    *m_instanceIndex           = 0;
+    m_associationInstanceCount = 0;
 
     DcmDataset dataset;
     OFCondition result;
@@ -897,7 +1017,8 @@ void SeriesEnquirer::pullInstanceUsingGetRetrieveMethod(
 void SeriesEnquirer::pushSeries(const InstancePathContainer& _pathContainer)
 {
     // Reset instance count.
-    m_instanceIndex = 0;
+    *m_instanceIndex           = 0;
+    m_associationInstanceCount = 0;
 
     OFCondition result;
 
@@ -918,7 +1039,7 @@ void SeriesEnquirer::pushSeries(const InstancePathContainer& _pathContainer)
         // Notify callback.
         if(m_progressCallback)
         {
-            m_progressCallback->asyncRun("", ++m_instanceIndex, path.string());
+            m_progressCallback->asyncRun("", ++(*m_instanceIndex), path.string());
         }
     }
 }
@@ -928,7 +1049,8 @@ void SeriesEnquirer::pushSeries(const InstancePathContainer& _pathContainer)
 void SeriesEnquirer::pushSeries(const DatasetContainer& _datasetContainer)
 {
     // Reset instance count.
-    m_instanceIndex = 0;
+    *m_instanceIndex           = 0;
+    m_associationInstanceCount = 0;
     OFCondition result;
 
     // Send images to pacs.
@@ -948,7 +1070,7 @@ void SeriesEnquirer::pushSeries(const DatasetContainer& _datasetContainer)
         // Notify callback.
         if(m_progressCallback)
         {
-            m_progressCallback->asyncRun("", ++m_instanceIndex, "");
+            m_progressCallback->asyncRun("", ++(*m_instanceIndex), "");
         }
     }
 }
@@ -1025,7 +1147,18 @@ OFCondition SeriesEnquirer::handleSTORERequest(
         // Notify callback.
         if(m_progressCallback)
         {
-            m_progressCallback->asyncRun(seriesID.c_str(), ++m_instanceIndex, filePath);
+            m_progressCallback->asyncRun(seriesID.c_str(), ++(*m_instanceIndex), filePath);
+        }
+
+        ++m_associationInstanceCount;
+        if(m_associationProgressCallback)
+        {
+            m_associationProgressCallback->asyncRun(
+                m_association,
+                seriesID.c_str(),
+                m_associationInstanceCount,
+                filePath
+            );
         }
     }
 
@@ -32,7 +32,9 @@
 #include <dcmtk/config/osconfig.h>
 #include <dcmtk/dcmnet/scu.h>
 
+#include <atomic>
 #include <filesystem>
+#include <memory>
 
 namespace sight::io::dimse
 {
@@ -75,12 +77,23 @@ public:
 
     typedef core::com::Slot<void (const std::string&, unsigned int, const std::string&)> ProgressCallbackSlotType;
 
+    /// Progress of one association: association index, series UID, instances received by the association, file path
+    typedef core::com::Slot<void (std::size_t, const std::string&, unsigned int, const std::string&)>
+        AssociationProgressCallbackSlotType;
+
     typedef std::vector<std::string> InstanceUIDContainer;
 
     typedef std::vector<std::filesystem::path> InstancePathContainer;
 
     typedef std::vector<CSPTR(DcmDataset)> DatasetContainer;
 
+    /// Defines the DICOM retrieve methods.
+    enum class RetrieveMethod
+    {
+        MOVE,
+        GET
+    };
+
     /// Initializes memnbers.
     IO_DIMSE_API SeriesEnquirer();
 
@@ -106,6 +119,18 @@ public:
         ProgressCallbackSlotType::sptr _progressCallback = ProgressCallbackSlotType::sptr()
     );
 
+    /**
+     * @brief Sets the callback notified of the instances received by each association.
+     *
+     * Unlike the progress callback, which counts the instances of all the associations, this callback receives the
+     * index of the association, 0 being this enquirer, and the number of instances received by this association only.
+     *
+     * @param _associationProgressCallback The association progress callback.
+     */
+    IO_DIMSE_API void setAssociationProgressCallback(
+        AssociationProgressCallbackSlotType::sptr _associationProgressCallback
+    );
+
     /// Initializes the network and negotiates association.
     IO_DIMSE_API bool connect();
 
@@ -190,6 +215,29 @@ public:
      */
     IO_DIMSE_API void pullSeriesUsingGetRetrieveMethod(InstanceUIDContainer _instanceUIDContainer);
 
+    /**
+     * @brief Pulls series concurrently on several associations.
+     *
+     * The association of this enquirer pulls series, along with _associationCount - 1 other enquirers initialized
+     * like this one, each one on its own association and thread. Each association takes the next series to pull
+     * until all of them are pulled. The received instances are written in the same folder, the progress
+     * callback counts the instances of all the associations and the association progress callback counts the
+     * instances of each association.
+     *
+     * With C-MOVE requests, the instances are sent by the PACS to the move destination, a SeriesRetriever which
+     * accepts one association at a time. Thus C-MOVE requests always use a single association.
+     *
+     * @param _instanceUIDContainer The series instance UID container.
+     * @param _associationCount The number of associations pulling series at the same time.
+     * @param _method The retrieve method.
+     * @pre This enquirer must be connected.
+     */
+    IO_DIMSE_API void pullSeriesConcurrently(
+        InstanceUIDContainer _instanceUIDContainer,
+        std::size_t _associationCount,
+        RetrieveMethod _method = RetrieveMethod::GET
+    );
+
     /**
      * @brief Pulls instance using C-MOVE requests.
      * @param _seriesInstanceUID The series instance UID.
@@ -295,6 +343,13 @@ protected:
 
 private:
 
+    /**
+     * @brief Pulls a series without resetting the instance count.
+     * @param _seriesInstanceUID The series instance UID.
+     * @param _method The retrieve method.
+     */
+    void pullSeries(const std::string& _seriesInstanceUID, RetrieveMethod _method);
+
     /// Defines the MOVE destination AE Title.
     std::string m_moveApplicationTitle;
 
@@ -304,8 +359,17 @@ private:
     /// Contains the progress callback slot.
     ProgressCallbackSlotType::sptr m_progressCallback;
 
-    /// Sets the dowloaded instance index.
-    unsigned int m_instanceIndex {0};
+    /// Sets the dowloaded instance index, shared by the enquirers pulling series concurrently.
+    std::shared_ptr<std::atomic<unsigned int> > m_instanceIndex;
+
+    /// Contains the association progress callback slot.
+    AssociationProgressCallbackSlotType::sptr m_associationProgressCallback;
+
+    /// Defines the index of the association of this enquirer when pulling series concurrently.
+    std::size_t m_association {0};
+
+    /// Sets the number of instances received by the association of this enquirer.
+    unsigned int m_associationInstanceCount {0};
 };
 
 } // namespace sight::io::dimse.
@@ -0,0 +1,382 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "SeriesEnquirerConcurrentTest.hpp"
+
+#include <core/com/Slot.hpp>
+#include <core/com/Slot.hxx>
+#include <core/thread/Worker.hpp>
+#include <core/tools/System.hpp>
+
+#include <io/dimse/SeriesEnquirer.hpp>
+
+#include <dcmtk/config/osconfig.h>
+#include <dcmtk/dcmdata/dcdeftag.h>
+#include <dcmtk/dcmdata/dcuid.h>
+#include <dcmtk/dcmnet/scppool.h>
+#include <dcmtk/ofstd/ofstd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <mutex>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(::sight::io::dimse::ut::SeriesEnquirerConcurrentTest);
+
+namespace sight::io::dimse
+{
+
+namespace ut
+{
+
+//------------------------------------------------------------------------------
+
+static const std::string s_STAND_IN_TITLE  = "STANDIN";
+static const unsigned short s_STAND_IN_PORT = 11120;
+static const Uint16 s_INSTANCE_COUNT        = 5;
+
+// Number of C-GET requests received and being processed by the stand-in, and whether two of them were processed at
+// the same time
+static std::mutex s_getMutex;
+static std::condition_variable s_getCondition;
+static std::size_t s_getCount       = 0;
+static std::size_t s_activeGetCount = 0;
+static bool s_concurrentGets        = false;
+
+//------------------------------------------------------------------------------
+
+static std::string instanceUID(const std::string& _seriesUID, Uint16 _index)
+{
+    return _seriesUID + "." + std::to_string(_index + 1);
+}
+
+/**
+ * @brief C-GET SCP standing in for a PACS, it sends generated secondary capture instances.
+ *
+ * The stand-in runs in a pool, each association is handled by its own instance in its own thread.
+ */
+class GetStandIn : public DcmThreadSCP
+{
+protected:
+
+    //------------------------------------------------------------------------------
+
+    OFCondition handleIncomingCommand(
+        T_DIMSE_Message* _message,
+        const DcmPresentationContextInfo& _presentationContext
+    ) override
+    {
+        if(_message->CommandField != DIMSE_C_GET_RQ)
+        {
+            return DcmThreadSCP::handleIncomingCommand(_message, _presentationContext);
+        }
+
+        const T_DIMSE_C_GetRQ request = _message->msg.CGetRQ;
+
+        // Read the requested series
+        T_ASC_PresentationContextID presID = _presentationContext.presentationContextID;
+        DcmDataset* identifier             = nullptr;
+        OFCondition result                 = this->receiveDIMSEDataset(&presID, &identifier);
+        if(result.bad())
+        {
+            return result;
+        }
+
+        OFString seriesUID;
+        identifier->findAndGetOFString(DCM_SeriesInstanceUID, seriesUID);
+        delete identifier;
+
+        // The first request waits for a second one, which only comes if the associations pull concurrently
+        {
+            std::unique_lock<std::mutex> lock(s_getMutex);
+            ++s_getCount;
+            s_concurrentGets = s_concurrentGets || ++s_activeGetCount >= 2;
+            s_getCondition.notify_all();
+            s_getCondition.wait_for(lock, std::chrono::seconds(10), []{return s_concurrentGets;});
+        }
+
+        // Send the instances with C-STORE sub-operations on the same association
+        const T_ASC_PresentationContextID storePresID = this->findStoragePresentationContext();
+        Uint16 completed                              = 0;
+        for(Uint16 i = 0 ; i < s_INSTANCE_COUNT && storePresID != 0 ; ++i)
+        {
+            const std::string sopInstanceUID = instanceUID(seriesUID.c_str(), i);
+
+            DcmDataset dataset;
+            dataset.putAndInsertOFStringArray(DCM_SOPClassUID, UID_SecondaryCaptureImageStorage);
+            dataset.putAndInsertOFStringArray(DCM_SOPInstanceUID, sopInstanceUID.c_str());
+            dataset.putAndInsertOFStringArray(DCM_StudyInstanceUID, "1.2.826.0.1.3680043.2.1143.1");
+            dataset.putAndInsertOFStringArray(DCM_SeriesInstanceUID, seriesUID);
+            dataset.putAndInsertOFStringArray(DCM_PatientName, "Stand^In");
+            dataset.putAndInsertOFStringArray(DCM_Modality, "OT");
+
+            T_DIMSE_Message store;
+            std::memset(&store, 0, sizeof(store));
+            store.CommandField = DIMSE_C_STORE_RQ;
+
+            T_DIMSE_C_StoreRQ& storeRequest = store.msg.CStoreRQ;
+            storeRequest.MessageID   = ++m_messageID;
+            storeRequest.DataSetType = DIMSE_DATASET_PRESENT;
+            storeRequest.Priority    = DIMSE_PRIORITY_MEDIUM;
+            OFStandard::strlcpy(
+                storeRequest.AffectedSOPClassUID,
+                UID_SecondaryCaptureImageStorage,
+                sizeof(storeRequest.AffectedSOPClassUID)
+            );
+            OFStandard::strlcpy(
+                storeRequest.AffectedSOPInstanceUID,
+                sopInstanceUID.c_str(),
+                sizeof(storeRequest.AffectedSOPInstanceUID)
+            );
+
+            result = this->sendDIMSEMessage(storePresID, &store, &dataset);
+            if(result.bad())
+            {
+                return result;
+            }
+
+            T_DIMSE_Message storeResponse;
+            T_ASC_PresentationContextID storeResponsePresID = storePresID;
+            DcmDataset* statusDetail                        = nullptr;
+            result = this->receiveDIMSECommand(&storeResponsePresID, &storeResponse, &statusDetail);
+            delete statusDetail;
+            if(result.bad())
+            {
+                return result;
+            }
+
+            if(storeResponse.CommandField == DIMSE_C_STORE_RSP
+               && storeResponse.msg.CStoreRSP.DimseStatus == STATUS_Success)
+            {
+                ++completed;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(s_getMutex);
+            --s_activeGetCount;
+        }
+
+        // Send the final C-GET response
+        T_DIMSE_Message message;
+        std::memset(&message, 0, sizeof(message));
+        message.CommandField = DIMSE_C_GET_RSP;
+
+        T_DIMSE_C_GetRSP& response = message.msg.CGetRSP;
+        response.MessageIDBeingRespondedTo      = request.MessageID;
+        response.DataSetType                    = DIMSE_DATASET_NULL;
+        response.DimseStatus                    = completed == s_INSTANCE_COUNT
+                                                  ? STATUS_Success
+                                                  : STATUS_GET_Warning_SubOperationsCompleteOneOrMoreFailures;
+        response.NumberOfCompletedSubOperations = completed;
+        response.NumberOfFailedSubOperations    = Uint16(s_INSTANCE_COUNT - completed);
+        response.NumberOfWarningSubOperations   = 0;
+        response.opts                           = O_GET_AFFECTEDSOPCLASSUID
+                                                  | O_GET_NUMBEROFCOMPLETEDSUBOPERATIONS
+                                                  | O_GET_NUMBEROFFAILEDSUBOPERATIONS
+                                                  | O_GET_NUMBEROFWARNINGSUBOPERATIONS;
+        OFStandard::strlcpy(
+            response.AffectedSOPClassUID,
+            request.AffectedSOPClassUID,
+            sizeof(response.AffectedSOPClassUID)
+        );
+
+        return this->sendDIMSEMessage(presID, &message, nullptr);
+    }
+
+private:
+
+    //------------------------------------------------------------------------------
+
+    T_ASC_PresentationContextID findStoragePresentationContext()
+    {
+        // Presentation context IDs are odd numbers
+        for(unsigned int presID = 1 ; presID < 256 ; presID += 2)
+        {
+            OFString abstractSyntax;
+            OFString transferSyntax;
+            this->findPresentationContext(T_ASC_PresentationContextID(presID), abstractSyntax, transferSyntax);
+            if(abstractSyntax == UID_SecondaryCaptureImageStorage)
+            {
+                return T_ASC_PresentationContextID(presID);
+            }
+        }
+
+        return 0;
+    }
+
+    Uint16 m_messageID {0};
+};
+
+/// Runs the pool of stand-in SCPs in a worker until it is destroyed.
+class StandInPool
+{
+public:
+
+    StandInPool()
+    {
+        OFList<OFString> transferSyntaxes;
+        transferSyntaxes.push_back(UID_LittleEndianExplicitTransferSyntax);
+        transferSyntaxes.push_back(UID_LittleEndianImplicitTransferSyntax);
+
+        DcmSCPConfig& config = m_pool.getConfig();
+        config.setAETitle(s_STAND_IN_TITLE.c_str());
+        config.setPort(s_STAND_IN_PORT);
+        config.setConnectionBlockingMode(DUL_NOBLOCK);
+        config.setConnectionTimeout(1);
+        config.addPresentationContext(UID_VerificationSOPClass, transferSyntaxes);
+        config.addPresentationContext(UID_GETStudyRootQueryRetrieveInformationModel, transferSyntaxes);
+
+        // The enquirer is the storage SCP of the C-STORE sub-operations
+        config.addPresentationContext(UID_SecondaryCaptureImageStorage, transferSyntaxes, ASC_SC_ROLE_SCP);
+
+        m_pool.setMaxThreads(4);
+        m_worker->post([this]{m_pool.listen();});
+    }
+
+    ~StandInPool()
+    {
+        m_pool.stopAfterCurrentAssociations();
+        m_worker->stop();
+    }
+
+private:
+
+    DcmSCPPool<GetStandIn> m_pool;
+    core::thread::Worker::sptr m_worker {core::thread::Worker::New()};
+};
+
+//------------------------------------------------------------------------------
+
+void SeriesEnquirerConcurrentTest::setUp()
+{
+    // Set up context before running a test.
+    m_seriesUIDs.clear();
+    for(int i = 1 ; i <= 4 ; ++i)
+    {
+        m_seriesUIDs.push_back("1.2.826.0.1.3680043.2.1143.1." + std::to_string(i));
+    }
+
+    std::lock_guard<std::mutex> lock(s_getMutex);
+    s_getCount       = 0;
+    s_activeGetCount = 0;
+    s_concurrentGets = false;
+}
+
+//------------------------------------------------------------------------------
+
+void SeriesEnquirerConcurrentTest::tearDown()
+{
+    // Clean up after the test run.
+    const std::filesystem::path path = core::tools::System::getTemporaryFolder() / "dicom";
+    for(const std::string& seriesUID : m_seriesUIDs)
+    {
+        std::filesystem::remove_all(path / seriesUID);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SeriesEnquirerConcurrentTest::pullSeriesConcurrently()
+{
+    StandInPool standIn;
+
+    // Progress of all the associations and of each association
+    std::mutex mutex;
+    unsigned int instanceCount = 0;
+    std::map<std::size_t, unsigned int> associationInstanceCounts;
+
+    std::function<void(const std::string&, unsigned int, const std::string&)> progress =
+        [&](const std::string&, unsigned int _index, const std::string&)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            instanceCount = std::max(instanceCount, _index);
+        };
+    std::function<void(std::size_t, const std::string&, unsigned int, const std::string&)> associationProgress =
+        [&](std::size_t _association, const std::string&, unsigned int _index, const std::string&)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            associationInstanceCounts[_association] = std::max(associationInstanceCounts[_association], _index);
+        };
+
+    core::thread::Worker::sptr worker = core::thread::Worker::New();
+    auto progressSlot                 = core::com::newSlot(progress);
+    auto associationProgressSlot      = core::com::newSlot(associationProgress);
+    progressSlot->setWorker(worker);
+    associationProgressSlot->setWorker(worker);
+
+    io::dimse::SeriesEnquirer::sptr enquirer = io::dimse::SeriesEnquirer::New();
+    enquirer->initialize("SeriesEnquirerTest", "localhost", s_STAND_IN_PORT, s_STAND_IN_TITLE, "", progressSlot);
+    enquirer->setAssociationProgressCallback(associationProgressSlot);
+    CPPUNIT_ASSERT(enquirer->connect());
+    CPPUNIT_ASSERT(enquirer->pingPacs());
+
+    CPPUNIT_ASSERT_NO_THROW(
+        enquirer->pullSeriesConcurrently(m_seriesUIDs, 3, io::dimse::SeriesEnquirer::RetrieveMethod::GET)
+    );
+    enquirer->disconnect();
+
+    // The progress callbacks are run asynchronously, wait for them
+    worker->postTask<void>(std::function<void()>([]{})).wait();
+    worker->stop();
+
+    // Two series were pulled at the same time
+    {
+        std::lock_guard<std::mutex> lock(s_getMutex);
+        CPPUNIT_ASSERT_EQUAL(m_seriesUIDs.size(), s_getCount);
+        CPPUNIT_ASSERT(s_concurrentGets);
+    }
+
+    // Each instance is written in the folder of its series
+    const std::filesystem::path path = core::tools::System::getTemporaryFolder() / "dicom";
+    for(const std::string& seriesUID : m_seriesUIDs)
+    {
+        for(Uint16 i = 0 ; i < s_INSTANCE_COUNT ; ++i)
+        {
+            const std::filesystem::path file = path / seriesUID / instanceUID(seriesUID, i);
+            CPPUNIT_ASSERT_MESSAGE("'" + file.string() + "' was not pulled", std::filesystem::exists(file));
+        }
+    }
+
+    // The global progress counts all the instances, the association progress splits them between the associations
+    const unsigned int total = static_cast<unsigned int>(m_seriesUIDs.size()) * s_INSTANCE_COUNT;
+    CPPUNIT_ASSERT_EQUAL(total, instanceCount);
+
+    unsigned int associationTotal = 0;
+    for(const auto& association : associationInstanceCounts)
+    {
+        CPPUNIT_ASSERT(association.first < 3);
+        associationTotal += association.second;
+    }
+
+    CPPUNIT_ASSERT(associationInstanceCounts.size() >= 2);
+    CPPUNIT_ASSERT_EQUAL(total, associationTotal);
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace ut
+
+} // namespace sight::io::dimse
@@ -0,0 +1,64 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <string>
+#include <vector>
+
+namespace sight::io::dimse
+{
+
+namespace ut
+{
+
+/**
+ * @brief Tests SeriesEnquirer::pullSeriesConcurrently() against a local C-GET SCP standing in for a PACS.
+ */
+class SeriesEnquirerConcurrentTest : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(SeriesEnquirerConcurrentTest);
+CPPUNIT_TEST(pullSeriesConcurrently);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // Interface
+    // Sets the series served by the stand-in SCP
+    void setUp();
+    // Removes the pulled series
+    void tearDown();
+
+    // Test functions
+    // Pulls several series on several associations with C-GET requests
+    void pullSeriesConcurrently();
+
+private:
+
+    // Series instance UIDs served by the stand-in SCP
+    std::vector<std::string> m_seriesUIDs;
+};
+
+} // namespace ut
+
+} // namespace sight::io::dimse
@@ -31,11 +31,17 @@
 #include <QtNetwork>
 
 #include <filesystem>
+#include <type_traits>
 
 namespace sight::io::http
 {
 
-ClientQt::ClientQt()
+//-----------------------------------------------------------------------------
+
+ClientQt::ClientQt() :
+    m_manager(nullptr),
+    m_running(0),
+    m_maxConcurrentRequests(6)
 {
 }
 
@@ -43,79 +49,210 @@ ClientQt::ClientQt()
 
 ClientQt::~ClientQt()
 {
+    if(m_manager != nullptr)
+    {
+        // The manager and its pending replies are deleted when the thread finishes
+        m_thread.quit();
+        m_thread.wait();
+    }
 }
 
 //-----------------------------------------------------------------------------
 
-QByteArray ClientQt::get(Request::sptr request)
+QNetworkAccessManager* ClientQt::getManager()
 {
-    QNetworkAccessManager networkManager;
-    const QUrl qtUrl(QString::fromStdString(request->getUrl()));
-    QNetworkRequest qtRequest(qtUrl);
+    std::lock_guard<std::mutex> lock(m_managerMutex);
+    if(m_manager == nullptr)
+    {
+        m_manager = new QNetworkAccessManager();
+        m_manager->moveToThread(&m_thread);
+        QObject::connect(&m_thread, &QThread::finished, m_manager, &QObject::deleteLater);
+        m_thread.start();
+    }
 
-    this->computeHeaders(qtRequest, request->getHeaders());
+    return m_manager;
+}
 
-    QNetworkReply* reply = networkManager.get(qtRequest);
-    QEventLoop loop;
-    QObject::connect(reply, &QNetworkReply::finished, &loop, &QEventLoop::quit);
-    QObject::connect(
-        reply,
-        QOverload<QNetworkReply::NetworkError>::of(
-            &QNetworkReply::error
-        ),
-        this,
-        &ClientQt::processError
+//-----------------------------------------------------------------------------
+
+template<typename T>
+std::future<T> ClientQt::send(
+    Operation operation,
+    Request::sptr request,
+    const QByteArray& body,
+    SinkType sink,
+    std::function<T(QNetworkReply*)> result
+)
+{
+    auto promise          = std::make_shared<std::promise<T> >();
+    std::future<T> future = promise->get_future();
+
+    std::function<void(QNetworkReply*)> finished =
+        [this, operation, promise, result](QNetworkReply* reply)
+        {
+            try
+            {
+                // HEAD requests return the headers whatever the status
+                if(operation != Operation::HEAD && reply->error() != QNetworkReply::NoError)
+                {
+                    this->processError(reply->error());
+                }
+
+                if constexpr(std::is_void<T>::value)
+                {
+                    result(reply);
+                    promise->set_value();
+                }
+                else
+                {
+                    promise->set_value(result(reply));
+                }
+            }
+            catch(...)
+            {
+                promise->set_exception(std::current_exception());
+            }
+        };
+
+    QNetworkAccessManager* manager = this->getManager();
+    QMetaObject::invokeMethod(
+        manager,
+        [this, operation, request, body, sink, finished]
+        {
+            m_pending.push_back(std::bind(&ClientQt::start, this, operation, request, body, sink, finished));
+            this->startPending();
+        },
+        Qt::QueuedConnection
     );
 
-    loop.exec();
-    QByteArray data = reply->readAll();
-    reply->deleteLater();
-    return data;
+    return future;
 }
 
 //-----------------------------------------------------------------------------
 
-std::string ClientQt::getFile(Request::sptr request)
+void ClientQt::start(
+    Operation operation,
+    Request::sptr request,
+    const QByteArray& body,
+    SinkType sink,
+    std::function<void(QNetworkReply*)> finished
+)
 {
-    QNetworkAccessManager networkManager;
     const QUrl qtUrl(QString::fromStdString(request->getUrl()));
     QNetworkRequest qtRequest(qtUrl);
 
+    if(operation == Operation::POST)
+    {
+        qtRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+    }
+
     this->computeHeaders(qtRequest, request->getHeaders());
 
-    QNetworkReply* reply = networkManager.get(qtRequest);
-    QEventLoop loop;
-    QObject::connect(reply, &QNetworkReply::finished, &loop, &QEventLoop::quit);
+    QNetworkReply* reply = nullptr;
+    switch(operation)
+    {
+        case Operation::GET:
+            reply = m_manager->get(qtRequest);
+            break;
+
+        case Operation::HEAD:
+            reply = m_manager->head(qtRequest);
+            break;
+
+        case Operation::POST:
+            reply = m_manager->post(qtRequest, body);
+            break;
+    }
+
+    ++m_running;
+
+    if(sink)
+    {
+        QObject::connect(reply, &QNetworkReply::readyRead, m_manager, [reply, sink]{sink(reply->readAll());});
+    }
+
     QObject::connect(
         reply,
-        QOverload<QNetworkReply::NetworkError>::of(
-            &QNetworkReply::error
-        ),
-        this,
-        &ClientQt::processError
-    );
+        &QNetworkReply::finished,
+        m_manager,
+        [this, reply, sink, finished]
+        {
+            if(sink && reply->bytesAvailable() > 0)
+            {
+                sink(reply->readAll());
+            }
+
+            finished(reply);
+            reply->deleteLater();
+
+            --m_running;
+            this->startPending();
+        });
+}
+
+//-----------------------------------------------------------------------------
+
+void ClientQt::startPending()
+{
+    while(!m_pending.empty() && m_running < m_maxConcurrentRequests)
+    {
+        const std::function<void()> request = m_pending.front();
+        m_pending.pop_front();
+        request();
+    }
+}
+
+//-----------------------------------------------------------------------------
 
+QByteArray ClientQt::get(Request::sptr request)
+{
+    std::future<QByteArray> future = this->getAsync(request);
+    return waitFor(future);
+}
+
+//-----------------------------------------------------------------------------
+
+std::future<QByteArray> ClientQt::getAsync(Request::sptr request)
+{
+    return this->send<QByteArray>(
+        Operation::GET,
+        request,
+        QByteArray(),
+        nullptr,
+        [](QNetworkReply* reply){return reply->readAll();});
+}
+
+//-----------------------------------------------------------------------------
+
+std::future<void> ClientQt::getAsync(Request::sptr request, SinkType sink)
+{
+    return this->send<void>(Operation::GET, request, QByteArray(), sink, [](QNetworkReply*){});
+}
+
+//-----------------------------------------------------------------------------
+
+std::string ClientQt::getFile(Request::sptr request)
+{
     std::filesystem::path folderPath = core::tools::System::getTemporaryFolder();
     std::filesystem::path filePath   = folderPath / core::tools::UUID::generateUUID();
 
-    QFile file(filePath.string().c_str());
+    auto file = std::make_shared<QFile>(filePath.string().c_str());
 
-    while(file.exists())
+    while(file->exists())
     {
         filePath = folderPath / core::tools::UUID::generateUUID();
-        file.setFileName(filePath.string().c_str());
+        file->setFileName(filePath.string().c_str());
     }
 
-    if(!file.open(QIODevice::WriteOnly))
+    if(!file->open(QIODevice::WriteOnly))
     {
         throw("Could not create a temporary file");
     }
 
-    QObject::connect(reply, &QNetworkReply::readyRead, [&]{file.write(reply->readAll());});
-
-    loop.exec();
-    file.write(reply->readAll());
-    reply->deleteLater();
+    // The response is written while it is received
+    std::future<void> future = this->getAsync(request, [file](const QByteArray& data){file->write(data);});
+    waitFor(future);
+    file->close();
 
     return filePath.string();
 }
@@ -152,29 +289,20 @@ void ClientQt::processError(QNetworkReply::NetworkError errorCode)
 
 QByteArray ClientQt::post(Request::sptr request, const QByteArray& body)
 {
-    QNetworkAccessManager networkManager;
-    const QUrl qtUrl(QString::fromStdString(request->getUrl()));
-    QNetworkRequest qtRequest(qtUrl);
-
-    qtRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+    std::future<QByteArray> future = this->postAsync(request, body);
+    return waitFor(future);
+}
 
-    this->computeHeaders(qtRequest, request->getHeaders());
+//-----------------------------------------------------------------------------
 
-    QNetworkReply* reply = networkManager.post(qtRequest, body);
-    QEventLoop loop;
-    QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
-    QObject::connect(
-        reply,
-        QOverload<QNetworkReply::NetworkError>::of(
-            &QNetworkReply::error
-        ),
-        this,
-        &ClientQt::processError
-    );
-    loop.exec();
-    QByteArray data = reply->readAll();
-    reply->deleteLater();
-    return data;
+std::future<QByteArray> ClientQt::postAsync(Request::sptr request, const QByteArray& body)
+{
+    return this->send<QByteArray>(
+        Operation::POST,
+        request,
+        body,
+        nullptr,
+        [](QNetworkReply* reply){return reply->readAll();});
 }
 
 //-----------------------------------------------------------------------------
@@ -192,30 +320,50 @@ void ClientQt::computeHeaders(QNetworkRequest& request, const Request::HeadersTy
 
 Request::HeadersType ClientQt::head(Request::sptr request)
 {
-    QNetworkAccessManager networkManager;
-    Request::HeadersType headers;
+    std::future<Request::HeadersType> future = this->headAsync(request);
+    return waitFor(future);
+}
 
-    const QUrl qtUrl(QString::fromStdString(request->getUrl()));
-    QNetworkRequest qtRequest(qtUrl);
+//-----------------------------------------------------------------------------
 
-    this->computeHeaders(qtRequest, request->getHeaders());
+std::future<Request::HeadersType> ClientQt::headAsync(Request::sptr request)
+{
+    return this->send<Request::HeadersType>(
+        Operation::HEAD,
+        request,
+        QByteArray(),
+        nullptr,
+        [](QNetworkReply* reply)
+        {
+            Request::HeadersType headers;
+            const QList<QNetworkReply::RawHeaderPair>& rawHeaders = reply->rawHeaderPairs();
+
+            QList<QNetworkReply::RawHeaderPair>::const_iterator cIt = rawHeaders.begin();
+
+            for( ; cIt != rawHeaders.end() ; ++cIt)
+            {
+                headers[cIt->first.data()] = cIt->second.data();
+            }
+
+            return headers;
+        });
+}
 
-    QNetworkReply* reply = networkManager.head(qtRequest);
-    QEventLoop loop;
-    QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
-    loop.exec();
+//-----------------------------------------------------------------------------
 
-    const QList<QNetworkReply::RawHeaderPair>& rawHeaders = reply->rawHeaderPairs();
+void ClientQt::setMaxConcurrentRequests(std::size_t max)
+{
+    SIGHT_ASSERT("At least one request must be allowed", max > 0);
+    m_maxConcurrentRequests = max;
 
-    QList<QNetworkReply::RawHeaderPair>::const_iterator cIt = rawHeaders.begin();
+    QMetaObject::invokeMethod(this->getManager(), [this]{this->startPending();}, Qt::QueuedConnection);
+}
 
-    for( ; cIt != rawHeaders.end() ; ++cIt)
-    {
-        headers[cIt->first.data()] = cIt->second.data();
-    }
+//-----------------------------------------------------------------------------
 
-    reply->deleteLater();
-    return headers;
+std::size_t ClientQt::getMaxConcurrentRequests() const
+{
+    return m_maxConcurrentRequests;
 }
 
 //-----------------------------------------------------------------------------
@@ -28,9 +28,18 @@
 #include "io/http/exceptions/HostNotFound.hpp"
 #include "io/http/Request.hpp"
 
+#include <QCoreApplication>
 #include <QNetworkReply>
+#include <QThread>
 #include <QtNetwork>
 
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+
 namespace sight::io::http
 {
 
@@ -45,6 +54,10 @@ struct HTTPResponse
 
 /**
  * @brief HTTP client using Qt Network.
+ *
+ * The requests are sent from a network thread owning a single QNetworkAccessManager, thus the connections to a host
+ * are kept alive and reused from one request to another. The asynchronous methods allow to have several requests in
+ * flight, up to getMaxConcurrentRequests(), the other ones are queued.
  */
 class IO_HTTP_CLASS_API ClientQt : public QObject
 {
@@ -52,6 +65,9 @@ Q_OBJECT
 
 public:
 
+    /// Function receiving the response body chunk by chunk, called from the network thread.
+    typedef std::function<void (const QByteArray&)> SinkType;
+
     /**
      * Constructor/Destructor
      * @{
@@ -86,6 +102,52 @@ public:
      */
     IO_HTTP_API QByteArray post(Request::sptr request, const QByteArray& body);
 
+    /**
+     * @brief Retrieves data over network without waiting for the response
+     * @param request the request
+     * @return the future response body, or the exception of the failed request
+     */
+    IO_HTTP_API std::future<QByteArray> getAsync(Request::sptr request);
+
+    /**
+     * @brief Retrieves data over network and streams the response body to a sink instead of buffering it
+     * @param request the request
+     * @param sink function receiving the body chunks, called from the network thread
+     * @return the future end of the request, or the exception of the failed request
+     */
+    IO_HTTP_API std::future<void> getAsync(Request::sptr request, SinkType sink);
+
+    /**
+     * @brief Performs head request without waiting for the response
+     * @param request the request
+     * @return the future headers resulting of the request
+     */
+    IO_HTTP_API std::future<Request::HeadersType> headAsync(Request::sptr request);
+
+    /**
+     * @brief Performs POST request without waiting for the response
+     * @param request the request
+     * @param body the body content
+     * @return the future response body, or the exception of the failed request
+     */
+    IO_HTTP_API std::future<QByteArray> postAsync(Request::sptr request, const QByteArray& body);
+
+    /// Sets/gets the maximum number of requests in flight, 6 by default like the number of connections per host of Qt
+    IO_HTTP_API void setMaxConcurrentRequests(std::size_t max);
+    IO_HTTP_API std::size_t getMaxConcurrentRequests() const;
+
+    /// Waits for an asynchronous request, the events of the calling thread are still processed meanwhile
+    template<typename T>
+    static T waitFor(std::future<T>& future)
+    {
+        while(future.wait_for(std::chrono::milliseconds(10)) != std::future_status::ready)
+        {
+            QCoreApplication::processEvents();
+        }
+
+        return future.get();
+    }
+
 public Q_SLOTS:
 
     /// Slot triggered when an error occurs.
@@ -93,8 +155,55 @@ public Q_SLOTS:
 
 private:
 
+    enum class Operation
+    {
+        GET,
+        HEAD,
+        POST
+    };
+
+    /// Queues a request in the network thread, the result is computed from the finished reply
+    template<typename T>
+    std::future<T> send(
+        Operation operation,
+        Request::sptr request,
+        const QByteArray& body,
+        SinkType sink,
+        std::function<T(QNetworkReply*)> result
+    );
+
+    /// Sends a request, called in the network thread
+    void start(
+        Operation operation,
+        Request::sptr request,
+        const QByteArray& body,
+        SinkType sink,
+        std::function<void(QNetworkReply*)> finished
+    );
+
+    /// Starts the queued requests while there are less than m_maxConcurrentRequests in flight
+    void startPending();
+
+    /// Returns the network access manager, started with the network thread on first use
+    QNetworkAccessManager* getManager();
+
     /// Set request headers with given values.
     void computeHeaders(QNetworkRequest& request, const Request::HeadersType& headers);
+
+    /// Thread running the network access manager
+    QThread m_thread;
+
+    /// Shared network access manager, keeps the connections alive, belongs to m_thread
+    QNetworkAccessManager* m_manager;
+
+    /// Protects the creation of m_manager
+    std::mutex m_managerMutex;
+
+    /// Requests waiting for a free slot and number of requests in flight, only accessed from m_thread
+    std::deque<std::function<void()> > m_pending;
+    std::size_t m_running;
+
+    std::atomic<std::size_t> m_maxConcurrentRequests;
 };
 
 } // namespace sight::io::http
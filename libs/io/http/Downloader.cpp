@@ -0,0 +1,191 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/http/Downloader.hpp"
+
+#include <core/spyLog.hpp>
+
+#include <QCoreApplication>
+
+#include <algorithm>
+#include <thread>
+
+namespace sight::io::http
+{
+
+/// Maximum exponent of the retry backoff, the delay stops doubling after this number of attempts
+static constexpr unsigned int s_MAX_BACKOFF_SHIFT = 6;
+
+//-----------------------------------------------------------------------------
+
+Downloader::Downloader(ClientQt& client, unsigned int retries, std::chrono::milliseconds retryDelay) :
+    m_client(client),
+    m_retries(retries),
+    m_retryDelay(retryDelay)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+Downloader::~Downloader()
+{
+}
+
+//-----------------------------------------------------------------------------
+
+std::size_t Downloader::add(Request::sptr request, const std::filesystem::path& file)
+{
+    Download download;
+    download.request = request;
+    download.path    = file;
+    this->start(download);
+
+    m_downloads.push_back(std::move(download));
+    return m_downloads.size() - 1;
+}
+
+//-----------------------------------------------------------------------------
+
+void Downloader::start(Download& download)
+{
+    auto file = std::make_shared<QFile>(QString::fromStdString(download.path.string()));
+    download.file = file;
+
+    download.future = m_client.getAsync(
+        download.request,
+        [file](const QByteArray& data)
+        {
+            // Many downloads may be queued, the file descriptors are only used by the requests in flight
+            if(file->isOpen() || file->open(QIODevice::WriteOnly))
+            {
+                file->write(data);
+            }
+        });
+}
+
+//-----------------------------------------------------------------------------
+
+void Downloader::wait(std::size_t index)
+{
+    SIGHT_ASSERT("Download " << index << " does not exist", index < m_downloads.size());
+    Download& download = m_downloads[index];
+
+    if(download.finished)
+    {
+        return;
+    }
+
+    for(unsigned int attempt = 0 ; !download.finished ; ++attempt)
+    {
+        try
+        {
+            ClientQt::waitFor(download.future);
+
+            // The request is finished, the file is not written from the network thread anymore
+            if(download.file->error() != QFileDevice::NoError
+               || (!download.file->isOpen() && !download.file->open(QIODevice::WriteOnly)))
+            {
+                throw exceptions::Base("Could not write the file " + download.path.string());
+            }
+
+            download.file->close();
+            download.finished = true;
+        }
+        catch(const exceptions::Base& e)
+        {
+            const bool retry = attempt < m_retries && dynamic_cast<const exceptions::ContentNotFound*>(&e) == nullptr;
+            if(!retry)
+            {
+                download.file->close();
+                download.finished = true;
+                ++m_finishedCount;
+                if(m_progressCallback)
+                {
+                    m_progressCallback(m_finishedCount, m_downloads.size());
+                }
+
+                throw;
+            }
+
+            SIGHT_WARN(
+                "Download of '" << download.request->getUrl() << "' failed (" << e.what() << "), retry "
+                << attempt + 1 << "/" << m_retries
+            );
+            this->sleep(m_retryDelay * (1U << std::min(attempt, s_MAX_BACKOFF_SHIFT)));
+            this->start(download);
+        }
+    }
+
+    ++m_finishedCount;
+    if(m_progressCallback)
+    {
+        m_progressCallback(m_finishedCount, m_downloads.size());
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Downloader::sleep(std::chrono::milliseconds delay)
+{
+    // Like ClientQt::waitFor(), the events are processed so that the GUI is not frozen while waiting
+    const auto deadline = std::chrono::steady_clock::now() + delay;
+    for(auto now = std::chrono::steady_clock::now() ; now < deadline ; now = std::chrono::steady_clock::now())
+    {
+        QCoreApplication::processEvents();
+        const auto step = std::min<std::chrono::steady_clock::duration>(deadline - now, std::chrono::milliseconds(10));
+        std::this_thread::sleep_for(step);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Downloader::waitAll()
+{
+    for(std::size_t i = 0 ; i < m_downloads.size() ; ++i)
+    {
+        this->wait(i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+std::size_t Downloader::getCount() const
+{
+    return m_downloads.size();
+}
+
+//-----------------------------------------------------------------------------
+
+std::size_t Downloader::getFinishedCount() const
+{
+    return m_finishedCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void Downloader::setProgressCallback(ProgressCallbackType callback)
+{
+    m_progressCallback = callback;
+}
+
+//-----------------------------------------------------------------------------
+
+} // namespace sight::io::http
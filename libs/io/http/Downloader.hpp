@@ -0,0 +1,137 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "io/http/ClientQt.hpp"
+#include "io/http/config.hpp"
+#include "io/http/Request.hpp"
+
+#include <QFile>
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace sight::io::http
+{
+
+/**
+ * @brief Downloads files concurrently with a ClientQt.
+ *
+ * All the downloads are sent as soon as they are added, the client limits the number of requests in flight (see
+ * ClientQt::setMaxConcurrentRequests()). The response bodies are written to the files while they are received.
+ *
+ * The downloads can be waited one by one, thus the first files can be processed while the following ones are still
+ * downloading. A download that failed is sent again when it is waited, after a delay doubled at each attempt
+ * (up to 64 times the first delay). The events are processed during this delay.
+ *
+ * This class is not thread-safe, it must be used from a single thread.
+ */
+class IO_HTTP_CLASS_API Downloader
+{
+public:
+
+    /// Function called when a download is finished, receives the number of finished downloads and the total count
+    typedef std::function<void (std::size_t, std::size_t)> ProgressCallbackType;
+
+    /**
+     * @brief Constructor
+     * @param client client used to send the requests, it must outlive the downloader
+     * @param retries number of times a failed download is sent again
+     * @param retryDelay delay before the first retry, doubled at each attempt up to 64 times this delay
+     */
+    IO_HTTP_API Downloader(
+        ClientQt& client,
+        unsigned int retries                  = 3,
+        std::chrono::milliseconds retryDelay = std::chrono::milliseconds(200)
+    );
+
+    /// Destructor, the pending downloads are not waited
+    IO_HTTP_API ~Downloader();
+
+    /**
+     * @brief Sends a download request
+     * @param request the request
+     * @param file path of the file written with the response body
+     * @return the index of the download
+     */
+    IO_HTTP_API std::size_t add(Request::sptr request, const std::filesystem::path& file);
+
+    /**
+     * @brief Waits for a download, it is sent again if it failed
+     * @param index index of the download
+     * @throw exceptions::ContentNotFound if the file does not exist, it is not retried
+     * @throw exceptions::Base if the download still fails after all the retries
+     */
+    IO_HTTP_API void wait(std::size_t index);
+
+    /// Waits for all the downloads, in their order
+    IO_HTTP_API void waitAll();
+
+    /// Returns the number of downloads
+    IO_HTTP_API std::size_t getCount() const;
+
+    /// Returns the number of finished downloads
+    IO_HTTP_API std::size_t getFinishedCount() const;
+
+    /// Sets the function called when a download is finished, from the thread waiting for it
+    IO_HTTP_API void setProgressCallback(ProgressCallbackType callback);
+
+private:
+
+    struct Download
+    {
+        Request::sptr request;
+        std::filesystem::path path;
+        std::shared_ptr<QFile> file;
+        std::future<void> future;
+        bool finished {false};
+    };
+
+    /// Sends the request of a download, the file is only opened when the first bytes are received
+    void start(Download& download);
+
+    /// Waits before a retry while processing the events
+    static void sleep(std::chrono::milliseconds delay);
+
+    /// Client used for the requests
+    ClientQt& m_client;
+
+    /// Number of retries of a failed download
+    unsigned int m_retries;
+
+    /// Delay before the first retry
+    std::chrono::milliseconds m_retryDelay;
+
+    /// Downloads, in the order of add()
+    std::vector<Download> m_downloads;
+
+    /// Number of finished downloads
+    std::size_t m_finishedCount {0};
+
+    ProgressCallbackType m_progressCallback;
+};
+
+} // namespace sight::io::http
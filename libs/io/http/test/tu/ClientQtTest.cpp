@@ -31,6 +31,11 @@
 
 #include <utest/Exception.hpp>
 
+#include <QTcpSocket>
+
+#include <memory>
+#include <vector>
+
 CPPUNIT_TEST_SUITE_REGISTRATION(::sight::io::http::ut::ClientQtTest);
 
 namespace sight::io::http
@@ -98,6 +103,8 @@ void ClientQtTest::setUp()
         };
     m_worker = ui::qt::getQtWorker(argc, argv, callback, "", "");
 
+    m_connectionCount = 0;
+
     m_server.moveToThread(&m_thread);
     m_thread.connect(&m_thread, &QThread::started, [ = ]{m_server.listen();});
     m_thread.connect(&m_thread, &QThread::finished, [ = ]{m_server.close();});
@@ -250,6 +257,118 @@ void ClientQtTest::post()
 
 //------------------------------------------------------------------------------
 
+void ClientQtTest::startServer(std::function<QByteArray(const QByteArray&)> answer)
+{
+    m_server.connect(
+        &m_server,
+        &QTcpServer::newConnection,
+        [ = ]
+            {
+                QTcpSocket* socket = m_server.nextPendingConnection();
+                ++m_connectionCount;
+
+                // The connection is kept open, several requests may be received on the same socket
+                auto data = std::make_shared<QByteArray>();
+                socket->connect(
+                    socket,
+                    &QTcpSocket::readyRead,
+                    [ = ]
+                {
+                    *data += socket->readAll();
+
+                    int end = data->indexOf("\r\n\r\n");
+                    while(end >= 0)
+                    {
+                        // Request line: GET <path> HTTP/1.1
+                        const QList<QByteArray> requestLine = data->left(data->indexOf("\r\n")).split(' ');
+                        const QByteArray body               = answer(requestLine.value(1));
+                        data->remove(0, end + 4);
+
+                        socket->write(
+                            "HTTP/1.1 200 OK\r\n"
+                            "Content-Type: application/octet-stream\r\n"
+                            "Content-Length: " + QByteArray::number(body.size()) + "\r\n\r\n"
+                        );
+                        socket->write(body);
+
+                        end = data->indexOf("\r\n\r\n");
+                    }
+                });
+                socket->connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+            });
+
+    m_thread.start();
+
+    for(int i = 0 ; !m_server.isListening() && i < 10 ; ++i)
+    {
+        QThread::sleep(1);
+    }
+
+    CPPUNIT_ASSERT(m_server.isListening());
+}
+
+//------------------------------------------------------------------------------
+
+void ClientQtTest::concurrentGet()
+{
+    this->startServer([](const QByteArray& path){return path;});
+
+    const std::string url = "http://localhost:" + std::to_string(m_server.serverPort());
+
+    m_client.setMaxConcurrentRequests(2);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), m_client.getMaxConcurrentRequests());
+
+    std::vector<std::future<QByteArray> > answers;
+    for(int i = 0 ; i < 8 ; ++i)
+    {
+        answers.push_back(m_client.getAsync(sight::io::http::Request::New(url + "/instances/" + std::to_string(i))));
+    }
+
+    for(int i = 0 ; i < 8 ; ++i)
+    {
+        const QByteArray answer = answers[std::size_t(i)].get();
+        CPPUNIT_ASSERT_EQUAL(std::string("/instances/" + std::to_string(i)), answer.toStdString());
+    }
+
+    // The requests are queued, no more than two connections are opened, and reused
+    CPPUNIT_ASSERT(m_connectionCount >= 1);
+    CPPUNIT_ASSERT(m_connectionCount <= 2);
+
+    // The synchronous API uses the same connections
+    const QByteArray& answer = m_client.get(sight::io::http::Request::New(url + "/instances"));
+    CPPUNIT_ASSERT_EQUAL(std::string("/instances"), answer.toStdString());
+    CPPUNIT_ASSERT(m_connectionCount <= 2);
+}
+
+//------------------------------------------------------------------------------
+
+void ClientQtTest::streamedGet()
+{
+    const QByteArray expected(8 * 1024 * 1024, 'x');
+    this->startServer([ = ](const QByteArray&){return expected;});
+
+    auto request =
+        sight::io::http::Request::New("http://localhost:" + std::to_string(m_server.serverPort()) + "/file");
+
+    // The sink is only called from the network thread
+    QByteArray received;
+    int chunks = 0;
+    std::future<void> future = m_client.getAsync(
+        request,
+        [&](const QByteArray& data)
+        {
+            received += data;
+            ++chunks;
+        });
+    future.get();
+
+    CPPUNIT_ASSERT(chunks > 1);
+    CPPUNIT_ASSERT_EQUAL(expected.size(), received.size());
+    CPPUNIT_ASSERT(expected == received);
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace ut
 
 } // namespace sight::io::http
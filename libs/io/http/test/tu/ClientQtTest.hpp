@@ -31,7 +31,9 @@
 #include <QCoreApplication>
 #include <QTcpServer>
 
+#include <atomic>
 #include <filesystem>
+#include <functional>
 
 namespace sight::io::http
 {
@@ -44,6 +46,8 @@ class ClientQtTest : public CPPUNIT_NS::TestFixture
 CPPUNIT_TEST_SUITE(ClientQtTest);
 CPPUNIT_TEST(get);
 CPPUNIT_TEST(post);
+CPPUNIT_TEST(concurrentGet);
+CPPUNIT_TEST(streamedGet);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -59,9 +63,16 @@ public:
     void get();
     // Simulates a POST request on Orthanc /tools/find route
     void post();
+    // Sends several GET requests at once, the connections must be reused
+    void concurrentGet();
+    // Streams a large GET response to a sink
+    void streamedGet();
 
 private:
 
+    // Starts a keep-alive server answering each GET request with the body computed from its path
+    void startServer(std::function<QByteArray(const QByteArray&)> answer);
+
     // Application thread
     core::thread::Worker::sptr m_worker;
     // HTTP client
@@ -70,6 +81,8 @@ private:
     QTcpServer m_server;
     // Server thread
     QThread m_thread;
+    // Number of connections accepted by the server
+    std::atomic<int> m_connectionCount;
 };
 
 } // namespace ut
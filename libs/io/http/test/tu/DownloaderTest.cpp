@@ -0,0 +1,256 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "DownloaderTest.hpp"
+
+#include <core/thread/ActiveWorkers.hpp>
+#include <core/tools/System.hpp>
+
+#include <io/http/Downloader.hpp>
+
+#include <ui/qt/App.hpp>
+#include <ui/qt/WorkerQt.hpp>
+
+#include <QTcpSocket>
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(::sight::io::http::ut::DownloaderTest);
+
+namespace sight::io::http
+{
+
+namespace ut
+{
+
+//------------------------------------------------------------------------------
+
+static std::string instanceContent(const std::string& path)
+{
+    std::string content;
+    for(int i = 0 ; i < 1000 ; ++i)
+    {
+        content += path;
+    }
+
+    return content;
+}
+
+//------------------------------------------------------------------------------
+
+static std::string readFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+//------------------------------------------------------------------------------
+
+void DownloaderTest::setUp()
+{
+    // Set up context before running a test.
+    static char arg1[] = "DownloaderTest";
+#if defined(__linux)
+    static char arg2[]  = "-platform";
+    static char arg3[]  = "offscreen";
+    static char* argv[] = {arg1, arg2, arg3, nullptr};
+    static int argc     = 3;
+#else
+    static char* argv[] = {arg1, 0};
+    static int argc     = 1;
+#endif
+
+    CPPUNIT_ASSERT(qApp == NULL);
+    std::function<QSharedPointer<QCoreApplication>(int&, char**)> callback =
+        [](int& argc, char** argv)
+        {
+            return QSharedPointer<QApplication>(new ui::qt::App(argc, argv, false));
+        };
+    m_worker = ui::qt::getQtWorker(argc, argv, callback, "", "");
+
+    m_failingCount = 0;
+    m_missingCount = 0;
+
+    m_folder = core::tools::System::getTemporaryFolder() / "DownloaderTest";
+    std::filesystem::create_directories(m_folder);
+
+    // Keep-alive server answering /instances/{id}/file, "failing" answers an error once, "missing" does not exist
+    m_server.connect(
+        &m_server,
+        &QTcpServer::newConnection,
+        [ = ]
+            {
+                QTcpSocket* socket = m_server.nextPendingConnection();
+                auto data          = std::make_shared<QByteArray>();
+                socket->connect(
+                    socket,
+                    &QTcpSocket::readyRead,
+                    [ = ]
+                {
+                    *data += socket->readAll();
+
+                    int end = data->indexOf("\r\n\r\n");
+                    while(end >= 0)
+                    {
+                        const std::string path = data->left(data->indexOf("\r\n")).split(' ').value(1).toStdString();
+                        data->remove(0, end + 4);
+
+                        if(path.find("missing") != std::string::npos)
+                        {
+                            ++m_missingCount;
+                            socket->write("HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n");
+                        }
+                        else if(path.find("failing") != std::string::npos && m_failingCount++ == 0)
+                        {
+                            socket->write("HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\n\r\n");
+                        }
+                        else
+                        {
+                            const std::string body = instanceContent(path);
+                            socket->write(
+                                ("HTTP/1.1 200 OK\r\n"
+                                 "Content-Type: application/dicom\r\n"
+                                 "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body).c_str()
+                            );
+                        }
+
+                        end = data->indexOf("\r\n\r\n");
+                    }
+                });
+                socket->connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+            });
+
+    m_server.moveToThread(&m_thread);
+    m_thread.connect(&m_thread, &QThread::started, [ = ]{m_server.listen();});
+    m_thread.connect(&m_thread, &QThread::finished, [ = ]{m_server.close();});
+    m_thread.start();
+
+    for(int i = 0 ; !m_server.isListening() && i < 10 ; ++i)
+    {
+        QThread::sleep(1);
+    }
+
+    CPPUNIT_ASSERT(m_server.isListening());
+}
+
+//------------------------------------------------------------------------------
+
+void DownloaderTest::tearDown()
+{
+    // Clean up after the test run.
+    m_thread.quit();
+    m_thread.wait();
+
+    m_thread.disconnect();
+    m_server.disconnect();
+
+    std::filesystem::remove_all(m_folder);
+
+    m_worker->post(std::bind(&QCoreApplication::quit));
+    m_worker->getFuture().wait();
+    m_worker.reset();
+
+    core::thread::ActiveWorkers::getDefault()->clearRegistry();
+    CPPUNIT_ASSERT(qApp == NULL);
+}
+
+//------------------------------------------------------------------------------
+
+void DownloaderTest::download()
+{
+    const std::string url = "http://localhost:" + std::to_string(m_server.serverPort());
+
+    m_client.setMaxConcurrentRequests(3);
+    sight::io::http::Downloader downloader(m_client);
+
+    std::size_t progress = 0;
+    downloader.setProgressCallback(
+        [&](std::size_t finished, std::size_t total)
+        {
+            CPPUNIT_ASSERT_EQUAL(progress + 1, finished);
+            CPPUNIT_ASSERT_EQUAL(std::size_t(20), total);
+            progress = finished;
+        });
+
+    for(int i = 0 ; i < 20 ; ++i)
+    {
+        const std::string id    = std::to_string(i);
+        const std::size_t index = downloader.add(
+            sight::io::http::Request::New(url + "/instances/" + id + "/file"),
+            m_folder / id
+        );
+        CPPUNIT_ASSERT_EQUAL(std::size_t(i), index);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(std::size_t(20), downloader.getCount());
+
+    // The first file can be used while the other ones are downloading
+    downloader.wait(0);
+    CPPUNIT_ASSERT_EQUAL(instanceContent("/instances/0/file"), readFile(m_folder / "0"));
+
+    downloader.waitAll();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(20), downloader.getFinishedCount());
+    CPPUNIT_ASSERT_EQUAL(std::size_t(20), progress);
+
+    for(int i = 0 ; i < 20 ; ++i)
+    {
+        const std::string id = std::to_string(i);
+        CPPUNIT_ASSERT_EQUAL(instanceContent("/instances/" + id + "/file"), readFile(m_folder / id));
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void DownloaderTest::retry()
+{
+    const std::string url = "http://localhost:" + std::to_string(m_server.serverPort());
+
+    sight::io::http::Downloader downloader(m_client, 2, std::chrono::milliseconds(10));
+
+    const std::size_t failing = downloader.add(
+        sight::io::http::Request::New(url + "/instances/failing/file"),
+        m_folder / "failing"
+    );
+    const std::size_t missing = downloader.add(
+        sight::io::http::Request::New(url + "/instances/missing/file"),
+        m_folder / "missing"
+    );
+
+    // The first answer is an error, the download is sent again
+    CPPUNIT_ASSERT_NO_THROW(downloader.wait(failing));
+    CPPUNIT_ASSERT_EQUAL(2, int(m_failingCount));
+    CPPUNIT_ASSERT_EQUAL(instanceContent("/instances/failing/file"), readFile(m_folder / "failing"));
+
+    // A missing file is not retried
+    CPPUNIT_ASSERT_THROW(downloader.wait(missing), sight::io::http::exceptions::ContentNotFound);
+    CPPUNIT_ASSERT_EQUAL(1, int(m_missingCount));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), downloader.getFinishedCount());
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace ut
+
+} // namespace sight::io::http
@@ -0,0 +1,81 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <core/thread/Worker.hpp>
+
+#include <io/http/ClientQt.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <QTcpServer>
+
+#include <atomic>
+#include <filesystem>
+
+namespace sight::io::http
+{
+
+namespace ut
+{
+
+class DownloaderTest : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(DownloaderTest);
+CPPUNIT_TEST(download);
+CPPUNIT_TEST(retry);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // Interface
+    // Set up the application, the server and the download folder
+    void setUp();
+    // Clean up the application, the server and the download folder
+    void tearDown();
+
+    // Test functions
+    // Downloads several instances concurrently
+    void download();
+    // Downloads an instance failing once and a missing instance
+    void retry();
+
+private:
+
+    // Application thread
+    core::thread::Worker::sptr m_worker;
+    // HTTP client
+    sight::io::http::ClientQt m_client;
+    // Local server simulating the Orthanc /instances/{id}/file route
+    QTcpServer m_server;
+    // Server thread
+    QThread m_thread;
+    // Number of requests received by the server for the failing and the missing instances
+    std::atomic<int> m_failingCount;
+    std::atomic<int> m_missingCount;
+    // Folder of the downloaded files
+    std::filesystem::path m_folder;
+};
+
+} // namespace ut
+
+} // namespace sight::io::http
@@ -27,6 +27,7 @@
 #include "data/GenericDeserializer.hpp"
 #include "data/MeshDeserializer.hpp"
 #include "data/PatientDeserializer.hpp"
+#include "data/PointSetDeserializer.hpp"
 #include "data/SeriesDeserializer.hpp"
 #include "data/StringDeserializer.hpp"
 #include "data/StudyDeserializer.hpp"
@@ -40,6 +41,7 @@
 #include <data/Mesh.hpp>
 #include <data/mt/locked_ptr.hpp>
 #include <data/Patient.hpp>
+#include <data/PointSet.hpp>
 #include <data/Series.hpp>
 #include <data/String.hpp>
 #include <data/Study.hpp>
@@ -66,6 +68,7 @@ static const std::unordered_map<std::string, std::function<data::IDataDeserializ
     {sight::data::String::classname(), &std::make_unique<data::StringDeserializer>},
     {sight::data::Composite::classname(), &std::make_unique<data::CompositeDeserializer>},
     {sight::data::Mesh::classname(), &std::make_unique<data::MeshDeserializer>},
+    {sight::data::PointSet::classname(), &std::make_unique<data::PointSetDeserializer>},
     {sight::data::Equipment::classname(), &std::make_unique<data::EquipmentDeserializer>},
     {sight::data::Patient::classname(), &std::make_unique<data::PatientDeserializer>},
     {sight::data::Study::classname(), &std::make_unique<data::StudyDeserializer>},
@@ -27,6 +27,7 @@
 #include "data/GenericSerializer.hpp"
 #include "data/MeshSerializer.hpp"
 #include "data/PatientSerializer.hpp"
+#include "data/PointSetSerializer.hpp"
 #include "data/SeriesSerializer.hpp"
 #include "data/StringSerializer.hpp"
 #include "data/StudySerializer.hpp"
@@ -40,6 +41,7 @@
 #include <data/Mesh.hpp>
 #include <data/mt/locked_ptr.hpp>
 #include <data/Patient.hpp>
+#include <data/PointSet.hpp>
 #include <data/Series.hpp>
 #include <data/String.hpp>
 #include <data/Study.hpp>
@@ -64,6 +66,7 @@ static const std::unordered_map<std::string, std::function<data::IDataSerializer
     {sight::data::String::classname(), &std::make_unique<data::StringSerializer>},
     {sight::data::Composite::classname(), &std::make_unique<data::CompositeSerializer>},
     {sight::data::Mesh::classname(), &std::make_unique<data::MeshSerializer>},
+    {sight::data::PointSet::classname(), &std::make_unique<data::PointSetSerializer>},
     {sight::data::Equipment::classname(), &std::make_unique<data::EquipmentSerializer>},
     {sight::data::Patient::classname(), &std::make_unique<data::PatientSerializer>},
     {sight::data::Study::classname(), &std::make_unique<data::StudySerializer>},
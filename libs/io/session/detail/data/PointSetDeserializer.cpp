@@ -0,0 +1,112 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "PointSetDeserializer.hpp"
+
+#include <core/exceptionmacros.hpp>
+
+#include <data/PointSet.hpp>
+
+namespace sight::io::session
+{
+
+namespace detail::data
+{
+
+//------------------------------------------------------------------------------
+
+sight::data::Object::sptr PointSetDeserializer::deserialize(
+    const zip::ArchiveReader::sptr& archive,
+    const boost::property_tree::ptree& tree,
+    const std::map<std::string, sight::data::Object::sptr>&,
+    const sight::data::Object::sptr& object,
+    const core::crypto::secure_string& password
+) const
+{
+    // Create or reuse the object
+    const auto& pointSet = object ? sight::data::PointSet::dynamicCast(object) : sight::data::PointSet::New();
+
+    SIGHT_ASSERT(
+        "Object '" << pointSet->getClassname() << "' is not a '" << sight::data::PointSet::classname() << "'",
+        pointSet
+    );
+
+    // Check version number. Not mandatory, but could help for future release
+    const int version = tree.get<int>("version", 0);
+    SIGHT_THROW_IF(
+        PointSetDeserializer::classname() << " is not implemented for version '" << version << "'.",
+        version > 1
+    );
+
+    // Remove previous attributes, if the object is reused
+    for(const auto& name : pointSet->getAttributeNames())
+    {
+        pointSet->removeAttribute(name);
+    }
+
+    const auto size = tree.get<size_t>("Size");
+    pointSet->clear();
+    pointSet->resize(size);
+
+    {
+        const auto& istream = archive->openFile(
+            std::filesystem::path(pointSet->getUUID() + "/points.raw"),
+            password
+        );
+
+        istream->read(
+            reinterpret_cast<char*>(pointSet->getCoordinates()),
+            static_cast<std::streamsize>(size * sizeof(sight::data::PointSet::PointType))
+        );
+
+        SIGHT_THROW_IF("Unable to read the point set coordinates.", size > 0 && !istream->good());
+    }
+
+    const auto& attributesTree = tree.get_child("Attributes");
+    size_t index               = 0;
+
+    for(const auto& attributeTree : attributesTree)
+    {
+        const auto& name = readFromTree(attributeTree.second, "Name");
+        auto& attribute  = pointSet->addAttribute(name, attributeTree.second.get<size_t>("Components"));
+
+        const auto& istream = archive->openFile(
+            std::filesystem::path(pointSet->getUUID() + "/attribute_" + std::to_string(index++) + ".raw"),
+            password
+        );
+
+        istream->read(
+            reinterpret_cast<char*>(attribute.values.data()),
+            static_cast<std::streamsize>(attribute.values.size() * sizeof(sight::data::PointSet::AttributeValueType))
+        );
+
+        SIGHT_THROW_IF(
+            "Unable to read the point set attribute '" << name << "'.",
+            !attribute.values.empty() && !istream->good()
+        );
+    }
+
+    return pointSet;
+}
+
+} // detail::data
+
+} // namespace sight::io::session
@@ -0,0 +1,95 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "PointSetSerializer.hpp"
+
+#include <data/PointSet.hpp>
+
+namespace sight::io::session
+{
+
+namespace detail::data
+{
+
+/// Serialization function
+void PointSetSerializer::serialize(
+    const zip::ArchiveWriter::sptr& archive,
+    boost::property_tree::ptree& tree,
+    const sight::data::Object::csptr& object,
+    std::map<std::string, sight::data::Object::csptr>&,
+    const core::crypto::secure_string& password
+) const
+{
+    const auto& pointSet = sight::data::PointSet::dynamicCast(object);
+    SIGHT_ASSERT(
+        "Object '"
+        << (object ? object->getClassname() : sight::data::Object::classname())
+        << "' is not a '"
+        << sight::data::PointSet::classname()
+        << "'",
+        pointSet
+    );
+
+    // Add a version number. Not mandatory, but could help for future release
+    tree.put("version", 1);
+    tree.put("Size", pointSet->size());
+
+    // Write the coordinates as a raw binary buffer, no need to go through VTK for a simple array
+    {
+        const auto& ostream = archive->openFile(
+            std::filesystem::path(pointSet->getUUID() + "/points.raw"),
+            password
+        );
+
+        ostream->write(
+            reinterpret_cast<const char*>(pointSet->getCoordinates()),
+            static_cast<std::streamsize>(pointSet->size() * sizeof(sight::data::PointSet::PointType))
+        );
+    }
+
+    // Write the attributes, using their index as file name to avoid issues with their names
+    boost::property_tree::ptree attributesTree;
+    size_t index = 0;
+
+    for(const auto& [name, attribute] : pointSet->getAttributes())
+    {
+        boost::property_tree::ptree attributeTree;
+        writeToTree(attributeTree, "Name", name);
+        attributeTree.put("Components", attribute.numberOfComponents);
+        attributesTree.add_child("Attribute", attributeTree);
+
+        const auto& ostream = archive->openFile(
+            std::filesystem::path(pointSet->getUUID() + "/attribute_" + std::to_string(index++) + ".raw"),
+            password
+        );
+
+        ostream->write(
+            reinterpret_cast<const char*>(attribute.values.data()),
+            static_cast<std::streamsize>(attribute.values.size() * sizeof(sight::data::PointSet::AttributeValueType))
+        );
+    }
+
+    tree.add_child("Attributes", attributesTree);
+}
+
+} // detail::data
+
+} // namespace sight::io::session
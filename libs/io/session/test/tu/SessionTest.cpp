@@ -32,6 +32,7 @@
 #include <core/data/iterator/MeshIterators.hpp>
 #include <core/data/iterator/MeshIterators.hxx>
 #include <core/data/Patient.hpp>
+#include <core/data/PointSet.hpp>
 #include <core/data/Series.hpp>
 #include <core/data/String.hpp>
 #include <core/data/Study.hpp>
@@ -50,6 +51,8 @@
 #include <utestData/Data.hpp>
 #include <utestData/generator/Mesh.hpp>
 
+#include <numeric>
+
 // Registers the fixture into the 'registry'
 CPPUNIT_TEST_SUITE_REGISTRATION(::sight::io::session::ut::SessionTest);
 
@@ -495,6 +498,73 @@ void SessionTest::meshTest()
 
 //------------------------------------------------------------------------------
 
+void SessionTest::pointSetTest()
+{
+    // Create a temporary directory
+    const std::filesystem::path tmpfolder = core::tools::System::getTemporaryFolder();
+    std::filesystem::create_directories(tmpfolder);
+    const std::filesystem::path testPath = tmpfolder / "pointSetTest.zip";
+
+    // Create a test point set
+    const auto& originalPointSet = data::PointSet::New();
+    originalPointSet->addAttribute("scalar");
+    originalPointSet->addAttribute("color", 3);
+
+    for(size_t i = 0 ; i < 1000 ; ++i)
+    {
+        const double value = static_cast<double>(i);
+        originalPointSet->pushBack({value, value * 2., value * 3.});
+    }
+
+    auto& scalars = originalPointSet->getAttribute("scalar")->values;
+    std::iota(scalars.begin(), scalars.end(), 0.f);
+    auto& colors = originalPointSet->getAttribute("color")->values;
+    std::iota(colors.begin(), colors.end(), 1.f);
+
+    // Test serialization
+    {
+        const auto& pointSet = data::PointSet::New();
+        pointSet->deepCopy(originalPointSet);
+
+        // Create the session writer
+        auto sessionWriter = io::session::SessionWriter::New();
+        CPPUNIT_ASSERT(sessionWriter);
+
+        // Configure the session writer
+        sessionWriter->setObject(pointSet);
+        sessionWriter->setFile(testPath);
+        sessionWriter->write();
+
+        CPPUNIT_ASSERT(std::filesystem::exists(testPath));
+    }
+
+    // Test deserialization
+    {
+        auto sessionReader = io::session::SessionReader::New();
+        CPPUNIT_ASSERT(sessionReader);
+        sessionReader->setFile(testPath);
+        sessionReader->read();
+
+        // Test values
+        const auto& pointSet = data::PointSet::dynamicCast(sessionReader->getObject());
+        CPPUNIT_ASSERT(pointSet);
+
+        CPPUNIT_ASSERT_EQUAL(originalPointSet->size(), pointSet->size());
+        CPPUNIT_ASSERT(originalPointSet->getPoints() == pointSet->getPoints());
+        CPPUNIT_ASSERT(originalPointSet->getAttributeNames() == pointSet->getAttributeNames());
+
+        for(const auto& name : originalPointSet->getAttributeNames())
+        {
+            const auto* originalAttribute = originalPointSet->getAttribute(name);
+            const auto* attribute         = pointSet->getAttribute(name);
+            CPPUNIT_ASSERT_EQUAL(originalAttribute->numberOfComponents, attribute->numberOfComponents);
+            CPPUNIT_ASSERT(originalAttribute->values == attribute->values);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
 void SessionTest::equipmentTest()
 {
     // Create a temporary directory
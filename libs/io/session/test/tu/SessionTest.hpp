@@ -40,6 +40,7 @@ CPPUNIT_TEST(stringTest);
 CPPUNIT_TEST(circularTest);
 CPPUNIT_TEST(compositeTest);
 CPPUNIT_TEST(meshTest);
+CPPUNIT_TEST(pointSetTest);
 CPPUNIT_TEST(equipmentTest);
 CPPUNIT_TEST(patientTest);
 CPPUNIT_TEST(studyTest);
@@ -61,6 +62,7 @@ public:
     void circularTest();
     void compositeTest();
     void meshTest();
+    void pointSetTest();
     void equipmentTest();
     void patientTest();
     void studyTest();
@@ -22,6 +22,7 @@
 
 #include "io/vtk/MetaImageReader.hpp"
 
+#include "io/vtk/helper/MappedImage.hpp"
 #include "io/vtk/helper/vtkLambdaCommand.hpp"
 #include "io/vtk/vtk.hpp"
 
@@ -63,6 +64,13 @@ void MetaImageReader::read()
 
     data::Image::sptr pImage = this->getConcreteObject();
 
+    if(m_mappingEnabled && helper::MappedImage::mapMetaImage(this->getFile(), pImage))
+    {
+        m_job->doneWork(100);
+        m_job->finish();
+        return;
+    }
+
     vtkSmartPointer<vtkMetaImageReader> reader = vtkSmartPointer<vtkMetaImageReader>::New();
     reader->SetFileName(this->getFile().string().c_str());
 
@@ -115,4 +123,11 @@ core::jobs::IJob::sptr MetaImageReader::getJob() const
 
 //------------------------------------------------------------------------------
 
+void MetaImageReader::enableMapping(bool enable)
+{
+    m_mappingEnabled = enable;
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace sight::io::vtk
@@ -22,6 +22,7 @@
 
 #include "io/vtk/VtiImageReader.hpp"
 
+#include "io/vtk/helper/MappedImage.hpp"
 #include "io/vtk/helper/vtkLambdaCommand.hpp"
 #include "io/vtk/vtk.hpp"
 
@@ -63,6 +64,13 @@ void VtiImageReader::read()
 
     data::Image::sptr pImage = getConcreteObject();
 
+    if(m_mappingEnabled && helper::MappedImage::mapVtiImage(this->getFile(), pImage))
+    {
+        m_job->doneWork(100);
+        m_job->finish();
+        return;
+    }
+
     vtkSmartPointer<vtkXMLImageDataReader> reader = vtkSmartPointer<vtkXMLImageDataReader>::New();
     reader->SetFileName(this->getFile().string().c_str());
 
@@ -116,4 +124,11 @@ core::jobs::IJob::sptr VtiImageReader::getJob() const
 
 //------------------------------------------------------------------------------
 
+void VtiImageReader::enableMapping(bool enable)
+{
+    m_mappingEnabled = enable;
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace sight::io::vtk
@@ -76,10 +76,22 @@ public:
     /// @return internal job
     IO_VTK_API SPTR(core::jobs::IJob) getJob() const override;
 
+    /**
+     * @brief Enables the mapping of the pixels of an uncompressed raw image instead of reading them
+     *
+     * The pixels are then loaded by the system when they are accessed. The mapping is copy-on-write, the file is
+     * never modified, but it must not be overwritten nor truncated as long as the image uses it. Images that can not
+     * be mapped (compressed, ascii, ...) are read as usual.
+     */
+    IO_VTK_API void enableMapping(bool enable);
+
 private:
 
     ///Internal job
     SPTR(core::jobs::Observer) m_job;
+
+    /// Maps the pixels instead of reading them if possible
+    bool m_mappingEnabled {false};
 };
 
 } // namespace sight::io::vtk
@@ -0,0 +1,531 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/vtk/helper/MappedImage.hpp"
+
+#include "io/vtk/vtk.hpp"
+
+#include <core/memory/exception/Memory.hpp>
+#include <core/spyLog.hpp>
+
+#include <boost/algorithm/string/trim.hpp>
+
+#include <vtkDataObject.h>
+#include <vtkDataSetAttributes.h>
+#include <vtkInformation.h>
+#include <vtkMetaImageReader.h>
+#include <vtkSmartPointer.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+#include <vtkXMLImageDataReader.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace sight::io::vtk
+{
+
+namespace helper
+{
+
+/// Geometry and pixel type of an image, as read by VTK
+struct ImageInformation
+{
+    data::Image::Size size;
+    data::Image::Spacing spacing;
+    data::Image::Origin origin;
+    core::tools::Type type;
+    std::size_t numberOfComponents {1};
+    std::string scalarsName;
+    std::size_t sizeInBytes {0};
+};
+
+//------------------------------------------------------------------------------
+
+static bool isLittleEndian()
+{
+    const std::uint16_t value = 1;
+    std::uint8_t firstByte    = 0;
+    std::memcpy(&firstByte, &value, 1);
+    return firstByte == 1;
+}
+
+//------------------------------------------------------------------------------
+
+static bool getImageInformation(vtkInformation* info, ImageInformation& imageInfo)
+{
+    if(info == nullptr || !info->Has(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()))
+    {
+        return false;
+    }
+
+    vtkInformation* attrInfo = vtkDataObject::GetActiveFieldInformation(
+        info,
+        vtkDataObject::FIELD_ASSOCIATION_POINTS,
+        vtkDataSetAttributes::SCALARS
+    );
+    if(attrInfo == nullptr)
+    {
+        return false;
+    }
+
+    int extent[6];
+    info->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
+
+    double spacing[3] = {1., 1., 1.};
+    if(info->Has(vtkDataObject::SPACING()))
+    {
+        info->Get(vtkDataObject::SPACING(), spacing);
+    }
+
+    double origin[3] = {0., 0., 0.};
+    if(info->Has(vtkDataObject::ORIGIN()))
+    {
+        info->Get(vtkDataObject::ORIGIN(), origin);
+    }
+
+    std::size_t dimensions[3];
+    std::size_t numberOfPixels = 1;
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        if(extent[2 * i + 1] < extent[2 * i])
+        {
+            return false;
+        }
+
+        dimensions[i]   = static_cast<std::size_t>(extent[2 * i + 1] - extent[2 * i] + 1);
+        numberOfPixels *= dimensions[i];
+    }
+
+    // Same geometry as io::vtk::fromVTKImage(), a flat image is only supported along the z axis
+    if(dimensions[2] == 1 && dimensions[0] > 1 && dimensions[1] > 1)
+    {
+        imageInfo.size    = {dimensions[0], dimensions[1], 0};
+        imageInfo.spacing = {spacing[0], spacing[1], 0.};
+        imageInfo.origin  = {origin[0], origin[1], 0.};
+    }
+    else if(dimensions[0] > 1 && dimensions[1] > 1 && dimensions[2] > 1)
+    {
+        imageInfo.size    = {dimensions[0], dimensions[1], dimensions[2]};
+        imageInfo.spacing = {spacing[0], spacing[1], spacing[2]};
+        imageInfo.origin  = {origin[0], origin[1], origin[2]};
+    }
+    else
+    {
+        return false;
+    }
+
+    try
+    {
+        imageInfo.type = io::vtk::TypeTranslator::translate(attrInfo->Get(vtkDataObject::FIELD_ARRAY_TYPE()));
+    }
+    catch(const std::exception&)
+    {
+        return false;
+    }
+
+    if(attrInfo->Has(vtkDataObject::FIELD_NUMBER_OF_COMPONENTS()))
+    {
+        imageInfo.numberOfComponents =
+            static_cast<std::size_t>(attrInfo->Get(vtkDataObject::FIELD_NUMBER_OF_COMPONENTS()));
+    }
+
+    if(attrInfo->Has(vtkDataObject::FIELD_NAME()))
+    {
+        imageInfo.scalarsName = attrInfo->Get(vtkDataObject::FIELD_NAME());
+    }
+
+    imageInfo.sizeInBytes = numberOfPixels * imageInfo.numberOfComponents * imageInfo.type.sizeOf();
+
+    return imageInfo.sizeInBytes > 0;
+}
+
+//------------------------------------------------------------------------------
+
+static bool mapPixels(
+    const std::filesystem::path& file,
+    std::uintmax_t offset,
+    const ImageInformation& imageInfo,
+    const data::Image::sptr& image
+)
+{
+    std::error_code error;
+    const std::uintmax_t fileSize = std::filesystem::file_size(file, error);
+    if(error || fileSize < offset + imageInfo.sizeInBytes)
+    {
+        return false;
+    }
+
+    image->setSize2(imageInfo.size);
+    image->setSpacing2(imageInfo.spacing);
+    image->setOrigin2(imageInfo.origin);
+    image->setType(imageInfo.type);
+    image->setNumberOfComponents(imageInfo.numberOfComponents);
+
+    if(imageInfo.numberOfComponents == 1)
+    {
+        image->setPixelFormat(data::Image::PixelFormat::GRAY_SCALE);
+    }
+    else if(imageInfo.numberOfComponents == 3)
+    {
+        image->setPixelFormat(data::Image::PixelFormat::RGB);
+    }
+    else if(imageInfo.numberOfComponents == 4)
+    {
+        image->setPixelFormat(data::Image::PixelFormat::RGBA);
+    }
+
+    try
+    {
+        image->mapFile(file, static_cast<std::size_t>(offset));
+    }
+    catch(const core::memory::exception::Memory& e)
+    {
+        SIGHT_WARN(e.what() << ", the image is read instead.");
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+bool MappedImage::mapMetaImage(const std::filesystem::path& file, const data::Image::sptr& image)
+{
+    // The header is made of 'key = value' lines, the last one being the location of the pixels
+    std::ifstream header(file, std::ios::binary);
+    if(!header)
+    {
+        return false;
+    }
+
+    static constexpr std::size_t s_MAX_LINES = 256;
+
+    std::map<std::string, std::string> fields;
+    std::string line;
+    std::streamoff localOffset = -1;
+    for(std::size_t count = 0 ; count < s_MAX_LINES && std::getline(header, line) ; ++count)
+    {
+        const auto separator = line.find('=');
+        if(separator == std::string::npos)
+        {
+            continue;
+        }
+
+        const std::string key = boost::algorithm::trim_copy(line.substr(0, separator));
+        fields[key] = boost::algorithm::trim_copy(line.substr(separator + 1));
+
+        if(key == "ElementDataFile")
+        {
+            localOffset = header.tellg();
+            break;
+        }
+    }
+
+    header.close();
+
+    const auto getField =
+        [&fields](const std::string& key)
+        {
+            const auto iter = fields.find(key);
+            return iter == fields.end() ? std::string() : iter->second;
+        };
+
+    const std::string dataFile = getField("ElementDataFile");
+
+    // Compressed, ascii, listed or numbered pixel files are read by VTK
+    if(dataFile.empty() || dataFile == "LIST" || dataFile.find('%') != std::string::npos
+       || (!getField("CompressedData").empty() && getField("CompressedData") != "False")
+       || getField("BinaryData") == "False")
+    {
+        return false;
+    }
+
+    const std::string msb = !getField("BinaryDataByteOrderMSB").empty()
+                            ? getField("BinaryDataByteOrderMSB") : getField("ElementByteOrderMSB");
+    if(msb == (isLittleEndian() ? "True" : "False"))
+    {
+        return false;
+    }
+
+    long long headerSize = 0;
+    if(!getField("HeaderSize").empty())
+    {
+        try
+        {
+            headerSize = std::stoll(getField("HeaderSize"));
+        }
+        catch(const std::exception&)
+        {
+            return false;
+        }
+    }
+
+    vtkSmartPointer<vtkMetaImageReader> reader = vtkSmartPointer<vtkMetaImageReader>::New();
+    reader->SetFileName(file.string().c_str());
+    reader->UpdateInformation();
+
+    ImageInformation imageInfo;
+    if(!getImageInformation(reader->GetOutputInformation(0), imageInfo))
+    {
+        return false;
+    }
+
+    if(dataFile == "LOCAL")
+    {
+        if(localOffset < 0 || headerSize != 0)
+        {
+            return false;
+        }
+
+        return mapPixels(file, static_cast<std::uintmax_t>(localOffset), imageInfo, image);
+    }
+
+    const std::filesystem::path rawFile = file.parent_path() / dataFile;
+
+    std::uintmax_t offset = 0;
+    if(headerSize == -1)
+    {
+        // The pixels are at the end of the file
+        std::error_code error;
+        const std::uintmax_t fileSize = std::filesystem::file_size(rawFile, error);
+        if(error || fileSize < imageInfo.sizeInBytes)
+        {
+            return false;
+        }
+
+        offset = fileSize - imageInfo.sizeInBytes;
+    }
+    else if(headerSize >= 0)
+    {
+        offset = static_cast<std::uintmax_t>(headerSize);
+    }
+    else
+    {
+        return false;
+    }
+
+    return mapPixels(rawFile, offset, imageInfo, image);
+}
+
+//------------------------------------------------------------------------------
+
+static std::string getTagAttributes(const std::string& xml, const std::string& tag)
+{
+    std::smatch match;
+    if(std::regex_search(xml, match, std::regex("<" + tag + "\\b([^>]*)>")))
+    {
+        return match[1].str();
+    }
+
+    return std::string();
+}
+
+//------------------------------------------------------------------------------
+
+static std::string getAttribute(const std::string& attributes, const std::string& name)
+{
+    std::smatch match;
+    if(std::regex_search(attributes, match, std::regex("(^|\\s)" + name + "\\s*=\\s*\"([^\"]*)\"")))
+    {
+        return match[2].str();
+    }
+
+    return std::string();
+}
+
+//------------------------------------------------------------------------------
+
+static std::vector<long long> parseExtent(const std::string& extent)
+{
+    std::vector<long long> values;
+    std::istringstream stream(extent);
+    long long value = 0;
+    while(stream >> value)
+    {
+        values.push_back(value);
+    }
+
+    return values;
+}
+
+//------------------------------------------------------------------------------
+
+bool MappedImage::mapVtiImage(const std::filesystem::path& file, const data::Image::sptr& image)
+{
+    std::ifstream input(file, std::ios::binary);
+    if(!input)
+    {
+        return false;
+    }
+
+    // The XML part precedes the appended data, which starts after the '_' following the <AppendedData> tag. Files
+    // with inline data are not mapped, only their beginning is read to find it.
+    static constexpr std::size_t s_MAX_HEADER_SIZE = 1024 * 1024;
+    static constexpr std::size_t s_CHUNK_SIZE      = 16 * 1024;
+
+    std::string content;
+    std::string xml;
+    std::string appendedAttributes;
+    std::uintmax_t appendedStart = 0;
+    while(content.size() < s_MAX_HEADER_SIZE && input)
+    {
+        char chunk[s_CHUNK_SIZE];
+        input.read(chunk, static_cast<std::streamsize>(s_CHUNK_SIZE));
+        content.append(chunk, static_cast<std::size_t>(input.gcount()));
+
+        const std::size_t tag = content.find("<AppendedData");
+        if(tag == std::string::npos)
+        {
+            continue;
+        }
+
+        const std::size_t tagEnd = content.find('>', tag);
+        const std::size_t marker = tagEnd == std::string::npos ? std::string::npos : content.find('_', tagEnd);
+        if(marker != std::string::npos)
+        {
+            xml                = content.substr(0, tag);
+            appendedAttributes = content.substr(tag + 13, tagEnd - tag - 13);
+            appendedStart      = marker + 1;
+            break;
+        }
+    }
+
+    if(xml.empty())
+    {
+        return false;
+    }
+
+    const std::string fileAttributes = getTagAttributes(xml, "VTKFile");
+    const std::string headerType     = getAttribute(fileAttributes, "header_type");
+    if(getAttribute(fileAttributes, "type") != "ImageData"
+       || getAttribute(fileAttributes, "byte_order") != (isLittleEndian() ? "LittleEndian" : "BigEndian")
+       || !getAttribute(fileAttributes, "compressor").empty()
+       || !(headerType.empty() || headerType == "UInt32" || headerType == "UInt64")
+       || getAttribute(appendedAttributes, "encoding") != "raw")
+    {
+        return false;
+    }
+
+    // A single piece covering the whole image
+    const std::string pieceAttributes = getTagAttributes(xml, "Piece");
+    if(xml.find("<Piece") != xml.rfind("<Piece")
+       || parseExtent(getAttribute(pieceAttributes, "Extent"))
+       != parseExtent(getAttribute(getTagAttributes(xml, "ImageData"), "WholeExtent")))
+    {
+        return false;
+    }
+
+    vtkSmartPointer<vtkXMLImageDataReader> reader = vtkSmartPointer<vtkXMLImageDataReader>::New();
+    reader->SetFileName(file.string().c_str());
+    reader->UpdateInformation();
+
+    ImageInformation imageInfo;
+    if(!getImageInformation(reader->GetOutputInformation(0), imageInfo))
+    {
+        return false;
+    }
+
+    // Finds the array used as scalars by VTK
+    const std::size_t pointDataStart = xml.find("<PointData");
+    const std::size_t pointDataEnd   = xml.find("</PointData>", pointDataStart);
+    if(pointDataStart == std::string::npos || pointDataEnd == std::string::npos)
+    {
+        return false;
+    }
+
+    const std::string pointData   = xml.substr(pointDataStart, pointDataEnd - pointDataStart);
+    const std::string scalarsName = imageInfo.scalarsName.empty()
+                                    ? getAttribute(getTagAttributes(pointData, "PointData"), "Scalars")
+                                    : imageInfo.scalarsName;
+
+    std::string arrayAttributes;
+    const std::regex dataArray("<DataArray\\b([^>]*)>");
+    for(auto iter = std::sregex_iterator(pointData.begin(), pointData.end(), dataArray) ;
+        iter != std::sregex_iterator() ; ++iter)
+    {
+        if(getAttribute((*iter)[1].str(), "Name") == scalarsName)
+        {
+            arrayAttributes = (*iter)[1].str();
+            break;
+        }
+    }
+
+    if(arrayAttributes.empty() || getAttribute(arrayAttributes, "format") != "appended")
+    {
+        return false;
+    }
+
+    std::uintmax_t arrayOffset = 0;
+    try
+    {
+        arrayOffset = std::stoull(getAttribute(arrayAttributes, "offset"));
+    }
+    catch(const std::exception&)
+    {
+        return false;
+    }
+
+    // The raw data of the array is preceded by its size
+    const std::uintmax_t blockStart     = appendedStart + arrayOffset;
+    const std::size_t blockHeaderSize   = headerType == "UInt64" ? 8 : 4;
+    std::uint64_t blockSize             = 0;
+    char blockHeader[8]                 = {0};
+    input.clear();
+    input.seekg(static_cast<std::streamoff>(blockStart));
+    input.read(blockHeader, static_cast<std::streamsize>(blockHeaderSize));
+    if(input.gcount() != static_cast<std::streamsize>(blockHeaderSize))
+    {
+        return false;
+    }
+
+    if(blockHeaderSize == 8)
+    {
+        std::memcpy(&blockSize, blockHeader, 8);
+    }
+    else
+    {
+        std::uint32_t blockSize32 = 0;
+        std::memcpy(&blockSize32, blockHeader, 4);
+        blockSize = blockSize32;
+    }
+
+    if(blockSize != imageInfo.sizeInBytes)
+    {
+        return false;
+    }
+
+    input.close();
+
+    return mapPixels(file, blockStart + blockHeaderSize, imageInfo, image);
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace helper
+
+} // namespace sight::io::vtk
@@ -0,0 +1,69 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "io/vtk/config.hpp"
+
+#include <data/Image.hpp>
+
+#include <filesystem>
+
+namespace sight::io::vtk
+{
+
+namespace helper
+{
+
+/**
+ * @brief Helper to map the uncompressed pixels of image files in a data::Image, without reading them.
+ *
+ * The geometry and the pixel type are read by VTK, only the pixel storage is parsed here. The image buffer is then
+ * mapped on the raw pixels in the file (see data::Image::mapFile()): the pixels are loaded when they are accessed.
+ * Nothing is done and false is returned if the pixels can not be mapped, i.e. they are compressed, encoded, split in
+ * several pieces or stored in the wrong byte order, thus the caller can read the file as usual.
+ */
+class IO_VTK_CLASS_API MappedImage
+{
+public:
+
+    /**
+     * @brief Maps the pixels of a MetaImage file (.mhd/.raw or .mha).
+     *
+     * @param[in] file MetaImage header file.
+     * @param[out] image image receiving the geometry and the mapped pixels.
+     * @return true if the pixels are mapped.
+     */
+    IO_VTK_API static bool mapMetaImage(const std::filesystem::path& file, const data::Image::sptr& image);
+
+    /**
+     * @brief Maps the pixels of a VTK XML image file (.vti) whose data is appended in raw encoding.
+     *
+     * @param[in] file VTK XML image file.
+     * @param[out] image image receiving the geometry and the mapped pixels.
+     * @return true if the pixels are mapped.
+     */
+    IO_VTK_API static bool mapVtiImage(const std::filesystem::path& file, const data::Image::sptr& image);
+};
+
+} // namespace helper
+
+} // namespace sight::io::vtk
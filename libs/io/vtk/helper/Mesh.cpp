@@ -23,20 +23,30 @@
 #include "io/vtk/helper/Mesh.hpp"
 
 #include <data/Array.hpp>
+#include <data/thread/RegionThreader.hpp>
 
 #include <vtkCell.h>
+#include <vtkCellArray.h>
 #include <vtkCellData.h>
 #include <vtkDataArray.h>
 #include <vtkExtractUnstructuredGrid.h>
 #include <vtkFillHolesFilter.h>
 #include <vtkFloatArray.h>
 #include <vtkGeometryFilter.h>
+#include <vtkIdList.h>
+#include <vtkIdTypeArray.h>
 #include <vtkMassProperties.h>
+#include <vtkNew.h>
 #include <vtkPointData.h>
 #include <vtkPoints.h>
 #include <vtkPolyDataNormals.h>
 #include <vtkSmartPointer.h>
 #include <vtkUnsignedCharArray.h>
+#include <vtkVersion.h>
+
+#include <array>
+#include <cstring>
+#include <vector>
 
 namespace sight::io::vtk
 {
@@ -44,6 +54,530 @@ namespace sight::io::vtk
 namespace helper
 {
 
+namespace
+{
+
+/// Number of elements above which the conversion loops are split between several threads
+constexpr std::size_t s_MIN_PARALLEL_SIZE = 100000;
+
+//------------------------------------------------------------------------------
+
+/// Calls _func(regionBegin, regionEnd, threadId) on [0, _size), with several threads for large ranges.
+template<typename FUNC>
+void parallelFor(FUNC _func, std::size_t _size)
+{
+    data::thread::RegionThreader rt((_size >= s_MIN_PARALLEL_SIZE) ? 4 : 1);
+    rt(_func, _size);
+}
+
+//------------------------------------------------------------------------------
+
+/// Copies a VTK RGB or RGBA color array into a RGBA buffer.
+void copyColorsFromVTK(vtkUnsignedCharArray* _src, data::iterator::RGBA* _dst, std::size_t _count)
+{
+    const unsigned char* const src = _src->GetPointer(0);
+
+    if(_src->GetNumberOfComponents() == 3)
+    {
+        parallelFor(
+            [&](std::size_t _begin, std::size_t _end, std::size_t)
+            {
+                for(std::size_t i = _begin ; i < _end ; ++i)
+                {
+                    _dst[i] = {src[i * 3], src[i * 3 + 1], src[i * 3 + 2], 255};
+                }
+            },
+            _count
+        );
+    }
+    else
+    {
+        std::memcpy(_dst, src, _count * sizeof(data::iterator::RGBA));
+    }
+}
+
+//------------------------------------------------------------------------------
+
+/// Creates a VTK color array holding a copy of a RGB or RGBA buffer.
+vtkSmartPointer<vtkUnsignedCharArray> colorsToVTK(
+    const data::Mesh::ColorValueType* _colors,
+    std::size_t _count,
+    int _nbComponents
+)
+{
+    const vtkSmartPointer<vtkUnsignedCharArray> colors = vtkSmartPointer<vtkUnsignedCharArray>::New();
+    colors->SetNumberOfComponents(_nbComponents);
+    colors->SetName("Colors");
+    colors->SetNumberOfTuples(static_cast<vtkIdType>(_count));
+    std::memcpy(colors->GetPointer(0), _colors, _count * static_cast<std::size_t>(_nbComponents));
+    return colors;
+}
+
+//------------------------------------------------------------------------------
+
+/// Creates a VTK float array holding a copy of a buffer of tuples.
+vtkSmartPointer<vtkFloatArray> floatsToVTK(const float* _values, std::size_t _count, int _nbComponents)
+{
+    const vtkSmartPointer<vtkFloatArray> array = vtkSmartPointer<vtkFloatArray>::New();
+    array->SetNumberOfComponents(_nbComponents);
+    array->SetNumberOfTuples(static_cast<vtkIdType>(_count));
+    std::memcpy(array->GetPointer(0), _values, _count * static_cast<std::size_t>(_nbComponents) * sizeof(float));
+    return array;
+}
+
+//------------------------------------------------------------------------------
+
+/// Converts contiguous VTK point ids and pushes them as _nbCells cells of the given type.
+template<typename ID_TYPE>
+void pushCellRun(
+    data::Mesh& _mesh,
+    data::Mesh::CellType _type,
+    const ID_TYPE* _ids,
+    std::size_t _nbIds,
+    data::Mesh::Size _nbCells,
+    std::vector<data::Mesh::PointId>& _buffer
+)
+{
+    _buffer.resize(_nbIds);
+    parallelFor(
+        [&](std::size_t _begin, std::size_t _end, std::size_t)
+        {
+            for(std::size_t i = _begin ; i < _end ; ++i)
+            {
+                _buffer[i] = static_cast<data::Mesh::PointId>(_ids[i]);
+            }
+        },
+        _nbIds
+    );
+    _mesh.pushCells(_type, _buffer.data(), _nbCells);
+}
+
+#if VTK_MAJOR_VERSION >= 9
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Pushes the cells of a vtkCellArray into the mesh, reading its offsets and connectivity arrays directly.
+ *
+ * Consecutive cells with the same number of points are pushed at once.
+ *
+ * @param _vtkCellType VTK_VERTEX, VTK_LINE or VTK_POLYGON, depending on whether _cells holds the vertices, the lines
+ * or the polygons of the vtkPolyData.
+ */
+template<typename ID_TYPE>
+void pushVTKCellArray(
+    data::Mesh& _mesh,
+    const ID_TYPE* _offsets,
+    const ID_TYPE* _connectivity,
+    vtkIdType _nbCells,
+    int _vtkCellType,
+    std::vector<data::Mesh::PointId>& _buffer
+)
+{
+    if(_vtkCellType == VTK_VERTEX)
+    {
+        // Vertices and poly vertices both give one point cell per id
+        const auto nbIds = static_cast<std::size_t>(_offsets[_nbCells] - _offsets[0]);
+        pushCellRun(
+            _mesh,
+            data::Mesh::CellType::POINT,
+            _connectivity + _offsets[0],
+            nbIds,
+            static_cast<data::Mesh::Size>(nbIds),
+            _buffer
+        );
+        return;
+    }
+
+    vtkIdType runBegin = 0;
+    while(runBegin < _nbCells)
+    {
+        const ID_TYPE cellSize = _offsets[runBegin + 1] - _offsets[runBegin];
+
+        vtkIdType runEnd = runBegin + 1;
+        while(runEnd < _nbCells && _offsets[runEnd + 1] - _offsets[runEnd] == cellSize)
+        {
+            ++runEnd;
+        }
+
+        data::Mesh::CellType type = data::Mesh::CellType::NO_CELL;
+        if(_vtkCellType == VTK_LINE && cellSize == 2)
+        {
+            type = data::Mesh::CellType::EDGE;
+        }
+        else if(_vtkCellType == VTK_POLYGON && cellSize == 3)
+        {
+            type = data::Mesh::CellType::TRIANGLE;
+        }
+        else if(_vtkCellType == VTK_POLYGON && cellSize == 4)
+        {
+            type = data::Mesh::CellType::QUAD;
+        }
+        else
+        {
+            SIGHT_THROW(
+                "VTK Mesh type " << (_vtkCellType == VTK_LINE ? VTK_POLY_LINE : VTK_POLYGON) << " not supported."
+            );
+        }
+
+        pushCellRun(
+            _mesh,
+            type,
+            _connectivity + _offsets[runBegin],
+            static_cast<std::size_t>(_offsets[runEnd] - _offsets[runBegin]),
+            static_cast<data::Mesh::Size>(runEnd - runBegin),
+            _buffer
+        );
+
+        runBegin = runEnd;
+    }
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+
+/// Pushes the cells of a vtkPolyData into the mesh one by one, in the order of their VTK ids.
+void pushVTKCellsOneByOne(data::Mesh& _mesh, vtkPolyData* _polyData)
+{
+    // Consecutive cells of the same type are gathered and pushed at once
+    const vtkIdType numberOfCells = _polyData->GetNumberOfCells();
+    std::vector<data::Mesh::PointId> cellPointIds;
+    cellPointIds.reserve(3 * static_cast<std::size_t>(numberOfCells));
+    data::Mesh::CellType runType = data::Mesh::CellType::NO_CELL;
+    data::Mesh::Size runSize     = 0;
+
+    const auto pushRun =
+        [&]()
+        {
+            if(runSize > 0)
+            {
+                _mesh.pushCells(runType, cellPointIds.data(), runSize);
+            }
+
+            cellPointIds.clear();
+            runSize = 0;
+        };
+
+    const auto addCell =
+        [&](data::Mesh::CellType _type, const vtkIdType* _ids, vtkIdType _nbIds)
+        {
+            if(_type != runType)
+            {
+                pushRun();
+                runType = _type;
+            }
+
+            for(vtkIdType j = 0 ; j < _nbIds ; ++j)
+            {
+                cellPointIds.push_back(static_cast<data::Mesh::PointId>(_ids[j]));
+            }
+
+            ++runSize;
+        };
+
+    vtkNew<vtkIdList> idList;
+    for(vtkIdType i = 0 ; i < numberOfCells ; ++i)
+    {
+        // Retrieve the point ids directly, without instantiating a vtkCell
+        _polyData->GetCellPoints(i, idList);
+        const vtkIdType nbIds = idList->GetNumberOfIds();
+        const vtkIdType* ids  = idList->GetPointer(0);
+        const int cellType    = _polyData->GetCellType(i);
+
+        switch(cellType)
+        {
+            case VTK_VERTEX:
+                SIGHT_ASSERT("Wrong number of ids: " << nbIds, nbIds == 1);
+                addCell(data::Mesh::CellType::POINT, ids, 1);
+                break;
+
+            case VTK_LINE:
+                SIGHT_ASSERT("Wrong number of ids: " << nbIds, nbIds == 2);
+                addCell(data::Mesh::CellType::EDGE, ids, 2);
+                break;
+
+            case VTK_TRIANGLE:
+                SIGHT_ASSERT("Wrong number of ids: " << nbIds, nbIds == 3);
+                addCell(data::Mesh::CellType::TRIANGLE, ids, 3);
+                break;
+
+            case VTK_QUAD:
+                SIGHT_ASSERT("Wrong number of ids: " << nbIds, nbIds == 4);
+                addCell(data::Mesh::CellType::QUAD, ids, 4);
+                break;
+
+            case VTK_POLY_VERTEX:
+                for(vtkIdType j = 0 ; j < nbIds ; ++j)
+                {
+                    addCell(data::Mesh::CellType::POINT, ids + j, 1);
+                }
+
+                break;
+
+            default:
+                SIGHT_THROW("VTK Mesh type " << cellType << " not supported.");
+        }
+    }
+
+    pushRun();
+}
+
+//------------------------------------------------------------------------------
+
+/// Pushes all the cells of a vtkPolyData into the mesh, in the order of their VTK ids.
+void pushVTKCells(data::Mesh& _mesh, vtkPolyData* _polyData)
+{
+#if VTK_MAJOR_VERSION >= 9
+    // Cells inserted one by one keep their insertion order, which may differ from the order of the cell arrays when
+    // vertices, lines and polygons are mixed. The cell arrays are thus only read directly when there is a single one.
+    vtkCellArray* const cellArrays[] = {_polyData->GetVerts(), _polyData->GetLines(), _polyData->GetPolys()};
+    const int vtkCellTypes[]         = {VTK_VERTEX, VTK_LINE, VTK_POLYGON};
+
+    std::size_t nbCellArrays = 0;
+    std::size_t cellArrayIdx = 0;
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        if(cellArrays[i] != nullptr && cellArrays[i]->GetNumberOfCells() > 0)
+        {
+            ++nbCellArrays;
+            cellArrayIdx = i;
+        }
+    }
+
+    if(nbCellArrays == 1 && _polyData->GetNumberOfStrips() == 0)
+    {
+        vtkCellArray* const cells = cellArrays[cellArrayIdx];
+        std::vector<data::Mesh::PointId> buffer;
+
+        if(cells->IsStorage64Bit())
+        {
+            pushVTKCellArray(
+                _mesh,
+                cells->GetOffsetsArray64()->GetPointer(0),
+                cells->GetConnectivityArray64()->GetPointer(0),
+                cells->GetNumberOfCells(),
+                vtkCellTypes[cellArrayIdx],
+                buffer
+            );
+        }
+        else
+        {
+            pushVTKCellArray(
+                _mesh,
+                cells->GetOffsetsArray32()->GetPointer(0),
+                cells->GetConnectivityArray32()->GetPointer(0),
+                cells->GetNumberOfCells(),
+                vtkCellTypes[cellArrayIdx],
+                buffer
+            );
+        }
+
+        return;
+    }
+#endif
+
+    pushVTKCellsOneByOne(_mesh, _polyData);
+}
+
+#if VTK_MAJOR_VERSION >= 9
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Builds the vertices, lines and polygons of a vtkPolyData from the mesh offsets and cell data.
+ *
+ * vtkPolyData numbers its vertices first, then its lines and finally its polygons. The cells are thus only converted
+ * if the mesh already follows this order, otherwise the ids of the cells, and so their attributes, would not match.
+ *
+ * @return false if the mesh cells could not be converted this way
+ */
+bool setVTKCellArrays(const data::Mesh& _mesh, vtkPolyData* _polyData)
+{
+    const data::Mesh::Size nbCells = _mesh.getNumberOfCells();
+    const auto cellBegin           = _mesh.begin<data::iterator::ConstCellIterator>();
+    const auto* const types        = cellBegin->type;
+    const auto* const offsets      = cellBegin->offset;
+    const auto* const cellData     = cellBegin->pointIdx;
+
+    // First cell of the vertices, lines, polygons, and end of the cells
+    std::array<data::Mesh::Size, 4> kindBegin = {0, nbCells, nbCells, nbCells};
+    std::size_t currentKind                   = 0;
+    for(data::Mesh::Size i = 0 ; i < nbCells ; ++i)
+    {
+        std::size_t kind = 0;
+        switch(types[i])
+        {
+            case data::Mesh::CellType::POINT:
+                kind = 0;
+                break;
+
+            case data::Mesh::CellType::EDGE:
+                kind = 1;
+                break;
+
+            case data::Mesh::CellType::TRIANGLE:
+            case data::Mesh::CellType::QUAD:
+                kind = 2;
+                break;
+
+            default:
+                return false;
+        }
+
+        if(kind < currentKind)
+        {
+            return false;
+        }
+
+        for( ; currentKind < kind ; ++currentKind)
+        {
+            kindBegin[currentKind + 1] = i;
+        }
+    }
+
+    std::array<vtkSmartPointer<vtkCellArray>, 3> cellArrays;
+    for(std::size_t kind = 0 ; kind < 3 ; ++kind)
+    {
+        cellArrays[kind] = vtkSmartPointer<vtkCellArray>::New();
+
+        const data::Mesh::Size begin = kindBegin[kind];
+        const data::Mesh::Size end   = kindBegin[kind + 1];
+        if(begin == end)
+        {
+            continue;
+        }
+
+        const data::Mesh::CellId dataBegin = offsets[begin];
+        const data::Mesh::CellId dataEnd   = (end < nbCells) ? offsets[end] : _mesh.getCellDataSize();
+
+        const vtkSmartPointer<vtkIdTypeArray> vtkOffsets = vtkSmartPointer<vtkIdTypeArray>::New();
+        vtkOffsets->SetNumberOfValues(static_cast<vtkIdType>(end - begin + 1));
+        vtkIdType* const dstOffsets = vtkOffsets->GetPointer(0);
+
+        const vtkSmartPointer<vtkIdTypeArray> vtkConnectivity = vtkSmartPointer<vtkIdTypeArray>::New();
+        vtkConnectivity->SetNumberOfValues(static_cast<vtkIdType>(dataEnd - dataBegin));
+        vtkIdType* const dstConnectivity = vtkConnectivity->GetPointer(0);
+
+        parallelFor(
+            [&](std::size_t _begin, std::size_t _end, std::size_t)
+            {
+                for(std::size_t i = _begin ; i < _end ; ++i)
+                {
+                    dstOffsets[i] = static_cast<vtkIdType>(offsets[begin + i] - dataBegin);
+                }
+            },
+            end - begin
+        );
+        dstOffsets[end - begin] = static_cast<vtkIdType>(dataEnd - dataBegin);
+
+        parallelFor(
+            [&](std::size_t _begin, std::size_t _end, std::size_t)
+            {
+                for(std::size_t i = _begin ; i < _end ; ++i)
+                {
+                    dstConnectivity[i] = static_cast<vtkIdType>(cellData[dataBegin + i]);
+                }
+            },
+            dataEnd - dataBegin
+        );
+
+        cellArrays[kind]->SetData(vtkOffsets, vtkConnectivity);
+    }
+
+    _polyData->SetVerts(cellArrays[0]);
+    _polyData->SetLines(cellArrays[1]);
+    _polyData->SetPolys(cellArrays[2]);
+    _polyData->SetStrips(vtkSmartPointer<vtkCellArray>::New());
+
+    return true;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+
+/// Inserts the mesh cells one by one into a vtkPolyData, tetrahedrons are inserted as lines.
+void insertVTKCells(const data::Mesh& _mesh, vtkPolyData* _polyData)
+{
+    _polyData->Allocate(static_cast<vtkIdType>(_mesh.getNumberOfCells()));
+
+    auto itr          = _mesh.begin<data::iterator::ConstCellIterator>();
+    const auto itrEnd = _mesh.end<data::iterator::ConstCellIterator>();
+
+    int typeVtkCell;
+    vtkIdType cell[4];
+    for( ; itr != itrEnd ; ++itr)
+    {
+        const data::Mesh::CellType cellType = *itr->type;
+
+        switch(cellType)
+        {
+            case data::Mesh::CellType::NO_CELL:
+                break;
+
+            case data::Mesh::CellType::POINT:
+                typeVtkCell = VTK_VERTEX;
+                cell[0]     = static_cast<vtkIdType>(itr->pointIdx[0]);
+                _polyData->InsertNextCell(typeVtkCell, 1, cell);
+                break;
+
+            case data::Mesh::CellType::EDGE:
+                typeVtkCell = VTK_LINE;
+                cell[0]     = static_cast<vtkIdType>(itr->pointIdx[0]);
+                cell[1]     = static_cast<vtkIdType>(itr->pointIdx[1]);
+                _polyData->InsertNextCell(typeVtkCell, 2, cell);
+                break;
+
+            case data::Mesh::CellType::TRIANGLE:
+                typeVtkCell = VTK_TRIANGLE;
+                cell[0]     = static_cast<vtkIdType>(itr->pointIdx[0]);
+                cell[1]     = static_cast<vtkIdType>(itr->pointIdx[1]);
+                cell[2]     = static_cast<vtkIdType>(itr->pointIdx[2]);
+                _polyData->InsertNextCell(typeVtkCell, 3, cell);
+                break;
+
+            case data::Mesh::CellType::QUAD:
+                typeVtkCell = VTK_QUAD;
+                cell[0]     = static_cast<vtkIdType>(itr->pointIdx[0]);
+                cell[1]     = static_cast<vtkIdType>(itr->pointIdx[1]);
+                cell[2]     = static_cast<vtkIdType>(itr->pointIdx[2]);
+                cell[3]     = static_cast<vtkIdType>(itr->pointIdx[3]);
+                _polyData->InsertNextCell(typeVtkCell, 4, cell);
+                break;
+
+            case data::Mesh::CellType::TETRA:
+                typeVtkCell = VTK_LINE;
+
+                cell[0] = static_cast<vtkIdType>(itr->pointIdx[1]);
+                cell[1] = static_cast<vtkIdType>(itr->pointIdx[2]);
+                _polyData->InsertNextCell(typeVtkCell, 2, cell);
+
+                cell[0] = static_cast<vtkIdType>(itr->pointIdx[2]);
+                cell[1] = static_cast<vtkIdType>(itr->pointIdx[3]);
+                _polyData->InsertNextCell(typeVtkCell, 2, cell);
+
+                cell[0] = static_cast<vtkIdType>(itr->pointIdx[3]);
+                cell[1] = static_cast<vtkIdType>(itr->pointIdx[0]);
+                _polyData->InsertNextCell(typeVtkCell, 2, cell);
+
+                cell[0] = static_cast<vtkIdType>(itr->pointIdx[2]);
+                cell[1] = static_cast<vtkIdType>(itr->pointIdx[0]);
+                _polyData->InsertNextCell(typeVtkCell, 2, cell);
+
+                cell[0] = static_cast<vtkIdType>(itr->pointIdx[1]);
+                cell[1] = static_cast<vtkIdType>(itr->pointIdx[3]);
+                _polyData->InsertNextCell(typeVtkCell, 2, cell);
+                break;
+
+            default:
+                SIGHT_THROW("Mesh type " << static_cast<int>(cellType) << " not supported.");
+        }
+    }
+}
+
+} // namespace
+
 //------------------------------------------------------------------------------
 
 void Mesh::fromVTKMesh(vtkSmartPointer<vtkPolyData> polyData, data::Mesh::sptr mesh)
@@ -108,160 +642,89 @@ void Mesh::fromVTKMesh(vtkSmartPointer<vtkPolyData> polyData, data::Mesh::sptr m
             attributes
         );
 
-        const double* point;
-        mesh->setNumberOfPoints(static_cast<data::Mesh::Size>(numberOfPoints));
-        auto pointIter = mesh->begin<data::iterator::PointIterator>();
-        for(vtkIdType i = 0 ; i < numberOfPoints ; ++i)
+        // Copy all the points at once, converting them to float if needed
+        if(points->GetDataType() == VTK_FLOAT)
         {
-            point             = points->GetPoint(i);
-            *pointIter->point =
-            {static_cast<float>(point[0]), static_cast<float>(point[1]), static_cast<float>(point[2])};
-            if(pointColors)
-            {
-                if(pointColors->GetNumberOfComponents() == 3)
-                {
-                    const auto color = pointColors->GetPointer(i * 3);
-                    pointIter->rgba->r = color[0];
-                    pointIter->rgba->g = color[1];
-                    pointIter->rgba->b = color[2];
-                    pointIter->rgba->a = 255;
-                }
-                else
-                {
-                    const auto color = pointColors->GetPointer(i * 4);
-                    pointIter->rgba->r = color[0];
-                    pointIter->rgba->g = color[1];
-                    pointIter->rgba->b = color[2];
-                    pointIter->rgba->a = color[3];
-                }
-            }
-
-            if(pointNormals)
+            mesh->pushPoints(
+                static_cast<const data::Mesh::PointValueType*>(points->GetVoidPointer(0)),
+                static_cast<data::Mesh::Size>(numberOfPoints)
+            );
+        }
+        else
+        {
+            std::vector<data::Mesh::PointValueType> floatPoints(3 * static_cast<std::size_t>(numberOfPoints));
+            if(points->GetDataType() == VTK_DOUBLE)
             {
-                const auto normal = pointNormals->GetPointer(i * 3);
-                pointIter->normal->nx = normal[0];
-                pointIter->normal->ny = normal[1];
-                pointIter->normal->nz = normal[2];
+                const double* const src = static_cast<const double*>(points->GetVoidPointer(0));
+                parallelFor(
+                    [&](std::size_t _begin, std::size_t _end, std::size_t)
+                    {
+                        for(std::size_t i = _begin ; i < _end ; ++i)
+                        {
+                            floatPoints[i] = static_cast<data::Mesh::PointValueType>(src[i]);
+                        }
+                    },
+                    floatPoints.size()
+                );
             }
-
-            if(pointTexCoords)
+            else
             {
-                const auto texCoords = pointTexCoords->GetPointer(i * 2);
-                pointIter->tex->u = texCoords[0];
-                pointIter->tex->v = texCoords[1];
+                for(vtkIdType i = 0 ; i < numberOfPoints ; ++i)
+                {
+                    const double* point = points->GetPoint(i);
+                    floatPoints[3 * static_cast<std::size_t>(i)]     = static_cast<float>(point[0]);
+                    floatPoints[3 * static_cast<std::size_t>(i) + 1] = static_cast<float>(point[1]);
+                    floatPoints[3 * static_cast<std::size_t>(i) + 2] = static_cast<float>(point[2]);
+                }
             }
 
-            ++pointIter;
+            mesh->pushPoints(floatPoints.data(), static_cast<data::Mesh::Size>(numberOfPoints));
         }
 
-        vtkCell* cell;
-        vtkIdList* idList;
-        int cellType;
-        for(vtkIdType i = 0 ; i < numberOfCells ; ++i)
-        {
-            cell     = polyData->GetCell(i);
-            idList   = cell->GetPointIds();
-            cellType = cell->GetCellType();
-
-            switch(cellType)
-            {
-                case VTK_VERTEX:
-                    SIGHT_ASSERT("Wrong number of ids: " << idList->GetNumberOfIds(), idList->GetNumberOfIds() == 1);
-                    mesh->pushCell(static_cast<data::Mesh::PointId>(idList->GetId(0)));
-                    break;
-
-                case VTK_LINE:
-                    SIGHT_ASSERT("Wrong number of ids: " << idList->GetNumberOfIds(), idList->GetNumberOfIds() == 2);
-                    mesh->pushCell(
-                        static_cast<data::Mesh::PointId>(idList->GetId(
-                                                             0
-                                                         )),
-                        static_cast<data::Mesh::PointId>(idList->GetId(1))
-                    );
-                    break;
-
-                case VTK_TRIANGLE:
-                    SIGHT_ASSERT("Wrong number of ids: " << idList->GetNumberOfIds(), idList->GetNumberOfIds() == 3);
-                    mesh->pushCell(
-                        static_cast<data::Mesh::PointId>(idList->GetId(
-                                                             0
-                                                         )),
-                        static_cast<data::Mesh::PointId>(idList->GetId(1)),
-                        static_cast<data::Mesh::PointId>(idList->GetId(2))
-                    );
-                    break;
-
-                case VTK_QUAD:
-                    SIGHT_ASSERT("Wrong number of ids: " << idList->GetNumberOfIds(), idList->GetNumberOfIds() == 4);
-                    mesh->pushCell(
-                        static_cast<data::Mesh::PointId>(idList->GetId(
-                                                             0
-                                                         )),
-                        static_cast<data::Mesh::PointId>(idList->GetId(1)),
-                        static_cast<data::Mesh::PointId>(idList->GetId(
-                                                             2
-                                                         )),
-                        static_cast<data::Mesh::PointId>(idList->GetId(3))
-                    );
-                    break;
-
-                case VTK_POLY_VERTEX:
-                    for(vtkIdType j = 0 ; j < idList->GetNumberOfIds() ; ++j)
-                    {
-                        mesh->pushCell(static_cast<data::Mesh::PointId>(idList->GetId(j)));
-                    }
+        if(pointColors || pointNormals || pointTexCoords)
+        {
+            // The mesh attribute arrays are contiguous, they are filled from their first element
+            const auto pointBegin = mesh->begin<data::iterator::PointIterator>();
+            const auto nbPoints   = static_cast<std::size_t>(numberOfPoints);
 
-                    break;
+            if(pointColors)
+            {
+                copyColorsFromVTK(pointColors, pointBegin->rgba, nbPoints);
+            }
 
-                default:
-                    SIGHT_THROW("VTK Mesh type " << cellType << " not supported.");
+            if(pointNormals)
+            {
+                std::memcpy(pointBegin->normal, pointNormals->GetPointer(0), nbPoints * sizeof(data::iterator::Normal));
+            }
+
+            if(pointTexCoords)
+            {
+                std::memcpy(pointBegin->tex, pointTexCoords->GetPointer(0), nbPoints * sizeof(data::iterator::TexCoords));
             }
         }
 
+        pushVTKCells(*mesh, polyData);
+
         mesh->adjustAllocatedMemory();
 
-        if(cellColors || cellNormals || cellTexCoords)
+        if(numberOfCells > 0 && (cellColors || cellNormals || cellTexCoords))
         {
-            auto cellIter = mesh->begin<data::iterator::CellIterator>();
+            const auto cellBegin = mesh->begin<data::iterator::CellIterator>();
+            const auto nbCells   = static_cast<std::size_t>(numberOfCells);
 
-            for(vtkIdType i = 0 ; i != numberOfCells ; ++i)
+            if(cellColors)
             {
-                if(cellColors)
-                {
-                    if(cellColors->GetNumberOfComponents() == 3)
-                    {
-                        const auto color = cellColors->GetPointer(i * 3);
-                        cellIter->rgba->r = color[0];
-                        cellIter->rgba->g = color[1];
-                        cellIter->rgba->b = color[2];
-                        cellIter->rgba->a = 255;
-                    }
-                    else
-                    {
-                        const auto color = cellColors->GetPointer(i * 4);
-                        cellIter->rgba->r = color[0];
-                        cellIter->rgba->g = color[1];
-                        cellIter->rgba->b = color[2];
-                        cellIter->rgba->a = color[3];
-                    }
-                }
-
-                if(cellNormals)
-                {
-                    const auto normal = cellNormals->GetPointer(i * 3);
-                    cellIter->normal->nx = normal[0];
-                    cellIter->normal->ny = normal[1];
-                    cellIter->normal->nz = normal[2];
-                }
+                copyColorsFromVTK(cellColors, cellBegin->rgba, nbCells);
+            }
 
-                if(cellTexCoords)
-                {
-                    const auto texCoords = cellTexCoords->GetPointer(i * 2);
-                    cellIter->tex->u = texCoords[0];
-                    cellIter->tex->v = texCoords[1];
-                }
+            if(cellNormals)
+            {
+                std::memcpy(cellBegin->normal, cellNormals->GetPointer(0), nbCells * sizeof(data::iterator::Normal));
+            }
 
-                ++cellIter;
+            if(cellTexCoords)
+            {
+                std::memcpy(cellBegin->tex, cellTexCoords->GetPointer(0), nbCells * sizeof(data::iterator::TexCoords));
             }
         }
     }
@@ -502,147 +965,27 @@ void Mesh::toVTKMesh(const data::Mesh::csptr& mesh, vtkSmartPointer<vtkPolyData>
 {
     const vtkSmartPointer<vtkPoints> pts = vtkSmartPointer<vtkPoints>::New();
     polyData->SetPoints(pts);
-    Mesh::updatePolyDataPoints(polyData, mesh);
 
     const auto nbCells  = mesh->getNumberOfCells();
     const auto dumpLock = mesh->lock();
 
     if(nbCells > 0)
     {
-        polyData->Allocate(static_cast<int>(nbCells));
-        auto itr          = mesh->begin<data::iterator::ConstCellIterator>();
-        const auto itrEnd = mesh->end<data::iterator::ConstCellIterator>();
-
-        unsigned char* newColors = nullptr;
-        float* newNormals        = nullptr;
-        float* newTexCoords      = nullptr;
-        size_t nbColorComponents = 0;
-
-        if(mesh->hasCellColors())
-        {
-            nbColorComponents = itr->rgba ? 4 : 3;
-            newColors         = new unsigned char [nbCells * nbColorComponents];
-        }
-
-        if(mesh->hasCellNormals())
+#if VTK_MAJOR_VERSION >= 9
+        if(!setVTKCellArrays(*mesh, polyData))
         {
-            newNormals = new float [nbCells * 3];
-        }
-
-        if(mesh->hasCellTexCoords())
-        {
-            newTexCoords = new float [nbCells * 2];
+            insertVTKCells(*mesh, polyData);
         }
+#else
+        insertVTKCells(*mesh, polyData);
+#endif
 
-        int typeVtkCell;
-        vtkIdType cell[4];
-        for(vtkIdType i = 0 ; itr != itrEnd ; ++itr, ++i)
-        {
-            const data::Mesh::CellType cellType = *itr->type;
-
-            switch(cellType)
-            {
-                case data::Mesh::CellType::NO_CELL:
-                    break;
-
-                case data::Mesh::CellType::POINT:
-                    typeVtkCell = VTK_VERTEX;
-                    cell[0]     = static_cast<vtkIdType>(itr->pointIdx[0]);
-                    polyData->InsertNextCell(typeVtkCell, 1, cell);
-                    break;
-
-                case data::Mesh::CellType::EDGE:
-                    typeVtkCell = VTK_LINE;
-                    cell[0]     = static_cast<vtkIdType>(itr->pointIdx[0]);
-                    cell[1]     = static_cast<vtkIdType>(itr->pointIdx[1]);
-                    polyData->InsertNextCell(typeVtkCell, 2, cell);
-                    break;
-
-                case data::Mesh::CellType::TRIANGLE:
-                    typeVtkCell = VTK_TRIANGLE;
-                    cell[0]     = static_cast<vtkIdType>(itr->pointIdx[0]);
-                    cell[1]     = static_cast<vtkIdType>(itr->pointIdx[1]);
-                    cell[2]     = static_cast<vtkIdType>(itr->pointIdx[2]);
-                    polyData->InsertNextCell(typeVtkCell, 3, cell);
-                    break;
-
-                case data::Mesh::CellType::QUAD:
-                    typeVtkCell = VTK_QUAD;
-                    cell[0]     = static_cast<vtkIdType>(itr->pointIdx[0]);
-                    cell[1]     = static_cast<vtkIdType>(itr->pointIdx[1]);
-                    cell[2]     = static_cast<vtkIdType>(itr->pointIdx[2]);
-                    cell[3]     = static_cast<vtkIdType>(itr->pointIdx[3]);
-                    polyData->InsertNextCell(typeVtkCell, 4, cell);
-                    break;
-
-                case data::Mesh::CellType::TETRA:
-                    typeVtkCell = VTK_LINE;
-
-                    cell[0] = static_cast<vtkIdType>(itr->pointIdx[1]);
-                    cell[1] = static_cast<vtkIdType>(itr->pointIdx[2]);
-                    polyData->InsertNextCell(typeVtkCell, 2, cell);
-
-                    cell[0] = static_cast<vtkIdType>(itr->pointIdx[2]);
-                    cell[1] = static_cast<vtkIdType>(itr->pointIdx[3]);
-                    polyData->InsertNextCell(typeVtkCell, 2, cell);
-
-                    cell[0] = static_cast<vtkIdType>(itr->pointIdx[3]);
-                    cell[1] = static_cast<vtkIdType>(itr->pointIdx[0]);
-                    polyData->InsertNextCell(typeVtkCell, 2, cell);
-
-                    cell[0] = static_cast<vtkIdType>(itr->pointIdx[2]);
-                    cell[1] = static_cast<vtkIdType>(itr->pointIdx[0]);
-                    polyData->InsertNextCell(typeVtkCell, 2, cell);
-
-                    cell[0] = static_cast<vtkIdType>(itr->pointIdx[1]);
-                    cell[1] = static_cast<vtkIdType>(itr->pointIdx[3]);
-                    polyData->InsertNextCell(typeVtkCell, 2, cell);
-                    break;
-
-                default:
-                    SIGHT_THROW("Mesh type " << static_cast<int>(cellType) << " not supported.");
-            }
-
-            if(mesh->hasCellColors() && nbColorComponents == 3)
-            {
-                newColors[i * 3]     = itr->rgb->r;
-                newColors[i * 3 + 1] = itr->rgb->g;
-                newColors[i * 3 + 2] = itr->rgb->b;
-            }
-            else if(mesh->hasCellColors())
-            {
-                newColors[i * 4]     = itr->rgba->r;
-                newColors[i * 4 + 1] = itr->rgba->g;
-                newColors[i * 4 + 2] = itr->rgba->b;
-                newColors[i * 4 + 3] = itr->rgba->a;
-            }
-
-            if(mesh->hasCellNormals())
-            {
-                newNormals[i * 3]     = itr->normal->nx;
-                newNormals[i * 3 + 1] = itr->normal->ny;
-                newNormals[i * 3 + 2] = itr->normal->nz;
-            }
-
-            if(mesh->hasCellTexCoords())
-            {
-                newTexCoords[i * 2]     = itr->tex->u;
-                newTexCoords[i * 2 + 1] = itr->tex->v;
-            }
-        }
+        const auto cellBegin = mesh->begin<data::iterator::ConstCellIterator>();
 
         if(mesh->hasCellColors())
         {
-            vtkSmartPointer<vtkUnsignedCharArray> colors = vtkSmartPointer<vtkUnsignedCharArray>::New();
-            colors->SetNumberOfComponents(static_cast<int>(nbColorComponents));
-            colors->SetName("Colors");
-            colors->SetArray(
-                newColors,
-                static_cast<vtkIdType>(nbCells * nbColorComponents),
-                0,
-                vtkUnsignedCharArray::VTK_DATA_ARRAY_DELETE
-            );
-            polyData->GetCellData()->SetScalars(colors);
+            const int nbComponents = mesh->hasRGBCellColors() ? 3 : 4;
+            polyData->GetCellData()->SetScalars(colorsToVTK(mesh->getCellColorsBuffer(), nbCells, nbComponents));
         }
         else if(polyData->GetCellData()->HasArray("Colors"))
         {
@@ -651,11 +994,7 @@ void Mesh::toVTKMesh(const data::Mesh::csptr& mesh, vtkSmartPointer<vtkPolyData>
 
         if(mesh->hasCellNormals())
         {
-            vtkSmartPointer<vtkFloatArray> normals = vtkSmartPointer<vtkFloatArray>::New();
-            normals->SetNumberOfComponents(3);
-            normals->SetArray(newNormals, static_cast<vtkIdType>(nbCells * 3), 0, vtkFloatArray::VTK_DATA_ARRAY_DELETE);
-
-            polyData->GetCellData()->SetNormals(normals);
+            polyData->GetCellData()->SetNormals(floatsToVTK(&cellBegin->normal->nx, nbCells, 3));
         }
         else if(polyData->GetCellData()->GetAttribute(vtkDataSetAttributes::NORMALS))
         {
@@ -664,15 +1003,7 @@ void Mesh::toVTKMesh(const data::Mesh::csptr& mesh, vtkSmartPointer<vtkPolyData>
 
         if(mesh->hasCellTexCoords())
         {
-            vtkSmartPointer<vtkFloatArray> texCoords = vtkSmartPointer<vtkFloatArray>::New();
-            texCoords->SetNumberOfComponents(2);
-            texCoords->SetArray(
-                newTexCoords,
-                static_cast<vtkIdType>(nbCells * 2),
-                0,
-                vtkFloatArray::VTK_DATA_ARRAY_DELETE
-            );
-            polyData->GetCellData()->SetTCoords(texCoords);
+            polyData->GetCellData()->SetTCoords(floatsToVTK(&cellBegin->tex->u, nbCells, 2));
         }
         else if(polyData->GetCellData()->GetAttribute(vtkDataSetAttributes::TCOORDS))
         {
@@ -869,88 +1200,15 @@ void Mesh::updatePolyDataPointsAndAttributes(
 {
     const auto dumplock = meshSrc->lock();
 
-    vtkPoints* polyDataPoints = polyDataDst->GetPoints();
-
-    auto itr          = meshSrc->begin<data::iterator::ConstPointIterator>();
-    const auto itrEnd = meshSrc->end<data::iterator::ConstPointIterator>();
-
-    const vtkIdType nbPoints = static_cast<vtkIdType>(meshSrc->getNumberOfPoints());
-
-    if(nbPoints != polyDataPoints->GetNumberOfPoints())
-    {
-        polyDataPoints->SetNumberOfPoints(nbPoints);
-    }
-
-    unsigned char* newColors = nullptr;
-    float* newNormals        = nullptr;
-    float* newTexCoords      = nullptr;
-    size_t nbColorComponents = 0;
-    if(meshSrc->hasPointColors())
-    {
-        nbColorComponents = itr->rgba ? 4 : 3;
-        newColors         = new unsigned char [static_cast<size_t>(nbPoints) * nbColorComponents];
-    }
-
-    if(meshSrc->hasPointNormals())
-    {
-        newNormals = new float [static_cast<size_t>(nbPoints * 3)];
-    }
-
-    if(meshSrc->hasPointTexCoords())
-    {
-        newTexCoords = new float [static_cast<size_t>(nbPoints * 2)];
-    }
-
-    for(vtkIdType i = 0 ; itr != itrEnd ; ++itr, ++i)
-    {
-        const auto point = itr->point;
-        polyDataPoints->SetPoint(
-            i,
-            static_cast<double>(point->x),
-            static_cast<double>(point->y),
-            static_cast<double>(point->z)
-        );
-
-        if(meshSrc->hasPointColors() && nbColorComponents == 3)
-        {
-            newColors[i * 3]     = itr->rgb->r;
-            newColors[i * 3 + 1] = itr->rgb->g;
-            newColors[i * 3 + 2] = itr->rgb->b;
-        }
-        else if(meshSrc->hasPointColors())
-        {
-            newColors[i * 4]     = itr->rgba->r;
-            newColors[i * 4 + 1] = itr->rgba->g;
-            newColors[i * 4 + 2] = itr->rgba->b;
-            newColors[i * 4 + 3] = itr->rgba->a;
-        }
-
-        if(meshSrc->hasPointNormals())
-        {
-            newNormals[i * 3]     = itr->normal->nx;
-            newNormals[i * 3 + 1] = itr->normal->ny;
-            newNormals[i * 3 + 2] = itr->normal->nz;
-        }
+    Mesh::updatePolyDataPoints(polyDataDst, meshSrc);
 
-        if(meshSrc->hasPointTexCoords())
-        {
-            newTexCoords[i * 2]     = itr->tex->u;
-            newTexCoords[i * 2 + 1] = itr->tex->v;
-        }
-    }
+    const auto nbPoints   = static_cast<std::size_t>(meshSrc->getNumberOfPoints());
+    const auto pointBegin = meshSrc->begin<data::iterator::ConstPointIterator>();
 
     if(meshSrc->hasPointColors())
     {
-        vtkSmartPointer<vtkUnsignedCharArray> colors = vtkSmartPointer<vtkUnsignedCharArray>::New();
-        colors->SetNumberOfComponents(static_cast<int>(nbColorComponents));
-        colors->SetName("Colors");
-        colors->SetArray(
-            newColors,
-            nbPoints * static_cast<vtkIdType>(nbColorComponents),
-            0,
-            vtkUnsignedCharArray::VTK_DATA_ARRAY_DELETE
-        );
-        polyDataDst->GetPointData()->SetScalars(colors);
+        const int nbComponents = meshSrc->hasRGBPointColors() ? 3 : 4;
+        polyDataDst->GetPointData()->SetScalars(colorsToVTK(meshSrc->getPointColorsBuffer(), nbPoints, nbComponents));
     }
     else if(polyDataDst->GetPointData()->HasArray("Colors"))
     {
@@ -959,11 +1217,7 @@ void Mesh::updatePolyDataPointsAndAttributes(
 
     if(meshSrc->hasPointNormals())
     {
-        vtkSmartPointer<vtkFloatArray> normals = vtkSmartPointer<vtkFloatArray>::New();
-        normals->SetNumberOfComponents(3);
-        normals->SetArray(newNormals, nbPoints * 3, 0, vtkFloatArray::VTK_DATA_ARRAY_DELETE);
-
-        polyDataDst->GetPointData()->SetNormals(normals);
+        polyDataDst->GetPointData()->SetNormals(floatsToVTK(&pointBegin->normal->nx, nbPoints, 3));
     }
     else if(polyDataDst->GetPointData()->GetAttribute(vtkDataSetAttributes::NORMALS))
     {
@@ -972,17 +1226,13 @@ void Mesh::updatePolyDataPointsAndAttributes(
 
     if(meshSrc->hasPointTexCoords())
     {
-        vtkSmartPointer<vtkFloatArray> texCoords = vtkSmartPointer<vtkFloatArray>::New();
-        texCoords->SetNumberOfComponents(2);
-        texCoords->SetArray(newTexCoords, nbPoints * 2, 0, vtkFloatArray::VTK_DATA_ARRAY_DELETE);
-        polyDataDst->GetPointData()->SetTCoords(texCoords);
+        polyDataDst->GetPointData()->SetTCoords(floatsToVTK(&pointBegin->tex->u, nbPoints, 2));
     }
     else if(polyDataDst->GetPointData()->GetAttribute(vtkDataSetAttributes::TCOORDS))
     {
         polyDataDst->GetPointData()->RemoveArray(vtkDataSetAttributes::TCOORDS);
     }
 
-    polyDataPoints->Modified();
     polyDataDst->Modified();
 }
 
@@ -998,16 +1248,26 @@ void Mesh::updatePolyDataPoints(
     vtkPoints* polyDataPoints = polyDataDst->GetPoints();
     const vtkIdType nbPoints  = static_cast<vtkIdType>(meshSrc->getNumberOfPoints());
     const auto dumpLock       = meshSrc->lock();
-    auto points               = meshSrc->begin<data::iterator::ConstPointIterator>();
+
+    // Mesh points are stored as float, they are copied at once in a float VTK array
+    if(polyDataPoints->GetDataType() != VTK_FLOAT)
+    {
+        polyDataPoints->SetDataTypeToFloat();
+    }
 
     if(nbPoints != polyDataPoints->GetNumberOfPoints())
     {
         polyDataPoints->SetNumberOfPoints(nbPoints);
     }
 
-    for(vtkIdType i = 0 ; i != nbPoints ; ++i, ++points)
+    if(nbPoints > 0)
     {
-        polyDataPoints->SetPoint(i, points->point->x, points->point->y, points->point->z);
+        const auto pointBegin = meshSrc->begin<data::iterator::ConstPointIterator>();
+        std::memcpy(
+            polyDataPoints->GetVoidPointer(0),
+            pointBegin->point,
+            static_cast<std::size_t>(nbPoints) * sizeof(data::iterator::Point)
+        );
     }
 
     polyDataPoints->Modified();
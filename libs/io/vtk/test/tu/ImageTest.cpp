@@ -22,6 +22,7 @@
 
 #include "ImageTest.hpp"
 
+#include <core/memory/BufferManager.hpp>
 #include <core/tools/System.hpp>
 
 #include <data/Image.hpp>
@@ -40,10 +41,12 @@
 
 #include <vtkGenericDataObjectReader.h>
 #include <vtkImageData.h>
+#include <vtkMetaImageWriter.h>
 #include <vtkPointData.h>
 #include <vtkPolyData.h>
 #include <vtkSmartPointer.h>
 #include <vtkSphereSource.h>
+#include <vtkXMLImageDataWriter.h>
 
 #include <filesystem>
 
@@ -198,6 +201,55 @@ void writerTest(const std::string& imagetype, const std::string& filename)
 
 //------------------------------------------------------------------------------
 
+template<typename R>
+void mappedImageTest(const data::Image::sptr& image, const std::filesystem::path& file, bool mapped)
+{
+    data::Image::sptr mappedImage = data::Image::New();
+    typename R::sptr reader       = R::New();
+    reader->setObject(mappedImage);
+    reader->setFile(file);
+    reader->enableMapping(true);
+    reader->read();
+
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("test on <" + file.string() + "> Failed ", image->getType(), mappedImage->getType());
+
+    compareImageAttributes(
+        image->getSize2(),
+        image->getSpacing2(),
+        image->getOrigin2(),
+        image->getNumberOfDimensions(),
+
+        mappedImage->getSize2(),
+        mappedImage->getSpacing2(),
+        mappedImage->getOrigin2(),
+        mappedImage->getNumberOfDimensions()
+    );
+
+    CPPUNIT_ASSERT_EQUAL(image->getSizeInBytes(), mappedImage->getSizeInBytes());
+
+    // The buffer is backed by a copy-on-write mapping of the file only if the fast path was taken
+    const auto infos = core::memory::BufferManager::getDefault()->getBufferInfos().get();
+    const auto& info = infos.at(mappedImage->getBufferObject()->getBufferPointer());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("test on <" + file.string() + "> Failed ", mapped, bool(info.mappedFile));
+    if(mapped)
+    {
+        CPPUNIT_ASSERT(info.mappedFile->isCopyOnWrite());
+    }
+
+    const auto dumpLock       = image->lock();
+    const auto mappedDumpLock = mappedImage->lock();
+
+    const char* ptr       = static_cast<const char*>(image->getBuffer());
+    const char* mappedPtr = static_cast<const char*>(mappedImage->getBuffer());
+
+    CPPUNIT_ASSERT_MESSAGE(
+        "test on <" + file.string() + "> Failed ",
+        std::equal(ptr, ptr + image->getSizeInBytes(), mappedPtr)
+    );
+}
+
+//------------------------------------------------------------------------------
+
 void imageFromVTKTest(const std::string& imagename, const std::string& type)
 {
     const std::filesystem::path imagePath(utestData::Data::dir()
@@ -584,6 +636,62 @@ void ImageTest::vtiWriterTest()
 
 // ------------------------------------------------------------------------------
 
+void ImageTest::mappedReaderTest()
+{
+    const std::filesystem::path folder(core::tools::System::getTemporaryFolder() / "mappedReaderTest");
+    std::filesystem::create_directories(folder);
+
+    for(const std::string& type : {"int8", "uint8", "int16", "uint16", "int32", "uint32", "float"})
+    {
+        data::Image::sptr image = data::Image::New();
+        utestData::generator::Image::generateRandomImage(image, core::tools::Type(type));
+
+        // Uncompressed files, the pixels are mapped
+        {
+            const auto dumpLock = image->lock();
+
+            vtkSmartPointer<vtkImageData> vtkImage = vtkSmartPointer<vtkImageData>::New();
+            io::vtk::toVTKImage(image, vtkImage);
+
+            vtkSmartPointer<vtkMetaImageWriter> mhdWriter = vtkSmartPointer<vtkMetaImageWriter>::New();
+            mhdWriter->SetInputData(vtkImage);
+            mhdWriter->SetFileName((folder / "image.mhd").string().c_str());
+            mhdWriter->SetRAWFileName((folder / "image.raw").string().c_str());
+            mhdWriter->SetCompression(false);
+            mhdWriter->Write();
+
+            vtkSmartPointer<vtkXMLImageDataWriter> vtiWriter = vtkSmartPointer<vtkXMLImageDataWriter>::New();
+            vtiWriter->SetInputData(vtkImage);
+            vtiWriter->SetFileName((folder / "image.vti").string().c_str());
+            vtiWriter->SetDataModeToAppended();
+            vtiWriter->EncodeAppendedDataOff();
+            vtiWriter->SetCompressorTypeToNone();
+            vtiWriter->Write();
+        }
+
+        mappedImageTest<io::vtk::MetaImageReader>(image, folder / "image.mhd", true);
+        mappedImageTest<io::vtk::VtiImageReader>(image, folder / "image.vti", true);
+
+        // Compressed files, the readers fall back to VTK
+        io::vtk::MetaImageWriter::sptr mhdWriter = io::vtk::MetaImageWriter::New();
+        mhdWriter->setObject(image);
+        mhdWriter->setFile(folder / "compressed.mhd");
+        mhdWriter->write();
+
+        io::vtk::VtiImageWriter::sptr vtiWriter = io::vtk::VtiImageWriter::New();
+        vtiWriter->setObject(image);
+        vtiWriter->setFile(folder / "compressed.vti");
+        vtiWriter->write();
+
+        mappedImageTest<io::vtk::MetaImageReader>(image, folder / "compressed.mhd", false);
+        mappedImageTest<io::vtk::VtiImageReader>(image, folder / "compressed.vti", false);
+    }
+
+    std::filesystem::remove_all(folder);
+}
+
+// ------------------------------------------------------------------------------
+
 void ImageTest::vtkReaderTest()
 {
     const std::filesystem::path imagePath(utestData::Data::dir() / "sight/image/vtk/img.vtk");
@@ -47,6 +47,7 @@ CPPUNIT_TEST(mhdReaderTest);
 CPPUNIT_TEST(mhdWriterTest);
 CPPUNIT_TEST(vtiReaderTest);
 CPPUNIT_TEST(vtiWriterTest);
+CPPUNIT_TEST(mappedReaderTest);
 CPPUNIT_TEST(vtkReaderTest);
 CPPUNIT_TEST(vtkWriterTest);
 
@@ -66,6 +67,7 @@ public:
     void mhdWriterTest();
     void vtiReaderTest();
     void vtiWriterTest();
+    void mappedReaderTest();
     void vtkReaderTest();
     void vtkWriterTest();
 };
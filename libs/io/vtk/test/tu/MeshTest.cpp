@@ -44,6 +44,8 @@
 #include <utestData/Data.hpp>
 #include <utestData/generator/Mesh.hpp>
 
+#include <vtkCellArray.h>
+#include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkPolyDataMapper.h>
 #include <vtkSmartPointer.h>
@@ -729,6 +731,205 @@ void MeshTest::testWriteStlFile()
 
 //------------------------------------------------------------------------------
 
+void MeshTest::testMixedCells()
+{
+    // Cells sorted as vertices, lines and polygons are converted through the VTK cell arrays, the others one by one
+    for(const bool sorted : {true, false})
+    {
+        const data::Mesh::sptr mesh1 = data::Mesh::New();
+        mesh1->reserve(
+            8,
+            5,
+            data::Mesh::CellType::QUAD,
+            data::Mesh::Attributes::POINT_COLORS | data::Mesh::Attributes::POINT_NORMALS
+            | data::Mesh::Attributes::POINT_TEX_COORDS | data::Mesh::Attributes::CELL_COLORS
+            | data::Mesh::Attributes::CELL_NORMALS | data::Mesh::Attributes::CELL_TEX_COORDS
+        );
+
+        const auto dumpLock = mesh1->lock();
+
+        for(data::Mesh::PointId i = 0 ; i < 8 ; ++i)
+        {
+            const float value = static_cast<float>(i);
+            mesh1->pushPoint(value, 2.f * value, -value);
+            mesh1->setPointColor(i, static_cast<std::uint8_t>(i), 10, 20, 255);
+            mesh1->setPointNormal(i, 0.f, 0.f, 1.f);
+            mesh1->setPointTexCoord(i, value / 8.f, 1.f - value / 8.f);
+        }
+
+        if(sorted)
+        {
+            mesh1->pushCell(0);
+            mesh1->pushCell(1, 2);
+            mesh1->pushCell(0, 1, 2);
+            mesh1->pushCell(2, 3, 4);
+            mesh1->pushCell(4, 5, 6, 7);
+        }
+        else
+        {
+            mesh1->pushCell(0, 1, 2);
+            mesh1->pushCell(0);
+            mesh1->pushCell(4, 5, 6, 7);
+            mesh1->pushCell(1, 2);
+            mesh1->pushCell(2, 3, 4);
+        }
+
+        for(data::Mesh::CellId i = 0 ; i < 5 ; ++i)
+        {
+            const float value = static_cast<float>(i);
+            mesh1->setCellColor(i, 255, static_cast<std::uint8_t>(i), 0, 128);
+            mesh1->setCellNormal(i, 1.f, 0.f, 0.f);
+            mesh1->setCellTexCoord(i, value / 5.f, 0.5f);
+        }
+
+        mesh1->adjustAllocatedMemory();
+
+        const vtkSmartPointer<vtkPolyData> poly = vtkSmartPointer<vtkPolyData>::New();
+        io::vtk::helper::Mesh::toVTKMesh(mesh1, poly);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<vtkIdType>(8), poly->GetNumberOfPoints());
+        CPPUNIT_ASSERT_EQUAL(static_cast<vtkIdType>(1), poly->GetNumberOfVerts());
+        CPPUNIT_ASSERT_EQUAL(static_cast<vtkIdType>(1), poly->GetNumberOfLines());
+        CPPUNIT_ASSERT_EQUAL(static_cast<vtkIdType>(3), poly->GetNumberOfPolys());
+
+        const data::Mesh::sptr mesh2 = data::Mesh::New();
+        io::vtk::helper::Mesh::fromVTKMesh(poly, mesh2);
+
+        compare(mesh1, mesh2);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void MeshTest::testDoublePrecisionPoints()
+{
+    const vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+    points->SetDataTypeToDouble();
+    points->InsertNextPoint(0.5, 1.5, 2.5);
+    points->InsertNextPoint(-3.25, 4., 0.);
+    points->InsertNextPoint(1e3, -1e-3, 7.);
+
+    const vtkSmartPointer<vtkCellArray> polys = vtkSmartPointer<vtkCellArray>::New();
+    const vtkIdType triangle[3]               = {2, 0, 1};
+    polys->InsertNextCell(3, triangle);
+
+    const vtkSmartPointer<vtkPolyData> poly = vtkSmartPointer<vtkPolyData>::New();
+    poly->SetPoints(points);
+    poly->SetPolys(polys);
+
+    const data::Mesh::sptr mesh = data::Mesh::New();
+    io::vtk::helper::Mesh::fromVTKMesh(poly, mesh);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<data::Mesh::Size>(3), mesh->getNumberOfPoints());
+    CPPUNIT_ASSERT_EQUAL(static_cast<data::Mesh::Size>(1), mesh->getNumberOfCells());
+
+    const auto dumpLock = mesh->lock();
+
+    auto pointItr = mesh->begin<data::iterator::ConstPointIterator>();
+    for(vtkIdType i = 0 ; i < 3 ; ++i, ++pointItr)
+    {
+        const double* point = points->GetPoint(i);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(static_cast<float>(point[0]), pointItr->point->x, 1e-6);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(static_cast<float>(point[1]), pointItr->point->y, 1e-6);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(static_cast<float>(point[2]), pointItr->point->z, 1e-6);
+    }
+
+    const auto cellItr = mesh->begin<data::iterator::ConstCellIterator>();
+    CPPUNIT_ASSERT(*cellItr->type == data::Mesh::CellType::TRIANGLE);
+    CPPUNIT_ASSERT_EQUAL(static_cast<data::Mesh::PointId>(2), cellItr->pointIdx[0]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<data::Mesh::PointId>(0), cellItr->pointIdx[1]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<data::Mesh::PointId>(1), cellItr->pointIdx[2]);
+}
+
+//------------------------------------------------------------------------------
+
+void MeshTest::bulkConversionTest()
+{
+    const data::Mesh::Size width    = 101;
+    const data::Mesh::Size height   = 51;
+    const data::Mesh::Size nbPoints = width * height;
+
+    std::vector<data::Mesh::PointValueType> points(3 * std::size_t(nbPoints));
+    std::vector<data::Mesh::PointId> triangles;
+    triangles.reserve(6 * std::size_t(width - 1) * std::size_t(height - 1));
+    for(data::Mesh::Size y = 0 ; y < height ; ++y)
+    {
+        for(data::Mesh::Size x = 0 ; x < width ; ++x)
+        {
+            const data::Mesh::PointId id = y * width + x;
+            points[3 * std::size_t(id)]     = static_cast<float>(x);
+            points[3 * std::size_t(id) + 1] = static_cast<float>(y);
+            points[3 * std::size_t(id) + 2] = static_cast<float>((x + y) % 7);
+
+            if(x + 1 < width && y + 1 < height)
+            {
+                triangles.insert(triangles.end(), {id, id + 1, id + width});
+                triangles.insert(triangles.end(), {id + 1, id + width + 1, id + width});
+            }
+        }
+    }
+
+    const auto nbTriangles = static_cast<data::Mesh::Size>(triangles.size() / 3);
+
+    const data::Mesh::sptr mesh1 = data::Mesh::New();
+    mesh1->reserve(
+        nbPoints,
+        nbTriangles,
+        data::Mesh::CellType::TRIANGLE,
+        data::Mesh::Attributes::POINT_COLORS | data::Mesh::Attributes::POINT_NORMALS
+    );
+    const auto dumpLock1 = mesh1->lock();
+    mesh1->pushPoints(points.data(), nbPoints);
+    mesh1->pushCells(data::Mesh::CellType::TRIANGLE, triangles.data(), nbTriangles);
+
+    auto pointItr = mesh1->begin<data::iterator::PointIterator>();
+    for(data::Mesh::Size i = 0 ; i < nbPoints ; ++i, ++pointItr)
+    {
+        *pointItr->rgba   = {static_cast<std::uint8_t>(i % 256), 128, 64, 255};
+        *pointItr->normal = {0.f, 0.f, 1.f};
+    }
+
+    const vtkSmartPointer<vtkPolyData> poly = vtkSmartPointer<vtkPolyData>::New();
+    io::vtk::helper::Mesh::toVTKMesh(mesh1, poly);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<vtkIdType>(nbPoints), poly->GetNumberOfPoints());
+    CPPUNIT_ASSERT_EQUAL(static_cast<vtkIdType>(nbTriangles), poly->GetNumberOfPolys());
+
+    const data::Mesh::sptr mesh2 = data::Mesh::New();
+    io::vtk::helper::Mesh::fromVTKMesh(poly, mesh2);
+
+    CPPUNIT_ASSERT_EQUAL(nbPoints, mesh2->getNumberOfPoints());
+    CPPUNIT_ASSERT_EQUAL(nbTriangles, mesh2->getNumberOfCells());
+    CPPUNIT_ASSERT(mesh2->hasPointColors());
+    CPPUNIT_ASSERT(mesh2->hasPointNormals());
+
+    // Every point and cell survives the round trip through VTK
+    const auto dumpLock2 = mesh2->lock();
+
+    auto cellItr = mesh2->begin<data::iterator::ConstCellIterator>();
+    for(data::Mesh::Size i = 0 ; i < nbTriangles ; ++i, ++cellItr)
+    {
+        CPPUNIT_ASSERT(*cellItr->type == data::Mesh::CellType::TRIANGLE);
+        CPPUNIT_ASSERT_EQUAL(triangles[3 * std::size_t(i)], cellItr->pointIdx[0]);
+        CPPUNIT_ASSERT_EQUAL(triangles[3 * std::size_t(i) + 1], cellItr->pointIdx[1]);
+        CPPUNIT_ASSERT_EQUAL(triangles[3 * std::size_t(i) + 2], cellItr->pointIdx[2]);
+    }
+
+    auto pointItr2 = mesh2->begin<data::iterator::ConstPointIterator>();
+    for(data::Mesh::Size i = 0 ; i < nbPoints ; ++i, ++pointItr2)
+    {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(points[3 * std::size_t(i)], pointItr2->point->x, 1e-6);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(points[3 * std::size_t(i) + 1], pointItr2->point->y, 1e-6);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(points[3 * std::size_t(i) + 2], pointItr2->point->z, 1e-6);
+        CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(i % 256), pointItr2->rgba->r);
+        CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(128), pointItr2->rgba->g);
+        CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(64), pointItr2->rgba->b);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(1.f, pointItr2->normal->nz, 1e-6);
+    }
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace ut
 
 } // namespace sight::io::vtk
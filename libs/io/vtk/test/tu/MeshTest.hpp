@@ -44,6 +44,9 @@ CPPUNIT_TEST(testMeshToGrid);
 CPPUNIT_TEST(testSyntheticMesh);
 CPPUNIT_TEST(testExportImportSyntheticMesh);
 CPPUNIT_TEST(testPointCloud);
+CPPUNIT_TEST(testMixedCells);
+CPPUNIT_TEST(testDoublePrecisionPoints);
+CPPUNIT_TEST(bulkConversionTest);
 CPPUNIT_TEST(testMeshUpdatePoints);
 CPPUNIT_TEST(testMeshUpdateColors);
 CPPUNIT_TEST(testMeshUpdateNormals);
@@ -73,6 +76,9 @@ public:
     void testSyntheticMesh();
     void testExportImportSyntheticMesh();
     void testPointCloud();
+    void testMixedCells();
+    void testDoublePrecisionPoints();
+    void bulkConversionTest();
     void testMeshUpdatePoints();
     void testMeshUpdateColors();
     void testMeshUpdateNormals();
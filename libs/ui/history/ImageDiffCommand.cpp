@@ -37,7 +37,6 @@ ImageDiffCommand::ImageDiffCommand(const data::Image::sptr& img, filter::image::
     m_modifSig(img->signal<data::Image::BufferModifiedSignalType>(data::Image::s_BUFFER_MODIFIED_SIG)),
     m_diff(diff)
 {
-    m_diff.shrink();
 }
 
 //------------------------------------------------------------------------------
@@ -27,6 +27,7 @@
 
 #include <core/data/Image.hpp>
 
+#include <filter/image/CompressedImageDiff.hpp>
 #include <filter/image/Image.hpp>
 #include <filter/image/ImageDiff.hpp>
 
@@ -37,7 +38,7 @@ class UI_HISTORY_CLASS_API ImageDiffCommand : public ICommand
 {
 public:
 
-    /// Constructor, uses an image and a change list for that image.
+    /// Constructor, uses an image and a change list for that image. The change list is stored compressed.
     UI_HISTORY_API ImageDiffCommand(const data::Image::sptr& img, filter::image::ImageDiff diff);
 
     /// The diff size.
@@ -58,7 +59,7 @@ private:
 
     data::Image::BufferModifiedSignalType::sptr m_modifSig;
 
-    filter::image::ImageDiff m_diff;
+    filter::image::CompressedImageDiff m_diff;
 };
 
 } // namespace sight::ui::history
@@ -161,8 +161,8 @@ void ImageDiffCommandTest::getSizeTest()
     // Ensure that the real size is at least bigger than the naive sizeof
     CPPUNIT_ASSERT(imageDiffCommand.getSize() > sizeof(imageDiffCommand));
 
-    // Ensure that the real size is at least bigger than the size of the diff
-    CPPUNIT_ASSERT(imageDiffCommand.getSize() > diff.getSize());
+    // Ensure that the command does not take more memory than the uncompressed diff
+    CPPUNIT_ASSERT(imageDiffCommand.getSize() < sizeof(imageDiffCommand) + diff.getSize());
 }
 
 //------------------------------------------------------------------------------
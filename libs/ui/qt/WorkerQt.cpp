@@ -81,6 +81,8 @@ public:
 
     void stop();
 
+    using core::thread::Worker::post;
+
     void post(TaskType handler);
 
     void setApp(QSharedPointer<QCoreApplication> app, const std::string& name, const std::string& version);
@@ -298,7 +300,7 @@ SPTR(core::thread::Timer) WorkerQt::createTimer()
 
 void WorkerQt::post(TaskType handler)
 {
-    QCoreApplication::postEvent(QCoreApplication::instance(), new WorkerQtTask(handler));
+    QCoreApplication::postEvent(QCoreApplication::instance(), new WorkerQtTask(this->instrument(handler)));
 }
 
 //------------------------------------------------------------------------------
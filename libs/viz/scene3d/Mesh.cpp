@@ -144,7 +144,7 @@ Mesh::~Mesh()
 //-----------------------------------------------------------------------------
 
 void Mesh::bindLayer(
-    const data::Mesh::csptr& _mesh,
+    size_t _numVertices,
     BufferBinding _binding,
     ::Ogre::VertexElementSemantic _semantic,
     ::Ogre::VertexElementType _type
@@ -166,7 +166,7 @@ void Mesh::bindLayer(
     // Get requested buffer size and previous buffer size.
     ::Ogre::HardwareVertexBufferSharedPtr cbuf;
 
-    const size_t uiNumVertices = _mesh->getNumberOfPoints();
+    const size_t uiNumVertices = _numVertices;
     size_t uiPrevNumVertices   = 0;
     if(bind->isBufferBound(m_binding[_binding]))
     {
@@ -318,34 +318,40 @@ void Mesh::updateMesh(const data::Mesh::sptr& _mesh, bool _pointsOnly)
 
     memset(numIndices, 0, sizeof(numIndices));
 
-    for( ; cellItr != cellEnd ; ++cellItr)
+    if(_pointsOnly)
     {
-        auto cellType = _pointsOnly
-                        ? data::Mesh::CellType::POINT
-                        : *cellItr->type;
-        if(cellType == data::Mesh::CellType::POINT)
-        {
-            numIndices[static_cast<unsigned int>(data::Mesh::CellType::POINT)] += 1;
-        }
-        else if(cellType == data::Mesh::CellType::EDGE)
-        {
-            numIndices[static_cast<unsigned int>(data::Mesh::CellType::EDGE)] += 2;
-        }
-        else if(cellType == data::Mesh::CellType::TRIANGLE)
-        {
-            numIndices[static_cast<unsigned int>(data::Mesh::CellType::TRIANGLE)] += 3;
-        }
-        else if(cellType == data::Mesh::CellType::QUAD)
-        {
-            numIndices[static_cast<unsigned int>(data::Mesh::CellType::QUAD)] += 4;
-        }
-        else if(cellType == data::Mesh::CellType::TETRA)
-        {
-            numIndices[static_cast<unsigned int>(data::Mesh::CellType::TETRA)] += 4;
-        }
-        else
+        // Points are rendered without index buffer, so there is no need to walk through the cells
+        numIndices[static_cast<unsigned int>(data::Mesh::CellType::POINT)] = static_cast<unsigned int>(numVertices);
+    }
+    else
+    {
+        for( ; cellItr != cellEnd ; ++cellItr)
         {
-            SIGHT_ERROR("Unhandled cell type in Ogre mesh: " << static_cast<int>(cellType));
+            auto cellType = *cellItr->type;
+            if(cellType == data::Mesh::CellType::POINT)
+            {
+                numIndices[static_cast<unsigned int>(data::Mesh::CellType::POINT)] += 1;
+            }
+            else if(cellType == data::Mesh::CellType::EDGE)
+            {
+                numIndices[static_cast<unsigned int>(data::Mesh::CellType::EDGE)] += 2;
+            }
+            else if(cellType == data::Mesh::CellType::TRIANGLE)
+            {
+                numIndices[static_cast<unsigned int>(data::Mesh::CellType::TRIANGLE)] += 3;
+            }
+            else if(cellType == data::Mesh::CellType::QUAD)
+            {
+                numIndices[static_cast<unsigned int>(data::Mesh::CellType::QUAD)] += 4;
+            }
+            else if(cellType == data::Mesh::CellType::TETRA)
+            {
+                numIndices[static_cast<unsigned int>(data::Mesh::CellType::TETRA)] += 4;
+            }
+            else
+            {
+                SIGHT_ERROR("Unhandled cell type in Ogre mesh: " << static_cast<int>(cellType));
+            }
         }
     }
 
@@ -578,6 +584,87 @@ void Mesh::updateMesh(const data::PointList::csptr& _pointList)
 
 //------------------------------------------------------------------------------
 
+void Mesh::updateMesh(const data::PointCloud::csptr& _pointCloud)
+{
+    const size_t uiNumVertices = _pointCloud->getNumberOfPoints();
+    SIGHT_DEBUG("Vertices #" << uiNumVertices);
+
+    // Check if mesh attributes
+    const bool hadNormal = m_hasNormal;
+    m_hasNormal          = _pointCloud->hasPointNormals();
+
+    //------------------------------------------
+    // Create vertex arrays
+    //------------------------------------------
+
+    // Create vertex data structure for all vertices shared between submeshes
+    if(!m_ogreMesh->sharedVertexData)
+    {
+        m_ogreMesh->sharedVertexData = new ::Ogre::VertexData();
+    }
+
+    ::Ogre::VertexBufferBinding& bind = *m_ogreMesh->sharedVertexData->vertexBufferBinding;
+    size_t uiPrevNumVertices          = 0;
+    if(bind.isBufferBound(m_binding[POSITION_NORMAL]))
+    {
+        uiPrevNumVertices = bind.getBuffer(m_binding[POSITION_NORMAL])->getNumVertices();
+    }
+
+    // The point cloud does not have any cell, we only need to reallocate when it grows or when the layout changes
+    if(uiPrevNumVertices < uiNumVertices || hadNormal != m_hasNormal)
+    {
+        FW_PROFILE("REALLOC MESH");
+
+        // We need to reallocate
+        m_ogreMesh->sharedVertexData->vertexCount = uiNumVertices;
+
+        // Allocate vertex buffer of the requested number of vertices (vertexCount)
+        // and bytes per vertex (offset)
+        ::Ogre::HardwareVertexBufferSharedPtr vbuf;
+        ::Ogre::HardwareBuffer::Usage usage = (m_isDynamic || m_isDynamicVertices)
+                                              ? ::Ogre::HardwareBuffer::HBU_DYNAMIC_WRITE_ONLY_DISCARDABLE
+                                              : ::Ogre::HardwareBuffer::HBU_STATIC_WRITE_ONLY;
+
+        size_t offset = 0;
+
+        // Create declaration (memory format) of vertex data based on data::PointCloud
+        ::Ogre::VertexDeclaration* declMain = m_ogreMesh->sharedVertexData->vertexDeclaration;
+
+        // Clear if necessary
+        declMain->removeAllElements();
+
+        // 1st buffer
+        declMain->addElement(m_binding[POSITION_NORMAL], offset, ::Ogre::VET_FLOAT3, ::Ogre::VES_POSITION);
+        offset += ::Ogre::VertexElement::getTypeSize(::Ogre::VET_FLOAT3);
+
+        if(m_hasNormal)
+        {
+            declMain->addElement(m_binding[POSITION_NORMAL], offset, ::Ogre::VET_FLOAT3, ::Ogre::VES_NORMAL);
+            offset += ::Ogre::VertexElement::getTypeSize(::Ogre::VET_FLOAT3);
+        }
+
+        // Set vertex buffer binding so buffer 0 is bound to our vertex buffer
+        ::Ogre::HardwareBufferManager& mgr = ::Ogre::HardwareBufferManager::getSingleton();
+        vbuf = mgr.createVertexBuffer(offset, uiNumVertices, usage, false);
+        bind.setBinding(m_binding[POSITION_NORMAL], vbuf);
+    }
+    else
+    {
+        // We don't reallocate, we keep the same vertex buffers and only update the number of vertices
+        m_ogreMesh->sharedVertexData->vertexCount = uiNumVertices;
+    }
+
+    const size_t pointType = static_cast<size_t>(data::Mesh::CellType::POINT);
+    if(m_subMeshes[pointType] == nullptr)
+    {
+        m_subMeshes[pointType] =
+            m_ogreMesh->createSubMesh(std::to_string(pointType));
+        m_subMeshes[pointType]->operationType = ::Ogre::RenderOperation::OT_POINT_LIST;
+    }
+}
+
+//------------------------------------------------------------------------------
+
 std::pair<bool, std::vector<R2VBRenderable*> > Mesh::updateR2VB(
     const data::Mesh::sptr& _mesh,
     ::Ogre::SceneManager& _sceneMgr,
@@ -919,6 +1006,122 @@ void Mesh::updateVertices(const data::PointList::csptr& _pointList)
 
 //-----------------------------------------------------------------------------
 
+void Mesh::updateVertices(const data::PointCloud::csptr& _pointCloud)
+{
+    FW_PROFILE_AVG("UPDATE VERTICES", 5);
+
+    // Getting Vertex Buffer
+    ::Ogre::VertexBufferBinding* bind          = m_ogreMesh->sharedVertexData->vertexBufferBinding;
+    ::Ogre::HardwareVertexBufferSharedPtr vbuf = bind->getBuffer(m_binding[POSITION_NORMAL]);
+
+    /// Upload the vertex data to the GPU
+    void* pVertex = vbuf->lock(::Ogre::HardwareBuffer::HBL_DISCARD);
+
+    // Update Ogre Mesh with data::PointCloud
+    const auto dumpLock = _pointCloud->lock();
+
+    const size_t numPoints = _pointCloud->getNumberOfPoints();
+    const auto* points     = _pointCloud->getPointsBuffer();
+    const auto* normals    = m_hasNormal ? _pointCloud->getPointNormalsBuffer() : nullptr;
+
+    typedef data::PointCloud::PointValueType PointValueType;
+
+    // Copy position and normal of each vertices
+    // Compute bounding box (for culling)
+    PointValueType xMin = std::numeric_limits<PointValueType>::max();
+    PointValueType yMin = std::numeric_limits<PointValueType>::max();
+    PointValueType zMin = std::numeric_limits<PointValueType>::max();
+    PointValueType xMax = std::numeric_limits<PointValueType>::lowest();
+    PointValueType yMax = std::numeric_limits<PointValueType>::lowest();
+    PointValueType zMax = std::numeric_limits<PointValueType>::lowest();
+
+    {
+        FW_PROFILE_AVG("UPDATE POS AND NORMALS", 5);
+
+        PointValueType* __restrict pPos = static_cast<PointValueType*>(pVertex);
+
+        if(m_hasNormal)
+        {
+            // Positions and normals are interleaved in the vertex buffer
+            for(size_t i = 0 ; i < numPoints ; ++i)
+            {
+                const auto& point = points[i];
+                xMin = std::min(xMin, point.x);
+                xMax = std::max(xMax, point.x);
+                yMin = std::min(yMin, point.y);
+                yMax = std::max(yMax, point.y);
+                zMin = std::min(zMin, point.z);
+                zMax = std::max(zMax, point.z);
+
+                memcpy(pPos, &point, sizeof(data::iterator::Point));
+                memcpy(pPos + 3, &normals[i], sizeof(data::iterator::Normal));
+                pPos += 6;
+            }
+        }
+        else
+        {
+            // The point buffer has exactly the layout of the vertex buffer, copy it at once
+            memcpy(pPos, points, numPoints * sizeof(data::iterator::Point));
+
+            for(size_t i = 0 ; i < numPoints ; ++i)
+            {
+                const auto& point = points[i];
+                xMin = std::min(xMin, point.x);
+                xMax = std::max(xMax, point.x);
+                yMin = std::min(yMin, point.y);
+                yMax = std::max(yMax, point.y);
+                zMin = std::min(zMin, point.z);
+                zMax = std::max(zMax, point.z);
+            }
+        }
+    }
+
+    // Unlock vertex data
+    vbuf->unlock();
+
+    if(xMin < std::numeric_limits<PointValueType>::max()
+       && yMin < std::numeric_limits<PointValueType>::max()
+       && zMin < std::numeric_limits<PointValueType>::max()
+       && xMax > std::numeric_limits<PointValueType>::lowest()
+       && yMax > std::numeric_limits<PointValueType>::lowest()
+       && zMax > std::numeric_limits<PointValueType>::lowest())
+    {
+        m_ogreMesh->_setBounds(::Ogre::AxisAlignedBox(xMin, yMin, zMin, xMax, yMax, zMax));
+
+        // Check again the bounds, since ogre may add some extent that could give infinite bounds
+        const bool valid = this->areBoundsValid(m_ogreMesh);
+        SIGHT_ASSERT("Invalid bounds found...", valid);
+
+        if(valid)
+        {
+            m_ogreMesh->_setBoundingSphereRadius(
+                ::Ogre::Math::Sqrt(
+                    ::Ogre::Math::Sqr(xMax - xMin)
+                    + ::Ogre::Math::Sqr(yMax - yMin)
+                    + ::Ogre::Math::Sqr(zMax - zMin)
+                ) / 2
+            );
+        }
+        else
+        {
+            SIGHT_ERROR("Infinite or NaN values for the bounding box. Check the point cloud validity.");
+
+            // This silent the problem so there is no crash in Ogre
+            m_ogreMesh->_setBounds(::Ogre::AxisAlignedBox::EXTENT_NULL);
+        }
+    }
+    else
+    {
+        // An extent was not found or is NaN
+        m_ogreMesh->_setBounds(::Ogre::AxisAlignedBox::EXTENT_NULL);
+    }
+
+    /// Notify Mesh object that it has been modified
+    m_ogreMesh->load();
+}
+
+//-----------------------------------------------------------------------------
+
 void Mesh::updateColors(const data::Mesh::csptr& _mesh)
 {
     FW_PROFILE_AVG("UPDATE COLORS", 5);
@@ -932,7 +1135,7 @@ void Mesh::updateColors(const data::Mesh::csptr& _mesh)
     // 1 - Initialization
     if(hasVertexColor)
     {
-        bindLayer(_mesh, COLOUR, ::Ogre::VES_DIFFUSE, Ogre::VET_COLOUR);
+        bindLayer(_mesh->getNumberOfPoints(), COLOUR, ::Ogre::VES_DIFFUSE, Ogre::VET_COLOUR);
     }
     else
     {
@@ -1054,6 +1257,50 @@ void Mesh::updateColors(const data::Mesh::csptr& _mesh)
 
 //-----------------------------------------------------------------------------
 
+void Mesh::updateColors(const data::PointCloud::csptr& _pointCloud)
+{
+    FW_PROFILE_AVG("UPDATE COLORS", 5);
+
+    ::Ogre::VertexBufferBinding* bind = m_ogreMesh->sharedVertexData->vertexBufferBinding;
+    SIGHT_ASSERT("Invalid vertex buffer binding", bind);
+
+    const bool hasVertexColor = _pointCloud->hasPointColors();
+
+    if(hasVertexColor)
+    {
+        bindLayer(_pointCloud->getNumberOfPoints(), COLOUR, ::Ogre::VES_DIFFUSE, Ogre::VET_COLOUR);
+
+        const auto lock = _pointCloud->lock();
+
+        // Source points
+        ::Ogre::HardwareVertexBufferSharedPtr cbuf = bind->getBuffer(m_binding[COLOUR]);
+        ::Ogre::RGBA* pColor                       =
+            static_cast< ::Ogre::RGBA*>(cbuf->lock(::Ogre::HardwareBuffer::HBL_DISCARD));
+
+        // Destination
+        const auto* colors = reinterpret_cast<const std::uint8_t*>(_pointCloud->getPointColorsBuffer());
+
+        // Copy points
+        viz::scene3d::helper::Mesh::copyColors(pColor, colors, _pointCloud->getNumberOfPoints(), 4);
+
+        cbuf->unlock();
+    }
+    else if(bind->isBufferBound(m_binding[COLOUR]))
+    {
+        // Unbind vertex color if it was previously enabled
+        bind->unsetBinding(m_binding[COLOUR]);
+        m_binding[COLOUR] = 0xFFFF;
+    }
+
+    m_hasVertexColor    = hasVertexColor;
+    m_hasPrimitiveColor = false;
+
+    /// Notify Mesh object that it has been modified
+    m_ogreMesh->load();
+}
+
+//-----------------------------------------------------------------------------
+
 void Mesh::updateTexCoords(const data::Mesh::csptr& _mesh)
 {
     m_hasUV = _mesh->hasPointTexCoords();
@@ -1061,7 +1308,7 @@ void Mesh::updateTexCoords(const data::Mesh::csptr& _mesh)
     // . UV Buffer - By now, we just use one UV coordinates set for each mesh
     if(m_hasUV)
     {
-        bindLayer(_mesh, TEXCOORD, ::Ogre::VES_TEXTURE_COORDINATES, Ogre::VET_FLOAT2);
+        bindLayer(_mesh->getNumberOfPoints(), TEXCOORD, ::Ogre::VES_TEXTURE_COORDINATES, Ogre::VET_FLOAT2);
 
         FW_PROFILE_AVG("UPDATE TexCoords", 5);
 
@@ -26,6 +26,7 @@
 #include "viz/scene3d/Material.hpp"
 
 #include <data/Mesh.hpp>
+#include <data/PointCloud.hpp>
 #include <data/PointList.hpp>
 
 #include <OGRE/OgreMesh.h>
@@ -64,13 +65,13 @@ public:
      *
      * The buffer must contain a data type and must not be interleaved.
      *
-     * @param _mesh used to find buffer data.
+     * @param _numVertices number of vertices of the buffer.
      * @param _binding layer binfing.
      * @param _semantic semantic of the buffer.
      * @param _type data type in the buffer.
      */
     void bindLayer(
-        const data::Mesh::csptr& _mesh,
+        size_t _numVertices,
         BufferBinding _binding,
         ::Ogre::VertexElementSemantic _semantic,
         ::Ogre::VertexElementType _type
@@ -84,6 +85,7 @@ public:
     VIZ_SCENE3D_API void setVisible(bool _visible);
     VIZ_SCENE3D_API void updateMesh(const data::Mesh::sptr& _mesh, bool _pointsOnly = false);
     VIZ_SCENE3D_API void updateMesh(const data::PointList::csptr& _pointList);
+    VIZ_SCENE3D_API void updateMesh(const data::PointCloud::csptr& _pointCloud);
     VIZ_SCENE3D_API std::pair<bool, std::vector<R2VBRenderable*> > updateR2VB(
         const data::Mesh::sptr& _mesh,
         ::Ogre::SceneManager& _sceneMgr,
@@ -95,8 +97,12 @@ public:
     VIZ_SCENE3D_API void updateVertices(const data::Mesh::csptr& _mesh);
     /// Updates the vertices position
     VIZ_SCENE3D_API void updateVertices(const data::PointList::csptr& mesh);
+    /// Updates the vertices position and normals
+    VIZ_SCENE3D_API void updateVertices(const data::PointCloud::csptr& _pointCloud);
     /// Updates the vertices colors.
     VIZ_SCENE3D_API void updateColors(const data::Mesh::csptr& _mesh);
+    /// Updates the vertices colors.
+    VIZ_SCENE3D_API void updateColors(const data::PointCloud::csptr& _pointCloud);
     /// Updates the vertices texture coordinates.
     VIZ_SCENE3D_API void updateTexCoords(const data::Mesh::csptr& _mesh);
     /// Erase the mesh data, called when the configuration change (new layer, etc...), to simplify modifications.
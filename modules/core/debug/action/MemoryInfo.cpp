@@ -60,23 +60,39 @@ void MemoryInfo::updating()
     std::uint64_t usedProcessMemory = core::memory::tools::MemoryMonitorTools::getUsedProcessMemory();
     std::uint64_t estimateFreeMem   = core::memory::tools::MemoryMonitorTools::estimateFreeMem();
 
-    core::memory::BufferManager::SizeType managedBufferSize = 0;
-    core::memory::BufferManager::SizeType dumpedBufferSize  = 0;
-    core::memory::BufferManager::sptr manager               = core::memory::BufferManager::getDefault();
+    core::memory::BufferManager::BufferStats stats = {};
+    core::memory::BufferManager::sptr manager      = core::memory::BufferManager::getDefault();
     if(manager)
     {
-        core::memory::BufferManager::BufferStats stats = manager->getBufferStats().get();
-        managedBufferSize = stats.totalManaged;
-        dumpedBufferSize  = stats.totalDumped;
+        stats = manager->getBufferStats().get();
     }
 
+    // Mean dump and restore times, in ms
+    const double dumpTime = stats.dumpCount > 0
+                            ? stats.dumpTime / 1000. / static_cast<double>(stats.dumpCount) : 0.;
+    const double restoreTime = stats.restoreCount > 0
+                               ? stats.restoreTime / 1000. / static_cast<double>(stats.restoreCount) : 0.;
+
     std::stringstream stream;
     stream << "Total system memory = " << totalSystemMemory / mo << " Mo" << std::endl;
     stream << "Free system memory  = " << freeSystemMemory / mo << " Mo" << std::endl;
     stream << "Used process memory = " << usedProcessMemory / mo << " Mo" << std::endl;
     stream << "Estimed Free memory = " << estimateFreeMem / mo << " Mo" << std::endl;
-    stream << "ManagedBuffer size  = " << managedBufferSize / mo << " Mo" << std::endl;
-    stream << "DumpedBuffer size   = " << dumpedBufferSize / mo << " Mo" << std::endl;
+    stream << "ManagedBuffer size  = " << stats.totalManaged / mo << " Mo" << std::endl;
+    stream << "DumpedBuffer size   = " << stats.totalDumped / mo << " Mo" << std::endl;
+    stream << "Dumps               = " << stats.dumpCount << ", " << stats.dumpedBytes / mo << " Mo written in "
+    << stats.dumpFileBytes / mo << " Mo, " << dumpTime << " ms per dump" << std::endl;
+    stream << "Restores            = " << stats.restoreCount << ", " << stats.restoredBytes / mo << " Mo, "
+    << restoreTime << " ms per restore" << std::endl;
+    stream << "Allocations         = " << stats.allocationCount << ", " << stats.allocatedBytes / mo << " Mo"
+    << std::endl;
+    stream << "Frees               = " << stats.freeCount << ", " << stats.freedBytes / mo << " Mo" << std::endl;
+    for(const auto& [owner, ownerStats] : stats.owners)
+    {
+        stream << "  " << (owner.empty() ? std::string("Unknown") : owner) << " = " << ownerStats.count
+        << " buffers, " << ownerStats.totalManaged / mo << " Mo, " << ownerStats.totalDumped / mo << " Mo dumped"
+        << std::endl;
+    }
 
     // Information message box
     sight::ui::base::dialog::MessageDialog::show(
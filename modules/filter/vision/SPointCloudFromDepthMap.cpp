@@ -81,11 +81,15 @@ void SPointCloudFromDepthMap::updating()
 {
     auto calibration = this->getInput<data::CameraSeries>("calibration");
     auto depthMap    = this->getInput<data::Image>("depthMap");
-    auto pointCloud  = this->getInOut<data::Mesh>("pointCloud");
-    SIGHT_ASSERT("Missing 'pointCloud' inout", pointCloud);
+    auto output      = this->getInOut<data::Object>("pointCloud");
+    SIGHT_ASSERT("Missing 'pointCloud' inout", output);
     SIGHT_ASSERT("Missing 'calibration' input", calibration);
     SIGHT_ASSERT("Missing 'depthMap' input", depthMap);
 
+    const auto mesh       = data::Mesh::dynamicCast(output);
+    const auto pointCloud = data::PointCloud::dynamicCast(output);
+    SIGHT_ASSERT("'pointCloud' must be a data::Mesh or a data::PointCloud", mesh || pointCloud);
+
     auto depthCalibration = calibration->getCamera(0);
 
     auto rgbMap = this->getInput<data::Image>("rgbMap");
@@ -98,67 +102,123 @@ void SPointCloudFromDepthMap::updating()
         SIGHT_ASSERT("Missing extrinsic matrix", extrinsicMatrix);
     }
 
-    // Initialize mesh points memory one time in order to increase performances
-    if(pointCloud->getNumberOfPoints() == 0)
+    const auto size       = depthMap->getSize2();
+    const size_t nbPoints = size[0] * size[1];
+
+    data::mt::ObjectWriteLock outputLock(output);
+
+    std::vector<core::memory::BufferObject::Lock> outputDumpLock;
+    data::iterator::Point* points = nullptr;
+    data::iterator::RGBA* colors  = nullptr;
+
+    if(mesh)
     {
-        const auto size       = depthMap->getSize2();
-        const size_t width    = size[0];
-        const size_t height   = size[1];
-        const size_t nbPoints = width * height;
-
-        data::mt::ObjectWriteLock meshLock(pointCloud);
-        // allocate mesh
-        data::Mesh::Attributes attribute = data::Mesh::Attributes::NONE;
-        if(rgbMap)
+        // Initialize mesh points memory one time in order to increase performances
+        if(mesh->getNumberOfPoints() == 0)
         {
-            attribute = data::Mesh::Attributes::POINT_COLORS;
-        }
+            // allocate mesh
+            data::Mesh::Attributes attribute = data::Mesh::Attributes::NONE;
+            if(rgbMap)
+            {
+                attribute = data::Mesh::Attributes::POINT_COLORS;
+            }
+
+            mesh->resize(nbPoints, nbPoints, data::Mesh::CellType::POINT, attribute);
 
-        pointCloud->resize(nbPoints, nbPoints, data::Mesh::CellType::POINT, attribute);
+            const auto dumpLock = mesh->lock();
 
-        const auto dumpLock = pointCloud->lock();
+            auto itr = mesh->begin<data::iterator::CellIterator>();
+
+            // to display the mesh, we need to create cells with one point.
+            for(size_t i = 0 ; i < nbPoints ; ++i, ++itr)
+            {
+                *itr->type         = data::Mesh::CellType::POINT;
+                *itr->offset       = i;
+                *(itr + 1)->offset = i + 1; // to be able to iterate through point indices
+                itr->pointIdx[0]   = i;
+            }
 
-        auto itr = pointCloud->begin<data::iterator::CellIterator>();
+            auto sig = mesh->signal<data::Mesh::ModifiedSignalType>(data::Mesh::s_MODIFIED_SIG);
+            sig->asyncEmit();
+        }
 
-        // to display the mesh, we need to create cells with one point.
-        for(size_t i = 0 ; i < nbPoints ; ++i, ++itr)
+        outputDumpLock = mesh->lock();
+        points         = static_cast<data::iterator::Point*>(mesh->getPointsArray()->getBuffer());
+        if(mesh->hasPointColors())
         {
-            *itr->type         = data::Mesh::CellType::POINT;
-            *itr->offset       = i;
-            *(itr + 1)->offset = i + 1; // to be able to iterate through point indices
-            itr->pointIdx[0]   = i;
+            colors = static_cast<data::iterator::RGBA*>(mesh->getPointColorsArray()->getBuffer());
+        }
+    }
+    else
+    {
+        // The point cloud does not need any cell, its memory is only reallocated when the depth map grows
+        const auto attribute = rgbMap ? data::PointCloud::Attributes::POINT_COLORS
+                                      : data::PointCloud::Attributes::NONE;
+        if(pointCloud->getCapacity() < nbPoints || pointCloud->getAttributes() != attribute)
+        {
+            pointCloud->reserve(nbPoints, attribute);
         }
 
-        auto sig = pointCloud->signal<data::Mesh::ModifiedSignalType>(data::Mesh::s_MODIFIED_SIG);
-        sig->asyncEmit();
+        outputDumpLock = pointCloud->lock();
+        points         = pointCloud->getPointsBuffer();
+        if(rgbMap)
+        {
+            colors = pointCloud->getPointColorsBuffer();
+        }
     }
 
-    if(rgbMap)
+    size_t nbRealPoints = 0;
+    if(rgbMap && colors)
     {
-        this->depthMapToPointCloudRGB(
+        nbRealPoints = this->depthMapToPointCloudRGB(
             depthCalibration,
             colorCalibration,
             depthMap,
             rgbMap,
             extrinsicMatrix,
-            pointCloud
+            points,
+            colors
         );
+    }
+    else
+    {
+        nbRealPoints = this->depthMapToPointCloud(depthCalibration, depthMap, points);
+    }
 
-        auto sig =
-            pointCloud->signal<data::Mesh::VertexModifiedSignalType>(data::Mesh::s_VERTEX_MODIFIED_SIG);
+    // Since we discard points for which the depth map is out of range, the buffers are not full
+    if(mesh)
+    {
+        mesh->setNumberOfPoints(nbRealPoints);
+        mesh->setNumberOfCells(nbRealPoints);
+        mesh->setCellDataSize(nbRealPoints);
+
+        auto sig = mesh->signal<data::Mesh::VertexModifiedSignalType>(data::Mesh::s_VERTEX_MODIFIED_SIG);
         sig->asyncEmit();
 
-        auto sig2 = pointCloud->signal<data::Mesh::PointColorsModifiedSignalType>(
-            data::Mesh::s_POINT_COLORS_MODIFIED_SIG
-        );
-        sig2->asyncEmit();
+        if(colors)
+        {
+            auto sig2 = mesh->signal<data::Mesh::PointColorsModifiedSignalType>(
+                data::Mesh::s_POINT_COLORS_MODIFIED_SIG
+            );
+            sig2->asyncEmit();
+        }
     }
     else
     {
-        this->depthMapToPointCloud(depthCalibration, depthMap, pointCloud);
-        auto sig =
-            pointCloud->signal<data::Mesh::VertexModifiedSignalType>(data::Mesh::s_VERTEX_MODIFIED_SIG);
+        pointCloud->setNumberOfPoints(nbRealPoints);
+
+        auto sig = pointCloud->signal<data::PointCloud::VertexModifiedSignalType>(
+            data::PointCloud::s_VERTEX_MODIFIED_SIG
+        );
         sig->asyncEmit();
+
+        if(colors)
+        {
+            auto sig2 = pointCloud->signal<data::PointCloud::PointColorsModifiedSignalType>(
+                data::PointCloud::s_POINT_COLORS_MODIFIED_SIG
+            );
+            sig2->asyncEmit();
+        }
     }
 
     m_sigComputed->asyncEmit();
@@ -198,10 +258,10 @@ void SPointCloudFromDepthMap::setDepthRange(int _val, std::string _key)
 
 //------------------------------------------------------------------------------
 
-void SPointCloudFromDepthMap::depthMapToPointCloud(
+size_t SPointCloudFromDepthMap::depthMapToPointCloud(
     const data::Camera::csptr& depthCamera,
     const data::Image::csptr& depthMap,
-    const data::Mesh::sptr& pointCloud
+    data::iterator::Point* points
 )
 {
     SIGHT_INFO("Input RGB map was empty, skipping colors");
@@ -210,7 +270,7 @@ void SPointCloudFromDepthMap::depthMapToPointCloud(
     if(type != core::tools::Type::s_UINT16)
     {
         SIGHT_ERROR("Wrong input depth map format: " << type << ", uint16 is expected.");
-        return;
+        return 0;
     }
 
     const auto size     = depthMap->getSize2();
@@ -228,12 +288,6 @@ void SPointCloudFromDepthMap::depthMapToPointCloud(
                  fx = depthCamera->getFx(),
                  fy = depthCamera->getFy();
 
-    data::mt::ObjectWriteLock meshLock(pointCloud);
-
-    const auto meshDumpLock = pointCloud->lock();
-
-    auto pointsItr = pointCloud->begin<data::iterator::PointIterator>();
-
     size_t nbRealPoints = 0;
     for(size_t y = 0 ; y != height ; ++y)
     {
@@ -244,10 +298,7 @@ void SPointCloudFromDepthMap::depthMapToPointCloud(
             {
                 double px, py, pz;
                 sight::filter::vision::Projection::projectPixel<double>(x, y, depth, cx, cy, fx, fy, px, py, pz);
-                pointsItr->point->x = static_cast<float>(px);
-                pointsItr->point->y = static_cast<float>(py);
-                pointsItr->point->z = static_cast<float>(pz);
-                ++pointsItr;
+                points[nbRealPoints] = {static_cast<float>(px), static_cast<float>(py), static_cast<float>(pz)};
                 ++nbRealPoints;
             }
 
@@ -255,20 +306,19 @@ void SPointCloudFromDepthMap::depthMapToPointCloud(
         }
     }
 
-    pointCloud->setNumberOfPoints(nbRealPoints);
-    pointCloud->setNumberOfCells(nbRealPoints);
-    pointCloud->setCellDataSize(nbRealPoints);
+    return nbRealPoints;
 }
 
 //------------------------------------------------------------------------------
 
-void SPointCloudFromDepthMap::depthMapToPointCloudRGB(
+size_t SPointCloudFromDepthMap::depthMapToPointCloudRGB(
     const data::Camera::csptr& depthCamera,
     const data::Camera::csptr& colorCamera,
     const data::Image::csptr& depthMap,
     const data::Image::csptr& colorMap,
     const data::Matrix4::csptr& extrinsic,
-    const data::Mesh::sptr& pointCloud
+    data::iterator::Point* points,
+    data::iterator::RGBA* colors
 )
 {
     SIGHT_INFO("Input RGB map was supplied, including colors");
@@ -277,7 +327,7 @@ void SPointCloudFromDepthMap::depthMapToPointCloudRGB(
     if(type != core::tools::Type::s_UINT16)
     {
         SIGHT_ERROR("Wrong input depth map format: " << type << ", uint16 is expected.");
-        return;
+        return 0;
     }
 
     // Make sure RGB and depth maps are the same size
@@ -289,13 +339,13 @@ void SPointCloudFromDepthMap::depthMapToPointCloudRGB(
     if(rgbType != core::tools::Type::s_UINT8)
     {
         SIGHT_ERROR("Wrong input rgb format: " << rgbType << ", uint8 is expected.");
-        return;
+        return 0;
     }
 
     if(4 != colorMap->getNumberOfComponents())
     {
         SIGHT_ERROR("Wrong number of components in rgb : " << colorMap->getNumberOfComponents() << ", 4 is expected.");
-        return;
+        return 0;
     }
 
     const auto rgbSize     = colorMap->getSize2();
@@ -305,7 +355,7 @@ void SPointCloudFromDepthMap::depthMapToPointCloudRGB(
     if(rgbWidth != width || rgbHeight != height)
     {
         SIGHT_ERROR("RGB and depth maps must have the same size");
-        return;
+        return 0;
     }
 
     data::mt::ObjectReadLock depthMapLock(depthMap);
@@ -328,12 +378,6 @@ void SPointCloudFromDepthMap::depthMapToPointCloudRGB(
                  rgbFx = colorCamera->getFx(),
                  rgbFy = colorCamera->getFy();
 
-    data::mt::ObjectWriteLock meshLock(pointCloud);
-
-    const auto meshDumpLock = pointCloud->lock();
-
-    auto pointsItr = pointCloud->begin<data::iterator::PointIterator>();
-
     const data::iterator::RGBA defaultColor = {255, 255, 255, 255};
 
     size_t nbRealPoints     = 0;
@@ -350,9 +394,7 @@ void SPointCloudFromDepthMap::depthMapToPointCloudRGB(
                 // get the 3D coordinates in the depth world
                 double px, py, pz;
                 sight::filter::vision::Projection::projectPixel<double>(x, y, depth, cx, cy, fx, fy, px, py, pz);
-                pointsItr->point->x = static_cast<float>(px);
-                pointsItr->point->y = static_cast<float>(py);
-                pointsItr->point->z = static_cast<float>(pz);
+                points[nbRealPoints] = {static_cast<float>(px), static_cast<float>(py), static_cast<float>(pz)};
 
                 // Transform point to the rgb sensor world
                 const ::glm::dvec4 point(px, py, pz, 1.0);
@@ -380,19 +422,18 @@ void SPointCloudFromDepthMap::depthMapToPointCloudRGB(
                     if(rgbIdx < imageSize)
                     {
                         const auto color = rgbBegin + rgbIdx;
-                        *pointsItr->rgba = *color;
+                        colors[nbRealPoints] = *color;
                     }
                     else
                     {
-                        *pointsItr->rgba = defaultColor;
+                        colors[nbRealPoints] = defaultColor;
                     }
                 }
                 else
                 {
-                    *pointsItr->rgba = defaultColor;
+                    colors[nbRealPoints] = defaultColor;
                 }
 
-                ++pointsItr;
                 ++nbRealPoints;
             }
 
@@ -400,10 +441,7 @@ void SPointCloudFromDepthMap::depthMapToPointCloudRGB(
         }
     }
 
-    // Since we discard points for which the depth map is zero, the mesh buffers are not full
-    pointCloud->setNumberOfPoints(nbRealPoints);
-    pointCloud->setNumberOfCells(nbRealPoints);
-    pointCloud->setCellDataSize(nbRealPoints);
+    return nbRealPoints;
 }
 
 //-----------------------------------------------------------------------------
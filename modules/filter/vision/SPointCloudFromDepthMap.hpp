@@ -28,6 +28,7 @@
 #include <data/Image.hpp>
 #include <data/Matrix4.hpp>
 #include <data/Mesh.hpp>
+#include <data/PointCloud.hpp>
 
 #include <glm/mat4x4.hpp>
 
@@ -64,7 +65,9 @@ namespace sight::module::filter::vision
  *   map must have the same dimensions as the depth map.
  *
  * @subsection In-Out In-Out
- * - \b pointCloud [sight::data::Mesh]: Computed point cloud.
+ * - \b pointCloud [sight::data::Mesh or sight::data::PointCloud]: Computed point cloud. A data::PointCloud is
+ *   recommended: it does not store any cell, thus it is cheaper to allocate and to update. With a data::Mesh, one
+ *   point cell is created per pixel of the depth map.
  *
  * @subsection Configuration Configuration
  */
@@ -128,24 +131,30 @@ private:
 
     /**
      * @brief Computes a point cloud from a depth map.
+     * @param points output point buffer, it must be able to hold one point per pixel of the depth map.
+     * @return the number of points written in the buffer.
      */
-    void depthMapToPointCloud(
+    size_t depthMapToPointCloud(
         const data::Camera::csptr& depthCamera,
         const data::Image::csptr& depthMap,
-        const data::Mesh::sptr& pointCloud
+        data::iterator::Point* points
     );
 
     /**
      * @brief Computes a point cloud with colors from a depth map and a color
      * map.
+     * @param points output point buffer, it must be able to hold one point per pixel of the depth map.
+     * @param colors output color buffer, it must be able to hold one color per pixel of the depth map.
+     * @return the number of points written in the buffers.
      */
-    void depthMapToPointCloudRGB(
+    size_t depthMapToPointCloudRGB(
         const data::Camera::csptr& depthCamera,
         const data::Camera::csptr& colorCamera,
         const data::Image::csptr& depthMap,
         const data::Image::csptr& colorMap,
         const data::Matrix4::csptr& extrinsic,
-        const data::Mesh::sptr& pointCloud
+        data::iterator::Point* points,
+        data::iterator::RGBA* colors
     );
 
     /// Min value of depth used to build pointcloud.
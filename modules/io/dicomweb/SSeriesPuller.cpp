@@ -32,6 +32,7 @@
 #include <data/helper/SeriesDB.hpp>
 #include <data/Vector.hpp>
 
+#include <io/http/Downloader.hpp>
 #include <io/http/exceptions/Base.hpp>
 #include <io/http/helper/Series.hpp>
 #include <io/http/Request.hpp>
@@ -45,16 +46,25 @@
 #include <ui/base/preferences/helper.hpp>
 
 #include <filesystem>
+#include <sstream>
+#include <tuple>
 
 namespace sight::module::io::dicomweb
 {
 
+static const core::com::Signals::SignalKeyType s_PROGRESSED_SIG       = "progressed";
+static const core::com::Signals::SignalKeyType s_STARTED_PROGRESS_SIG = "progressStarted";
+static const core::com::Signals::SignalKeyType s_STOPPED_PROGRESS_SIG = "progressStopped";
+
 //------------------------------------------------------------------------------
 
 SSeriesPuller::SSeriesPuller() noexcept :
     m_isPulling(false),
     m_seriesIndex(0)
 {
+    m_sigProgressed      = this->newSignal<ProgressedSignalType>(s_PROGRESSED_SIG);
+    m_sigProgressStarted = this->newSignal<ProgressStartedSignalType>(s_STARTED_PROGRESS_SIG);
+    m_sigProgressStopped = this->newSignal<ProgressStoppedSignalType>(s_STOPPED_PROGRESS_SIG);
 }
 
 //------------------------------------------------------------------------------
@@ -79,6 +89,21 @@ void SSeriesPuller::configuring()
     // Dicom Reader Config
     std::tie(success, m_dicomReaderSrvConfig) = config->getSafeAttributeValue("dicomReaderConfig");
 
+    // Download settings
+    std::string value;
+    std::tie(success, value) = config->getSafeAttributeValue("maxConcurrentDownloads");
+    if(success)
+    {
+        m_maxConcurrentDownloads = std::stoul(value);
+        SIGHT_ASSERT("At least one download must be allowed", m_maxConcurrentDownloads > 0);
+    }
+
+    std::tie(success, value) = config->getSafeAttributeValue("retries");
+    if(success)
+    {
+        m_retries = static_cast<unsigned int>(std::stoul(value));
+    }
+
     service::IService::ConfigType configuration = this->getConfigTree();
     //Parse server port and hostname
     if(configuration.count("server"))
@@ -230,12 +255,7 @@ void SSeriesPuller::pullSeries()
             data::DicomSeries::sptr series = data::DicomSeries::dynamicCast(*it);
 
             // Check if the series must be pulled
-            if(series
-               && std::find(
-                   m_localSeries.begin(),
-                   m_localSeries.end(),
-                   series->getInstanceUID()
-               ) == m_localSeries.end())
+            if(series && m_localSeries.find(series->getInstanceUID()) == m_localSeries.end())
             {
                 // Add series in the pulling series map
                 m_pullingDicomSeriesMap[series->getInstanceUID()] = series;
@@ -250,6 +270,26 @@ void SSeriesPuller::pullSeries()
         // Pull series
         if(!pullSeriesVector.empty())
         {
+            m_sigProgressStarted->asyncEmit(m_progressbarId);
+
+            // The instances are downloaded concurrently, on persistent connections
+            m_clientQt.setMaxConcurrentRequests(m_maxConcurrentDownloads);
+            sight::io::http::Downloader downloader(m_clientQt, m_retries);
+            downloader.setProgressCallback(
+                [this](std::size_t finished, std::size_t total)
+                {
+                    std::stringstream ss;
+                    ss << "Downloading file " << finished << "/" << total;
+                    const float percentage = static_cast<float>(finished) / static_cast<float>(total);
+                    m_sigProgressed->asyncEmit(m_progressbarId, percentage, ss.str());
+                });
+
+            /// Url PACS
+            const std::string pacsServer("http://" + m_serverHostname + ":" + std::to_string(m_serverPort));
+
+            // Folder and end of the downloads of each series
+            std::vector<std::tuple<std::string, std::filesystem::path, std::size_t> > seriesDownloads;
+
             /// GET
             const InstanceUIDContainerType& seriesInstancesUIDs =
                 sight::io::http::helper::Series::toSeriesInstanceUIDContainer(pullSeriesVector);
@@ -264,9 +304,6 @@ void SSeriesPuller::pullSeries()
                 body.insert("Query", query);
                 body.insert("Limit", 0);
 
-                /// Url PACS
-                const std::string pacsServer("http://" + m_serverHostname + ":" + std::to_string(m_serverPort));
-
                 /// Orthanc "/tools/find" route. POST a JSON to get all Series corresponding to the SeriesInstanceUID.
                 sight::io::http::Request::sptr request = sight::io::http::Request::New(
                     pacsServer + "/tools/find"
@@ -291,6 +328,11 @@ void SSeriesPuller::pullSeries()
                 QJsonDocument jsonResponse    = QJsonDocument::fromJson(seriesAnswer);
                 const QJsonArray& seriesArray = jsonResponse.array();
 
+                // Create dicom folder
+                const std::filesystem::path seriesPath = core::tools::System::getTemporaryFolder()
+                                                         / seriesInstancesUID;
+                std::filesystem::create_directories(seriesPath);
+
                 const size_t seriesArraySize = seriesArray.count();
                 for(size_t i = 0 ; i < seriesArraySize ; ++i)
                 {
@@ -309,41 +351,46 @@ void SSeriesPuller::pullSeries()
                     {
                         const std::string& instanceUID = instancesArray.at(j).toString().toStdString();
 
-                        /// GET DICOM Instance file.
+                        /// GET DICOM Instance file, the download starts in the background.
                         const std::string instanceUrl(pacsServer + "/instances/" + instanceUID + "/file");
+                        downloader.add(sight::io::http::Request::New(instanceUrl), seriesPath / instanceUID);
+                    }
+                }
+
+                seriesDownloads.emplace_back(seriesInstancesUID, seriesPath, downloader.getCount());
+            }
+
+            // Read each series as soon as its instances are downloaded, the next ones are still downloading
+            std::size_t index = 0;
+            for(const auto& [seriesInstancesUID, seriesPath, end] : seriesDownloads)
+            {
+                for( ; index < end ; ++index)
+                {
+                    try
+                    {
+                        downloader.wait(index);
+                    }
+                    catch(sight::io::http::exceptions::ContentNotFound& exception)
+                    {
+                        std::stringstream ss;
+                        ss << "Content not found:  \n"
+                        << "Unable download the DICOM instance. \n";
 
-                        try
-                        {
-                            m_path = m_clientQt.getFile(sight::io::http::Request::New(instanceUrl));
-                        }
-                        catch(sight::io::http::exceptions::ContentNotFound& exception)
-                        {
-                            std::stringstream ss;
-                            ss << "Content not found:  \n"
-                            << "Unable download the DICOM instance. \n";
-
-                            this->displayErrorMessage(ss.str());
-                            SIGHT_WARN(exception.what());
-                        }
-
-                        // Create dicom folder
-                        std::filesystem::path instancePath = m_path.parent_path() / seriesInstancesUID;
-                        QDir().mkpath(instancePath.string().c_str());
-                        // Move dicom file to the created dicom folder
-                        instancePath /= m_path.filename();
-                        QFile().rename(m_path.string().c_str(), instancePath.string().c_str());
-                        m_path = m_path.parent_path() / seriesInstancesUID;
+                        this->displayErrorMessage(ss.str());
+                        SIGHT_WARN(exception.what());
                     }
                 }
+
+                m_localSeries[seriesInstancesUID] = seriesPath;
+                this->readSeries(seriesInstancesUID);
             }
-        }
 
-        // Read series if there is no error
-        if(m_isPulling)
-        {
-            this->readLocalSeries(selectedSeriesVector);
+            m_sigProgressStopped->asyncEmit(m_progressbarId);
         }
 
+        // Read the selected series pulled previously
+        this->readLocalSeries(selectedSeriesVector);
+
         // Set pulling boolean to false
         m_isPulling = false;
     }
@@ -353,6 +400,7 @@ void SSeriesPuller::pullSeries()
         ss << "Unknown error.";
         this->displayErrorMessage(ss.str());
         SIGHT_WARN(exception.what());
+        m_sigProgressStopped->asyncEmit(m_progressbarId);
         m_isPulling = false;
     }
 }
@@ -360,42 +408,42 @@ void SSeriesPuller::pullSeries()
 //------------------------------------------------------------------------------
 
 void SSeriesPuller::readLocalSeries(DicomSeriesContainerType selectedSeries)
+{
+    for(const data::Series::sptr& series : selectedSeries)
+    {
+        this->readSeries(series->getInstanceUID());
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SSeriesPuller::readSeries(const std::string& seriesInstanceUID)
 {
     // Read only series that are not in the SeriesDB
     const InstanceUIDContainerType& alreadyLoadedSeries =
         sight::io::http::helper::Series::toSeriesInstanceUIDContainer(m_destinationSeriesDB->getContainer());
 
-    // Create temporary series helper
-    data::helper::SeriesDB tempSDBhelper(m_tempSeriesDB);
+    const SeriesFolderMapType::const_iterator folder = m_localSeries.find(seriesInstanceUID);
 
-    for(const data::Series::sptr& series : selectedSeries)
+    // Check if the series is loaded
+    if(folder != m_localSeries.end()
+       && std::find(
+           alreadyLoadedSeries.begin(),
+           alreadyLoadedSeries.end(),
+           seriesInstanceUID
+       ) == alreadyLoadedSeries.end())
     {
-        const std::string& selectedSeriesUID = series->getInstanceUID();
+        // Clear temporary series
+        data::helper::SeriesDB tempSDBhelper(m_tempSeriesDB);
+        tempSDBhelper.clear();
 
-        // Add the series to the local series vector
-        if(std::find(m_localSeries.begin(), m_localSeries.end(), selectedSeriesUID) == m_localSeries.end())
-        {
-            m_localSeries.push_back(selectedSeriesUID);
-        }
-
-        // Check if the series is loaded
-        if(std::find(
-               alreadyLoadedSeries.begin(),
-               alreadyLoadedSeries.end(),
-               selectedSeriesUID
-           ) == alreadyLoadedSeries.end())
-        {
-            // Clear temporary series
-            tempSDBhelper.clear();
+        m_dicomReader->setFolder(folder->second);
+        m_dicomReader->update();
 
-            m_dicomReader->setFolder(m_path);
-            m_dicomReader->update();
-
-            // Merge series
-            data::helper::SeriesDB sDBhelper(m_destinationSeriesDB);
-            sDBhelper.merge(m_tempSeriesDB);
-            sDBhelper.notify();
-        }
+        // Merge series
+        data::helper::SeriesDB sDBhelper(m_destinationSeriesDB);
+        sDBhelper.merge(m_tempSeriesDB);
+        sDBhelper.notify();
     }
 }
 
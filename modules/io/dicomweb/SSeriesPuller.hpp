@@ -24,6 +24,8 @@
 
 #include "modules/io/dicomweb/config.hpp"
 
+#include <core/com/Signal.hpp>
+
 #include <data/SeriesDB.hpp>
 
 #include <io/base/service/IReader.hpp>
@@ -46,6 +48,13 @@ namespace sight::module::io::dicomweb
 /**
  * @brief   This service is used to pull series from a PACS (Orthanc).
  *
+ * The instances are downloaded concurrently, a failed download is retried after a delay doubled at each attempt.
+ * Each series is read as soon as its instances are downloaded, while the following series are still downloading.
+ *
+ * @section Signals Signals
+ * - \b progressStarted(std::string): sent when the download starts (bar id).
+ * - \b progressed(std::string, float, std::string): sent when an instance is downloaded (bar id, percentage, message).
+ * - \b progressStopped(std::string): sent when the download ends (bar id).
 
  * @section Slots Slots
  * - \b displayErrorMessage(const std::string&) : display an error message.
@@ -56,7 +65,8 @@ namespace sight::module::io::dicomweb
         <service type="sight::module::io::dicomweb::SSeriesPuller">
             <in key="selectedSeries" uid="..." />
             <inout key="seriesDB" uid="..." />
-            <config dicomReader="::sight::module::io::dicom::SSeriesDBReader" dicomReaderConfig="config" />
+            <config dicomReader="::sight::module::io::dicom::SSeriesDBReader" dicomReaderConfig="config"
+                    maxConcurrentDownloads="6" retries="3" />
             <server>%SERVER_HOSTNAME%:%SERVER_PORT%</server>
        </service>
    @endcode
@@ -66,6 +76,8 @@ namespace sight::module::io::dicomweb
  * - \b seriesDB [sight::data::SeriesDB]: SeriesDB where to put the retrieved dicom series.
  * @subsection Configuration Configuration:
  * - \b dicomReaderConfig Optional configuration for the DICOM Reader.
+ * - \b maxConcurrentDownloads (optional, default=6): maximum number of instances downloaded at the same time.
+ * - \b retries (optional, default=3): number of times a failed instance download is retried.
  * - \b server : server URL. Need hostname and port in this format addr:port (default value is 127.0.0.1:4242).
  * @note : hostname and port of this service are from the preference settings.
  */
@@ -80,6 +92,10 @@ public:
     typedef std::vector<std::string> InstanceUIDContainerType;
     typedef std::map<std::string, unsigned int> InstanceCountMapType;
     typedef std::map<std::string, WPTR(data::DicomSeries)> DicomSeriesMapType;
+    typedef std::map<std::string, std::filesystem::path> SeriesFolderMapType;
+    typedef core::com::Signal<void (std::string)> ProgressStartedSignalType;
+    typedef core::com::Signal<void (std::string, float, std::string)> ProgressedSignalType;
+    typedef core::com::Signal<void (std::string)> ProgressStoppedSignalType;
 
     /**
      * @brief Constructor
@@ -116,6 +132,12 @@ private:
      */
     void readLocalSeries(DicomSeriesContainerType selectedSeries);
 
+    /**
+     * @brief Read a local series if it is not already in the destination SeriesDB.
+     * @param[in] seriesInstanceUID SeriesInstanceUID of the series to read
+     */
+    void readSeries(const std::string& seriesInstanceUID);
+
     /**
      * @brief Display an error message.
      * @param[in] message Error message to display
@@ -140,8 +162,8 @@ private:
     /// Destination SeriesDB
     data::SeriesDB::sptr m_destinationSeriesDB;
 
-    /// Local Series
-    InstanceUIDContainerType m_localSeries;
+    /// Local Series and their DICOM folders
+    SeriesFolderMapType m_localSeries;
 
     /// Is pulling is set to true when we are pulling series
     bool m_isPulling;
@@ -167,8 +189,23 @@ private:
     /// Server port
     int m_serverPort {4242};
 
-    /// DICOM Folder path
-    std::filesystem::path m_path;
+    /// Maximum number of instances downloaded at the same time
+    std::size_t m_maxConcurrentDownloads {6};
+
+    /// Number of retries of a failed instance download
+    unsigned int m_retries {3};
+
+    /// Signal emitted when the progress bar is started
+    ProgressStartedSignalType::sptr m_sigProgressStarted;
+
+    /// Signal emitted when the progress bar is updated
+    ProgressedSignalType::sptr m_sigProgressed;
+
+    /// Signal emitted when the progress bar is stopped
+    ProgressStoppedSignalType::sptr m_sigProgressStopped;
+
+    /// Progress bar ID
+    std::string m_progressbarId {"pullDicomWebProgressBar"};
 };
 
 } // namespace sight::module::io::dicomweb
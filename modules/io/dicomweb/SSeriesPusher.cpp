@@ -40,6 +40,10 @@
 #include <ui/base/dialog/MessageDialog.hpp>
 #include <ui/base/preferences/helper.hpp>
 
+#include <deque>
+#include <functional>
+#include <sstream>
+
 namespace sight::module::io::dicomweb
 {
 
@@ -47,11 +51,21 @@ namespace sight::module::io::dicomweb
 
 static const service::IService::KeyType s_SERIES_IN = "selectedSeries";
 
+static const core::com::Signals::SignalKeyType s_PROGRESSED_SIG       = "progressed";
+static const core::com::Signals::SignalKeyType s_STARTED_PROGRESS_SIG = "progressStarted";
+static const core::com::Signals::SignalKeyType s_STOPPED_PROGRESS_SIG = "progressStopped";
+
+static const core::com::Slots::SlotKeyType s_CANCEL_SLOT = "cancel";
+
 //------------------------------------------------------------------------------
 
-SSeriesPusher::SSeriesPusher() noexcept :
-    m_isPushing(false)
+SSeriesPusher::SSeriesPusher() noexcept
 {
+    m_sigProgressed      = this->newSignal<ProgressedSignalType>(s_PROGRESSED_SIG);
+    m_sigProgressStarted = this->newSignal<ProgressStartedSignalType>(s_STARTED_PROGRESS_SIG);
+    m_sigProgressStopped = this->newSignal<ProgressStoppedSignalType>(s_STOPPED_PROGRESS_SIG);
+
+    newSlot(s_CANCEL_SLOT, &SSeriesPusher::cancel, this);
 }
 
 //------------------------------------------------------------------------------
@@ -79,18 +93,27 @@ void SSeriesPusher::configuring()
     {
         throw core::tools::Failed("'server' element not found");
     }
+
+    m_maxConcurrentUploads = configuration.get<std::size_t>("maxConcurrentUploads", m_maxConcurrentUploads);
+    SIGHT_ASSERT("At least one upload must be allowed", m_maxConcurrentUploads > 0);
 }
 
 //------------------------------------------------------------------------------
 
 void SSeriesPusher::starting()
 {
+    m_pushWorker = core::thread::Worker::New();
 }
 
 //------------------------------------------------------------------------------
 
 void SSeriesPusher::stopping()
 {
+    // The upload in progress ends after the instances being uploaded
+    m_isCancelled = true;
+
+    m_pushWorker->stop();
+    m_pushWorker.reset();
 }
 
 //------------------------------------------------------------------------------
@@ -136,78 +159,175 @@ void SSeriesPusher::updating()
     }
     else
     {
-        // Push series to the PACS
-        this->pushSeries();
+        // Push series to the PACS, the service worker stays free to cancel the upload
+        m_isPushing   = true;
+        m_isCancelled = false;
+        m_pushWorker->post(
+            std::bind(
+                &SSeriesPusher::pushSeries,
+                this,
+                selectedSeries->getDataContainer<data::DicomSeries>()
+            )
+        );
     }
 }
 
 //------------------------------------------------------------------------------
 
-void SSeriesPusher::pushSeries()
+void SSeriesPusher::pushSeries(const std::vector<data::DicomSeries::sptr>& _series)
 {
-    m_isPushing = true;
+    /// Url PACS
+    const std::string pacsServer("http://" + m_serverHostname + ":" + std::to_string(m_serverPort));
 
-    data::Vector::csptr seriesVector = this->getInput<data::Vector>(s_SERIES_IN);
-
-    const std::vector<data::DicomSeries::sptr> dataVector =
-        seriesVector->getDataContainer<data::DicomSeries>();
-    // Connect to PACS
-    const size_t seriesVectorSize = seriesVector->size();
-    size_t nbSeriesSuccess        = 0;
-    for(const auto& dicomSeries : dataVector)
+    // An instance being uploaded, its buffer is kept locked until the answer is received
+    struct Upload
+    {
+        std::size_t seriesIndex;
+        core::memory::BufferObject::ConstLock lock;
+        std::future<QByteArray> answer;
+    };
+    std::deque<Upload> uploads;
+
+    std::size_t instanceCount = 0;
+    for(const auto& dicomSeries : _series)
     {
-        nbSeriesSuccess++;
+        instanceCount += dicomSeries->getDicomContainer().size();
+    }
 
-        data::DicomSeries::DicomContainerType dicomContainer = dicomSeries->getDicomContainer();
-        const size_t dicomContainerSize                      = dicomContainer.size();
+    // Number of instances successfully uploaded, for each series
+    std::vector<std::size_t> nbInstanceSuccess(_series.size(), 0);
+    std::size_t nbUploaded = 0;
 
-        size_t nbInstanceSuccess = 0;
-        try
+    // Waits for the oldest upload
+    const auto finishUpload =
+        [&]
         {
+            Upload& upload = uploads.front();
+            try
+            {
+                if(!sight::io::http::ClientQt::waitFor(upload.answer).isEmpty())
+                {
+                    ++nbInstanceSuccess[upload.seriesIndex];
+                }
+            }
+            catch(sight::io::http::exceptions::HostNotFound&)
+            {
+                uploads.pop_front();
+                throw;
+            }
+            catch(sight::io::http::exceptions::Base& exception)
+            {
+                SIGHT_WARN(exception.what());
+            }
+
+            uploads.pop_front();
+
+            ++nbUploaded;
+            std::stringstream ss;
+            ss << "Uploading file " << nbUploaded << "/" << instanceCount;
+            const float percentage = static_cast<float>(nbUploaded) / static_cast<float>(instanceCount);
+            m_sigProgressed->asyncEmit(m_progressbarId, percentage, ss.str());
+        };
+
+    m_sigProgressStarted->asyncEmit(m_progressbarId);
+    m_clientQt.setMaxConcurrentRequests(m_maxConcurrentUploads);
+
+    bool hostNotFound = false;
+
+    try
+    {
+        for(std::size_t seriesIndex = 0 ; seriesIndex < _series.size() && !m_isCancelled ; ++seriesIndex)
+        {
+            const data::DicomSeries::DicomContainerType dicomContainer =
+                _series[seriesIndex]->getDicomContainer();
+
             for(const auto& item : dicomContainer)
             {
-                const core::memory::BufferObject::sptr bufferObj = item.second;
-                const core::memory::BufferObject::Lock lockerDest(bufferObj);
-                const char* buffer = static_cast<char*>(lockerDest.getBuffer());
-                const size_t size  = bufferObj->getSize();
-
-                const QByteArray fileBuffer = QByteArray::fromRawData(buffer, size);
-
-                /// Url PACS
-                const std::string pacsServer("http://" + m_serverHostname + ":" + std::to_string(m_serverPort));
-                sight::io::http::Request::sptr request =
-                    sight::io::http::Request::New(pacsServer + "/instances");
-                QByteArray seriesAnswer;
-                if(fileBuffer.size() != 0)
+                if(m_isCancelled)
                 {
-                    seriesAnswer = m_clientQt.post(request, fileBuffer);
-                    if(!seriesAnswer.isEmpty())
-                    {
-                        nbInstanceSuccess++;
-                    }
+                    break;
                 }
 
-                if(dicomContainerSize == nbInstanceSuccess)
+                // Bound the memory used: the next instance is only read when an upload is finished
+                while(uploads.size() >= m_maxConcurrentUploads)
                 {
-                    this->displayMessage(
-                        "Upload successful: " + std::to_string(nbSeriesSuccess) + "/"
-                        + std::to_string(seriesVectorSize),
-                        false
-                    );
+                    finishUpload();
+                }
+
+                const core::memory::BufferObject::csptr bufferObj = item.second;
+                core::memory::BufferObject::ConstLock lock(bufferObj);
+                const char* buffer = static_cast<const char*>(lock.getBuffer());
+                const int size     = static_cast<int>(bufferObj->getSize());
+
+                if(size != 0)
+                {
+                    // The instance is sent without copy, from the locked buffer
+                    const QByteArray fileBuffer            = QByteArray::fromRawData(buffer, size);
+                    sight::io::http::Request::sptr request =
+                        sight::io::http::Request::New(pacsServer + "/instances");
+
+                    uploads.push_back({seriesIndex, lock, m_clientQt.postAsync(request, fileBuffer)});
                 }
             }
         }
-        catch(sight::io::http::exceptions::HostNotFound& exception)
+
+        while(!uploads.empty())
         {
-            std::stringstream ss;
-            ss << "Host not found.\n"
-            << "Please check your configuration: \n"
-            << "Pacs host name: " << m_serverHostname << "\n"
-            << "Pacs port: " << m_serverPort << "\n";
-            this->displayMessage(ss.str(), true);
-            SIGHT_WARN(exception.what());
+            finishUpload();
         }
     }
+    catch(sight::io::http::exceptions::HostNotFound& exception)
+    {
+        // Wait for the uploads in flight before unlocking their buffers
+        for(Upload& upload : uploads)
+        {
+            upload.answer.wait();
+        }
+
+        uploads.clear();
+        hostNotFound = true;
+
+        std::stringstream ss;
+        ss << "Host not found.\n"
+        << "Please check your configuration: \n"
+        << "Pacs host name: " << m_serverHostname << "\n"
+        << "Pacs port: " << m_serverPort << "\n";
+        this->signal<service::IService::FailureNotifiedSignalType>(service::IService::s_FAILURE_NOTIFIED_SIG)
+        ->asyncEmit(ss.str());
+        SIGHT_WARN(exception.what());
+    }
+
+    m_sigProgressStopped->asyncEmit(m_progressbarId);
+
+    std::size_t nbSeriesSuccess = 0;
+    for(std::size_t seriesIndex = 0 ; seriesIndex < _series.size() ; ++seriesIndex)
+    {
+        if(nbInstanceSuccess[seriesIndex] == _series[seriesIndex]->getDicomContainer().size())
+        {
+            ++nbSeriesSuccess;
+        }
+    }
+
+    if(m_isCancelled)
+    {
+        this->signal<service::IService::InfoNotifiedSignalType>(service::IService::s_INFO_NOTIFIED_SIG)
+        ->asyncEmit(
+            "Upload cancelled: " + std::to_string(nbUploaded) + "/" + std::to_string(instanceCount)
+            + " instances uploaded"
+        );
+    }
+    else if(nbSeriesSuccess > 0)
+    {
+        this->signal<service::IService::SuccessNotifiedSignalType>(service::IService::s_SUCCESS_NOTIFIED_SIG)
+        ->asyncEmit(
+            "Upload successful: " + std::to_string(nbSeriesSuccess) + "/" + std::to_string(_series.size())
+        );
+    }
+    else if(!hostNotFound)
+    {
+        this->signal<service::IService::FailureNotifiedSignalType>(service::IService::s_FAILURE_NOTIFIED_SIG)
+        ->asyncEmit("Upload failed: no series could be uploaded to the PACS");
+    }
 
     // Set pushing boolean to false
     m_isPushing = false;
@@ -215,15 +335,9 @@ void SSeriesPusher::pushSeries()
 
 //------------------------------------------------------------------------------
 
-void SSeriesPusher::displayMessage(const std::string& message, bool error) const
+void SSeriesPusher::cancel()
 {
-    SIGHT_WARN_IF("Error: " + message, error);
-    sight::ui::base::dialog::MessageDialog messageBox;
-    messageBox.setTitle((error ? "Error" : "Information"));
-    messageBox.setMessage(message);
-    messageBox.setIcon(error ? (ui::base::dialog::IMessageDialog::CRITICAL) : (ui::base::dialog::IMessageDialog::INFO));
-    messageBox.addButton(ui::base::dialog::IMessageDialog::OK);
-    messageBox.show();
+    m_isCancelled = true;
 }
 
 //------------------------------------------------------------------------------
@@ -24,18 +24,22 @@
 
 #include "modules/io/dicomweb/config.hpp"
 
+#include <core/com/Signal.hpp>
 #include <core/com/Slot.hpp>
 #include <core/memory/BufferObject.hpp>
+#include <core/thread/Worker.hpp>
 
 #include <io/http/ClientQt.hpp>
 
 #include <service/IController.hpp>
 
+#include <atomic>
 #include <vector>
 
 namespace sight::data
 {
 
+class DicomSeries;
 class Series;
 
 }
@@ -46,18 +50,36 @@ namespace sight::module::io::dicomweb
 /**
  * @brief   This service is used to push a DICOM series to a PACS.
  *
+ * Several instances are uploaded at the same time. The instances are read one by one from the DICOM container of
+ * the series, thus only the instances being uploaded are in memory.
+ *
+ * The upload runs on a dedicated worker, thus the service worker stays free to receive the cancel() slot. The end of
+ * the upload is reported with the infoNotified, successNotified and failureNotified signals, they are meant to be
+ * connected to a sight::module::ui::qt::SNotifier. The progress signals can be connected to a
+ * sight::module::io::dimse::SProgressBarController.
+ *
+ * @section Signals Signals
+ * - \b progressStarted(std::string): sent when the upload starts (bar id).
+ * - \b progressed(std::string, float, std::string): sent when an instance is uploaded (bar id, percentage, message).
+ * - \b progressStopped(std::string): sent when the upload ends (bar id).
+ *
+ * @section Slots Slots
+ * - \b cancel(): stops the upload, the instances being uploaded are finished.
+ *
  * @section XML XML Configuration
  *
  * @code{.xml}
         <service type="sight::module::io::dicomweb::SSeriesPusher">
             <in key="selectedSeries" uid="..." />
             <server>%PACS_SERVER_HOSTNAME%:%PACS_SERVER_PORT%</server>
+            <maxConcurrentUploads>4</maxConcurrentUploads>
        </service>
    @endcode
  * @subsection Input Input:
  * - \b selectedSeries [sight::data::Vector]: List of DICOM series to push to the PACS.
  * @subsection Configuration Configuration:
  * - \b server : server URL. Need hostname and port in this format addr:port (default value is 127.0.0.1:4242).
+ * - \b maxConcurrentUploads (optional, default=4): maximum number of instances uploaded at the same time.
  * @note : hostname and port of this service are from the preference settings.
  */
 class MODULE_IO_DICOMWEB_CLASS_API SSeriesPusher : public service::IController
@@ -71,6 +93,10 @@ public:
     MODULE_IO_DICOMWEB_API static const core::com::Slots::SlotKeyType s_DISPLAY_SLOT;
     typedef core::com::Slot<void (const std::string&, bool)> DisplayMessageSlotType;
 
+    typedef core::com::Signal<void (std::string)> ProgressStartedSignalType;
+    typedef core::com::Signal<void (std::string, float, std::string)> ProgressedSignalType;
+    typedef core::com::Signal<void (std::string)> ProgressStoppedSignalType;
+
     /**
      * @brief Constructor
      */
@@ -86,32 +112,49 @@ protected:
     /// Gets the configuration.
     MODULE_IO_DICOMWEB_API void configuring() override;
 
-    /// Does nothing.
+    /// Creates the upload worker.
     MODULE_IO_DICOMWEB_API void starting() override;
 
-    /// Does nothing.
+    /// Cancels the upload and stops the upload worker.
     MODULE_IO_DICOMWEB_API void stopping() override;
 
-    /// Checks the configuration and push the series.
+    /// Checks the configuration and pushes the series on the upload worker.
     MODULE_IO_DICOMWEB_API void updating() override;
 
 private:
 
-    /// Push Series
-    void pushSeries();
+    /// Pushes the series, runs on the upload worker
+    void pushSeries(const std::vector<SPTR(data::DicomSeries)>& _series);
 
-    /**
-     * @brief Display a message
-     * @param[in] message Message to display
-     * @param[in] error True if the message is an error messsage
-     */
-    void displayMessage(const std::string& message, bool error) const;
+    /// SLOT: stops pushing the series
+    void cancel();
 
     /// Http Qt Client
     sight::io::http::ClientQt m_clientQt;
 
+    /// Worker of the upload
+    core::thread::Worker::sptr m_pushWorker;
+
     /// Set to true when pushing series
-    bool m_isPushing;
+    std::atomic<bool> m_isPushing {false};
+
+    /// Set to true to stop pushing series
+    std::atomic<bool> m_isCancelled {false};
+
+    /// Maximum number of instances uploaded at the same time
+    std::size_t m_maxConcurrentUploads {4};
+
+    /// Signal emitted when the progress bar is started
+    ProgressStartedSignalType::sptr m_sigProgressStarted;
+
+    /// Signal emitted when the progress bar is updated
+    ProgressedSignalType::sptr m_sigProgressed;
+
+    /// Signal emitted when the progress bar is stopped
+    ProgressStoppedSignalType::sptr m_sigProgressStopped;
+
+    /// Progress bar ID
+    std::string m_progressbarId {"pushDicomWebProgressBar"};
 
     /// Server hostname preference key
     std::string m_serverHostnameKey;
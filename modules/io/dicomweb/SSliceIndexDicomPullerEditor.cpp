@@ -61,6 +61,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iterator>
+#include <optional>
 
 namespace sight::module::io::dicomweb
 {
@@ -114,6 +115,38 @@ void SSliceIndexDicomPullerEditor::configuring()
         m_delay = ::boost::lexical_cast<unsigned int>(delayStr);
     }
 
+    // Number of decoded slices kept in memory
+    std::string cacheSizeStr;
+    std::tie(success, cacheSizeStr) = config->getSafeAttributeValue("cacheSize");
+    if(success)
+    {
+        m_sliceCache.setCapacity(::boost::lexical_cast<size_t>(cacheSizeStr));
+    }
+
+    // Number of slices prefetched on each side of the selected one
+    std::string prefetchStr;
+    std::tie(success, prefetchStr) = config->getSafeAttributeValue("prefetch");
+    if(success)
+    {
+        m_prefetchCount = ::boost::lexical_cast<size_t>(prefetchStr);
+    }
+
+    // Parse server port and hostname preference keys
+    const service::IService::ConfigType configuration = this->getConfigTree();
+    if(configuration.count("server"))
+    {
+        const std::string serverInfo               = configuration.get("server", "");
+        const std::string::size_type splitPosition = serverInfo.find(':');
+        SIGHT_ASSERT("Server info not formatted correctly", splitPosition != std::string::npos);
+
+        m_serverHostnameKey = serverInfo.substr(0, splitPosition);
+        m_serverPortKey     = serverInfo.substr(splitPosition + 1, serverInfo.size());
+    }
+    else
+    {
+        throw core::tools::Failed("'server' element not found");
+    }
+
     if(m_delayTimer && m_delayTimer->isRunning())
     {
         m_delayTimer->stop();
@@ -164,6 +197,9 @@ void SSliceIndexDicomPullerEditor::starting()
     // Connect the signals
     QObject::connect(m_sliceIndexSlider, SIGNAL(valueChanged(int)), this, SLOT(changeSliceIndex(int)));
 
+    // Create the worker pulling and decoding the slices
+    m_requestWorker = core::thread::Worker::New();
+
     // Create temporary SeriesDB
     m_tempSeriesDB = data::SeriesDB::New();
 
@@ -188,16 +224,13 @@ void SSliceIndexDicomPullerEditor::starting()
         dicomReader->setConfiguration(m_readerConfig);
     }
 
+    // The reader runs on the request worker, with the pulls
+    dicomReader->setWorker(m_requestWorker);
     dicomReader->configure();
-    dicomReader->start();
+    dicomReader->start().wait();
 
     m_dicomReader = dicomReader;
 
-    // Image Indecies
-    m_axialIndex    = data::Integer::New(0);
-    m_frontalIndex  = data::Integer::New(0);
-    m_sagittalIndex = data::Integer::New(0);
-
     // Load a slice
     if(m_delayTimer)
     {
@@ -224,13 +257,28 @@ void SSliceIndexDicomPullerEditor::stopping()
         m_delayTimer->stop();
     }
 
+    // Skip the pending requests
+    {
+        std::lock_guard<std::mutex> lock(m_sliceCacheMutex);
+        m_selectedSeriesUID.clear();
+    }
+
     // Stop dicom reader
     if(!m_dicomReader.expired())
     {
-        m_dicomReader.lock()->stop();
+        m_dicomReader.lock()->stop().wait();
         service::OSR::unregisterService(m_dicomReader.lock());
     }
 
+    // Stop the worker
+    m_requestWorker->stop();
+    m_requestWorker.reset();
+
+    {
+        std::lock_guard<std::mutex> lock(m_sliceCacheMutex);
+        m_sliceCache.clear();
+    }
+
     this->destroy();
 }
 
@@ -274,28 +322,199 @@ void SSliceIndexDicomPullerEditor::triggerNewSlice()
     SIGHT_ASSERT("DicomSeries should not be null !", dicomSeries);
 
     // Compute slice index
-    const size_t selectedSliceIndex = static_cast<size_t>(m_sliceIndexSlider->value())
-                                      + dicomSeries->getFirstInstanceNumber();
-    if(!dicomSeries->isInstanceAvailable(selectedSliceIndex))
+    const size_t firstSliceIndex    = dicomSeries->getFirstInstanceNumber();
+    const size_t endSliceIndex      = firstSliceIndex + dicomSeries->getNumberOfInstances();
+    const size_t selectedSliceIndex = static_cast<size_t>(m_sliceIndexSlider->value()) + firstSliceIndex;
+    const std::string seriesUID     = dicomSeries->getInstanceUID();
+
+    // Url PACS, the preferences are read here as the requests run on the request worker
+    const std::string hostname = ui::base::preferences::getValue(m_serverHostnameKey);
+    if(!hostname.empty())
+    {
+        m_serverHostname = hostname;
+    }
+
+    const std::string port = ui::base::preferences::getValue(m_serverPortKey);
+    if(!port.empty())
+    {
+        m_serverPort = std::stoi(port);
+    }
+
+    const std::string pacsServer("http://" + m_serverHostname + ":" + std::to_string(m_serverPort));
+
+    // The pending requests of the previous slices become outdated
+    m_selectedSliceIndex = selectedSliceIndex;
+
+    // Reuse the slice if it is already decoded, else read it on the request worker
+    std::optional<data::Image::sptr> slice;
+    {
+        std::lock_guard<std::mutex> lock(m_sliceCacheMutex);
+        if(seriesUID != m_selectedSeriesUID)
+        {
+            // The slices of the previous series are no longer needed
+            m_sliceCache.clear();
+            m_selectedSeriesUID = seriesUID;
+        }
+
+        slice = m_sliceCache.get({seriesUID, selectedSliceIndex});
+    }
+
+    if(slice)
     {
-        this->pullInstance();
+        this->setOutput("image", *slice);
     }
     else
     {
-        this->readImage(selectedSliceIndex);
+        m_requestWorker->post(
+            std::bind(
+                &SSliceIndexDicomPullerEditor::loadSlice,
+                this,
+                pacsServer,
+                seriesUID,
+                selectedSliceIndex,
+                true
+            )
+        );
+    }
+
+    // Prefetch the neighbouring slices, the nearest ones first
+    for(size_t i = 1 ; i <= m_prefetchCount ; ++i)
+    {
+        if(selectedSliceIndex + i < endSliceIndex)
+        {
+            m_requestWorker->post(
+                std::bind(
+                    &SSliceIndexDicomPullerEditor::loadSlice,
+                    this,
+                    pacsServer,
+                    seriesUID,
+                    selectedSliceIndex + i,
+                    false
+                )
+            );
+        }
+
+        if(selectedSliceIndex >= firstSliceIndex + i)
+        {
+            m_requestWorker->post(
+                std::bind(
+                    &SSliceIndexDicomPullerEditor::loadSlice,
+                    this,
+                    pacsServer,
+                    seriesUID,
+                    selectedSliceIndex - i,
+                    false
+                )
+            );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SSliceIndexDicomPullerEditor::loadSlice(
+    const std::string& pacsServer,
+    const std::string& seriesUID,
+    size_t sliceIndex,
+    bool display
+)
+{
+    // Skip the requests outdated since the slider moved on or the series changed
+    const size_t selectedSliceIndex = m_selectedSliceIndex;
+    const size_t distance           = sliceIndex > selectedSliceIndex
+                                      ? sliceIndex - selectedSliceIndex
+                                      : selectedSliceIndex - sliceIndex;
+    if((display && distance != 0) || distance > m_prefetchCount)
+    {
+        return;
+    }
+
+    std::optional<data::Image::sptr> slice;
+    {
+        std::lock_guard<std::mutex> lock(m_sliceCacheMutex);
+        if(seriesUID != m_selectedSeriesUID)
+        {
+            return;
+        }
+
+        slice = m_sliceCache.get({seriesUID, sliceIndex});
+    }
+
+    if(!slice)
+    {
+        data::DicomSeries::sptr dicomSeries = this->getInOut<data::DicomSeries>("series");
+        if(!dicomSeries || dicomSeries->getInstanceUID() != seriesUID)
+        {
+            return;
+        }
+
+        bool isInstanceAvailable = false;
+        {
+            core::mt::ReadLock lock(dicomSeries->getMutex());
+            isInstanceAvailable = dicomSeries->isInstanceAvailable(sliceIndex);
+        }
+
+        // If the slice is not pulled, pull it
+        if(!isInstanceAvailable && !this->pullInstance(pacsServer, dicomSeries, sliceIndex))
+        {
+            return;
+        }
+
+        const data::Image::sptr decodedSlice = this->readImage(dicomSeries, sliceIndex);
+        if(!decodedSlice)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_sliceCacheMutex);
+        m_sliceCache.insert({seriesUID, sliceIndex}, decodedSlice);
+        slice = decodedSlice;
+    }
+
+    if(display)
+    {
+        m_associatedWorker->post(
+            std::bind(&SSliceIndexDicomPullerEditor::displaySlice, this, seriesUID, sliceIndex, *slice)
+        );
     }
 }
 
 //------------------------------------------------------------------------------
 
-void SSliceIndexDicomPullerEditor::readImage(size_t selectedSliceIndex)
+void SSliceIndexDicomPullerEditor::displaySlice(
+    const std::string& seriesUID,
+    size_t sliceIndex,
+    const data::Image::sptr& slice
+)
+{
+    // The slider may have moved on while the slice was decoded
+    if(!this->isStarted() || sliceIndex != m_selectedSliceIndex)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_sliceCacheMutex);
+        if(seriesUID != m_selectedSeriesUID)
+        {
+            return;
+        }
+    }
+
+    this->setOutput("image", slice);
+}
+
+//------------------------------------------------------------------------------
+
+data::Image::sptr SSliceIndexDicomPullerEditor::readImage(
+    const data::DicomSeries::csptr& dicomSeries,
+    size_t selectedSliceIndex
+)
 {
     // DicomSeries
-    data::DicomSeries::csptr dicomSeries = this->getInOut<data::DicomSeries>("series");
-    SIGHT_ASSERT("DicomSeries should not be null !", dicomSeries);
     if(dicomSeries->getModality() != "CT" && dicomSeries->getModality() != "MR" && dicomSeries->getModality() != "XA")
     {
-        return;
+        return nullptr;
     }
 
     // Creates unique temporary folder, no need to check if exists before (see core::tools::System::getTemporaryFolder)
@@ -305,36 +524,39 @@ void SSliceIndexDicomPullerEditor::readImage(size_t selectedSliceIndex)
     SIGHT_INFO("Create " + tmpPath.string());
     std::filesystem::create_directories(tmpPath);
 
-    const auto& binaries = dicomSeries->getDicomContainer();
-    auto iter            = binaries.find(selectedSliceIndex);
-    SIGHT_ASSERT("Index '" << selectedSliceIndex << "' is not found in DicomSeries", iter != binaries.end());
+    {
+        core::mt::ReadLock seriesLock(dicomSeries->getMutex());
+
+        const auto& binaries = dicomSeries->getDicomContainer();
+        auto iter            = binaries.find(selectedSliceIndex);
+        SIGHT_ASSERT("Index '" << selectedSliceIndex << "' is not found in DicomSeries", iter != binaries.end());
 
-    const core::memory::BufferObject::sptr bufferObj = iter->second;
-    const core::memory::BufferObject::Lock lockerDest(bufferObj);
-    const char* buffer = static_cast<char*>(lockerDest.getBuffer());
-    const size_t size  = bufferObj->getSize();
+        const core::memory::BufferObject::sptr bufferObj = iter->second;
+        const core::memory::BufferObject::ConstLock lockerDest(bufferObj);
+        const char* buffer = static_cast<const char*>(lockerDest.getBuffer());
+        const size_t size  = bufferObj->getSize();
 
-    std::filesystem::path dest = tmpPath / std::to_string(selectedSliceIndex);
-    std::ofstream fs(dest, std::ios::binary | std::ios::trunc);
-    SIGHT_THROW_IF("Can't open '" << tmpPath << "' for write.", !fs.good());
+        std::filesystem::path dest = tmpPath / std::to_string(selectedSliceIndex);
+        std::ofstream fs(dest, std::ios::binary | std::ios::trunc);
+        SIGHT_THROW_IF("Can't open '" << tmpPath << "' for write.", !fs.good());
 
-    fs.write(buffer, size);
-    fs.close();
+        fs.write(buffer, size);
+        fs.close();
+    }
 
     // Read image
-    m_dicomReader.lock()->setFolder(tmpPath);
-    if(!m_dicomReader.expired())
+    const auto dicomReader = m_dicomReader.lock();
+    if(!dicomReader)
     {
-        m_dicomReader.lock()->update();
-
-        if(m_dicomReader.expired() || m_dicomReader.lock()->isStopped())
-        {
-            return;
-        }
+        return nullptr;
     }
-    else
+
+    dicomReader->setFolder(tmpPath);
+    dicomReader->update();
+
+    if(dicomReader->isStopped())
     {
-        return;
+        return nullptr;
     }
 
     //Copy image
@@ -345,68 +567,43 @@ void SSliceIndexDicomPullerEditor::readImage(size_t selectedSliceIndex)
         imageSeries = data::ImageSeries::dynamicCast(*(m_tempSeriesDB->getContainer().begin()));
     }
 
+    data::Image::sptr newImage;
     if(imageSeries)
     {
-        data::Image::sptr newImage      = imageSeries->getImage();
+        // Copy the read series to the slice, the reader output is overwritten by the next reading
+        newImage = data::Image::New();
+        newImage->deepCopy(imageSeries->getImage());
         const data::Image::Size newSize = newImage->getSize2();
 
-        newImage->setField(data::fieldHelper::Image::m_axialSliceIndexId, m_axialIndex);
-        m_frontalIndex->setValue(static_cast<int>(newSize[0] / 2));
-        newImage->setField(data::fieldHelper::Image::m_frontalSliceIndexId, m_frontalIndex);
-        m_sagittalIndex->setValue(static_cast<int>(newSize[1] / 2));
-        newImage->setField(data::fieldHelper::Image::m_sagittalSliceIndexId, m_sagittalIndex);
-
-        this->setOutput("image", newImage);
+        newImage->setField(data::fieldHelper::Image::m_axialSliceIndexId, data::Integer::New(0));
+        newImage->setField(
+            data::fieldHelper::Image::m_frontalSliceIndexId,
+            data::Integer::New(static_cast<int>(newSize[0] / 2))
+        );
+        newImage->setField(
+            data::fieldHelper::Image::m_sagittalSliceIndexId,
+            data::Integer::New(static_cast<int>(newSize[1] / 2))
+        );
     }
 
     std::error_code ec;
     std::filesystem::remove_all(path, ec);
     SIGHT_ERROR_IF("remove_all error for path " + path.string() + ": " + ec.message(), ec.value());
+
+    return newImage;
 }
 
 //------------------------------------------------------------------------------
 
-void SSliceIndexDicomPullerEditor::pullInstance()
+bool SSliceIndexDicomPullerEditor::pullInstance(
+    const std::string& pacsServer,
+    const data::DicomSeries::sptr& dicomSeries,
+    size_t selectedSliceIndex
+)
 {
-    service::IService::ConfigType configuration = this->getConfigTree();
-    //Parse server port and hostname
-    if(configuration.count("server"))
-    {
-        const std::string serverInfo               = configuration.get("server", "");
-        const std::string::size_type splitPosition = serverInfo.find(':');
-        SIGHT_ASSERT("Server info not formatted correctly", splitPosition != std::string::npos);
-
-        m_serverHostnameKey = serverInfo.substr(0, splitPosition);
-        m_serverPortKey     = serverInfo.substr(splitPosition + 1, serverInfo.size());
-    }
-    else
-    {
-        throw core::tools::Failed("'server' element not found");
-    }
-
-    const std::string hostname = ui::base::preferences::getValue(m_serverHostnameKey);
-    if(!hostname.empty())
-    {
-        m_serverHostname = hostname;
-    }
-
-    const std::string port = ui::base::preferences::getValue(m_serverPortKey);
-    if(!port.empty())
-    {
-        m_serverPort = std::stoi(port);
-    }
-
     // Catch any errors
     try
     {
-        // DicomSeries
-        data::DicomSeries::sptr dicomSeries = this->getInOut<data::DicomSeries>("series");
-        SIGHT_ASSERT("DicomSeries should not be null !", dicomSeries);
-
-        // Get selected slice
-        size_t selectedSliceIndex = static_cast<size_t>(m_sliceIndexSlider->value())
-                                    + dicomSeries->getFirstInstanceNumber();
-
         std::string seriesInstanceUID = dicomSeries->getInstanceUID();
 
         // Find Series according to SeriesInstanceUID
@@ -418,9 +615,6 @@ void SSliceIndexDicomPullerEditor::pullInstance()
         body.insert("Query", query);
         body.insert("Limit", 0);
 
-        /// Url PACS
-        const std::string pacsServer("http://" + m_serverHostname + ":" + std::to_string(m_serverPort));
-
         /// Orthanc "/tools/find" route. POST a JSON to get all Series corresponding to the SeriesInstanceUID.
         sight::io::http::Request::sptr request = sight::io::http::Request::New(
             pacsServer + "/tools/find"
@@ -435,11 +629,11 @@ void SSliceIndexDicomPullerEditor::pullInstance()
             std::stringstream ss;
             ss << "Host not found:\n"
             << " Please check your configuration: \n"
-            << "Pacs host name: " << m_serverHostname << "\n"
-            << "Pacs port: " << m_serverPort << "\n";
+            << "Pacs: " << pacsServer << "\n";
 
             this->displayErrorMessage(ss.str());
             SIGHT_WARN(exception.what());
+            return false;
         }
         QJsonDocument jsonResponse    = QJsonDocument::fromJson(seriesAnswer);
         const QJsonArray& seriesArray = jsonResponse.array();
@@ -472,11 +666,12 @@ void SSliceIndexDicomPullerEditor::pullInstance()
 
             this->displayErrorMessage(ss.str());
             SIGHT_WARN(exception.what());
+            return false;
         }
 
-        // Add path and trigger reading
+        // Add path
+        core::mt::WriteLock lock(dicomSeries->getMutex());
         dicomSeries->addDicomPath(selectedSliceIndex, instancePath);
-        this->readImage(selectedSliceIndex);
     }
     catch(sight::io::http::exceptions::Base& exception)
     {
@@ -484,7 +679,10 @@ void SSliceIndexDicomPullerEditor::pullInstance()
         ss << "Unknown error.";
         this->displayErrorMessage(ss.str());
         SIGHT_WARN(exception.what());
+        return false;
     }
+
+    return true;
 }
 
 //------------------------------------------------------------------------------
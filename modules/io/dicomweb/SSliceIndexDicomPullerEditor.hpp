@@ -24,6 +24,9 @@
 
 #include "modules/io/dicomweb/config.hpp"
 
+#include <core/thread/Worker.hpp>
+#include <core/tools/LRUCache.hpp>
+
 #include <io/http/ClientQt.hpp>
 
 #include <ui/base/IEditor.hpp>
@@ -31,7 +34,11 @@
 #include <QLineEdit>
 #include <QSlider>
 
+#include <atomic>
 #include <filesystem>
+#include <mutex>
+#include <string>
+#include <utility>
 
 namespace sight
 {
@@ -53,7 +60,8 @@ class IReader;
 namespace data
 {
 
-class Integer;
+class DicomSeries;
+class Image;
 class SeriesDB;
 
 }
@@ -70,6 +78,43 @@ struct ConfigurationElement;
 namespace sight::module::io::dicomweb
 {
 
+/**
+ * @brief This editor service is used to select a slice index and pull the image from the PACS if it is not
+ *        available on the local computer.
+ *
+ * The slices are pulled and decoded on a request worker, thus the slider stays responsive. The decoded slices are
+ * kept in a cache of the most recently used slices. When a slice is selected, its neighbouring slices are pulled and
+ * decoded in the background. The pending requests of slices too far from the selected one are skipped when the
+ * slider moves on.
+ *
+ * @section XML XML Configuration
+ * @code{.xml}
+    <service type="sight::module::io::dicomweb::SSliceIndexDicomPullerEditor">
+        <inout key="series" uid="..." />
+        <out key="image" uid="..." />
+        <server>%PACS_SERVER_HOSTNAME%:%PACS_SERVER_PORT%</server>
+        <config dicomReader="::sight::module::io::dicom::SSeriesDBReader" delay="500" cacheSize="32" prefetch="2">
+            <dicomReaderConfig>
+                ...
+            </dicomReaderConfig>
+        </config>
+    </service>
+   @endcode
+ *
+ * @subsection In-Out In-Out:
+ * - \b series [sight::data::DicomSeries]: DICOM series where to extract the images.
+ *
+ * @subsection Output Output:
+ * - \b image [sight::data::Image]: decoded slice.
+ *
+ * @subsection Configuration Configuration:
+ * - \b server: preference keys of the server hostname and port, in this format hostname:port.
+ * - \b dicomReader (mandatory): reader type to use.
+ * - \b dicomReaderConfig (optional): configuration of the DICOM reader.
+ * - \b delay (optional, unsigned, default=500): delay to wait between each slice move.
+ * - \b cacheSize (optional, unsigned, default=32): maximum number of decoded slices kept in memory.
+ * - \b prefetch (optional, unsigned, default=2): number of slices prefetched on each side of the selected one.
+ */
 class MODULE_IO_DICOMWEB_CLASS_API SSliceIndexDicomPullerEditor : public QObject,
                                                                   public sight::ui::base::IEditor
 {
@@ -113,17 +158,42 @@ protected:
 
 private:
 
-    /// Function called when a new slice must be displayed.
+    /// Displays the selected slice if it is cached, else requests it, then prefetches its neighbouring slices.
     void triggerNewSlice();
 
     /**
-     * @brief Read the selected image
-     * @param[in] selectedSliceIndex Selected slice of the image that must be read
+     * @brief Gets a slice from the cache, or pulls it if needed and reads it, called on the request worker.
+     * @param[in] pacsServer URL of the PACS
+     * @param[in] seriesUID instance UID of the series, the request is skipped if the series changed
+     * @param[in] sliceIndex index of the slice
+     * @param[in] display true to display the slice, false to only cache it
      */
-    void readImage(size_t selectedSliceIndex);
+    void loadSlice(const std::string& pacsServer, const std::string& seriesUID, size_t sliceIndex, bool display);
 
-    /// Pull the selected slice from the Pacs
-    void pullInstance();
+    /**
+     * @brief Read a slice
+     * @param[in] dicomSeries series of the slice
+     * @param[in] sliceIndex index of the slice that must be read
+     * @return the decoded slice, or nullptr if it can not be read
+     */
+    SPTR(data::Image) readImage(const CSPTR(data::DicomSeries)& dicomSeries, size_t sliceIndex);
+
+    /**
+     * @brief Pull a slice from the Pacs
+     * @param[in] pacsServer URL of the PACS
+     * @param[in] dicomSeries series of the slice
+     * @param[in] sliceIndex index of the slice that must be pulled
+     * @return true if the slice is pulled
+     */
+    bool pullInstance(const std::string& pacsServer, const SPTR(data::DicomSeries)& dicomSeries, size_t sliceIndex);
+
+    /**
+     * @brief Sets a decoded slice as output if it is still selected, called on the service worker.
+     * @param[in] seriesUID instance UID of the series of the slice
+     * @param[in] sliceIndex index of the slice
+     * @param[in] slice decoded slice
+     */
+    void displaySlice(const std::string& seriesUID, size_t sliceIndex, const SPTR(data::Image)& slice);
 
     /**
      * @brief Displays a dialog box with the error message
@@ -151,13 +221,6 @@ private:
     /// Temporary SeriesDB
     SPTR(data::SeriesDB) m_tempSeriesDB;
 
-    /// Axial slice index
-    SPTR(data::Integer) m_axialIndex;
-    /// Frontal slice index
-    SPTR(data::Integer) m_frontalIndex;
-    /// Sagittal slice index
-    SPTR(data::Integer) m_sagittalIndex;
-
     /// Series enquirer
     sight::io::http::ClientQt m_clientQt;
 
@@ -167,6 +230,24 @@ private:
     /// Delay
     unsigned int m_delay;
 
+    /// Worker pulling and decoding the slices
+    core::thread::Worker::sptr m_requestWorker;
+
+    /// Number of slices prefetched on each side of the selected one
+    size_t m_prefetchCount {2};
+
+    /// Most recently used decoded slices, by series instance UID and slice index
+    core::tools::LRUCache<std::pair<std::string, size_t>, SPTR(data::Image)> m_sliceCache {32};
+
+    /// Protects m_sliceCache and m_selectedSeriesUID, used from the service worker and the request worker
+    std::mutex m_sliceCacheMutex;
+
+    /// Instance UID of the series of the selected slice
+    std::string m_selectedSeriesUID;
+
+    /// Index of the selected slice, the requests of slices too far from it are skipped
+    std::atomic<size_t> m_selectedSliceIndex {0};
+
     /// Optional configuration to set to reader implementation
     SPTR(core::runtime::ConfigurationElement) m_readerConfig;
 
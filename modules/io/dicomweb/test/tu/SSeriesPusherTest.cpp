@@ -0,0 +1,418 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "SSeriesPusherTest.hpp"
+
+#include <core/com/Signal.hpp>
+#include <core/com/Signal.hxx>
+#include <core/com/Slot.hpp>
+#include <core/com/Slot.hxx>
+#include <core/thread/ActiveWorkers.hpp>
+
+#include <data/DicomSeries.hpp>
+#include <data/Vector.hpp>
+
+#include <service/macros.hpp>
+#include <service/op/Add.hpp>
+#include <service/registry/ObjectService.hpp>
+
+#include <ui/qt/App.hpp>
+#include <ui/qt/WorkerQt.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(::sight::module::io::dicomweb::ut::SSeriesPusherTest);
+
+namespace sight::module::io::dicomweb
+{
+
+namespace ut
+{
+
+//------------------------------------------------------------------------------
+
+static const std::size_t s_INSTANCE_SIZE = 1000;
+
+//------------------------------------------------------------------------------
+
+static data::DicomSeries::sptr createSeries(std::size_t instanceCount)
+{
+    data::DicomSeries::sptr series = data::DicomSeries::New();
+    for(std::size_t i = 0 ; i < instanceCount ; ++i)
+    {
+        core::memory::BufferObject::sptr buffer = core::memory::BufferObject::New();
+        buffer->allocate(s_INSTANCE_SIZE);
+        core::memory::BufferObject::Lock lock(buffer);
+        std::memset(lock.getBuffer(), static_cast<int>(i), s_INSTANCE_SIZE);
+        series->addBinary(i, buffer);
+    }
+
+    series->setNumberOfInstances(instanceCount);
+    return series;
+}
+
+//------------------------------------------------------------------------------
+
+static service::IService::sptr createPusher(
+    const data::Vector::sptr& selectedSeries,
+    const std::string& server,
+    std::size_t maxConcurrentUploads
+)
+{
+    service::IService::sptr srv = service::add("sight::module::io::dicomweb::SSeriesPusher");
+    CPPUNIT_ASSERT(srv);
+
+    service::IService::ConfigType config;
+    config.put("server", server);
+    config.put("maxConcurrentUploads", maxConcurrentUploads);
+
+    srv->registerInput(selectedSeries, "selectedSeries");
+    srv->setConfiguration(config);
+    CPPUNIT_ASSERT_NO_THROW(srv->configure());
+    CPPUNIT_ASSERT_NO_THROW(srv->start().wait());
+    return srv;
+}
+
+//------------------------------------------------------------------------------
+
+static void answer(QTcpSocket* socket, bool empty = false)
+{
+    if(empty)
+    {
+        socket->write("HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: 0\r\n\r\n");
+    }
+    else
+    {
+        socket->write("HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: 2\r\n\r\n{}");
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SSeriesPusherTest::setUp()
+{
+    // Set up context before running a test.
+    static char arg1[] = "SSeriesPusherTest";
+#if defined(__linux)
+    static char arg2[]  = "-platform";
+    static char arg3[]  = "offscreen";
+    static char* argv[] = {arg1, arg2, arg3, nullptr};
+    static int argc     = 3;
+#else
+    static char* argv[] = {arg1, 0};
+    static int argc     = 1;
+#endif
+
+    CPPUNIT_ASSERT(qApp == NULL);
+    std::function<QSharedPointer<QCoreApplication>(int&, char**)> callback =
+        [](int& argc, char** argv)
+        {
+            return QSharedPointer<QApplication>(new sight::ui::qt::App(argc, argv, false));
+        };
+    m_worker = sight::ui::qt::getQtWorker(argc, argv, callback, "", "");
+
+    m_instanceCount = 0;
+    m_byteCount     = 0;
+    m_holdAnswers   = false;
+    m_emptyAnswers  = false;
+
+    // Keep-alive server answering POST /instances, the answers can be held to keep the uploads in flight
+    m_server.connect(
+        &m_server,
+        &QTcpServer::newConnection,
+        [ = ]
+            {
+                QTcpSocket* socket = m_server.nextPendingConnection();
+                auto data          = std::make_shared<QByteArray>();
+                socket->connect(
+                    socket,
+                    &QTcpSocket::readyRead,
+                    [ = ]
+                {
+                    *data += socket->readAll();
+
+                    int end = data->indexOf("\r\n\r\n");
+                    while(end >= 0)
+                    {
+                        const QByteArray headers = data->left(end).toLower();
+                        const int lengthPos      = headers.indexOf("content-length:");
+                        const int length         = lengthPos < 0
+                                                   ? 0
+                                                   : headers.mid(lengthPos + 15, headers.indexOf("\r\n", lengthPos)
+                                                                 - lengthPos - 15).trimmed().toInt();
+
+                        // Wait for the whole body
+                        if(data->size() < end + 4 + length)
+                        {
+                            break;
+                        }
+
+                        data->remove(0, end + 4 + length);
+                        ++m_instanceCount;
+                        m_byteCount += static_cast<std::size_t>(length);
+
+                        if(m_holdAnswers)
+                        {
+                            m_heldSockets.append(socket);
+                        }
+                        else
+                        {
+                            answer(socket, m_emptyAnswers);
+                        }
+
+                        end = data->indexOf("\r\n\r\n");
+                    }
+                });
+                socket->connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+            });
+
+    m_server.moveToThread(&m_thread);
+    m_thread.connect(&m_thread, &QThread::started, [ = ]{m_server.listen();});
+    m_thread.connect(&m_thread, &QThread::finished, [ = ]{m_server.close();});
+    m_thread.start();
+
+    for(int i = 0 ; !m_server.isListening() && i < 10 ; ++i)
+    {
+        QThread::sleep(1);
+    }
+
+    CPPUNIT_ASSERT(m_server.isListening());
+}
+
+//------------------------------------------------------------------------------
+
+void SSeriesPusherTest::tearDown()
+{
+    // Clean up after the test run.
+    m_thread.quit();
+    m_thread.wait();
+
+    m_thread.disconnect();
+    m_server.disconnect();
+    m_heldSockets.clear();
+
+    m_worker->post(std::bind(&QCoreApplication::quit));
+    m_worker->getFuture().wait();
+    m_worker.reset();
+
+    core::thread::ActiveWorkers::getDefault()->clearRegistry();
+    CPPUNIT_ASSERT(qApp == NULL);
+}
+
+//------------------------------------------------------------------------------
+
+void SSeriesPusherTest::releaseAnswers()
+{
+    QMetaObject::invokeMethod(
+        &m_server,
+        [this]
+        {
+            m_holdAnswers = false;
+            for(const QPointer<QTcpSocket>& socket : m_heldSockets)
+            {
+                if(socket)
+                {
+                    answer(socket);
+                }
+            }
+
+            m_heldSockets.clear();
+        },
+        Qt::BlockingQueuedConnection
+    );
+}
+
+//------------------------------------------------------------------------------
+
+void SSeriesPusherTest::pushTest()
+{
+    auto selectedSeries = data::Vector::New();
+    selectedSeries->getContainer().push_back(createSeries(3));
+    selectedSeries->getContainer().push_back(createSeries(4));
+
+    const std::string server    = "localhost:" + std::to_string(m_server.serverPort());
+    service::IService::sptr srv = createPusher(selectedSeries, server, 2);
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::string message;
+
+    std::function<void(std::string)> fnNotified =
+        [&](std::string _message)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                message = _message;
+            }
+            condition.notify_one();
+        };
+
+    core::thread::Worker::sptr worker = core::thread::Worker::New();
+    auto slotNotified                 = core::com::newSlot(fnNotified);
+    slotNotified->setWorker(worker);
+    srv->signal<service::IService::SuccessNotifiedSignalType>(service::IService::s_SUCCESS_NOTIFIED_SIG)
+    ->connect(slotNotified);
+
+    // The upload runs on its own worker, updating() returns before the end of the upload
+    CPPUNIT_ASSERT_NO_THROW(srv->update().wait());
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        CPPUNIT_ASSERT(condition.wait_for(lock, std::chrono::seconds(30), [&]{return !message.empty();}));
+        CPPUNIT_ASSERT_EQUAL(std::string("Upload successful: 2/2"), message);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(std::size_t(7), std::size_t(m_instanceCount));
+    CPPUNIT_ASSERT_EQUAL(7 * s_INSTANCE_SIZE, std::size_t(m_byteCount));
+
+    srv->signal<service::IService::SuccessNotifiedSignalType>(service::IService::s_SUCCESS_NOTIFIED_SIG)
+    ->disconnect(slotNotified);
+    worker->stop();
+
+    CPPUNIT_ASSERT_NO_THROW(srv->stop().wait());
+    service::OSR::unregisterService(srv);
+}
+
+//------------------------------------------------------------------------------
+
+void SSeriesPusherTest::cancelTest()
+{
+    m_holdAnswers = true;
+
+    auto selectedSeries = data::Vector::New();
+    selectedSeries->getContainer().push_back(createSeries(10));
+
+    const std::string server    = "localhost:" + std::to_string(m_server.serverPort());
+    service::IService::sptr srv = createPusher(selectedSeries, server, 2);
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::string message;
+
+    std::function<void(std::string)> fnNotified =
+        [&](std::string _message)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                message = _message;
+            }
+            condition.notify_one();
+        };
+
+    core::thread::Worker::sptr worker = core::thread::Worker::New();
+    auto slotNotified                 = core::com::newSlot(fnNotified);
+    slotNotified->setWorker(worker);
+    srv->signal<service::IService::InfoNotifiedSignalType>(service::IService::s_INFO_NOTIFIED_SIG)
+    ->connect(slotNotified);
+
+    CPPUNIT_ASSERT_NO_THROW(srv->update().wait());
+
+    for(int i = 0 ; m_instanceCount == 0 && i < 100 ; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    CPPUNIT_ASSERT(m_instanceCount > 0);
+
+    // The service worker is not blocked by the upload, the cancel slot is run while no answer is received
+    auto cancelled = srv->slot("cancel")->asyncRun();
+    CPPUNIT_ASSERT(cancelled.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+
+    this->releaseAnswers();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        CPPUNIT_ASSERT(condition.wait_for(lock, std::chrono::seconds(30), [&]{return !message.empty();}));
+        CPPUNIT_ASSERT_EQUAL(std::string("Upload cancelled: "), message.substr(0, 18));
+    }
+
+    // Only the instances in flight when cancelling are uploaded
+    CPPUNIT_ASSERT(m_instanceCount < 10);
+
+    srv->signal<service::IService::InfoNotifiedSignalType>(service::IService::s_INFO_NOTIFIED_SIG)
+    ->disconnect(slotNotified);
+    worker->stop();
+
+    CPPUNIT_ASSERT_NO_THROW(srv->stop().wait());
+    service::OSR::unregisterService(srv);
+}
+
+//------------------------------------------------------------------------------
+
+void SSeriesPusherTest::failureTest()
+{
+    m_emptyAnswers = true;
+
+    auto selectedSeries = data::Vector::New();
+    selectedSeries->getContainer().push_back(createSeries(3));
+
+    const std::string server    = "localhost:" + std::to_string(m_server.serverPort());
+    service::IService::sptr srv = createPusher(selectedSeries, server, 2);
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::string message;
+
+    std::function<void(std::string)> fnNotified =
+        [&](std::string _message)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                message = _message;
+            }
+            condition.notify_one();
+        };
+
+    core::thread::Worker::sptr worker = core::thread::Worker::New();
+    auto slotNotified                 = core::com::newSlot(fnNotified);
+    slotNotified->setWorker(worker);
+    srv->signal<service::IService::FailureNotifiedSignalType>(service::IService::s_FAILURE_NOTIFIED_SIG)
+    ->connect(slotNotified);
+
+    CPPUNIT_ASSERT_NO_THROW(srv->update().wait());
+
+    // The server rejects every instance, no series is uploaded
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        CPPUNIT_ASSERT(condition.wait_for(lock, std::chrono::seconds(30), [&]{return !message.empty();}));
+        CPPUNIT_ASSERT_EQUAL(std::string("Upload failed: "), message.substr(0, 15));
+    }
+
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), std::size_t(m_instanceCount));
+
+    srv->signal<service::IService::FailureNotifiedSignalType>(service::IService::s_FAILURE_NOTIFIED_SIG)
+    ->disconnect(slotNotified);
+    worker->stop();
+
+    CPPUNIT_ASSERT_NO_THROW(srv->stop().wait());
+    service::OSR::unregisterService(srv);
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace ut
+
+} // namespace sight::module::io::dicomweb
@@ -0,0 +1,90 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <core/thread/Worker.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <QPointer>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QThread>
+
+#include <atomic>
+#include <cstddef>
+
+namespace sight::module::io::dicomweb
+{
+
+namespace ut
+{
+
+class SSeriesPusherTest : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(SSeriesPusherTest);
+CPPUNIT_TEST(pushTest);
+CPPUNIT_TEST(cancelTest);
+CPPUNIT_TEST(failureTest);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // Interface
+    // Set up the application and the server
+    void setUp();
+    // Clean up the application and the server
+    void tearDown();
+
+    // Test functions
+    // Pushes two series, the service worker stays free while uploading
+    void pushTest();
+    // Cancels an upload while the server does not answer
+    void cancelTest();
+    // Pushes a series rejected by the server, a failure is notified
+    void failureTest();
+
+private:
+
+    // Answers the requests held by the server
+    void releaseAnswers();
+
+    // Application thread
+    core::thread::Worker::sptr m_worker;
+    // Local server simulating the Orthanc /instances route
+    QTcpServer m_server;
+    // Server thread
+    QThread m_thread;
+    // Number of instances and bytes received by the server
+    std::atomic<std::size_t> m_instanceCount;
+    std::atomic<std::size_t> m_byteCount;
+    // When true, the server does not answer until releaseAnswers() is called
+    std::atomic<bool> m_holdAnswers;
+    // When true, the server answers with an empty body, the instances are considered as not uploaded
+    std::atomic<bool> m_emptyAnswers;
+    // Sockets waiting for an answer, only used from the server thread
+    QList<QPointer<QTcpSocket> > m_heldSockets;
+};
+
+} // namespace ut
+
+} // namespace sight::module::io::dicomweb
@@ -50,6 +50,7 @@ static const core::com::Slots::SlotKeyType s_REMOVE_SERIES_SLOT = "removeSeries"
 
 static const std::string s_DICOM_READER_CONFIG = "dicomReader";
 static const std::string s_READER_CONFIG       = "readerConfig";
+static const std::string s_ASSOCIATIONS_CONFIG = "associations";
 
 static const service::IService::KeyType s_PACS_INPUT     = "pacsConfig";
 static const service::IService::KeyType s_SELECTED_INPUT = "selectedSeries";
@@ -87,6 +88,10 @@ void SSeriesPuller::configuring()
     SIGHT_ERROR_IF("'" + s_DICOM_READER_CONFIG + "' attribute not set", m_dicomReaderImplementation.empty())
 
     m_readerConfig = config.get(s_READER_CONFIG, m_readerConfig);
+
+    m_associationCount = config.get<std::size_t>(s_ASSOCIATIONS_CONFIG, m_associationCount);
+    SIGHT_ERROR_IF("'" + s_ASSOCIATIONS_CONFIG + "' must be at least 1", m_associationCount == 0);
+    m_associationCount = std::max<std::size_t>(m_associationCount, 1);
 }
 
 //------------------------------------------------------------------------------
@@ -240,10 +245,10 @@ void SSeriesPuller::pullSeries()
             using sight::io::dimse::helper::Series;
             if(pacsConfig->getRetrieveMethod() == sight::io::dimse::data::PacsConfiguration::GET_RETRIEVE_METHOD)
             {
-                seriesEnquirer->pullSeriesUsingGetRetrieveMethod(
-                    Series::toSeriesInstanceUIDContainer(
-                        pullSeriesVector
-                    )
+                seriesEnquirer->pullSeriesConcurrently(
+                    Series::toSeriesInstanceUIDContainer(pullSeriesVector),
+                    m_associationCount,
+                    sight::io::dimse::SeriesEnquirer::RetrieveMethod::GET
                 );
             }
             else if(pacsConfig->getRetrieveMethod()
@@ -260,20 +265,20 @@ void SSeriesPuller::pullSeries()
                 // Start series retriever in a worker.
                 worker->post(std::bind(&sight::io::dimse::SeriesRetriever::start, seriesRetriever));
 
-                // Pull Selected Series.
-                seriesEnquirer->pullSeriesUsingMoveRetrieveMethod(
-                    Series::toSeriesInstanceUIDContainer(
-                        pullSeriesVector
-                    )
+                // Pull Selected Series, the series retriever accepts a single association.
+                seriesEnquirer->pullSeriesConcurrently(
+                    Series::toSeriesInstanceUIDContainer(pullSeriesVector),
+                    1,
+                    sight::io::dimse::SeriesEnquirer::RetrieveMethod::MOVE
                 );
             }
             else
             {
                 SIGHT_ERROR("Unknown retrieve method, 'get' will be used");
-                seriesEnquirer->pullSeriesUsingGetRetrieveMethod(
-                    Series::toSeriesInstanceUIDContainer(
-                        pullSeriesVector
-                    )
+                seriesEnquirer->pullSeriesConcurrently(
+                    Series::toSeriesInstanceUIDContainer(pullSeriesVector),
+                    m_associationCount,
+                    sight::io::dimse::SeriesEnquirer::RetrieveMethod::GET
                 );
             }
         }
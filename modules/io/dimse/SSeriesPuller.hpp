@@ -52,7 +52,7 @@ namespace sight::module::io::dimse
         <in key="pacsConfig" uid="..." />
         <in key="selectedSeries" uid="..." />
         <inout key="seriesDB" uid="..." />
-        <config dicomReader="::sight::module::io::dicom::SSeriesDBReader" dicomReaderConfig="config" />
+        <config dicomReader="::sight::module::io::dicom::SSeriesDBReader" dicomReaderConfig="config" associations="4" />
     </service>
    @endcode
  *
@@ -66,6 +66,8 @@ namespace sight::module::io::dimse
  * @subsection Configuration Configuration:
  * - \b dicomReader (mandatory, string): reader type to use.
  * - \b dicomReaderConfig (optional, string, default=""): configuration for the DICOM Reader.
+ * - \b associations (optional, unsigned int, default=1): number of associations pulling series at the same time
+ *   with C-GET requests. C-MOVE requests use a single association since the move destination accepts only one.
  */
 class MODULE_IO_DIMSE_CLASS_API SSeriesPuller final : public service::IController,
                                                       public service::IHasServices
@@ -168,6 +170,9 @@ private:
     /// Defines the progress bar ID.
     std::string m_progressbarId {"pullDicomProgressBar"};
 
+    /// Defines the number of associations pulling series at the same time.
+    std::size_t m_associationCount {1};
+
     /// Defines the total number of instances that must be downloaded.
     std::size_t m_instanceCount {0};
 
@@ -40,12 +40,16 @@
 
 #include <QHBoxLayout>
 
+#include <optional>
+
 namespace sight::module::io::dimse
 {
 
 static const std::string s_DELAY_CONFIG        = "delay";
 static const std::string s_DICOM_READER_CONFIG = "dicomReader";
 static const std::string s_READER_CONFIG       = "readerConfig";
+static const std::string s_CACHE_SIZE_CONFIG   = "cacheSize";
+static const std::string s_PREFETCH_CONFIG     = "prefetch";
 
 static const service::IService::KeyType s_DICOMSERIES_INOUT = "series";
 static const service::IService::KeyType s_IMAGE_INOUT       = "image";
@@ -78,6 +82,9 @@ void SSliceIndexDicomEditor::configuring()
     SIGHT_ERROR_IF("'" + s_DICOM_READER_CONFIG + "' attribute not set", m_dicomReaderImplementation.empty())
 
     m_readerConfig = configType.get(s_READER_CONFIG, m_readerConfig);
+
+    m_sliceCache.setCapacity(config.get<std::size_t>(s_CACHE_SIZE_CONFIG, m_sliceCache.getCapacity()));
+    m_prefetchCount = config.get<std::size_t>(s_PREFETCH_CONFIG, m_prefetchCount);
 }
 
 //------------------------------------------------------------------------------
@@ -171,6 +178,13 @@ void SSliceIndexDicomEditor::updating()
     const auto dicomSeries   = this->getLockedInOut<const data::DicomSeries>(s_DICOMSERIES_INOUT);
     const size_t sliceNumber = dicomSeries->getNumberOfInstances();
 
+    // The series may have changed, the slices of the previous one are no longer needed. The slices decoded meanwhile
+    // by the pending requests are cached with the instance UID of their series, thus they are never displayed here.
+    {
+        std::lock_guard<std::mutex> lock(m_sliceCacheMutex);
+        m_sliceCache.clear();
+    }
+
     if(sliceNumber > 0)
     {
         // If the current slice index is the initial value of the slider, we just send a signal to trigger other
@@ -227,25 +241,113 @@ void SSliceIndexDicomEditor::setSliderInformation(unsigned _value)
 
 void SSliceIndexDicomEditor::retrieveSlice()
 {
-    // Check if the slice already exists.
-    const auto dicomSeries          = this->getLockedInOut<data::DicomSeries>(s_DICOMSERIES_INOUT);
-    const size_t selectedSliceIndex = m_slider->value() + dicomSeries->getFirstInstanceNumber();
-    const bool isInstanceAvailable  = dicomSeries->isInstanceAvailable(selectedSliceIndex);
+    const auto dicomSeries             = this->getLockedInOut<const data::DicomSeries>(s_DICOMSERIES_INOUT);
+    const std::string seriesUID        = dicomSeries->getInstanceUID();
+    const std::size_t firstSliceIndex  = dicomSeries->getFirstInstanceNumber();
+    const std::size_t endSliceIndex    = firstSliceIndex + dicomSeries->getNumberOfInstances();
+    const std::size_t selectedSliceIdx = static_cast<std::size_t>(m_slider->value()) + firstSliceIndex;
+
+    // The pending requests of the previous slices become outdated.
+    m_selectedSliceIndex = selectedSliceIdx;
+
+    // Display the slice if it is already decoded, else read it on the request worker.
+    std::optional<data::Image::sptr> slice;
+    {
+        std::lock_guard<std::mutex> lock(m_sliceCacheMutex);
+        slice = m_sliceCache.get({seriesUID, selectedSliceIdx});
+    }
 
-    // If the slice is not pulled, pull it.
-    if(!isInstanceAvailable)
+    if(slice)
     {
-        m_requestWorker->post(std::bind(&SSliceIndexDicomEditor::pullSlice, this, selectedSliceIndex));
+        this->displaySlice(*slice);
     }
     else
     {
-        this->readSlice(dicomSeries, selectedSliceIndex);
+        m_requestWorker->post(
+            std::bind(&SSliceIndexDicomEditor::loadSlice, this, seriesUID, selectedSliceIdx, true)
+        );
+    }
+
+    // Prefetch the neighbouring slices, the nearest ones first.
+    for(std::size_t i = 1 ; i <= m_prefetchCount ; ++i)
+    {
+        if(selectedSliceIdx + i < endSliceIndex)
+        {
+            m_requestWorker->post(
+                std::bind(&SSliceIndexDicomEditor::loadSlice, this, seriesUID, selectedSliceIdx + i, false)
+            );
+        }
+
+        if(selectedSliceIdx >= firstSliceIndex + i)
+        {
+            m_requestWorker->post(
+                std::bind(&SSliceIndexDicomEditor::loadSlice, this, seriesUID, selectedSliceIdx - i, false)
+            );
+        }
     }
 }
 
 //------------------------------------------------------------------------------
 
-void SSliceIndexDicomEditor::pullSlice(std::size_t _selectedSliceIndex) const
+void SSliceIndexDicomEditor::loadSlice(const std::string& _seriesUID, std::size_t _sliceIndex, bool _display)
+{
+    // Skip the requests outdated since the slider moved on.
+    const std::size_t selectedSliceIndex = m_selectedSliceIndex;
+    const std::size_t distance           = _sliceIndex > selectedSliceIndex
+                                           ? _sliceIndex - selectedSliceIndex
+                                           : selectedSliceIndex - _sliceIndex;
+    if((_display && distance != 0) || distance > m_prefetchCount)
+    {
+        return;
+    }
+
+    std::optional<data::Image::sptr> slice;
+    {
+        std::lock_guard<std::mutex> lock(m_sliceCacheMutex);
+        slice = m_sliceCache.get({_seriesUID, _sliceIndex});
+    }
+
+    if(!slice)
+    {
+        bool isInstanceAvailable = false;
+        {
+            // Skip the requests of a previous series.
+            const auto dicomSeries = this->getLockedInOut<const data::DicomSeries>(s_DICOMSERIES_INOUT);
+            if(dicomSeries->getInstanceUID() != _seriesUID)
+            {
+                return;
+            }
+
+            isInstanceAvailable = dicomSeries->isInstanceAvailable(_sliceIndex);
+        }
+
+        // If the slice is not pulled, pull it.
+        if(!isInstanceAvailable && !this->pullSlice(_sliceIndex))
+        {
+            return;
+        }
+
+        const data::Image::sptr decodedSlice =
+            this->readSlice(this->getLockedInOut<data::DicomSeries>(s_DICOMSERIES_INOUT), _sliceIndex);
+        if(!decodedSlice)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_sliceCacheMutex);
+        m_sliceCache.insert({_seriesUID, _sliceIndex}, decodedSlice);
+        slice = decodedSlice;
+    }
+
+    if(_display)
+    {
+        this->displaySlice(*slice);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+bool SSliceIndexDicomEditor::pullSlice(std::size_t _selectedSliceIndex) const
 {
     bool success = false;
 
@@ -338,15 +440,12 @@ void SSliceIndexDicomEditor::pullSlice(std::size_t _selectedSliceIndex) const
         seriesEnquirer->disconnect();
     }
 
-    if(success)
-    {
-        this->readSlice(dicomSeries, _selectedSliceIndex);
-    }
+    return success;
 }
 
 //------------------------------------------------------------------------------
 
-void SSliceIndexDicomEditor::readSlice(
+data::Image::sptr SSliceIndexDicomEditor::readSlice(
     const data::mt::locked_ptr<data::DicomSeries>& _dicomSeries,
     std::size_t _selectedSliceIndex
 ) const
@@ -359,7 +458,7 @@ void SSliceIndexDicomEditor::readSlice(
             service::IService::s_INFO_NOTIFIED_SIG
         );
         notif->asyncEmit("Unable to read the modality '" + modality + "'");
-        return;
+        return nullptr;
     }
 
     // Get the DICOM buffer to write in a temporary folder.
@@ -367,8 +466,8 @@ void SSliceIndexDicomEditor::readSlice(
     auto iter            = binaries.find(_selectedSliceIndex);
     SIGHT_ASSERT("Index '" << _selectedSliceIndex << "' is not found in DicomSeries", iter != binaries.end());
     const core::memory::BufferObject::sptr bufferObj = iter->second;
-    const core::memory::BufferObject::Lock lockerDest(bufferObj);
-    const char* buffer      = static_cast<char*>(lockerDest.getBuffer());
+    const core::memory::BufferObject::ConstLock lockerDest(bufferObj);
+    const char* buffer      = static_cast<const char*>(lockerDest.getBuffer());
     const size_t bufferSize = bufferObj->getSize();
 
     // Creates unique temporary folder to save the DICOM instance.
@@ -381,7 +480,7 @@ void SSliceIndexDicomEditor::readSlice(
     if(!fs.good())
     {
         SIGHT_ERROR("Unable to open '" << path << "' for write.");
-        return;
+        return nullptr;
     }
 
     fs.write(buffer, bufferSize);
@@ -393,34 +492,43 @@ void SSliceIndexDicomEditor::readSlice(
 
     if(!m_dicomReader->hasFailed() && m_seriesDB->getContainer().size() > 0)
     {
-        // Copy the read serie to the image.
+        // Copy the read serie to the slice, the reader output is overwritten by the next reading.
         const data::ImageSeries::sptr imageSeries =
             data::ImageSeries::dynamicCast(*(m_seriesDB->getContainer().begin()));
-        const data::Image::sptr newImage = imageSeries->getImage();
-
-        const auto image = this->getLockedInOut<data::Image>(s_IMAGE_INOUT);
-        image->deepCopy(newImage);
+        const data::Image::sptr slice = data::Image::New();
+        slice->deepCopy(imageSeries->getImage());
 
         data::Integer::sptr axialIndex    = data::Integer::New(0);
-        data::Integer::sptr frontalIndex  = data::Integer::New(image->getSize2()[0] / 2);
-        data::Integer::sptr sagittalIndex = data::Integer::New(image->getSize2()[1] / 2);
+        data::Integer::sptr frontalIndex  = data::Integer::New(slice->getSize2()[0] / 2);
+        data::Integer::sptr sagittalIndex = data::Integer::New(slice->getSize2()[1] / 2);
 
-        image->setField(data::fieldHelper::Image::m_axialSliceIndexId, axialIndex);
-        image->setField(data::fieldHelper::Image::m_frontalSliceIndexId, frontalIndex);
-        image->setField(data::fieldHelper::Image::m_sagittalSliceIndexId, sagittalIndex);
+        slice->setField(data::fieldHelper::Image::m_axialSliceIndexId, axialIndex);
+        slice->setField(data::fieldHelper::Image::m_frontalSliceIndexId, frontalIndex);
+        slice->setField(data::fieldHelper::Image::m_sagittalSliceIndexId, sagittalIndex);
 
-        // Send the signal
-        const auto sig = image->signal<data::Image::ModifiedSignalType>(data::Image::s_MODIFIED_SIG);
-        sig->asyncEmit();
-    }
-    else
-    {
-        SIGHT_ERROR("Unable to read the image");
-        const auto notif = this->signal<service::IService::FailureNotifiedSignalType>(
-            service::IService::s_FAILURE_NOTIFIED_SIG
-        );
-        notif->asyncEmit("Unable to read the image");
+        return slice;
     }
+
+    SIGHT_ERROR("Unable to read the image");
+    const auto notif = this->signal<service::IService::FailureNotifiedSignalType>(
+        service::IService::s_FAILURE_NOTIFIED_SIG
+    );
+    notif->asyncEmit("Unable to read the image");
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+void SSliceIndexDicomEditor::displaySlice(const data::Image::csptr& _slice) const
+{
+    // The buffers of the cached slice are shared until the image is modified.
+    const auto image = this->getLockedInOut<data::Image>(s_IMAGE_INOUT);
+    image->deepCopy(_slice);
+
+    // Send the signal
+    const auto sig = image->signal<data::Image::ModifiedSignalType>(data::Image::s_MODIFIED_SIG);
+    sig->asyncEmit();
 }
 
 } // namespace sight::module::io::dimse.
@@ -26,8 +26,10 @@
 
 #include <core/thread/Timer.hpp>
 #include <core/thread/Worker.hpp>
+#include <core/tools/LRUCache.hpp>
 
 #include <data/DicomSeries.hpp>
+#include <data/Image.hpp>
 #include <data/SeriesDB.hpp>
 
 #include <io/base/service/IReader.hpp>
@@ -41,6 +43,11 @@
 #include <QPointer>
 #include <QSlider>
 
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <utility>
+
 namespace sight::module::io::dimse
 {
 
@@ -48,13 +55,18 @@ namespace sight::module::io::dimse
  * @brief This editor service is used to select a slice index and pull the image from the pacs if it is not
  *        available on the local computer.
  *
+ * The decoded slices are kept in a cache of the most recently used slices. When a slice is selected, its
+ * neighbouring slices are pulled and decoded in the background. The pending requests of slices too far from the
+ * selected one are skipped when the slider moves on.
+ *
  * @section XML XML Configuration
  * @code{.xml}
     <service type="sight::module::io::dimse::SSliceIndexDicomEditor">
         <in key="pacsConfig" uid="..." />
         <inout key="series" uid="..." />
         <inout key="image" uid="..." />
-        <config delay="500" dicomReader="::sight::module::io::dicom::SSeriesDBReader" dicomReaderConfig="config" />
+        <config delay="500" dicomReader="::sight::module::io::dicom::SSeriesDBReader" dicomReaderConfig="config"
+                cacheSize="32" prefetch="2" />
     </service>
    @endcode
  *
@@ -69,6 +81,8 @@ namespace sight::module::io::dimse
  * - \b delay (optional, unsigned, default=500): delay to wait between each slice move.
  * - \b dicomReader (mandatory, string): reader type to use.
  * - \b dicomReaderConfig (optional, string, default=""): configuration for the DICOM Reader.
+ * - \b cacheSize (optional, unsigned, default=32): maximum number of decoded slices kept in memory.
+ * - \b prefetch (optional, unsigned, default=2): number of slices prefetched on each side of the selected one.
  */
 class MODULE_IO_DIMSE_CLASS_API SSliceIndexDicomEditor final :
     public QObject,
@@ -120,25 +134,41 @@ private:
     /// Fills editor information.
     void setSliderInformation(unsigned _value);
 
-    /// Retrieves the local slice or pull it, then, read it.
+    /// Displays the selected slice if it is cached, else requests it, then prefetches its neighbouring slices.
     void retrieveSlice();
 
+    /**
+     * @brief Gets a slice from the cache, or pulls it if needed and reads it, called on the request worker.
+     * @param _seriesUID instance UID of the series, the request is skipped if the series changed.
+     * @param _sliceIndex index of the slice.
+     * @param _display true to display the slice, false to only cache it.
+     */
+    void loadSlice(const std::string& _seriesUID, std::size_t _sliceIndex, bool _display);
+
     /**
      * @brief Pulls the slice from the PACS.
      * @param _selectedSliceIndex index of the slice to pull.
+     * @return true if the slice is pulled.
      */
-    void pullSlice(std::size_t _selectedSliceIndex) const;
+    bool pullSlice(std::size_t _selectedSliceIndex) const;
 
     /**
      * @brief Reads a local slice.
      * @param _dicomSeries the dicom series instance.
      * @param _selectedSliceIndex index of the slice to read.
+     * @return the decoded slice, or nullptr if it can not be read.
      */
-    void readSlice(
+    data::Image::sptr readSlice(
         const data::mt::locked_ptr<data::DicomSeries>& _dicomSeries,
         std::size_t _selectedSliceIndex
     ) const;
 
+    /**
+     * @brief Copies a decoded slice to the image.
+     * @param _slice the decoded slice.
+     */
+    void displaySlice(const data::Image::csptr& _slice) const;
+
     /// Contains the worker of the series enquire thread.
     core::thread::Worker::sptr m_requestWorker;
 
@@ -165,6 +195,18 @@ private:
 
     /// Contains the seriesDB where the DICOM reader sets its output.
     data::SeriesDB::sptr m_seriesDB;
+
+    /// Defines the number of slices prefetched on each side of the selected one.
+    std::size_t m_prefetchCount {2};
+
+    /// Contains the most recently used decoded slices, by series instance UID and slice index.
+    core::tools::LRUCache<std::pair<std::string, std::size_t>, data::Image::sptr> m_sliceCache {32};
+
+    /// Protects m_sliceCache, used from the main thread and the request worker.
+    std::mutex m_sliceCacheMutex;
+
+    /// Stores the index of the selected slice, the requests of slices too far from it are skipped.
+    std::atomic<std::size_t> m_selectedSliceIndex {0};
 };
 
 } // namespace sight::module::io::dimse.
@@ -32,6 +32,8 @@
 #include <core/location/SingleFile.hpp>
 #include <core/location/SingleFolder.hpp>
 
+#include <io/base/reader/MatrixRecordReader.hpp>
+
 #include <service/macros.hpp>
 
 #include <ui/base/dialog/LocationDialog.hpp>
@@ -39,8 +41,10 @@
 
 #include <boost/tokenizer.hpp>
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <vector>
 
 namespace sight::module::io::matrix
 {
@@ -54,6 +58,7 @@ static const core::com::Slots::SlotKeyType s_PAUSE         = "pause";
 static const core::com::Slots::SlotKeyType s_READ_NEXT     = "readNext";
 static const core::com::Slots::SlotKeyType s_READ_PREVIOUS = "readPrevious";
 static const core::com::Slots::SlotKeyType s_SET_STEP      = "setStep";
+static const core::com::Slots::SlotKeyType s_SEEK          = "seek";
 
 //------------------------------------------------------------------------------
 
@@ -75,6 +80,7 @@ SMatricesReader::SMatricesReader() noexcept :
     newSlot(s_READ_NEXT, &SMatricesReader::readNext, this);
     newSlot(s_READ_PREVIOUS, &SMatricesReader::readPrevious, this);
     newSlot(s_SET_STEP, &SMatricesReader::setStep, this);
+    newSlot(s_SEEK, &SMatricesReader::seek, this);
 }
 
 //------------------------------------------------------------------------------
@@ -137,11 +143,12 @@ void SMatricesReader::openLocationDialog()
 {
     static auto defaultDirectory = std::make_shared<core::location::SingleFolder>();
     sight::ui::base::dialog::LocationDialog dialogFile;
-    dialogFile.setTitle(m_windowTitle.empty() ? "Choose a csv file to read" : m_windowTitle);
+    dialogFile.setTitle(m_windowTitle.empty() ? "Choose a csv or matrix timeline file to read" : m_windowTitle);
     dialogFile.setDefaultLocation(defaultDirectory);
     dialogFile.setOption(ui::base::dialog::ILocationDialog::READ);
     dialogFile.setType(ui::base::dialog::ILocationDialog::SINGLE_FILE);
     dialogFile.addFilter(".csv file", "*.csv");
+    dialogFile.addFilter("Matrix timeline file", "*.smtl");
 
     auto result = core::location::SingleFile::dynamicCast(dialogFile.show());
     if(result)
@@ -214,7 +221,7 @@ void SMatricesReader::readNext()
         // Compute difference between a possible step change in setStep() slot and the current step value
         const long shift = static_cast<long>(m_stepChanged - m_step);
 
-        if(m_tsMatricesCount + shift < m_tsMatrices.size())
+        if(m_tsMatricesCount + shift < this->getMatricesCount())
         {
             // Update matrix position index
             m_tsMatricesCount += shift;
@@ -266,66 +273,84 @@ void SMatricesReader::startReading()
 
     if(this->hasLocationDefined())
     {
-        if(nullptr == m_filestream)
+        if(sight::io::base::reader::MatrixRecordReader::isMatrixRecord(this->getFile()))
         {
-            std::string file = this->getFile().string();
+            // The binary file is mapped, the matrices are only read when they are pushed
+            try
+            {
+                m_matrixRecord = std::make_unique<sight::io::base::reader::MatrixRecordReader>(this->getFile());
 
-            m_filestream = new std::ifstream(file);
+                data::MatrixTL::sptr matrixTL = this->getInOut<data::MatrixTL>(s_MATRIXTL);
+                matrixTL->initPoolSize(m_matrixRecord->getNumberOfMatrices());
+            }
+            catch(const core::Exception& e)
+            {
+                SIGHT_ERROR(e.what());
+            }
         }
-
-        if(m_filestream->is_open())
+        else
         {
-            std::string line;
-            while(std::getline(*m_filestream, line))
+            if(nullptr == m_filestream)
             {
-                // parse the cvs file with tokenizer
-                const ::boost::char_separator<char> sep(", ;");
-                const ::boost::tokenizer< ::boost::char_separator<char> > tok {line, sep};
+                std::string file = this->getFile().string();
+
+                m_filestream = new std::ifstream(file);
+            }
 
-                // nb of 4x4 matrices = nb of elements - 1 (timestamp) / 16.
-                const long int nbOfElements = std::distance(tok.begin(), tok.end());
-                if(nbOfElements < 17)
+            if(m_filestream->is_open())
+            {
+                std::string line;
+                while(std::getline(*m_filestream, line))
                 {
-                    SIGHT_WARN("Too few elements(" << nbOfElements << ") to convert this csv line into matrices");
-                    continue;
-                }
+                    // parse the cvs file with tokenizer
+                    const ::boost::char_separator<char> sep(", ;");
+                    const ::boost::tokenizer< ::boost::char_separator<char> > tok {line, sep};
 
-                const unsigned int nbOfMatrices = static_cast<unsigned int>((nbOfElements - 1) / 16);
+                    // nb of 4x4 matrices = nb of elements - 1 (timestamp) / 16.
+                    const long int nbOfElements = std::distance(tok.begin(), tok.end());
+                    if(nbOfElements < 17)
+                    {
+                        SIGHT_WARN("Too few elements(" << nbOfElements << ") to convert this csv line into matrices");
+                        continue;
+                    }
 
-                data::MatrixTL::sptr matrixTL = this->getInOut<data::MatrixTL>(s_MATRIXTL);
-                matrixTL->initPoolSize(nbOfMatrices);
+                    const unsigned int nbOfMatrices = static_cast<unsigned int>((nbOfElements - 1) / 16);
 
-                TimeStampedMatrices currentTsMat;
+                    data::MatrixTL::sptr matrixTL = this->getInOut<data::MatrixTL>(s_MATRIXTL);
+                    matrixTL->initPoolSize(nbOfMatrices);
 
-                ::boost::tokenizer< ::boost::char_separator<char> >::iterator iter = tok.begin();
-                currentTsMat.timestamp = std::stod(iter.current_token());
+                    TimeStampedMatrices currentTsMat;
 
-                ++iter;
+                    ::boost::tokenizer< ::boost::char_separator<char> >::iterator iter = tok.begin();
+                    currentTsMat.timestamp = std::stod(iter.current_token());
 
-                for(unsigned int m = 0 ; m < nbOfMatrices ; ++m)
-                {
-                    std::array<float, 16> mat;
-                    for(unsigned int i = 0 ; i < mat.size() ; ++i)
-                    {
-                        mat[i] = std::stof(iter.current_token());
+                    ++iter;
 
-                        if(iter != tok.end())
+                    for(unsigned int m = 0 ; m < nbOfMatrices ; ++m)
+                    {
+                        std::array<float, 16> mat;
+                        for(unsigned int i = 0 ; i < mat.size() ; ++i)
                         {
-                            ++iter;
+                            mat[i] = std::stof(iter.current_token());
+
+                            if(iter != tok.end())
+                            {
+                                ++iter;
+                            }
                         }
+
+                        currentTsMat.matrices.push_back(mat);
                     }
 
-                    currentTsMat.matrices.push_back(mat);
+                    m_tsMatrices.push_back(currentTsMat);
                 }
 
-                m_tsMatrices.push_back(currentTsMat);
+                m_filestream->close();
+            }
+            else
+            {
+                SIGHT_ERROR("The csv file '" + this->getFile().string() + "' can not be openned.");
             }
-
-            m_filestream->close();
-        }
-        else
-        {
-            SIGHT_ERROR("The csv file '" + this->getFile().string() + "' can not be openned.");
         }
 
         if(m_oneShot)
@@ -344,12 +369,11 @@ void SMatricesReader::startReading()
             if(m_useTimelapse)
             {
                 m_timer->setOneShot(true);
-                if(m_tsMatrices.size() >= 2)
+                if(this->getMatricesCount() >= 2)
                 {
                     duration =
                         std::chrono::milliseconds(
-                            static_cast<std::uint64_t>(m_tsMatrices[1].timestamp
-                                                       - m_tsMatrices[0].timestamp)
+                            static_cast<std::uint64_t>(this->getTimestamp(1) - this->getTimestamp(0))
                         );
                 }
                 else
@@ -400,6 +424,8 @@ void SMatricesReader::stopReading()
         m_tsMatrices.clear();
     }
 
+    m_matrixRecord.reset();
+
     m_tsMatricesCount = 0;
 
     //clear the timeline
@@ -424,13 +450,11 @@ void SMatricesReader::pause()
 
 void SMatricesReader::readMatrices()
 {
-    if(m_tsMatricesCount < m_tsMatrices.size())
+    if(m_tsMatricesCount < this->getMatricesCount())
     {
         const auto tStart             = core::HiResClock::getTimeInMilliSec();
         data::MatrixTL::sptr matrixTL = this->getInOut<data::MatrixTL>(s_MATRIXTL);
 
-        TimeStampedMatrices currentMatrices = m_tsMatrices[m_tsMatricesCount];
-
         core::HiResClock::HiResClockType timestamp;
 
         if(m_createNewTS)
@@ -439,46 +463,45 @@ void SMatricesReader::readMatrices()
         }
         else
         {
-            timestamp = currentMatrices.timestamp;
+            timestamp = this->getTimestamp(m_tsMatricesCount);
         }
 
         // Push matrix in timeline
-        SPTR(data::MatrixTL::BufferType) matrixBuf;
-        matrixBuf = matrixTL->createBuffer(timestamp);
-        matrixTL->pushObject(matrixBuf);
-
         SIGHT_DEBUG("Reading matrix index " << m_tsMatricesCount << " with timestamp " << timestamp);
-        for(unsigned int i = 0 ; i < currentMatrices.matrices.size() ; ++i)
-        {
-            float mat[16];
-            std::copy(currentMatrices.matrices[i].begin(), currentMatrices.matrices[i].end(), &mat[0]);
-            matrixBuf->setElement(mat, i);
-        }
+        matrixTL->pushObject(this->createBuffer(matrixTL, m_tsMatricesCount, timestamp));
 
-        if(m_useTimelapse && (m_tsMatricesCount + m_step) < m_tsMatrices.size())
+        if(m_useTimelapse && (m_tsMatricesCount + m_step) < this->getMatricesCount())
         {
             const auto elapsedTime          = core::HiResClock::getTimeInMilliSec() - tStart;
             const std::size_t currentMatrix = m_tsMatricesCount;
-            const double currentTime        = m_tsMatrices[currentMatrix].timestamp + elapsedTime;
-            double nextDuration             = m_tsMatrices[m_tsMatricesCount + m_step].timestamp - currentTime;
+            const double currentTime        = this->getTimestamp(currentMatrix) + elapsedTime;
 
-            // If the next matrix delay is already passed, drop the matrices and check the next one.
-            while(nextDuration < elapsedTime && (m_tsMatricesCount + m_step) < m_tsMatrices.size())
+            // While the next matrix delay is already passed, skip it and check the one after. Only the matrices that
+            // are due are skipped, they are still pushed all at once if they keep their timestamp.
+            std::vector<SPTR(data::timeline::Object)> skippedMatrices;
+            while((m_tsMatricesCount + m_step) < this->getMatricesCount()
+                  && this->getTimestamp(m_tsMatricesCount + m_step) - currentTime < elapsedTime)
             {
-                nextDuration       = m_tsMatrices[m_tsMatricesCount + m_step].timestamp - currentTime;
                 m_tsMatricesCount += m_step;
                 SIGHT_DEBUG("Skipping a matrix");
+
+                if(!m_createNewTS)
+                {
+                    timestamp = this->getTimestamp(m_tsMatricesCount);
+                    skippedMatrices.push_back(this->createBuffer(matrixTL, m_tsMatricesCount, timestamp));
+                }
             }
 
+            matrixTL->pushObjects(skippedMatrices);
+
             // If it is the last matrix array: stop the timer or loop
-            if((m_tsMatricesCount + m_step) == m_tsMatrices.size())
+            if((m_tsMatricesCount + m_step) >= this->getMatricesCount())
             {
                 m_timer->stop();
             }
             else
             {
-                nextDuration = m_tsMatrices[m_tsMatricesCount + m_step].timestamp
-                               - currentTime;
+                const double nextDuration = this->getTimestamp(m_tsMatricesCount + m_step) - currentTime;
                 core::thread::Timer::TimeDurationType duration =
                     std::chrono::milliseconds(static_cast<std::int64_t>(nextDuration));
                 m_timer->stop();
@@ -500,4 +523,95 @@ void SMatricesReader::readMatrices()
 
 //------------------------------------------------------------------------------
 
+void SMatricesReader::seek(core::HiResClock::HiResClockType _timestamp)
+{
+    if(!m_timer || this->getMatricesCount() == 0)
+    {
+        SIGHT_WARN("There are no matrices to seek, the reading must be started first.");
+        return;
+    }
+
+    // The matrices are sorted by timestamp, a binary search finds them
+    std::size_t index = 0;
+    if(m_matrixRecord)
+    {
+        index = m_matrixRecord->find(_timestamp);
+    }
+    else
+    {
+        const auto iter = std::lower_bound(
+            m_tsMatrices.begin(),
+            m_tsMatrices.end(),
+            _timestamp,
+            [](const TimeStampedMatrices& _matrices, core::HiResClock::HiResClockType _value)
+            {
+                return _matrices.timestamp < _value;
+            });
+        index = static_cast<std::size_t>(std::distance(m_tsMatrices.begin(), iter));
+    }
+
+    m_tsMatricesCount = std::min(index, this->getMatricesCount() - 1);
+
+    // Read the matrices now, the timer then goes on from them. At a constant framerate, the next tick reads them.
+    if(m_oneShot || m_useTimelapse)
+    {
+        m_timer->stop();
+        m_timer->setDuration(std::chrono::milliseconds(0));
+        m_timer->start();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t SMatricesReader::getMatricesCount() const
+{
+    return m_matrixRecord ? m_matrixRecord->getNumberOfRecords() : m_tsMatrices.size();
+}
+
+//------------------------------------------------------------------------------
+
+core::HiResClock::HiResClockType SMatricesReader::getTimestamp(std::size_t _index) const
+{
+    return m_matrixRecord ? m_matrixRecord->getTimestamp(_index) : m_tsMatrices[_index].timestamp;
+}
+
+//------------------------------------------------------------------------------
+
+SPTR(data::MatrixTL::BufferType) SMatricesReader::createBuffer(
+    const data::MatrixTL::sptr& _matrixTL,
+    std::size_t _index,
+    core::HiResClock::HiResClockType _timestamp
+) const
+{
+    SPTR(data::MatrixTL::BufferType) matrixBuf = _matrixTL->createBuffer(_timestamp);
+
+    if(m_matrixRecord)
+    {
+        // Only the valid matrices of the record are copied
+        const std::uint64_t mask = m_matrixRecord->getMask(_index);
+        for(std::uint32_t i = 0 ; i < m_matrixRecord->getNumberOfMatrices() ; ++i)
+        {
+            if(((mask >> i) & 1) != 0)
+            {
+                const float* values = m_matrixRecord->getMatrix(_index, i);
+                std::copy(values, values + 16, *matrixBuf->addElement(i));
+            }
+        }
+    }
+    else
+    {
+        const TimeStampedMatrices& currentMatrices = m_tsMatrices[_index];
+        for(unsigned int i = 0 ; i < currentMatrices.matrices.size() ; ++i)
+        {
+            float mat[16];
+            std::copy(currentMatrices.matrices[i].begin(), currentMatrices.matrices[i].end(), &mat[0]);
+            matrixBuf->setElement(mat, i);
+        }
+    }
+
+    return matrixBuf;
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace sight::module::io::matrix
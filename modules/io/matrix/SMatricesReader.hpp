@@ -31,12 +31,21 @@
 #include <io/base/service/IReader.hpp>
 
 #include <array>
+#include <memory>
+
+namespace sight::io::base::reader
+{
+
+class MatrixRecordReader;
+
+}
 
 namespace sight::module::io::matrix
 {
 
 /**
- * @brief This service reads a csv file and extract matrices from it to push it into a matrixTL.
+ * @brief This service reads a csv file or a binary matrix timeline file and extract matrices from it to push it into a
+ * matrixTL.
  *
  * This service can be used in two ways, first one is full-automatic by setting the framerate (oneShot off),
  * the second one is one-per-one using readNext and/or readPrevious slots.
@@ -45,6 +54,10 @@ namespace sight::module::io::matrix
  * timestamp;matrix1-value1;...;matrix1-value16;...;matrixN-value1;...;matrixN-value16;
  * Each line should contain exactly the same number of matrices.
  *
+ * @note A binary matrix timeline file ('.smtl', see sight::io::base::reader::MatrixRecordReader) is mapped in memory
+ * instead of being parsed: long recordings are replayed without loading them first, and seeking a timestamp is fast.
+ * The file type is detected from its content.
+ *
  * @section Slots Slots
  * - \b startReading(): start reading matrices
  * - \b stopReading(): stop reading matrices
@@ -53,6 +66,8 @@ namespace sight::module::io::matrix
  * - \b readPrevious() : read previous matrices
  * - \b setStep(int step, std::string key) : set the step value between two matrices when calling readNext/readPrevious
  * slots on oneShot mode (supported key: "step")
+ * - \b seek(core::HiResClock::HiResClockType timestamp) : move to the first matrices not older than the timestamp and
+ * read them
  *
  * @section XML XML Configuration
  *
@@ -152,6 +167,22 @@ private:
     /// SLOT: Set step used on readPrevious/readNext slots
     void setStep(int _step, std::string _key);
 
+    /// SLOT: Move to the first matrices not older than the timestamp and read them
+    void seek(core::HiResClock::HiResClockType _timestamp);
+
+    /// Return the number of timestamped matrices read from the csv file or mapped from the binary file
+    std::size_t getMatricesCount() const;
+
+    /// Return the timestamp of the matrices at the given index
+    core::HiResClock::HiResClockType getTimestamp(std::size_t _index) const;
+
+    /// Create a timeline buffer containing the matrices at the given index
+    SPTR(data::MatrixTL::BufferType) createBuffer(
+        const data::MatrixTL::sptr& _matrixTL,
+        std::size_t _index,
+        core::HiResClock::HiResClockType _timestamp
+    ) const;
+
     /// Read matrices (this function is set to the worker)
     void readMatrices();
 
@@ -161,6 +192,9 @@ private:
 
     std::vector<TimeStampedMatrices> m_tsMatrices; ///< vector of TimeStampedMatrices read from csv file.
 
+    /// Binary matrix timeline file mapped in memory, used instead of m_tsMatrices
+    std::unique_ptr<sight::io::base::reader::MatrixRecordReader> m_matrixRecord;
+
     core::thread::Timer::sptr m_timer; ///< Timer to call readMatrices at constant framerate
 
     core::thread::Worker::sptr m_worker; ///< Worker for the readMatrices timer
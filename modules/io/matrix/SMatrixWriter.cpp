@@ -29,6 +29,8 @@
 #include <core/location/SingleFile.hpp>
 #include <core/location/SingleFolder.hpp>
 
+#include <io/base/writer/MatrixRecordWriter.hpp>
+
 #include <service/macros.hpp>
 
 #include <ui/base/dialog/LocationDialog.hpp>
@@ -46,6 +48,9 @@ static const core::com::Slots::SlotKeyType s_START_RECORD = "startRecord";
 static const core::com::Slots::SlotKeyType s_STOP_RECORD  = "stopRecord";
 static const core::com::Slots::SlotKeyType s_WRITE        = "write";
 
+/// Extension of the binary matrix timeline files, the other files are written in csv
+static const std::filesystem::path s_MATRIX_RECORD_EXTENSION = ".smtl";
+
 //------------------------------------------------------------------------------
 
 SMatrixWriter::SMatrixWriter() noexcept :
@@ -101,11 +106,12 @@ void SMatrixWriter::openLocationDialog()
 {
     static auto defaultDirectory = std::make_shared<core::location::SingleFolder>();
     sight::ui::base::dialog::LocationDialog dialogFile;
-    dialogFile.setTitle(m_windowTitle.empty() ? "Choose a folder to save the csv file" : m_windowTitle);
+    dialogFile.setTitle(m_windowTitle.empty() ? "Choose a file to save the matrices" : m_windowTitle);
     dialogFile.setDefaultLocation(defaultDirectory);
     dialogFile.setOption(ui::base::dialog::ILocationDialog::WRITE);
     dialogFile.setType(ui::base::dialog::ILocationDialog::SINGLE_FILE);
     dialogFile.addFilter(".csv file", "*.csv");
+    dialogFile.addFilter("Matrix timeline file", "*.smtl");
 
     auto result = core::location::SingleFile::dynamicCast(dialogFile.show());
     if(result)
@@ -163,19 +169,44 @@ void SMatrixWriter::write(core::HiResClock::HiResClockType timestamp)
             if(buffer)
             {
                 timestamp = object->getTimestamp();
-                const size_t time = static_cast<size_t>(timestamp);
-                m_filestream << time << ";";
-                for(unsigned int i = 0 ; i < numberOfMat ; ++i)
+                if(m_matrixRecord)
                 {
-                    const float* values = buffer->getElement(i);
+                    if(numberOfMat != m_matrixRecord->getNumberOfMatrices())
+                    {
+                        SIGHT_WARN(
+                            "The timeline holds " << numberOfMat << " matrices instead of "
+                            << m_matrixRecord->getNumberOfMatrices() << ", they are not recorded."
+                        );
+                        return;
+                    }
 
-                    for(unsigned int v = 0 ; v < 16 ; ++v)
+                    try
                     {
-                        m_filestream << values[v] << ";";
+                        // The matrices of the buffer are stored one after another
+                        m_matrixRecord->write(timestamp, buffer->getMask(), buffer->getElement(0));
+                    }
+                    catch(const core::Exception& e)
+                    {
+                        SIGHT_ERROR(e.what());
+                        this->stopRecord();
                     }
                 }
+                else
+                {
+                    const size_t time = static_cast<size_t>(timestamp);
+                    m_filestream << time << ";";
+                    for(unsigned int i = 0 ; i < numberOfMat ; ++i)
+                    {
+                        const float* values = buffer->getElement(i);
 
-                m_filestream << std::endl;
+                        for(unsigned int v = 0 ; v < 16 ; ++v)
+                        {
+                            m_filestream << values[v] << ";";
+                        }
+                    }
+
+                    m_filestream << std::endl;
+                }
             }
         }
     }
@@ -198,7 +229,31 @@ void SMatrixWriter::startRecord()
 
     if(this->hasLocationDefined())
     {
-        if(!m_filestream.is_open())
+        if(this->getFile().extension() == s_MATRIX_RECORD_EXTENSION)
+        {
+            if(!m_matrixRecord)
+            {
+                const auto matrixTL = this->getInput<data::MatrixTL>(sight::io::base::service::s_DATA_KEY);
+                try
+                {
+                    m_matrixRecord = std::make_unique<sight::io::base::writer::MatrixRecordWriter>(
+                        this->getFile(),
+                        matrixTL->getMaxElementNum(),
+                        openMode == std::ofstream::app
+                    );
+                    m_isRecording = true;
+                }
+                catch(const core::Exception& e)
+                {
+                    SIGHT_ERROR(e.what());
+                }
+            }
+            else
+            {
+                SIGHT_WARN("The file " + this->getFile().string() + " is already being recorded.");
+            }
+        }
+        else if(!m_filestream.is_open())
         {
             m_filestream.open(this->getFile().string(), std::ofstream::out | openMode);
             m_filestream.precision(7);
@@ -220,6 +275,20 @@ void SMatrixWriter::startRecord()
 void SMatrixWriter::stopRecord()
 {
     m_isRecording = false;
+    if(m_matrixRecord)
+    {
+        try
+        {
+            m_matrixRecord->flush();
+        }
+        catch(const core::Exception& e)
+        {
+            SIGHT_ERROR(e.what());
+        }
+
+        m_matrixRecord.reset();
+    }
+
     if(m_filestream.is_open())
     {
         m_filestream.flush();
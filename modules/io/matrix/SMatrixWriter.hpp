@@ -29,21 +29,33 @@
 #include <io/base/service/IWriter.hpp>
 
 #include <fstream>
+#include <memory>
+
+namespace sight::io::base::writer
+{
+
+class MatrixRecordWriter;
+
+}
 
 namespace sight::module::io::matrix
 {
 
 /**
- * @brief This service allows the user to save the timeline matrices in a csv file.
+ * @brief This service allows the user to save the timeline matrices in a csv file or in a binary matrix timeline file.
  *
  * @note The method 'updating' allows to save the timeline matrix with the current timestamp. If you want to save all
  * the
  *       matrices when they are pushed in the timeline, you must use the slots 'startRecord' and 'stopRecord'
  *
+ * @note The matrices are recorded in a binary matrix timeline file if the file extension is '.smtl' (see
+ * sight::io::base::writer::MatrixRecordWriter), otherwise in a csv file. The binary file is smaller, its records are
+ * written on a separate thread, and it can be replayed and seeked quickly by SMatricesReader.
+ *
  * @section Slots Slots
  * - \b startRecord() : start recording
  * - \b stopRecord() : stop recording
- * - \b write(core::HiResClock::HiResClockType) : write matrix in a csv file
+ * - \b write(core::HiResClock::HiResClockType) : write matrix in the file
  * - \b saveMatrix(core::HiResClock::HiResClockType) : save current matrices
  *
  * @section XML XML Configuration
@@ -119,6 +131,9 @@ private:
     bool m_isRecording; ///< flag if the service is recording.
 
     std::ofstream m_filestream;
+
+    /// Binary matrix timeline file, used instead of m_filestream for the '.smtl' files
+    std::unique_ptr<sight::io::base::writer::MatrixRecordWriter> m_matrixRecord;
 };
 
 } // ioTimeline
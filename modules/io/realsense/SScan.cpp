@@ -64,6 +64,7 @@ static const std::string s_DEPTH_FRAME_H = "depthH";
 static const std::string s_DEPTH_FRAME_W = "depthW";
 static const std::string s_PRESET        = "preset";
 static const std::string s_ALIGNMENT     = "alignTo";
+static const std::string s_POINTCLOUD    = "pointcloudType";
 
 static const std::string s_IREMITTER    = "IREmitter";
 static const std::string s_SWITCH_TO_IR = "switchToIR";
@@ -160,6 +161,13 @@ void SScan::configuring()
 
         const std::string alignTo = cfg->get<std::string>(s_ALIGNMENT, "None");
         this->updateAlignment(alignTo);
+
+        const std::string pointcloudType = cfg->get<std::string>(s_POINTCLOUD, "Mesh");
+        SIGHT_ASSERT(
+            "Unknown pointcloudType '" + pointcloudType + "', it must be 'Mesh' or 'PointCloud'",
+            pointcloudType == "Mesh" || pointcloudType == "PointCloud"
+        );
+        m_pointcloudAsMesh = (pointcloudType != "PointCloud");
     }
 
     static const auto s_modulePath = core::runtime::getModuleResourcePath(std::string("sight::module::io::realSense"));
@@ -371,24 +379,44 @@ void SScan::initialize(const ::rs2::pipeline_profile& _profile)
         }
     }
 
+    // Re-init the pointcloud.
+    const size_t nbPoints = depthStreamW * depthStreamH;
+
+    if(!m_pointcloudAsMesh)
+    {
+        //Only create the pointer one time.
+        auto pointcloud = data::PointCloud::dynamicCast(m_pointcloud);
+        if(pointcloud == nullptr)
+        {
+            pointcloud   = data::PointCloud::New();
+            m_pointcloud = pointcloud;
+        }
+
+        data::mt::ObjectWriteLock pointcloudLock(pointcloud);
+
+        // No cell is needed to display a data::PointCloud, only allocate points and colors.
+        pointcloud->resize(nbPoints, data::PointCloud::Attributes::POINT_COLORS);
+        return;
+    }
+
     //Only create the pointer one time.
-    if(m_pointcloud == nullptr)
+    auto mesh = data::Mesh::dynamicCast(m_pointcloud);
+    if(mesh == nullptr)
     {
-        m_pointcloud = data::Mesh::New();
+        mesh         = data::Mesh::New();
+        m_pointcloud = mesh;
     }
 
-    // Re-init the pointcloud.
-    SIGHT_ASSERT("Cannot create pointcloud output", m_pointcloud);
-    const size_t nbPoints = depthStreamW * depthStreamH;
+    SIGHT_ASSERT("Cannot create pointcloud output", mesh);
 
-    data::mt::ObjectWriteLock meshLock(m_pointcloud);
+    data::mt::ObjectWriteLock meshLock(mesh);
 
     // Allocate mesh.
-    m_pointcloud->resize(nbPoints, nbPoints, nbPoints, data::Mesh::Attributes::POINT_COLORS);
+    mesh->resize(nbPoints, nbPoints, nbPoints, data::Mesh::Attributes::POINT_COLORS);
 
-    const auto dumpLock = m_pointcloud->lock();
+    const auto dumpLock = mesh->lock();
 
-    auto itr = m_pointcloud->begin<data::iterator::CellIterator>();
+    auto itr = mesh->begin<data::iterator::CellIterator>();
 
     // to display the mesh, we need to create cells with one point.
     for(size_t i = 0 ; i < nbPoints ; ++i, ++itr)
@@ -399,9 +427,9 @@ void SScan::initialize(const ::rs2::pipeline_profile& _profile)
         itr->pointIdx[0]   = i;
     }
 
-    m_pointcloud->setNumberOfPoints(nbPoints);
-    m_pointcloud->setNumberOfCells(nbPoints);
-    m_pointcloud->setCellDataSize(nbPoints);
+    mesh->setNumberOfPoints(nbPoints);
+    mesh->setNumberOfCells(nbPoints);
+    mesh->setCellDataSize(nbPoints);
 }
 
 //-----------------------------------------------------------------------------
@@ -1261,7 +1289,27 @@ void SScan::onPointCloud(const ::rs2::points& _pc, const ::rs2::video_frame& _te
     {
         data::mt::ObjectWriteLock lockTFM(m_pointcloud);
 
-        const auto dumpLock = m_pointcloud->lock();
+        const auto mesh       = data::Mesh::dynamicCast(m_pointcloud);
+        const auto pointcloud = data::PointCloud::dynamicCast(m_pointcloud);
+        SIGHT_ASSERT("Pointcloud output must be a data::Mesh or a data::PointCloud", mesh || pointcloud);
+
+        std::vector<core::memory::BufferObject::Lock> dumpLock;
+        data::iterator::Point* points = nullptr;
+        data::iterator::RGBA* colors  = nullptr;
+        if(mesh)
+        {
+            dumpLock = mesh->lock();
+
+            const auto pointBegin = mesh->begin<data::iterator::PointIterator>();
+            points = pointBegin->point;
+            colors = pointBegin->rgba;
+        }
+        else
+        {
+            dumpLock = pointcloud->lock();
+            points   = pointcloud->getPointsBuffer();
+            colors   = pointcloud->getPointColorsBuffer();
+        }
 
         // Get Width and Height coordinates of texture
         const int textureW = _texture.get_width();  // Frame width in pixels
@@ -1278,11 +1326,6 @@ void SScan::onPointCloud(const ::rs2::points& _pc, const ::rs2::video_frame& _te
         const size_t pcSize = _pc.size();
 
         // Parallelization of the loop is possible since each element is independent.
-
-        const auto pointBegin = m_pointcloud->begin<data::iterator::PointIterator>();
-        auto points           = pointBegin->point;
-        auto colors           = pointBegin->rgba;
-
         #pragma omp parallel for
         for(std::int64_t i = 0 ; i < static_cast<std::int64_t>(pcSize) ; ++i)
         {
@@ -1326,13 +1369,26 @@ void SScan::onPointCloud(const ::rs2::points& _pc, const ::rs2::video_frame& _te
             this->setOutput(s_POINTCLOUD_OUTPUT, m_pointcloud);
         }
 
-        const auto sigVertex = m_pointcloud->signal<data::Mesh::VertexModifiedSignalType>
-                                   (data::Mesh::s_VERTEX_MODIFIED_SIG);
-        sigVertex->asyncEmit();
+        if(mesh)
+        {
+            const auto sigVertex = mesh->signal<data::Mesh::VertexModifiedSignalType>
+                                       (data::Mesh::s_VERTEX_MODIFIED_SIG);
+            sigVertex->asyncEmit();
 
-        const auto sigcolor = m_pointcloud->signal<data::Mesh::PointColorsModifiedSignalType>
-                                  (data::Mesh::s_POINT_COLORS_MODIFIED_SIG);
-        sigcolor->asyncEmit();
+            const auto sigcolor = mesh->signal<data::Mesh::PointColorsModifiedSignalType>
+                                      (data::Mesh::s_POINT_COLORS_MODIFIED_SIG);
+            sigcolor->asyncEmit();
+        }
+        else
+        {
+            const auto sigVertex = pointcloud->signal<data::PointCloud::VertexModifiedSignalType>
+                                       (data::PointCloud::s_VERTEX_MODIFIED_SIG);
+            sigVertex->asyncEmit();
+
+            const auto sigcolor = pointcloud->signal<data::PointCloud::PointColorsModifiedSignalType>
+                                      (data::PointCloud::s_POINT_COLORS_MODIFIED_SIG);
+            sigcolor->asyncEmit();
+        }
     }
 }
 
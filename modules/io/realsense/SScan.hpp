@@ -26,6 +26,7 @@
 
 #include <data/FrameTL.hpp>
 #include <data/Mesh.hpp>
+#include <data/PointCloud.hpp>
 
 #include <service/IRGBDGrabber.hpp>
 
@@ -109,7 +110,7 @@ namespace sight::module::io::realsense
         <out key="pointcloud" uid="..." />
         <inout key="cameraSeries" uid="..." />
         <config fps="30" colorW="1280" colorH="720" depthW="1280" depthH="720" switchToIR="true/false" preset="..."
- * alignTo="Color"/>
+ * alignTo="Color" pointcloudType="PointCloud"/>
         <recordFile>/path/to/the/file.bag</recordFile>
    </service>
    @endcode
@@ -119,7 +120,8 @@ namespace sight::module::io::realsense
  * - \b cameraSeries [sight::data::CameraSeries]: Camera series that will contain device camera information.
  *
  * @subsection Output Output
- * - \b pointcloud [sight::data::Mesh]: pointcloud computed from depth map. (optional)
+ * - \b pointcloud [sight::data::Mesh or sight::data::PointCloud]: pointcloud computed from depth map, see
+ *   'pointcloudType' (optional).
  * - \b distance [sight::data::Float]: distance (in mm) at center pixel. (optional)
  *
  * @subsection Configuration Configuration
@@ -132,6 +134,8 @@ namespace sight::module::io::realsense
  * - \b switchToIR: push infrared frame in color TL (default false) (optional)
  * - \b IREmitter: enable infrared emitter (default true) (optional)
  * - \b alignTo: align each frames to the chosen one, values can be: None (default), Color, Depth, Infrared (optionnal).
+ * - \b pointcloudType: type of the 'pointcloud' output, values can be: Mesh (default) or PointCloud. A
+ *   sight::data::PointCloud does not store any cell, thus it is faster to allocate and lighter in memory (optional).
  * - \b preset: (advanced option): load a json preset ( overwrite previous resolution values) (optional).
  *   - Default: Default preset
  *   - HighResHighAccuracy
@@ -428,8 +432,11 @@ private:
     /// Handle on which frame the pointcloud is mapped.
     PointcloudColormapEnumType m_pointcloudColorMap = PointcloudColormap::COLOR;
 
-    /// Pointer to the (optional) data::Mesh output.
-    data::Mesh::sptr m_pointcloud = nullptr;
+    /// Pointer to the (optional) data::Mesh or data::PointCloud output.
+    data::Object::sptr m_pointcloud = nullptr;
+
+    /// Output the pointcloud as a data::Mesh with one cell per point (true) or as a data::PointCloud (false).
+    bool m_pointcloudAsMesh = true;
 
     /// Struct that contains basic camera settings (fps, resolution, preset, ...).
     CameraSettings m_cameraSettings;
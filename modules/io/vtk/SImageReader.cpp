@@ -145,6 +145,9 @@ void SImageReader::stopping()
 void SImageReader::configuring()
 {
     sight::io::base::service::IReader::configuring();
+
+    const service::IService::ConfigType config = this->getConfigTree();
+    m_mapping = config.get<bool>("mapping", m_mapping);
 }
 
 //------------------------------------------------------------------------------
@@ -171,7 +174,7 @@ void SImageReader::updating()
         try
         {
             // Notify other image services that a new image has been loaded.
-            if(SImageReader::loadImage(this->getFile(), image, m_sigJobCreated))
+            if(SImageReader::loadImage(this->getFile(), image, m_sigJobCreated, m_mapping))
             {
                 auto sig = image->signal<data::Object::ModifiedSignalType>(data::Object::s_MODIFIED_SIG);
                 {
@@ -206,10 +209,21 @@ typename READER::sptr configureReader(const std::filesystem::path& imgFile)
 
 //------------------------------------------------------------------------------
 
+template<typename READER>
+typename READER::sptr configureReader(const std::filesystem::path& imgFile, bool mapping)
+{
+    typename READER::sptr reader = configureReader<READER>(imgFile);
+    reader->enableMapping(mapping);
+    return reader;
+}
+
+//------------------------------------------------------------------------------
+
 bool SImageReader::loadImage(
     const std::filesystem::path& imgFile,
     const data::mt::locked_ptr<data::Image>& img,
-    const SPTR(JobCreatedSignalType)& sigJobCreated
+    const SPTR(JobCreatedSignalType)& sigJobCreated,
+    bool mapping
 )
 {
     bool ok = true;
@@ -224,11 +238,11 @@ bool SImageReader::loadImage(
     }
     else if(ext == ".vti")
     {
-        imageReader = configureReader<sight::io::vtk::VtiImageReader>(imgFile);
+        imageReader = configureReader<sight::io::vtk::VtiImageReader>(imgFile, mapping);
     }
     else if(ext == ".mhd")
     {
-        imageReader = configureReader<sight::io::vtk::MetaImageReader>(imgFile);
+        imageReader = configureReader<sight::io::vtk::MetaImageReader>(imgFile, mapping);
     }
     else
     {
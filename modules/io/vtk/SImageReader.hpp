@@ -62,6 +62,7 @@ namespace sight::module::io::vtk
    <service type="sight::module::io::vtk::SImageReader">
        <inout key="data" uid="..." />
        <file>...</file>
+       <mapping>false</mapping>
    </service>
    @endcode
  * @subsection In-Out In-Out
@@ -69,6 +70,8 @@ namespace sight::module::io::vtk
  * @subsection Configuration Configuration
  * - \b file (optional): path of the image to load, if it is not defined, 'openLocationDialog()' should be called to
  * define the path.
+ * - \b mapping (optional, default=false): if true, the pixels of the .vti and .mhd images are mapped from the file
+ * instead of being read, when the file format allows it. The file must then be kept unchanged while the image is used.
  */
 class MODULE_IO_VTK_CLASS_API SImageReader : public sight::io::base::service::IReader
 {
@@ -107,12 +110,14 @@ public:
      * @brief This method is used to load an vtk image using a file path.
      * @param[in] vtkFile file system path of vtk image
      * @param[out] image new empty image that will contain image loaded, if reading process is a success.
+     * @param[in] mapping map the pixels of the .vti and .mhd images from the file instead of reading them
      * @return bool  \b true if the image loading is a success and \b false if it fails
      */
     MODULE_IO_VTK_API static bool loadImage(
         const std::filesystem::path& vtkFile,
         const data::mt::locked_ptr<data::Image>& img,
-        const SPTR(JobCreatedSignalType)& sigJobCreated
+        const SPTR(JobCreatedSignalType)& sigJobCreated,
+        bool mapping = false
     );
 
 protected:
@@ -148,6 +153,9 @@ private:
     std::filesystem::path m_fsImgPath;
 
     SPTR(JobCreatedSignalType) m_sigJobCreated;
+
+    /// Maps the pixels of the .vti and .mhd images instead of reading them
+    bool m_mapping {false};
 };
 
 } // namespace sight::module::io::vtk
@@ -22,6 +22,7 @@
 
 #include "ImageReaderWriterTest.hpp"
 
+#include <core/memory/BufferManager.hpp>
 #include <core/runtime/EConfigurationElement.hpp>
 #include <core/thread/ActiveWorkers.hpp>
 #include <core/thread/Worker.hpp>
@@ -31,6 +32,8 @@
 #include <data/ImageSeries.hpp>
 #include <data/reflection/visitor/CompareObjects.hpp>
 
+#include <io/vtk/vtk.hpp>
+
 #include <service/macros.hpp>
 #include <service/op/Add.hpp>
 #include <service/registry/ObjectService.hpp>
@@ -39,6 +42,11 @@
 #include <utestData/generator/Image.hpp>
 #include <utestData/helper/compare.hpp>
 
+#include <vtkImageData.h>
+#include <vtkMetaImageWriter.h>
+#include <vtkSmartPointer.h>
+#include <vtkXMLImageDataWriter.h>
+
 #include <filesystem>
 #include <fstream>
 
@@ -308,6 +316,74 @@ void ImageReaderWriterTest::testImageReaderExtension()
 
 //------------------------------------------------------------------------------
 
+void ImageReaderWriterTest::testMappedImageReader()
+{
+    const std::filesystem::path folder = core::tools::System::getTemporaryFolder() / "testMappedImageReader";
+    std::filesystem::create_directories(folder);
+
+    data::Image::sptr image = data::Image::New();
+    utestData::generator::Image::generateRandomImage(image, core::tools::Type::s_INT16);
+
+    // Only the uncompressed files can be mapped
+    {
+        const auto dumpLock = image->lock();
+
+        vtkSmartPointer<vtkImageData> vtkImage = vtkSmartPointer<vtkImageData>::New();
+        sight::io::vtk::toVTKImage(image, vtkImage);
+
+        vtkSmartPointer<vtkMetaImageWriter> mhdWriter = vtkSmartPointer<vtkMetaImageWriter>::New();
+        mhdWriter->SetInputData(vtkImage);
+        mhdWriter->SetFileName((folder / "image.mhd").string().c_str());
+        mhdWriter->SetRAWFileName((folder / "image.raw").string().c_str());
+        mhdWriter->SetCompression(false);
+        mhdWriter->Write();
+
+        vtkSmartPointer<vtkXMLImageDataWriter> vtiWriter = vtkSmartPointer<vtkXMLImageDataWriter>::New();
+        vtiWriter->SetInputData(vtkImage);
+        vtiWriter->SetFileName((folder / "image.vti").string().c_str());
+        vtiWriter->SetDataModeToAppended();
+        vtiWriter->EncodeAppendedDataOff();
+        vtiWriter->SetCompressorTypeToNone();
+        vtiWriter->Write();
+    }
+
+    for(const std::string& filename : {"image.mhd", "image.vti"})
+    {
+        for(const bool mapping : {false, true})
+        {
+            core::runtime::EConfigurationElement::sptr cfg = getIOConfiguration(folder / filename);
+            core::runtime::EConfigurationElement::sptr mappingCfg =
+                core::runtime::EConfigurationElement::New("mapping");
+            mappingCfg->setValue(mapping ? "true" : "false");
+            cfg->addConfigurationElement(mappingCfg);
+
+            data::Image::sptr imageFromDisk = data::Image::New();
+            runImageSrv("sight::module::io::vtk::SImageReader", cfg, imageFromDisk);
+
+            // The pixels are mapped from the file only when the mapping is configured
+            const auto infos = core::memory::BufferManager::getDefault()->getBufferInfos().get();
+            const auto& info = infos.at(imageFromDisk->getBufferObject()->getBufferPointer());
+            CPPUNIT_ASSERT_EQUAL_MESSAGE("test on <" + filename + "> Failed ", mapping, bool(info.mappedFile));
+
+            CPPUNIT_ASSERT_EQUAL(image->getType(), imageFromDisk->getType());
+            CPPUNIT_ASSERT_EQUAL(image->getSizeInBytes(), imageFromDisk->getSizeInBytes());
+
+            const auto imageDumpLock         = image->lock();
+            const auto imageFromDiskDumpLock = imageFromDisk->lock();
+
+            const char* const ptrOnGeneratedImage = static_cast<char*>(image->getBuffer());
+            const char* const ptrOnReadImage      = static_cast<char*>(imageFromDisk->getBuffer());
+            CPPUNIT_ASSERT(
+                std::equal(ptrOnGeneratedImage, ptrOnGeneratedImage + image->getSizeInBytes(), ptrOnReadImage)
+            );
+        }
+    }
+
+    std::filesystem::remove_all(folder);
+}
+
+//------------------------------------------------------------------------------
+
 void ImageReaderWriterTest::testBitmapImageWriter()
 {
     // Data to write
@@ -40,6 +40,7 @@ CPPUNIT_TEST(testVtkImageReader);
 CPPUNIT_TEST(testVtiImageReader);
 CPPUNIT_TEST(testMhdImageReader);
 CPPUNIT_TEST(testImageReaderExtension);
+CPPUNIT_TEST(testMappedImageReader);
 CPPUNIT_TEST(testBitmapImageWriter);
 CPPUNIT_TEST(testVtkImageWriter);
 CPPUNIT_TEST(testVtkImageSeriesWriter);
@@ -58,6 +59,7 @@ public:
     void testVtiImageReader();
     void testMhdImageReader();
     void testImageReaderExtension();
+    void testMappedImageReader();
     void testBitmapImageWriter();
     void testVtkImageWriter();
     void testVtkImageSeriesWriter();
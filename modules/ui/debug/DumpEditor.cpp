@@ -25,6 +25,7 @@
 #include <core/base.hpp>
 #include <core/com/Slot.hpp>
 #include <core/com/Slot.hxx>
+#include <core/HiResClock.hpp>
 #include <core/memory/BufferManager.hpp>
 #include <core/memory/ByteSize.hpp>
 #include <core/memory/IPolicy.hpp>
@@ -50,6 +51,8 @@
 #include <QTimer>
 #include <QVBoxLayout>
 
+#include <tuple>
+
 namespace sight::module::ui::debug
 {
 
@@ -58,6 +61,13 @@ namespace sight::module::ui::debug
 core::memory::BufferManager::BufferInfoMapType m_bufferInfos;
 core::memory::BufferManager::BufferStats m_bufferStats = {0, 0};
 
+/// Allocation and free rates computed between the two last refreshes, in bytes per second
+double m_allocationRate = 0.;
+double m_freeRate       = 0.;
+
+/// Time of the last refresh, in microseconds
+core::HiResClock::HiResClockType m_lastRefresh = 0.;
+
 //------------------------------------------------------------------------------
 
 QString getHumanReadableSize(core::memory::ByteSize::SizeType bytes)
@@ -352,7 +362,7 @@ InfoTableModel::InfoTableModel(QObject* parent) :
 int InfoTableModel::rowCount(const QModelIndex& parent) const
 {
     Q_UNUSED(parent);
-    return 4;
+    return 8;
 }
 
 //------------------------------------------------------------------------------
@@ -407,6 +417,29 @@ QVariant InfoTableModel::data(const QModelIndex& index, int role) const
                     bufferManagerMem = m_bufferStats.totalDumped;
                     return QString(getHumanReadableSize(bufferManagerMem));
 
+                    break;
+
+                case 4:
+                    return QString("%1 (%2)").arg(m_bufferStats.allocationCount)
+                           .arg(getHumanReadableSize(m_bufferStats.allocatedBytes));
+
+                    break;
+
+                case 5:
+                    return QString("%1 (%2)").arg(m_bufferStats.freeCount)
+                           .arg(getHumanReadableSize(m_bufferStats.freedBytes));
+
+                    break;
+
+                case 6:
+                    return getHumanReadableSize(static_cast<core::memory::ByteSize::SizeType>(m_allocationRate))
+                           + "/s";
+
+                    break;
+
+                case 7:
+                    return getHumanReadableSize(static_cast<core::memory::ByteSize::SizeType>(m_freeRate)) + "/s";
+
                     break;
             }
         }
@@ -441,6 +474,26 @@ QVariant InfoTableModel::headerData(int section, Qt::Orientation orientation, in
             case 3:
                 return QString("Dumped");
 
+                break;
+
+            case 4:
+                return QString("Allocations");
+
+                break;
+
+            case 5:
+                return QString("Frees");
+
+                break;
+
+            case 6:
+                return QString("Allocation rate");
+
+                break;
+
+            case 7:
+                return QString("Free rate");
+
                 break;
         }
     }
@@ -475,9 +528,10 @@ void DumpEditor::starting()
     m_list   = new QTableWidget();
     m_mapper = new QSignalMapper();
 
-    m_list->setColumnCount(5);
+    m_list->setColumnCount(6);
     QStringList header;
     header.push_back("Size");
+    header.push_back("Owner");
     header.push_back("Status");
     header.push_back("Timestamp");
     header.push_back("Locked");
@@ -499,6 +553,17 @@ void DumpEditor::starting()
     sizer->addLayout(sizerButton);
     sizer->addWidget(m_list, 2);
 
+    m_ownerList = new QTableWidget();
+    m_ownerList->setColumnCount(4);
+    QStringList ownerHeader;
+    ownerHeader.push_back("Owner");
+    ownerHeader.push_back("Buffers");
+    ownerHeader.push_back("Managed");
+    ownerHeader.push_back("Dumped");
+    m_ownerList->setHorizontalHeaderLabels(ownerHeader);
+    m_ownerList->verticalHeader()->hide();
+    sizer->addWidget(m_ownerList, 1);
+
     m_policyEditor = new QTableView();
     PolicyComboBoxDelegate* policyComboBoxDelegate = new PolicyComboBoxDelegate(m_policyEditor);
     PolicyTableModel* policyTableModel             = new PolicyTableModel(m_policyEditor);
@@ -582,16 +647,32 @@ protected:
 
 //------------------------------------------------------------------------------
 
-core::memory::BufferManager::BufferInfoMapType getInfoMap()
+std::pair<core::memory::BufferManager::BufferInfoMapType, core::memory::BufferManager::BufferStats> getBufferState()
 {
     core::memory::BufferManager::BufferInfoMapType infoMap;
-    core::memory::BufferManager::sptr buffManager = core::memory::BufferManager::getDefault();
+    core::memory::BufferManager::BufferStats stats = {};
+    core::memory::BufferManager::sptr buffManager  = core::memory::BufferManager::getDefault();
     if(buffManager)
     {
         infoMap = buffManager->getBufferInfos().get();
+        stats   = buffManager->getBufferStats().get();
     }
 
-    return infoMap;
+    return std::make_pair(infoMap, stats);
+}
+
+//------------------------------------------------------------------------------
+
+/// Returns the name displayed for a buffer owner, without the namespace
+QString getOwnerName(const std::string& owner)
+{
+    if(owner.empty())
+    {
+        return QString("Unknown");
+    }
+
+    const std::size_t pos = owner.rfind("::");
+    return QString::fromStdString(pos == std::string::npos ? owner : owner.substr(pos + 2));
 }
 
 //------------------------------------------------------------------------------
@@ -601,7 +682,7 @@ void DumpEditor::updating()
     m_policyEditor->reset();
     m_policyEditor->resizeColumnsToContents();
 
-    QFuture<core::memory::BufferManager::BufferInfoMapType> qFuture = QtConcurrent::run(getInfoMap);
+    QFuture<BufferStateType> qFuture = QtConcurrent::run(getBufferState);
     m_watcher.setFuture(qFuture);
 }
 
@@ -609,15 +690,26 @@ void DumpEditor::updating()
 
 void DumpEditor::onBufferInfo()
 {
-    m_bufferInfos = m_watcher.result();
-    m_bufferStats = core::memory::BufferManager::computeBufferStats(m_bufferInfos);
+    const core::memory::BufferManager::BufferStats previousStats = m_bufferStats;
+    const core::HiResClock::HiResClockType now                   = core::HiResClock::getTimeInMicroSec();
+
+    std::tie(m_bufferInfos, m_bufferStats) = m_watcher.result();
+
+    if(m_lastRefresh > 0. && now > m_lastRefresh)
+    {
+        const double elapsed = (now - m_lastRefresh) / 1000000.;
+        m_allocationRate = static_cast<double>(m_bufferStats.allocatedBytes - previousStats.allocatedBytes) / elapsed;
+        m_freeRate       = static_cast<double>(m_bufferStats.freedBytes - previousStats.freedBytes) / elapsed;
+    }
+
+    m_lastRefresh = now;
 
     m_mapper->blockSignals(true);
     core::com::Connection::Blocker block(m_connection);
 
     for(int row = 0 ; row < m_list->rowCount() ; row++)
     {
-        m_mapper->removeMappings(m_list->cellWidget(row, 4));
+        m_mapper->removeMappings(m_list->cellWidget(row, 5));
     }
 
     m_list->clearContents();
@@ -626,7 +718,7 @@ void DumpEditor::onBufferInfo()
     int itemCount = 0;
     m_list->setSortingEnabled(false);
     m_list->setRowCount(static_cast<int>(m_bufferInfos.size()));
-    m_list->setColumnCount(5);
+    m_list->setColumnCount(6);
     QColor backColor;
     for(const core::memory::BufferManager::BufferInfoMapType::value_type& elt : m_bufferInfos)
     {
@@ -667,24 +759,30 @@ void DumpEditor::onBufferInfo()
         currentSizeItem->setBackgroundColor(backColor);
         m_list->setItem(itemCount, 0, currentSizeItem);
 
+        QTableWidgetItem* ownerItem = new QTableWidgetItem(getOwnerName(dumpBuffInfo.owner));
+        ownerItem->setToolTip(QString::fromStdString(dumpBuffInfo.ownerId));
+        ownerItem->setFlags(Qt::ItemIsEnabled);
+        ownerItem->setBackgroundColor(backColor);
+        m_list->setItem(itemCount, 1, ownerItem);
+
         QTableWidgetItem* statusItem = new QTableWidgetItem(QString::fromStdString(status));
         statusItem->setFlags(Qt::ItemIsEnabled);
         statusItem->setBackgroundColor(backColor);
-        m_list->setItem(itemCount, 1, statusItem);
+        m_list->setItem(itemCount, 2, statusItem);
 
         QTableWidgetItem* dateItem = new QTableWidgetItem(QString::fromStdString(date));
         dateItem->setFlags(Qt::ItemIsEnabled);
         dateItem->setBackgroundColor(backColor);
-        m_list->setItem(itemCount, 2, dateItem);
+        m_list->setItem(itemCount, 3, dateItem);
 
         QTableWidgetItem* lockStatusItem = new QTableWidgetItem(QString::fromStdString(lockStatus));
         lockStatusItem->setFlags(Qt::ItemIsEnabled);
         lockStatusItem->setBackgroundColor(backColor);
-        m_list->setItem(itemCount, 3, lockStatusItem);
+        m_list->setItem(itemCount, 4, lockStatusItem);
 
         QPushButton* actionItem = new QPushButton(QString::fromStdString((loaded) ? "Dump" : "Restore"), m_list);
         actionItem->setEnabled(!isLock && (dumpBuffInfo.size > 0));
-        m_list->setCellWidget(itemCount, 4, actionItem);
+        m_list->setCellWidget(itemCount, 5, actionItem);
         QObject::connect(actionItem, SIGNAL(pressed()), m_mapper, SLOT(map()));
         m_mapper->setMapping(actionItem, itemCount);
 
@@ -695,6 +793,37 @@ void DumpEditor::onBufferInfo()
 
     m_mapper->blockSignals(false);
 
+    m_ownerList->setSortingEnabled(false);
+    m_ownerList->clearContents();
+    m_ownerList->setRowCount(static_cast<int>(m_bufferStats.owners.size()));
+    int ownerCount = 0;
+    for(const auto& [owner, ownerStats] : m_bufferStats.owners)
+    {
+        QTableWidgetItem* nameItem = new QTableWidgetItem(getOwnerName(owner));
+        nameItem->setToolTip(QString::fromStdString(owner));
+        nameItem->setFlags(Qt::ItemIsEnabled);
+        m_ownerList->setItem(ownerCount, 0, nameItem);
+
+        QTableWidgetItem* countItem = new QTableWidgetItem();
+        countItem->setData(Qt::DisplayRole, static_cast<qulonglong>(ownerStats.count));
+        countItem->setFlags(Qt::ItemIsEnabled);
+        m_ownerList->setItem(ownerCount, 1, countItem);
+
+        QTableWidgetItem* managedItem = new SizeTableWidgetItem(getHumanReadableSize(ownerStats.totalManaged));
+        managedItem->setData(Qt::UserRole, static_cast<qulonglong>(ownerStats.totalManaged));
+        managedItem->setFlags(Qt::ItemIsEnabled);
+        m_ownerList->setItem(ownerCount, 2, managedItem);
+
+        QTableWidgetItem* dumpedItem = new SizeTableWidgetItem(getHumanReadableSize(ownerStats.totalDumped));
+        dumpedItem->setData(Qt::UserRole, static_cast<qulonglong>(ownerStats.totalDumped));
+        dumpedItem->setFlags(Qt::ItemIsEnabled);
+        m_ownerList->setItem(ownerCount, 3, dumpedItem);
+
+        ++ownerCount;
+    }
+
+    m_ownerList->setSortingEnabled(true);
+
     m_infoEditor->reset();
     m_infoEditor->resizeColumnsToContents();
 }
@@ -37,6 +37,7 @@
 #include <QTableView>
 #include <QTableWidget>
 
+#include <utility>
 #include <vector>
 
 class QTimer;
@@ -109,7 +110,11 @@ private:
 
     typedef core::com::Slot<void ()> UpdateSlotType;
 
-    QFutureWatcher<core::memory::BufferManager::BufferInfoMapType> m_watcher;
+    /// Buffers information and statistics retrieved together from the buffer manager
+    typedef std::pair<core::memory::BufferManager::BufferInfoMapType,
+                      core::memory::BufferManager::BufferStats> BufferStateType;
+
+    QFutureWatcher<BufferStateType> m_watcher;
 
     // Managed buffers
     std::vector<const void* const*> m_objectsUID;
@@ -117,6 +122,9 @@ private:
     /// Widget to print some information on managed buffer by system
     QTableWidget* m_list;
 
+    /// Widget to print the memory used by each owner of the managed buffers (Image, Mesh, ...)
+    QTableWidget* m_ownerList;
+
     /// Button to force refresh
     QPushButton* m_refresh;
 
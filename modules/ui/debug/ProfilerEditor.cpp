@@ -0,0 +1,258 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "ProfilerEditor.hpp"
+
+#include <core/location/SingleFile.hpp>
+#include <core/location/SingleFolder.hpp>
+
+#include <service/macros.hpp>
+#include <service/Profiler.hpp>
+
+#include <ui/base/dialog/LocationDialog.hpp>
+#include <ui/base/dialog/MessageDialog.hpp>
+#include <ui/qt/container/QtContainer.hpp>
+
+#include <QCheckBox>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QPushButton>
+#include <QStringList>
+#include <QTableWidget>
+#include <QTableWidgetItem>
+#include <QTimer>
+#include <QVBoxLayout>
+
+#include <fstream>
+
+namespace sight::module::ui::debug
+{
+
+namespace
+{
+
+/// Table item sorted according to the value stored in Qt::UserRole rather than its text.
+class NumberTableWidgetItem : public QTableWidgetItem
+{
+public:
+
+    NumberTableWidgetItem(double _value, int _precision) :
+        QTableWidgetItem(QString::number(_value, 'f', _precision))
+    {
+        this->setData(Qt::UserRole, _value);
+        this->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+    }
+
+    //------------------------------------------------------------------------------
+
+    bool operator<(const QTableWidgetItem& _other) const override
+    {
+        return data(Qt::UserRole).toDouble() < _other.data(Qt::UserRole).toDouble();
+    }
+};
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+ProfilerEditor::ProfilerEditor() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+
+ProfilerEditor::~ProfilerEditor() noexcept
+{
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerEditor::configuring()
+{
+    this->sight::ui::base::IGuiContainer::initialize();
+
+    const auto config = this->getConfigTree();
+
+    m_topN          = config.get<std::size_t>("topN", m_topN);
+    m_refreshPeriod = config.get<int>("refreshPeriod", m_refreshPeriod);
+    m_enable        = config.get<bool>("enable", m_enable);
+
+    SIGHT_ASSERT("'refreshPeriod' must be strictly positive", m_refreshPeriod > 0);
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerEditor::starting()
+{
+    this->sight::ui::base::IGuiContainer::create();
+
+    auto qtContainer = sight::ui::qt::container::QtContainer::dynamicCast(this->getContainer());
+
+    m_enableCheckBox = new QCheckBox(tr("Enable profiling"));
+    m_resetButton    = new QPushButton(tr("Reset"));
+    m_exportButton   = new QPushButton(tr("Export CSV"));
+
+    QStringList header;
+    header << "Service" << "Class" << "Wall time (ms)" << "CPU time (ms)";
+    for(std::size_t i = 0 ; i < sight::service::Profiler::s_NB_OPERATIONS ; ++i)
+    {
+        const auto operation = static_cast<sight::service::Profiler::Operation>(i);
+        const auto name      = QString::fromStdString(sight::service::Profiler::getOperationName(operation));
+        header << name + " count" << name + " (ms)";
+    }
+
+    m_table = new QTableWidget();
+    m_table->setColumnCount(header.size());
+    m_table->setHorizontalHeaderLabels(header);
+    m_table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_table->verticalHeader()->hide();
+
+    QHBoxLayout* sizerButton = new QHBoxLayout();
+    sizerButton->addWidget(m_enableCheckBox);
+    sizerButton->addStretch();
+    sizerButton->addWidget(m_resetButton);
+    sizerButton->addWidget(m_exportButton);
+
+    QVBoxLayout* sizer = new QVBoxLayout();
+    sizer->addLayout(sizerButton);
+    sizer->addWidget(m_table);
+
+    qtContainer->setLayout(sizer);
+
+    if(m_enable)
+    {
+        sight::service::Profiler::setEnabled(true);
+    }
+
+    m_enableCheckBox->setChecked(sight::service::Profiler::isEnabled());
+
+    QObject::connect(m_enableCheckBox, &QCheckBox::stateChanged, this, &ProfilerEditor::onEnable);
+    QObject::connect(m_resetButton, &QPushButton::clicked, this, &ProfilerEditor::onReset);
+    QObject::connect(m_exportButton, &QPushButton::clicked, this, &ProfilerEditor::onExport);
+
+    m_updateTimer = new QTimer(qtContainer->getQtContainer());
+    m_updateTimer->setInterval(m_refreshPeriod);
+    QObject::connect(m_updateTimer, &QTimer::timeout, this, &ProfilerEditor::updating);
+    m_updateTimer->start();
+
+    this->updating();
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerEditor::stopping()
+{
+    m_updateTimer->stop();
+
+    QObject::disconnect(m_updateTimer, &QTimer::timeout, this, &ProfilerEditor::updating);
+    QObject::disconnect(m_enableCheckBox, &QCheckBox::stateChanged, this, &ProfilerEditor::onEnable);
+    QObject::disconnect(m_resetButton, &QPushButton::clicked, this, &ProfilerEditor::onReset);
+    QObject::disconnect(m_exportButton, &QPushButton::clicked, this, &ProfilerEditor::onExport);
+
+    this->destroy();
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerEditor::updating()
+{
+    const auto statistics = sight::service::Profiler::getStatistics(m_topN);
+
+    // Sorting is disabled while filling the table, otherwise the rows would be moved between two insertions
+    m_table->setSortingEnabled(false);
+    m_table->clearContents();
+    m_table->setRowCount(static_cast<int>(statistics.size()));
+
+    int row = 0;
+    for(const auto& service : statistics)
+    {
+        int column = 0;
+        m_table->setItem(row, column++, new QTableWidgetItem(QString::fromStdString(service.m_id)));
+        m_table->setItem(row, column++, new QTableWidgetItem(QString::fromStdString(service.m_classname)));
+        m_table->setItem(row, column++, new NumberTableWidgetItem(service.getWallTime() / 1000., 3));
+        m_table->setItem(row, column++, new NumberTableWidgetItem(service.getCPUTime() / 1000., 3));
+
+        for(const auto& operation : service.m_operations)
+        {
+            m_table->setItem(row, column++, new NumberTableWidgetItem(static_cast<double>(operation.m_count), 0));
+            m_table->setItem(row, column++, new NumberTableWidgetItem(operation.m_wallTime / 1000., 3));
+        }
+
+        ++row;
+    }
+
+    m_table->setSortingEnabled(true);
+    m_table->resizeColumnsToContents();
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerEditor::onEnable(int _state)
+{
+    sight::service::Profiler::setEnabled(_state == Qt::Checked);
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerEditor::onReset()
+{
+    sight::service::Profiler::reset();
+    this->updating();
+}
+
+//------------------------------------------------------------------------------
+
+void ProfilerEditor::onExport()
+{
+    static auto defaultDirectory = std::make_shared<core::location::SingleFolder>();
+    sight::ui::base::dialog::LocationDialog dialogFile;
+    dialogFile.setTitle("Choose a file to save the profiling statistics");
+    dialogFile.setDefaultLocation(defaultDirectory);
+    dialogFile.setOption(sight::ui::base::dialog::ILocationDialog::WRITE);
+    dialogFile.setType(sight::ui::base::dialog::ILocationDialog::SINGLE_FILE);
+    dialogFile.addFilter(".csv file", "*.csv");
+
+    auto result = core::location::SingleFile::dynamicCast(dialogFile.show());
+    if(result)
+    {
+        defaultDirectory->setFolder(result->getFile().parent_path());
+        dialogFile.saveDefaultLocation(defaultDirectory);
+
+        std::ofstream stream(result->getFile());
+        if(stream.is_open())
+        {
+            sight::service::Profiler::writeCSV(stream, m_topN);
+        }
+        else
+        {
+            sight::ui::base::dialog::MessageDialog::show(
+                "Warning",
+                "The file '" + result->getFile().string() + "' can not be written.",
+                sight::ui::base::dialog::IMessageDialog::WARNING
+            );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::module::ui::debug
@@ -0,0 +1,122 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "modules/ui/debug/config.hpp"
+
+#include <ui/base/IEditor.hpp>
+
+#include <QObject>
+#include <QPointer>
+
+class QCheckBox;
+class QPushButton;
+class QTableWidget;
+class QTimer;
+
+namespace sight::module::ui::debug
+{
+
+/**
+ * @brief Editor displaying the services that spend the most time in start, stop, update, swap and slots.
+ *
+ * The statistics are collected by sight::service::Profiler while the profiling is enabled. They can be reset and
+ * exported in a CSV file.
+ *
+ * @section XML XML Configuration
+ *
+ * @code{.xml}
+    <service type="sight::module::ui::debug::ProfilerEditor">
+        <topN>20</topN>
+        <refreshPeriod>1000</refreshPeriod>
+        <enable>false</enable>
+    </service>
+   @endcode
+ *
+ * @subsection Configuration Configuration
+ * - \b topN (optional, default: 20): number of services displayed, sorted by decreasing wall time.
+ * - \b refreshPeriod (optional, default: 1000): refresh period of the table in milliseconds.
+ * - \b enable (optional, default: false): enables the profiling when the editor starts.
+ */
+class MODULE_UI_DEBUG_CLASS_API ProfilerEditor : public QObject,
+                                                 public sight::ui::base::IEditor
+{
+Q_OBJECT
+
+public:
+
+    SIGHT_DECLARE_SERVICE(ProfilerEditor, sight::ui::base::IEditor);
+
+    /// Constructor. Does nothing.
+    MODULE_UI_DEBUG_API ProfilerEditor() noexcept;
+
+    /// Destructor. Does nothing.
+    MODULE_UI_DEBUG_API virtual ~ProfilerEditor() noexcept;
+
+protected:
+
+    /// Parses the configuration.
+    void configuring() override;
+
+    /// Creates the layout and starts the refresh timer.
+    void starting() override;
+
+    /// Stops the refresh timer and destroys the layout.
+    void stopping() override;
+
+    /// Fills the table with the current statistics.
+    void updating() override;
+
+protected Q_SLOTS:
+
+    /// Enables or disables the profiling.
+    void onEnable(int _state);
+
+    /// Clears the statistics.
+    void onReset();
+
+    /// Asks for a file and exports the statistics in CSV.
+    void onExport();
+
+private:
+
+    /// Number of services displayed.
+    std::size_t m_topN {20};
+
+    /// Refresh period of the table in milliseconds.
+    int m_refreshPeriod {1000};
+
+    /// Enables the profiling when starting.
+    bool m_enable {false};
+
+    QPointer<QCheckBox> m_enableCheckBox;
+    QPointer<QPushButton> m_resetButton;
+    QPointer<QPushButton> m_exportButton;
+
+    /// Table displaying the statistics of each service.
+    QPointer<QTableWidget> m_table;
+
+    /// Timer used to refresh the table.
+    QPointer<QTimer> m_updateTimer;
+};
+
+} // namespace sight::module::ui::debug
@@ -52,8 +52,9 @@ namespace sight::module::viz::scene3d::adaptor
 
 //-----------------------------------------------------------------------------
 
-static const service::IService::KeyType s_POINTLIST_INPUT = "pointList";
-static const service::IService::KeyType s_MESH_INPUT      = "mesh";
+static const service::IService::KeyType s_POINTLIST_INPUT  = "pointList";
+static const service::IService::KeyType s_MESH_INPUT       = "mesh";
+static const service::IService::KeyType s_POINTCLOUD_INPUT = "pointCloud";
 
 static const std::string s_COLOR_CONFIG             = "color";
 static const std::string s_VISIBLE_CONFIG           = "visible";
@@ -199,7 +200,24 @@ void SPointList::starting()
         }
         else
         {
-            SIGHT_ERROR("No '" + s_POINTLIST_INPUT + "' or '" + s_MESH_INPUT + "' specified.")
+            const auto pointCloudW = this->getWeakInput<data::PointCloud>(s_POINTCLOUD_INPUT);
+            const auto pointCloud  = pointCloudW.lock();
+            if(pointCloud)
+            {
+                if(!m_customMaterial && pointCloud->hasPointColors())
+                {
+                    m_materialTemplateName += "_PerPointColor";
+                }
+
+                this->updateMesh(pointCloud.get_shared());
+            }
+            else
+            {
+                SIGHT_ERROR(
+                    "No '" + s_POINTLIST_INPUT + "', '" + s_MESH_INPUT + "' or '" + s_POINTCLOUD_INPUT
+                    + "' specified."
+                )
+            }
         }
     }
 }
@@ -216,6 +234,10 @@ service::IService::KeyConnectionsMap SPointList::getAutoConnections() const
     connections.push(s_MESH_INPUT, data::Mesh::s_VERTEX_MODIFIED_SIG, s_UPDATE_SLOT);
     connections.push(s_MESH_INPUT, data::Mesh::s_MODIFIED_SIG, s_UPDATE_SLOT);
 
+    connections.push(s_POINTCLOUD_INPUT, data::PointCloud::s_VERTEX_MODIFIED_SIG, s_UPDATE_SLOT);
+    connections.push(s_POINTCLOUD_INPUT, data::PointCloud::s_POINT_COLORS_MODIFIED_SIG, s_UPDATE_SLOT);
+    connections.push(s_POINTCLOUD_INPUT, data::PointCloud::s_MODIFIED_SIG, s_UPDATE_SLOT);
+
     return connections;
 }
 
@@ -269,7 +291,19 @@ void SPointList::updating()
         }
         else
         {
-            SIGHT_ERROR("No '" + s_POINTLIST_INPUT + "' or '" + s_MESH_INPUT + "' specified.")
+            const auto pointCloudW = this->getWeakInput<data::PointCloud>(s_POINTCLOUD_INPUT);
+            const auto pointCloud  = pointCloudW.lock();
+            if(pointCloud)
+            {
+                this->updateMesh(pointCloud.get_shared());
+            }
+            else
+            {
+                SIGHT_ERROR(
+                    "No '" + s_POINTLIST_INPUT + "', '" + s_MESH_INPUT + "' or '" + s_POINTCLOUD_INPUT
+                    + "' specified."
+                )
+            }
         }
     }
 
@@ -466,6 +500,61 @@ void SPointList::updateMesh(const data::Mesh::csptr& _mesh)
 
 //------------------------------------------------------------------------------
 
+void SPointList::updateMesh(const data::PointCloud::csptr& _pointCloud)
+{
+    ::Ogre::SceneManager* sceneMgr = this->getSceneManager();
+    SIGHT_ASSERT("::Ogre::SceneManager is null", sceneMgr);
+
+    detachAndDestroyEntity();
+
+    const size_t uiNumVertices = _pointCloud->getNumberOfPoints();
+    if(uiNumVertices == 0)
+    {
+        SIGHT_DEBUG("Empty point cloud");
+
+        m_meshGeometry->clearMesh(*sceneMgr);
+        return;
+    }
+
+    this->getRenderService()->makeCurrent();
+
+    m_meshGeometry->updateMesh(_pointCloud);
+
+    //------------------------------------------
+    // Create entity and attach it in the scene graph
+    //------------------------------------------
+
+    if(!m_entity)
+    {
+        m_entity = m_meshGeometry->createEntity(*sceneMgr);
+        m_entity->setVisible(m_isVisible);
+        m_entity->setQueryFlags(m_queryFlags);
+    }
+
+    //------------------------------------------
+    // Update vertex layers
+    //------------------------------------------
+
+    m_meshGeometry->updateVertices(_pointCloud);
+    m_meshGeometry->updateColors(_pointCloud);
+
+    //------------------------------------------
+    // Create sub-services
+    //------------------------------------------
+    this->updateMaterialAdaptor();
+
+    this->attachNode(m_entity);
+
+    m_meshGeometry->setVisible(m_isVisible);
+
+    if(m_autoResetCamera)
+    {
+        this->getRenderService()->resetCameraCoordinates(m_layerID);
+    }
+}
+
+//------------------------------------------------------------------------------
+
 scene3d::adaptor::SMaterial::sptr SPointList::createMaterialService(const std::string& _materialSuffix)
 {
     auto materialAdaptor = this->registerService<module::viz::scene3d::adaptor::SMaterial>(
@@ -497,6 +586,15 @@ scene3d::adaptor::SMaterial::sptr SPointList::createMaterialService(const std::s
         {
             meshName = mesh->getID();
         }
+        else
+        {
+            const auto pointCloudW = this->getWeakInput<data::PointCloud>(s_POINTCLOUD_INPUT);
+            const auto pointCloud  = pointCloudW.lock();
+            if(pointCloud)
+            {
+                meshName = pointCloud->getID();
+            }
+        }
     }
 
     const std::string mtlName = meshName + "_" + materialAdaptor->getID() + _materialSuffix;
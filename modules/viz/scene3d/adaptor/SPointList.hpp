@@ -27,6 +27,7 @@
 #include "modules/viz/scene3d/config.hpp"
 
 #include <data/Material.hpp>
+#include <data/PointCloud.hpp>
 #include <data/PointList.hpp>
 
 #include <viz/scene3d/IAdaptor.hpp>
@@ -55,8 +56,8 @@ namespace sight::module::viz::scene3d::adaptor
 /**
  * @brief This adaptor shows a point list using billboards generated by a geometry shader.
  *
- * This class handles the display of a data::PointList or a data::Mesh. Both are exclusive you can only specify
- * one of the two.
+ * This class handles the display of a data::PointList, a data::PointCloud or a data::Mesh. They are exclusive, you
+ * can only specify one of them.
  *
  * @section Slots Slots
  * - \b updateVisibility(bool): Sets whether the points are visible or not.
@@ -77,6 +78,8 @@ namespace sight::module::viz::scene3d::adaptor
  * - \b pointList [sight::data::PointList] (optional): point list to display.
  * - \b mesh [sight::data::Mesh] (optional): point based mesh to display. If the mesh contains any topology, it will be
  *      ignored and only raw vertices will be displayed. or add some fields.
+ * - \b pointCloud [sight::data::PointCloud] (optional): point cloud to display, with its colors if any. Unlike a mesh,
+ *      a point cloud does not have any cell, so this is the fastest way to display sensor data.
  *
  * @subsection Configuration Configuration:
  * - \b layer (mandatory, string): defines the mesh's layer.
@@ -131,6 +134,9 @@ protected:
      * Connect data::PointList::s_MODIFIED_SIG of s_POINTLIST_INPUT to s_UPDATE_SLOT
      * Connect data::Mesh::s_VERTEX_MODIFIED_SIG of s_MESH_INPUT to s_UPDATE_SLOT
      * Connect data::Mesh::s_MODIFIED_SIG of s_MESH_INPUT to s_UPDATE_SLOT
+     * Connect data::PointCloud::s_VERTEX_MODIFIED_SIG of s_POINTCLOUD_INPUT to s_UPDATE_SLOT
+     * Connect data::PointCloud::s_POINT_COLORS_MODIFIED_SIG of s_POINTCLOUD_INPUT to s_UPDATE_SLOT
+     * Connect data::PointCloud::s_MODIFIED_SIG of s_POINTCLOUD_INPUT to s_UPDATE_SLOT
      */
     MODULE_VIZ_SCENE3D_API service::IService::KeyConnectionsMap getAutoConnections() const override;
 
@@ -167,6 +173,13 @@ private:
      */
     void updateMesh(const data::Mesh::csptr& _mesh);
 
+    /**
+     * @brief Updates the point list from a point cloud, checks if color, number of vertices have changed, and updates
+     * them.
+     * @param _pointCloud point cloud used for the update.
+     */
+    void updateMesh(const data::PointCloud::csptr& _pointCloud);
+
     /**
      * @brief Instantiates a new material adaptor.
      * @param _materialSuffix suffix use for the material name.
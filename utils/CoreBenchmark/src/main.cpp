@@ -0,0 +1,289 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include <core/log/SpyLogger.hpp>
+#include <core/memory/BufferAllocationPolicy.hpp>
+#include <core/memory/BufferManager.hpp>
+#include <core/memory/BufferObject.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdlib.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+/** \file CoreBenchmark/src/main
+ *
+ *********************
+ * Software : CoreBenchmark
+ *********************
+ * Measures the performance of the core library: the access to a part of a dumped buffer, the streaming through
+ * aligned buffers and the synchronous and asynchronous logging
+ * HELP  : CoreBenchmark.exe --help
+ * USE :   CoreBenchmark.exe <options>
+ * Allowed options:
+ *   -h [ --help ]           produce help message
+ *   -b [ --benchmark ] arg  set the benchmark to run (buffer, log, streaming), all of them are run by default
+ *   -t [ --threads ] arg    set the number of logging threads
+ */
+
+//------------------------------------------------------------------------------
+
+/// Run the function and return its duration in microseconds
+static std::int64_t measure(const std::function<void()>& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+//------------------------------------------------------------------------------
+
+/// Dump a buffer in the given mode and return the time in microseconds to read back one slice of it
+static std::int64_t measurePartialAccess(sight::core::memory::BufferManager::DumpModeType mode)
+{
+    sight::core::memory::BufferManager::sptr manager = sight::core::memory::BufferManager::getDefault();
+    manager->setDumpMode(mode);
+
+    const std::size_t SIZE                     = 64 * 1024 * 1024;
+    const std::size_t SLICE_SIZE               = 512 * 512;
+    sight::core::memory::BufferObject::sptr bo = sight::core::memory::BufferObject::New();
+    bo->allocate(SIZE);
+
+    {
+        sight::core::memory::BufferObject::Lock lock(bo->lock());
+        std::memset(lock.getBuffer(), 1, SIZE);
+    }
+
+    while(bo->lockCount() > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    manager->dumpBuffer(bo->getBufferPointer()).wait();
+
+    std::size_t sum     = 0;
+    const auto duration = measure(
+        [&]
+        {
+            sight::core::memory::BufferObject::Lock lock(bo->lock());
+            const char* slice = static_cast<const char*>(lock.getBuffer()) + SIZE / 2;
+
+            for(std::size_t i = 0 ; i < SLICE_SIZE ; ++i)
+            {
+                sum += static_cast<std::size_t>(slice[i]);
+            }
+        });
+
+    if(sum != SLICE_SIZE)
+    {
+        std::cout << "The slice read back from the dumped buffer is corrupted." << std::endl;
+    }
+
+    bo->destroy();
+    manager->setDumpMode(sight::core::memory::BufferManager::COPY);
+
+    return duration;
+}
+
+//------------------------------------------------------------------------------
+
+/// Compare the access to one slice of a dumped buffer, restored by copy or by mapping
+static void benchmarkBuffer()
+{
+    const auto copyTime   = measurePartialAccess(sight::core::memory::BufferManager::COPY);
+    const auto mappedTime = measurePartialAccess(sight::core::memory::BufferManager::MAPPED);
+
+    std::cout << "Access to one slice of a dumped buffer: " << copyTime << " us in COPY mode, " << mappedTime
+    << " us in MAPPED mode" << std::endl;
+}
+
+//------------------------------------------------------------------------------
+
+/// Stream x into y, a kernel bound by the memory bandwidth
+static void streamingKernel(const float* x, float* y, std::size_t size, int repeat)
+{
+    for(int r = 0 ; r < repeat ; ++r)
+    {
+        for(std::size_t i = 0 ; i < size ; ++i)
+        {
+            y[i] = 0.5f * x[i] + y[i];
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+/// Compare the streaming kernel on buffers aligned on a cache line and on buffers shifted by one float
+static void benchmarkStreaming()
+{
+    const std::size_t SIZE = 4 * 1024 * 1024;
+    const int REPEAT       = 10;
+
+    // One more float to shift the unaligned buffers
+    const std::size_t bufferSize = (SIZE + 1) * sizeof(float);
+
+    const sight::core::memory::BufferAllocationPolicy::sptr policy = sight::core::memory::BufferAlignedPolicy::New(
+        64,
+        sight::core::memory::BufferAlignedPolicy::HUGE_PAGE_SIZE
+    );
+
+    sight::core::memory::BufferObject::sptr boX = sight::core::memory::BufferObject::New();
+    sight::core::memory::BufferObject::sptr boY = sight::core::memory::BufferObject::New();
+    boX->allocate(bufferSize, policy);
+    boY->allocate(bufferSize, policy);
+
+    sight::core::memory::BufferObject::Lock lockX(boX->lock());
+    sight::core::memory::BufferObject::Lock lockY(boY->lock());
+    float* x = static_cast<float*>(lockX.getBuffer());
+    float* y = static_cast<float*>(lockY.getBuffer());
+    std::fill(x, x + SIZE + 1, 1.f);
+    std::fill(y, y + SIZE + 1, 0.f);
+
+    const auto alignedTime   = measure([&]{streamingKernel(x, y, SIZE, REPEAT);});
+    const auto unalignedTime = measure([&]{streamingKernel(x + 1, y + 1, SIZE, REPEAT);});
+
+    std::cout << "Streaming kernel on " << SIZE << " floats: " << alignedTime / REPEAT << " us aligned, "
+    << unalignedTime / REPEAT << " us unaligned" << std::endl;
+}
+
+//------------------------------------------------------------------------------
+
+/// Log messages from several threads and return the number of log calls per second
+static double measureLogRate(std::size_t nbThreads, std::size_t nbLogs)
+{
+    sight::core::log::SpyLogger& log = sight::core::log::SpyLogger::getSpyLogger();
+
+    std::stringstream stream;
+    const auto appenderId = log.addStreamAppender(stream);
+
+    const auto duration = measure(
+        [&]
+        {
+            std::vector<std::thread> threads;
+            for(std::size_t i = 0 ; i < nbThreads ; ++i)
+            {
+                threads.push_back(
+                    std::thread(
+                        [&log, nbLogs]
+                    {
+                        for(std::size_t j = 0 ; j < nbLogs ; ++j)
+                        {
+                            log.info("benchmark message", __FILE__, __LINE__);
+                        }
+                    }));
+            }
+
+            for(auto& thread : threads)
+            {
+                thread.join();
+            }
+        });
+
+    // All the messages are written once the appender is removed
+    log.removeAppender(appenderId);
+
+    return static_cast<double>(nbThreads * nbLogs) / (static_cast<double>(std::max<std::int64_t>(1, duration)) / 1e6);
+}
+
+//------------------------------------------------------------------------------
+
+/// Compare the log calls per second with a synchronous and an asynchronous logger
+static void benchmarkLog(std::size_t nbThreads)
+{
+    sight::core::log::SpyLogger& log = sight::core::log::SpyLogger::getSpyLogger();
+
+    const std::size_t NB_LOG = 5000;
+
+    log.setAsynchronous(false);
+    const double synchronousRate = measureLogRate(nbThreads, NB_LOG);
+
+    log.setAsynchronous(true, 8192, sight::core::log::SpyLogger::OverflowPolicy::BLOCK);
+    const double asynchronousRate = measureLogRate(nbThreads, NB_LOG);
+
+    log.setAsynchronous(false);
+
+    std::cout << "Log calls per second on " << nbThreads << " threads: synchronous " << synchronousRate
+    << ", asynchronous " << asynchronousRate << std::endl;
+}
+
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    // Declare the supported options.
+    ::boost::program_options::options_description desc("Allowed options");
+    desc.add_options()
+        ("help,h", "produce help message")
+        ("benchmark,b", ::boost::program_options::value<std::string>(),
+        "set the benchmark to run (buffer, log, streaming), all of them are run by default")
+        ("threads,t", ::boost::program_options::value<std::size_t>()->default_value(4),
+        "set the number of logging threads")
+    ;
+
+    // Manage the options
+    ::boost::program_options::variables_map vm;
+    ::boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
+    ::boost::program_options::notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::map<std::string, std::function<void()> > benchmarks = {
+        {"buffer", &benchmarkBuffer},
+        {"log", [&vm]{benchmarkLog(std::max<std::size_t>(1, vm["threads"].as<std::size_t>()));}},
+        {"streaming", &benchmarkStreaming}
+    };
+
+    if(vm.count("benchmark"))
+    {
+        const auto benchmark = benchmarks.find(vm["benchmark"].as<std::string>());
+        if(benchmark == benchmarks.end())
+        {
+            std::cout << "Unknown benchmark \"" << vm["benchmark"].as<std::string>() << "\"." << std::endl << std::endl;
+            std::cout << desc << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        benchmark->second();
+        return EXIT_SUCCESS;
+    }
+
+    for(const auto& benchmark : benchmarks)
+    {
+        benchmark.second();
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,173 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include <core/jobs/Observer.hpp>
+#include <core/tools/System.hpp>
+
+#include <data/DicomSeries.hpp>
+
+#include <io/dicom/helper/DicomAnonymizer.hpp>
+#include <io/dicom/helper/DicomSeries.hpp>
+#include <io/dicom/helper/DicomSeriesWriter.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <thread>
+
+/** \file DicomBenchmark/src/main
+ *
+ *********************
+ * Software : DicomBenchmark
+ *********************
+ * Measures the scan of a DICOM folder and the anonymized write of its series, on one thread and on several threads
+ * HELP  : DicomBenchmark.exe --help
+ * USE :   DicomBenchmark.exe <options>
+ * Allowed options:
+ *   -h [ --help ]           produce help message
+ *   -i [ --input ] arg      set the input folder
+ *   -t [ --threads ] arg    set the number of threads, 0 uses the number of hardware threads
+ */
+
+//------------------------------------------------------------------------------
+
+/// Run the function and return its duration in milliseconds
+static std::int64_t measure(const std::function<void()>& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    // Declare the supported options.
+    ::boost::program_options::options_description desc("Allowed options");
+    desc.add_options()
+        ("help,h", "produce help message")
+        ("input,i", ::boost::program_options::value<std::string>(), "set input folder")
+        ("threads,t", ::boost::program_options::value<std::size_t>()->default_value(0),
+        "set the number of threads, 0 uses the number of hardware threads")
+    ;
+
+    // Manage the options
+    ::boost::program_options::variables_map vm;
+    ::boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
+    ::boost::program_options::notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return EXIT_SUCCESS;
+    }
+    else if(!vm.count("input"))
+    {
+        std::cout << "You must specify an input folder." << std::endl << std::endl;
+        std::cout << desc << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::filesystem::path input(vm["input"].as<std::string>());
+    if(!std::filesystem::exists(input) || !std::filesystem::is_directory(input))
+    {
+        std::cout << "The specified input folder " << input << " is not a directory." << "\n";
+        return EXIT_FAILURE;
+    }
+
+    std::size_t threadCount = vm["threads"].as<std::size_t>();
+    if(threadCount == 0)
+    {
+        threadCount = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    std::vector<std::filesystem::path> filenames;
+    for(const auto& entry : std::filesystem::recursive_directory_iterator(input))
+    {
+        if(entry.is_regular_file())
+        {
+            filenames.push_back(entry.path());
+        }
+    }
+
+    // Scan of the files
+    sight::io::dicom::helper::DicomSeries::DicomSeriesContainerType seriesContainer;
+    for(const std::size_t threads : {std::size_t(1), threadCount})
+    {
+        const auto duration = measure(
+            [&]
+            {
+                sight::io::dicom::helper::DicomSeries helper;
+                helper.setThreadCount(threads);
+                seriesContainer = helper.read(filenames, sight::core::jobs::Observer::New("Reading DICOM files"));
+            });
+
+        std::cout << "Scan of " << filenames.size() << " files into " << seriesContainer.size() << " series ("
+        << threads << " threads): " << duration << " ms" << std::endl;
+    }
+
+    // Anonymized write of the series
+    std::size_t instanceCount = 0;
+    for(const auto& dicomSeries : seriesContainer)
+    {
+        instanceCount += dicomSeries->getNumberOfInstances();
+    }
+
+    const std::filesystem::path output = sight::core::tools::System::getTemporaryFolder("DicomBenchmark");
+    for(const std::size_t threads : {std::size_t(1), threadCount})
+    {
+        const std::filesystem::path destPath = output / std::to_string(threads);
+        std::filesystem::create_directories(destPath);
+
+        const auto duration = measure(
+            [&]
+            {
+                for(std::size_t i = 0 ; i < seriesContainer.size() ; ++i)
+                {
+                    const std::filesystem::path seriesPath = destPath / std::to_string(i);
+                    std::filesystem::create_directories(seriesPath);
+
+                    auto anonymizer = sight::io::dicom::helper::DicomAnonymizer::New();
+                    auto writer     = sight::io::dicom::helper::DicomSeriesWriter::New();
+                    writer->setObject(seriesContainer[i]);
+                    writer->setFolder(seriesPath);
+                    writer->setAnonymizer(anonymizer);
+                    writer->setThreadCount(threads);
+                    writer->write();
+                }
+            });
+
+        std::cout << "Anonymized write of " << instanceCount << " instances (" << threads << " threads): "
+        << duration << " ms" << std::endl;
+
+        std::filesystem::remove_all(destPath);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,236 @@
+/************************************************************************
+ *
+ * Copyright (C) 2021 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include <data/Mesh.hpp>
+
+#include <io/vtk/helper/Mesh.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <vtkPolyData.h>
+#include <vtkSmartPointer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+/** \file MeshBenchmark/src/main
+ *
+ *********************
+ * Software : MeshBenchmark
+ *********************
+ * Measures the construction of a mesh point by point and in bulk, and its conversion to and from VTK
+ * HELP  : MeshBenchmark.exe --help
+ * USE :   MeshBenchmark.exe <options>
+ * Allowed options:
+ *   -h [ --help ]           produce help message
+ *   -b [ --benchmark ] arg  set the benchmark to run (conversion, insertion), all of them are run by default
+ *   -s [ --size ] arg       set the number of points along each side of the grid mesh
+ */
+
+//------------------------------------------------------------------------------
+
+/// Run the function and return its duration in milliseconds
+static std::int64_t measure(const std::function<void()>& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+//------------------------------------------------------------------------------
+
+/// Triangulated grid of points
+struct Grid
+{
+    std::vector<sight::data::Mesh::PointValueType> points;
+    std::vector<sight::data::Mesh::PointId> triangles;
+};
+
+//------------------------------------------------------------------------------
+
+/// Generate a grid of width x height points, split into two triangles per square
+static Grid generateGrid(sight::data::Mesh::Size width, sight::data::Mesh::Size height)
+{
+    Grid grid;
+    grid.points.resize(3 * std::size_t(width) * std::size_t(height));
+    grid.triangles.reserve(6 * std::size_t(width - 1) * std::size_t(height - 1));
+
+    for(sight::data::Mesh::Size y = 0 ; y < height ; ++y)
+    {
+        for(sight::data::Mesh::Size x = 0 ; x < width ; ++x)
+        {
+            const sight::data::Mesh::PointId id = y * width + x;
+            grid.points[3 * std::size_t(id)]     = static_cast<float>(x);
+            grid.points[3 * std::size_t(id) + 1] = static_cast<float>(y);
+            grid.points[3 * std::size_t(id) + 2] = static_cast<float>((x + y) % 7);
+
+            if(x + 1 < width && y + 1 < height)
+            {
+                grid.triangles.insert(grid.triangles.end(), {id, id + 1, id + width});
+                grid.triangles.insert(grid.triangles.end(), {id + 1, id + width + 1, id + width});
+            }
+        }
+    }
+
+    return grid;
+}
+
+//------------------------------------------------------------------------------
+
+/// Compare the construction of a mesh point by point and cell by cell, without reservation, with a bulk construction
+static void benchmarkInsertion(sight::data::Mesh::Size gridSize)
+{
+    const Grid grid        = generateGrid(gridSize, gridSize);
+    const auto nbPoints    = static_cast<sight::data::Mesh::Size>(grid.points.size() / 3);
+    const auto nbTriangles = static_cast<sight::data::Mesh::Size>(grid.triangles.size() / 3);
+
+    sight::data::Mesh::sptr incrementalMesh = sight::data::Mesh::New();
+    const auto incrementalLock              = incrementalMesh->lock();
+    const auto incrementalTime              = measure(
+        [&]
+        {
+            for(sight::data::Mesh::PointId i = 0 ; i < nbPoints ; ++i)
+            {
+                incrementalMesh->pushPoint(&grid.points[3 * std::size_t(i)]);
+            }
+
+            for(sight::data::Mesh::CellId i = 0 ; i < nbTriangles ; ++i)
+            {
+                incrementalMesh->pushCell(
+                    grid.triangles[3 * i],
+                    grid.triangles[3 * i + 1],
+                    grid.triangles[3 * i + 2]
+                );
+            }
+        });
+
+    sight::data::Mesh::sptr bulkMesh = sight::data::Mesh::New();
+    const auto bulkLock              = bulkMesh->lock();
+    const auto bulkTime              = measure(
+        [&]
+        {
+            bulkMesh->pushPoints(grid.points.data(), nbPoints);
+            bulkMesh->pushCells(sight::data::Mesh::CellType::TRIANGLE, grid.triangles.data(), nbTriangles);
+        });
+
+    std::cout << "Mesh construction (" << nbPoints << " points, " << nbTriangles << " triangles): incremental "
+    << incrementalTime << " ms, bulk " << bulkTime << " ms" << std::endl;
+}
+
+//------------------------------------------------------------------------------
+
+/// Measure the conversion of a mesh with point colors and normals to a VTK poly data, and back
+static void benchmarkConversion(sight::data::Mesh::Size gridSize)
+{
+    // Twice as many points along the width, i.e. 1M triangles with the default size
+    const Grid grid        = generateGrid(2 * gridSize + 1, gridSize + 1);
+    const auto nbPoints    = static_cast<sight::data::Mesh::Size>(grid.points.size() / 3);
+    const auto nbTriangles = static_cast<sight::data::Mesh::Size>(grid.triangles.size() / 3);
+
+    const sight::data::Mesh::sptr mesh1 = sight::data::Mesh::New();
+    mesh1->reserve(
+        nbPoints,
+        nbTriangles,
+        sight::data::Mesh::CellType::TRIANGLE,
+        sight::data::Mesh::Attributes::POINT_COLORS | sight::data::Mesh::Attributes::POINT_NORMALS
+    );
+    const auto dumpLock1 = mesh1->lock();
+    mesh1->pushPoints(grid.points.data(), nbPoints);
+    mesh1->pushCells(sight::data::Mesh::CellType::TRIANGLE, grid.triangles.data(), nbTriangles);
+
+    auto pointItr = mesh1->begin<sight::data::iterator::PointIterator>();
+    for(sight::data::Mesh::Size i = 0 ; i < nbPoints ; ++i, ++pointItr)
+    {
+        *pointItr->rgba   = {static_cast<std::uint8_t>(i % 256), 128, 64, 255};
+        *pointItr->normal = {0.f, 0.f, 1.f};
+    }
+
+    const vtkSmartPointer<vtkPolyData> poly = vtkSmartPointer<vtkPolyData>::New();
+    const auto toVTKTime                    = measure([&]{sight::io::vtk::helper::Mesh::toVTKMesh(mesh1, poly);});
+
+    const sight::data::Mesh::sptr mesh2 = sight::data::Mesh::New();
+    const auto fromVTKTime              = measure([&]{sight::io::vtk::helper::Mesh::fromVTKMesh(poly, mesh2);});
+
+    std::cout << "Mesh conversion (" << nbPoints << " points, " << nbTriangles << " triangles): toVTKMesh "
+    << toVTKTime << " ms, fromVTKMesh " << fromVTKTime << " ms" << std::endl;
+}
+
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    // Declare the supported options.
+    ::boost::program_options::options_description desc("Allowed options");
+    desc.add_options()
+        ("help,h", "produce help message")
+        ("benchmark,b", ::boost::program_options::value<std::string>(),
+        "set the benchmark to run (conversion, insertion), all of them are run by default")
+        ("size,s", ::boost::program_options::value<sight::data::Mesh::Size>()->default_value(500),
+        "set the number of points along each side of the grid mesh")
+    ;
+
+    // Manage the options
+    ::boost::program_options::variables_map vm;
+    ::boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
+    ::boost::program_options::notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const auto gridSize = std::max<sight::data::Mesh::Size>(2, vm["size"].as<sight::data::Mesh::Size>());
+
+    const std::map<std::string, std::function<void()> > benchmarks = {
+        {"conversion", [gridSize]{benchmarkConversion(gridSize);}},
+        {"insertion", [gridSize]{benchmarkInsertion(gridSize);}}
+    };
+
+    if(vm.count("benchmark"))
+    {
+        const auto benchmark = benchmarks.find(vm["benchmark"].as<std::string>());
+        if(benchmark == benchmarks.end())
+        {
+            std::cout << "Unknown benchmark \"" << vm["benchmark"].as<std::string>() << "\"." << std::endl << std::endl;
+            std::cout << desc << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        benchmark->second();
+        return EXIT_SUCCESS;
+    }
+
+    for(const auto& benchmark : benchmarks)
+    {
+        benchmark.second();
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -147,6 +147,7 @@ int main(int argc, char* argv[])
     // Log options
     bool consoleLog = CONSOLE_LOG;
     bool fileLog    = FILE_LOG;
+    bool asyncLog   = false;
     std::string logFile;
     const std::string defaultLogFile = "SLM.log";
 
@@ -160,6 +161,7 @@ int main(int argc, char* argv[])
         ("flog", po::value(&fileLog)->implicit_value(true)->zero_tokens(), "Enable log output to file")
         ("no-flog", po::value(&fileLog)->implicit_value(false)->zero_tokens(), "Disable log output to file")
         ("log-output", po::value(&logFile)->default_value(defaultLogFile), "Log output filename")
+        ("log-async", po::value(&asyncLog)->implicit_value(true)->zero_tokens(), "Write log output from a dedicated thread")
 
         ("log-trace", po::value(&logLevel)->implicit_value(SpyLogger::SL_TRACE)->zero_tokens(), "Set loglevel to trace")
         ("log-debug", po::value(&logLevel)->implicit_value(SpyLogger::SL_DEBUG)->zero_tokens(), "Set loglevel to debug")
@@ -221,6 +223,7 @@ int main(int argc, char* argv[])
 
     // Log file
     SpyLogger& logger = sight::core::log::SpyLogger::getSpyLogger();
+    logger.setAsynchronous(asyncLog);
 
     if(consoleLog)
     {